@@ -0,0 +1,120 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// Blocked LAPACK-style factorizations implemented directly on obj_t:
+//
+//   bao_potrf():  A = L * L^H  or  A = U^H * U   (Cholesky)
+//   bao_getrf():  A = P * L * U                  (LU with partial pivoting)
+//   bao_geqrf():  A = Q * R                      (Householder QR)
+//
+// The output overwrites A in the same format as that of the corresponding
+// LAPACK routine, with one exception: the pivot indices returned by
+// bao_getrf() are zero-based (row i of A was interchanged with row p[i]).
+//
+// Each factorization is right-looking: a panel of BAO_FACTOR_NB columns is
+// factored, after which the trailing matrix is updated by the panel via
+// level-3 operations. Panels are factored recursively (by halving the
+// number of columns until at most BAO_FACTOR_NB_LEAF remain), so that most
+// of the panel's flops are also cast in terms of level-3 operations.
+//
+// When multiple threads are requested, the algorithms use a lookahead of
+// one panel: during the update by panel k, one thread first updates and
+// then factors panel k+1, while the remaining threads (joined by the first
+// thread once it is done) update the rest of the trailing matrix in blocks
+// of BAO_FACTOR_NB columns. This takes the panel factorization, which
+// exhibits little parallelism, off of the critical path. Each block of the
+// trailing update is computed by a single-threaded level-3 operation, and
+// thus the micropanels of the panel packed for that block are reused across
+// all of its BAO_FACTOR_NB columns.
+//
+// The factorizations return 0 on success. bao_potrf() returns j+1 if the
+// leading minor of order j+1 is not positive definite (in which case the
+// factorization is not completed), and bao_getrf() returns j+1 if U(j,j)
+// is exactly zero (in which case the factorization is completed, but U is
+// singular).
+//
+
+#ifndef BAO_FACTOR_NB
+#define BAO_FACTOR_NB      128
+#endif
+
+#ifndef BAO_FACTOR_NB_LEAF
+#define BAO_FACTOR_NB_LEAF 16
+#endif
+
+// A must be square and Hermitian (or symmetric) and have its lower or upper
+// triangle stored.
+BLIS_EXPORT_ADDON dim_t bao_potrf
+     (
+       const obj_t*  a
+     );
+
+BLIS_EXPORT_ADDON dim_t bao_potrf_ex
+     (
+       const obj_t*  a,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     );
+
+// p must be a vector of min(m,n) elements of datatype BLIS_INT.
+BLIS_EXPORT_ADDON dim_t bao_getrf
+     (
+       const obj_t*  a,
+       const obj_t*  p
+     );
+
+BLIS_EXPORT_ADDON dim_t bao_getrf_ex
+     (
+       const obj_t*  a,
+       const obj_t*  p,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     );
+
+// tau must be a vector of min(m,n) elements of the same datatype as A.
+BLIS_EXPORT_ADDON void bao_geqrf
+     (
+       const obj_t*  a,
+       const obj_t*  tau
+     );
+
+BLIS_EXPORT_ADDON void bao_geqrf_ex
+     (
+       const obj_t*  a,
+       const obj_t*  tau,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     );
+
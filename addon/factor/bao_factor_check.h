@@ -4,7 +4,7 @@
    An object-based framework for developing high-performance BLAS-like
    libraries.
 
-   Copyright (C) 2021, The University of Texas at Austin
+   Copyright (C) 2022, The University of Texas at Austin
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -32,18 +32,20 @@
 
 */
 
-void bao_l3_thread_decorator_single
+void bao_potrf_check
      (
-       l3aoint_ft func,
-       opid_t     family,
-       //pack_t     schema_a,
-       //pack_t     schema_b,
-       obj_t*     alpha,
-       obj_t*     a,
-       obj_t*     d,
-       obj_t*     b,
-       obj_t*     beta,
-       obj_t*     c,
-       cntx_t*    cntx,
-       rntm_t*    rntm
+       const obj_t*  a
      );
+
+void bao_getrf_check
+     (
+       const obj_t*  a,
+       const obj_t*  p
+     );
+
+void bao_geqrf_check
+     (
+       const obj_t*  a,
+       const obj_t*  tau
+     );
+
@@ -0,0 +1,141 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+typedef struct
+{
+	bao_factor_la_ft lookahead;
+	bao_factor_up_ft update;
+	dim_t            n0;
+	dim_t            n1;
+	dim_t            nb;
+	void*            params;
+
+	// The offset (relative to n0) of the next unclaimed block of columns.
+	dim_t            next;
+} bao_factor_step_t;
+
+static void bao_factor_step_entry( thrcomm_t* gl_comm, dim_t tid, const void* data_void )
+{
+	( void )gl_comm;
+
+	bao_factor_step_t* step = ( bao_factor_step_t* )data_void;
+
+	if ( tid == 0 && step->lookahead != NULL )
+		step->lookahead( step->params );
+
+	const dim_t n = step->n1 - step->n0;
+
+	while ( TRUE )
+	{
+		const dim_t j = __atomic_fetch_add( &step->next, step->nb, __ATOMIC_RELAXED );
+
+		if ( n <= j ) break;
+
+		step->update( step->n0 + j, step->n0 + bli_min( j + step->nb, n ),
+		              step->params );
+	}
+}
+
+void bao_factor_step
+     (
+       timpl_t          ti,
+       dim_t            nt,
+       bao_factor_la_ft lookahead,
+       bao_factor_up_ft update,
+       dim_t            n0,
+       dim_t            n1,
+       dim_t            nb,
+       void*            params
+     )
+{
+	// If there is nothing to update, there is also no reason to spawn
+	// threads.
+	if ( n1 <= n0 )
+	{
+		if ( lookahead != NULL ) lookahead( params );
+		return;
+	}
+
+	bao_factor_step_t step;
+	step.lookahead = lookahead;
+	step.update    = update;
+	step.n0        = n0;
+	step.n1        = n1;
+	step.nb        = nb;
+	step.params    = params;
+	step.next      = 0;
+
+	// Don't spawn more threads than there are tasks.
+	const dim_t n_tasks = ( n1 - n0 + nb - 1 ) / nb + ( lookahead != NULL );
+
+	nt = bli_min( nt, n_tasks );
+
+	if ( nt == 1 ) ti = BLIS_SINGLE;
+
+	bli_thread_launch( ti, nt, bao_factor_step_entry, &step );
+}
+
+void bao_factor_rntm_init
+     (
+             dim_t    m,
+             dim_t    n,
+       const rntm_t*  rntm,
+             rntm_t*  rntm_mt,
+             rntm_t*  rntm_st,
+             timpl_t* ti,
+             dim_t*   nt
+     )
+{
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	if ( rntm == NULL ) { bli_rntm_init_from_global( rntm_mt ); }
+	else                { *rntm_mt = *rntm;                     }
+
+	// Determine the number of threads requested (without disturbing the
+	// runtime, which is passed to the multithreaded operations).
+	rntm_t rntm_l = *rntm_mt;
+	bli_rntm_set_ways_for_op( BLIS_GEMM, BLIS_LEFT, m, n, n, &rntm_l );
+
+	*ti = bli_rntm_thread_impl( &rntm_l );
+	*nt = bli_rntm_calc_num_threads( &rntm_l );
+
+	if ( *nt < 1 || *ti == BLIS_SINGLE ) *nt = 1;
+
+	// The operations executed by each thread of a step are single-threaded.
+	bli_rntm_init( rntm_st );
+	bli_rntm_set_l3_sup( bli_rntm_l3_sup( rntm_mt ), rntm_st );
+}
+
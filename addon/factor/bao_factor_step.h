@@ -0,0 +1,72 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// Execute one step of a right-looking factorization with a lookahead of one
+// panel. If lookahead is non-NULL, thread 0 first calls lookahead( params ).
+// All threads then update the columns [n0,n1) of the trailing matrix by
+// repeatedly claiming the next block of (at most) nb columns [j0,j1) and
+// calling update( j0, j1, params ).
+//
+
+typedef void (*bao_factor_la_ft)( void* params );
+typedef void (*bao_factor_up_ft)( dim_t j0, dim_t j1, void* params );
+
+void bao_factor_step
+     (
+       timpl_t          ti,
+       dim_t            nt,
+       bao_factor_la_ft lookahead,
+       bao_factor_up_ft update,
+       dim_t            n0,
+       dim_t            n1,
+       dim_t            nb,
+       void*            params
+     );
+
+// Query the threading implementation and number of threads with which a
+// factorization should be executed, given the runtime passed in by the
+// caller (if any) and the dimensions of A, and initialize rntm_mt as a
+// copy of the caller's runtime and rntm_st as a single-threaded runtime.
+void bao_factor_rntm_init
+     (
+             dim_t    m,
+             dim_t    n,
+       const rntm_t*  rntm,
+             rntm_t*  rntm_mt,
+             rntm_t*  rntm_st,
+             timpl_t* ti,
+             dim_t*   nt
+     );
+
@@ -0,0 +1,636 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Householder QR factorization. Each panel of (at most) BAO_FACTOR_NB
+// columns is factored recursively in the manner of Elmroth and Gustavson,
+// which yields the Householder vectors V (stored below the diagonal of
+// the panel, with an implicit unit diagonal) together with the upper
+// triangular factor T of the compact WY representation of the panel's
+// orthogonal matrix, H(1) H(2) ... H(k) = I - V T V^H. The trailing matrix
+// is then updated as C := ( I - V T^H V^H ) C, and the diagonal of T holds
+// the scalar factors tau of the elementary reflectors.
+//
+
+typedef struct
+{
+	obj_t         a;
+	obj_t         t[2];
+	obj_t         v;
+	obj_t         y;
+	obj_t         tau;
+	dim_t         k;
+	dim_t         k0;
+	dim_t         k1;
+	dim_t         k2;
+	const cntx_t* cntx;
+	rntm_t*       rntm_st;
+} bao_geqrf_params_t;
+
+// Apply the block reflector I - V T^H V^H (where V is unit lower
+// trapezoidal) to C from the left.
+static void bao_geqrf_larfb
+     (
+       const obj_t*  v,
+       const obj_t*  t,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	const dim_t m = bli_obj_length( c );
+	const dim_t n = bli_obj_width( c );
+	const dim_t k = bli_obj_width( v );
+
+	if ( n == 0 ) return;
+
+	obj_t v1, v2, c1, c2, t_l, w;
+	bli_acquire_mpart( 0, 0, k,     k, v, &v1 );
+	bli_acquire_mpart( k, 0, m - k, k, v, &v2 );
+	bli_acquire_mpart( 0, 0, k,     n, c, &c1 );
+	bli_acquire_mpart( k, 0, m - k, n, c, &c2 );
+
+	bli_obj_set_struc( BLIS_TRIANGULAR, &v1 );
+	bli_obj_set_uplo( BLIS_LOWER, &v1 );
+	bli_obj_set_diag( BLIS_UNIT_DIAG, &v1 );
+
+	bli_obj_alias_to( t, &t_l );
+	bli_obj_set_struc( BLIS_TRIANGULAR, &t_l );
+	bli_obj_set_uplo( BLIS_UPPER, &t_l );
+	bli_obj_set_conjtrans( BLIS_CONJ_TRANSPOSE, &t_l );
+
+	bli_obj_create( bli_obj_dt( c ), k, n, 0, 0, &w );
+
+	// W := V^H * C = V1^H * C1 + V2^H * C2
+	bli_copym_ex( &c1, &w, cntx, rntm );
+	bli_obj_set_conjtrans( BLIS_CONJ_TRANSPOSE, &v1 );
+	bli_trmm_ex( BLIS_LEFT, &BLIS_ONE, &v1, &w, cntx, rntm );
+	bli_obj_set_conjtrans( BLIS_NO_TRANSPOSE, &v1 );
+
+	if ( k < m )
+	{
+		bli_obj_set_conjtrans( BLIS_CONJ_TRANSPOSE, &v2 );
+		bli_gemm_ex( &BLIS_ONE, &v2, &c2, &BLIS_ONE, &w, cntx, rntm );
+		bli_obj_set_conjtrans( BLIS_NO_TRANSPOSE, &v2 );
+	}
+
+	// W := T^H * W
+	bli_trmm_ex( BLIS_LEFT, &BLIS_ONE, &t_l, &w, cntx, rntm );
+
+	// C := C - V * W
+	if ( k < m )
+		bli_gemm_ex( &BLIS_MINUS_ONE, &v2, &w, &BLIS_ONE, &c2, cntx, rntm );
+
+	bli_trmm_ex( BLIS_LEFT, &BLIS_ONE, &v1, &w, cntx, rntm );
+	bli_subm_ex( &w, &c1, cntx, rntm );
+
+	bli_obj_free( &w );
+}
+
+// Apply the block reflector I - V T^H V^H to C from the left, where V is
+// a dense copy of the Householder vectors of a panel (with their unit
+// diagonal and the zeros above it stored explicitly) and Y = V T^H.
+static void bao_geqrf_larfb_dense
+     (
+       const obj_t*  v,
+       const obj_t*  y,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	const dim_t n = bli_obj_width( c );
+	const dim_t k = bli_obj_width( v );
+
+	if ( n == 0 ) return;
+
+	obj_t v_l, w;
+	bli_obj_alias_to( v, &v_l );
+	bli_obj_set_conjtrans( BLIS_CONJ_TRANSPOSE, &v_l );
+
+	bli_obj_create( bli_obj_dt( c ), k, n, 0, 0, &w );
+
+	// W := V^H * C
+	bli_gemm_ex( &BLIS_ONE, &v_l, c, &BLIS_ZERO, &w, cntx, rntm );
+
+	// C := C - Y * W
+	bli_gemm_ex( &BLIS_MINUS_ONE, y, &w, &BLIS_ONE, c, cntx, rntm );
+
+	bli_obj_free( &w );
+}
+
+// Compute sqrt( x^2 + y^2 + z^2 ) without unnecessary overflow or
+// underflow (as LAPACK's dlapy3 does).
+static double bao_geqrf_lapy3( double x, double y, double z )
+{
+	const double xa = fabs( x ), ya = fabs( y ), za = fabs( z );
+	const double w  = bli_fmax( xa, bli_fmax( ya, za ) );
+
+	if ( w == 0.0 ) return xa + ya + za;
+
+	return w * sqrt( ( xa / w ) * ( xa / w ) +
+	                 ( ya / w ) * ( ya / w ) +
+	                 ( za / w ) * ( za / w ) );
+}
+
+// Compute the norm of x.
+static double bao_geqrf_nrm2
+     (
+       const obj_t*  x,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	double xnorm = 0.0, dummy;
+
+	if ( bli_obj_vector_dim( x ) > 0 )
+	{
+		obj_t norm;
+		bli_obj_scalar_init_detached( bli_obj_dt_proj_to_real( x ), &norm );
+		bli_normfv_ex( x, &norm, cntx, rntm );
+		bli_getsc( &norm, &xnorm, &dummy );
+	}
+
+	return xnorm;
+}
+
+// Scale x by the real scalar s.
+static void bao_geqrf_scalv
+     (
+             double  s,
+       const obj_t*  x,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	obj_t scale;
+	bli_obj_scalar_init_detached( BLIS_DOUBLE, &scale );
+	bli_setsc( s, 0.0, &scale );
+	bli_scalv_ex( &scale, x, cntx, rntm );
+}
+
+// Generate an elementary reflector H = I - tau * v * v^H such that
+// H^H * ( alpha; x ) = ( beta; 0 ), where beta is real, overwriting alpha
+// with beta and x with the trailing part of v (whose first element is 1).
+// This follows LAPACK's ?larfg: if |beta| is below the safe minimum of the
+// datatype of x, alpha and x are repeatedly scaled up (at most 20 times)
+// before the reflector is computed, and beta is scaled back down at the
+// end.
+static void bao_geqrf_larfg
+     (
+       const obj_t*  alpha,
+       const obj_t*  x,
+             double* tau_r,
+             double* tau_i,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	double ar, ai;
+
+	bli_getsc( alpha, &ar, &ai );
+
+	double xnorm = bao_geqrf_nrm2( x, cntx, rntm );
+
+	if ( xnorm == 0.0 && ai == 0.0 )
+	{
+		*tau_r = 0.0;
+		*tau_i = 0.0;
+		return;
+	}
+
+	double beta = -copysign( bao_geqrf_lapy3( ar, ai, xnorm ), ar );
+
+	const bool   is_sp  = bli_dt_prec_is_single( bli_obj_dt( x ) );
+	const double safmin = ( is_sp ? FLT_MIN / FLT_EPSILON
+	                              : DBL_MIN / DBL_EPSILON );
+	const double rsafmn = 1.0 / safmin;
+
+	int knt = 0;
+
+	if ( fabs( beta ) < safmin )
+	{
+		// xnorm and beta may be inaccurate; scale x and recompute them.
+		do
+		{
+			knt  += 1;
+			bao_geqrf_scalv( rsafmn, x, cntx, rntm );
+			beta *= rsafmn;
+			ai   *= rsafmn;
+			ar   *= rsafmn;
+		}
+		while ( fabs( beta ) < safmin && knt < 20 );
+
+		xnorm = bao_geqrf_nrm2( x, cntx, rntm );
+		beta  = -copysign( bao_geqrf_lapy3( ar, ai, xnorm ), ar );
+	}
+
+	*tau_r = ( beta - ar ) / beta;
+	*tau_i = -ai / beta;
+
+	// x := x / ( alpha - beta ), computing the reciprocal of alpha - beta
+	// as in Smith's algorithm to avoid overflow in |alpha - beta|^2.
+	const double dr = ar - beta;
+	const double di = ai;
+	double       sr, si;
+
+	if ( fabs( dr ) >= fabs( di ) )
+	{
+		const double r = di / dr;
+		const double d = dr + di * r;
+		sr =  1.0 / d;
+		si = -r   / d;
+	}
+	else
+	{
+		const double r = dr / di;
+		const double d = di + dr * r;
+		sr =  r   / d;
+		si = -1.0 / d;
+	}
+
+	obj_t scale;
+	bli_obj_scalar_init_detached( BLIS_DCOMPLEX, &scale );
+	bli_setsc( sr, si, &scale );
+	bli_scalv_ex( &scale, x, cntx, rntm );
+
+	for ( int j = 0; j < knt; ++j )
+		beta *= safmin;
+
+	bli_setsc( beta, 0.0, alpha );
+}
+
+// Factor the (tall) panel P with the unblocked algorithm and compute the
+// triangular factor T.
+static void bao_geqrf_unb
+     (
+       const obj_t*  p,
+       const obj_t*  t,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	const dim_t m = bli_obj_length( p );
+	const dim_t n = bli_obj_width( p );
+
+	obj_t w, scale;
+	bli_obj_create( bli_obj_dt( p ), n, 1, 0, 0, &w );
+	bli_obj_scalar_init_detached( BLIS_DCOMPLEX, &scale );
+
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		obj_t alpha11, a21, v, a12, p0, t01, t00, w1;
+		bli_acquire_mpart( j,     j,     1,         1,         p, &alpha11 );
+		bli_acquire_mpart( j + 1, j,     m - j - 1, 1,         p, &a21 );
+		bli_acquire_mpart( j,     j,     m - j,     1,         p, &v );
+		bli_acquire_mpart( j,     j + 1, m - j,     n - j - 1, p, &a12 );
+		bli_acquire_mpart( j,     0,     m - j,     j,         p, &p0 );
+		bli_acquire_mpart( 0,     j,     j,         1,         t, &t01 );
+		bli_acquire_mpart( 0,     0,     j,         j,         t, &t00 );
+		bli_acquire_mpart( 0,     0,     n - j - 1, 1,         &w, &w1 );
+
+		double tau_r, tau_i, beta, dummy;
+
+		bao_geqrf_larfg( &alpha11, &a21, &tau_r, &tau_i, cntx, rntm );
+
+		// Temporarily store the unit element of v explicitly.
+		bli_getsc( &alpha11, &beta, &dummy );
+		bli_setsc( 1.0, 0.0, &alpha11 );
+
+		// A12 := H^H * A12 = A12 - conj(tau) * v * ( A12^H * v )^H
+		if ( j + 1 < n )
+		{
+			bli_obj_set_conjtrans( BLIS_CONJ_TRANSPOSE, &a12 );
+			bli_gemv_ex( &BLIS_ONE, &a12, &v, &BLIS_ZERO, &w1, cntx, rntm );
+			bli_obj_set_conjtrans( BLIS_NO_TRANSPOSE, &a12 );
+
+			bli_setsc( -tau_r, tau_i, &scale );
+			bli_obj_set_conj( BLIS_CONJUGATE, &w1 );
+			bli_ger_ex( &scale, &v, &w1, &a12, cntx, rntm );
+		}
+
+		// t01 := -tau * T00 * ( P0^H * v )
+		if ( 0 < j )
+		{
+			bli_obj_set_conjtrans( BLIS_CONJ_TRANSPOSE, &p0 );
+			bli_gemv_ex( &BLIS_ONE, &p0, &v, &BLIS_ZERO, &t01, cntx, rntm );
+
+			bli_obj_set_struc( BLIS_TRIANGULAR, &t00 );
+			bli_obj_set_uplo( BLIS_UPPER, &t00 );
+			bli_setsc( -tau_r, -tau_i, &scale );
+			bli_trmv_ex( &scale, &t00, &t01, cntx, rntm );
+		}
+
+		bli_setijm( tau_r, tau_i, j, j, t );
+		bli_setsc( beta, 0.0, &alpha11 );
+	}
+
+	bli_obj_free( &w );
+}
+
+// Factor the (tall) panel P recursively and compute the triangular factor T.
+static void bao_geqrf_rec
+     (
+       const obj_t*  p,
+       const obj_t*  t,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	const dim_t m = bli_obj_length( p );
+	const dim_t n = bli_obj_width( p );
+
+	if ( n <= BAO_FACTOR_NB_LEAF )
+	{
+		bao_geqrf_unb( p, t, cntx, rntm );
+		return;
+	}
+
+	const dim_t n1 = n / 2;
+	const dim_t n2 = n - n1;
+
+	obj_t p_l, p_r, p22, v1b, v1c, v2a, v2b, t11, t12, t22;
+	bli_acquire_mpart( 0,  0,  m,      n1, p, &p_l );
+	bli_acquire_mpart( 0,  n1, m,      n2, p, &p_r );
+	bli_acquire_mpart( n1, n1, m - n1, n2, p, &p22 );
+	bli_acquire_mpart( n1, 0,  n2,     n1, p, &v1b );
+	bli_acquire_mpart( n,  0,  m - n,  n1, p, &v1c );
+	bli_acquire_mpart( n1, n1, n2,     n2, p, &v2a );
+	bli_acquire_mpart( n,  n1, m - n,  n2, p, &v2b );
+	bli_acquire_mpart( 0,  0,  n1,     n1, t, &t11 );
+	bli_acquire_mpart( 0,  n1, n1,     n2, t, &t12 );
+	bli_acquire_mpart( n1, n1, n2,     n2, t, &t22 );
+
+	bao_geqrf_rec( &p_l, &t11, cntx, rntm );
+	bao_geqrf_larfb( &p_l, &t11, &p_r, cntx, rntm );
+	bao_geqrf_rec( &p22, &t22, cntx, rntm );
+
+	// T12 := -T11 * ( V1^H * V2 ) * T22
+	bli_obj_set_conjtrans( BLIS_CONJ_TRANSPOSE, &v1b );
+	bli_copym_ex( &v1b, &t12, cntx, rntm );
+
+	bli_obj_set_struc( BLIS_TRIANGULAR, &v2a );
+	bli_obj_set_uplo( BLIS_LOWER, &v2a );
+	bli_obj_set_diag( BLIS_UNIT_DIAG, &v2a );
+	bli_trmm_ex( BLIS_RIGHT, &BLIS_ONE, &v2a, &t12, cntx, rntm );
+
+	if ( n < m )
+	{
+		bli_obj_set_conjtrans( BLIS_CONJ_TRANSPOSE, &v1c );
+		bli_gemm_ex( &BLIS_ONE, &v1c, &v2b, &BLIS_ONE, &t12, cntx, rntm );
+	}
+
+	bli_obj_set_struc( BLIS_TRIANGULAR, &t11 );
+	bli_obj_set_uplo( BLIS_UPPER, &t11 );
+	bli_trmm_ex( BLIS_LEFT, &BLIS_MINUS_ONE, &t11, &t12, cntx, rntm );
+
+	bli_obj_set_struc( BLIS_TRIANGULAR, &t22 );
+	bli_obj_set_uplo( BLIS_UPPER, &t22 );
+	bli_trmm_ex( BLIS_RIGHT, &BLIS_ONE, &t22, &t12, cntx, rntm );
+}
+
+// Factor the panel of columns [k0,k1) and copy the diagonal of its
+// triangular factor to tau.
+static void bao_geqrf_panel
+     (
+       const obj_t*  a,
+       const obj_t*  t,
+       const obj_t*  tau,
+             dim_t   k0,
+             dim_t   k1,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	const dim_t m  = bli_obj_length( a );
+	const dim_t kb = k1 - k0;
+
+	obj_t p, t_k;
+	bli_acquire_mpart( k0, k0, m - k0, kb, a, &p );
+	bli_acquire_mpart( 0,  0,  kb,     kb, t, &t_k );
+
+	bao_geqrf_rec( &p, &t_k, cntx, rntm );
+
+	for ( dim_t i = 0; i < kb; ++i )
+	{
+		double tr, ti;
+
+		bli_getijm( i, i, &t_k, &tr, &ti );
+		bli_setijm( tr, ti, k0 + i, 0, tau );
+	}
+}
+
+// Copy the Householder vectors of the panel [k0,k1) to V_k, storing the
+// unit diagonal and the zeros above it explicitly, and compute
+// Y_k := V_k T^H, where T is the triangular factor of the panel. V_k and
+// Y_k alias the leading m - k0 rows and k1 - k0 columns of V and Y. They
+// are formed once per panel and shared by all of the updates of the
+// trailing matrix, each of which then consists of two gemm operations.
+static void bao_geqrf_form_vy
+     (
+       const obj_t*  a,
+       const obj_t*  t,
+       const obj_t*  v,
+       const obj_t*  y,
+             dim_t   k0,
+             dim_t   k1,
+             obj_t*  v_k,
+             obj_t*  y_k,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	const dim_t m  = bli_obj_length( a );
+	const dim_t kb = k1 - k0;
+
+	obj_t p, v1, t_l;
+	bli_acquire_mpart( k0, k0, m - k0, kb, a,   &p );
+	bli_acquire_mpart( 0,  0,  m - k0, kb, v,   v_k );
+	bli_acquire_mpart( 0,  0,  m - k0, kb, y,   y_k );
+	bli_acquire_mpart( 0,  0,  kb,     kb, v_k, &v1 );
+	bli_acquire_mpart( 0,  0,  kb,     kb, t,   &t_l );
+
+	bli_copym_ex( &p, v_k, cntx, rntm );
+
+	bli_obj_set_diag_offset( 1, &v1 );
+	bli_obj_set_uplo( BLIS_UPPER, &v1 );
+	bli_setm_ex( &BLIS_ZERO, &v1, cntx, rntm );
+
+	bli_obj_set_diag_offset( 0, &v1 );
+	bli_setd_ex( &BLIS_ONE, &v1, cntx, rntm );
+
+	bli_obj_set_struc( BLIS_TRIANGULAR, &t_l );
+	bli_obj_set_uplo( BLIS_UPPER, &t_l );
+	bli_obj_set_conjtrans( BLIS_CONJ_TRANSPOSE, &t_l );
+
+	bli_copym_ex( v_k, y_k, cntx, rntm );
+	bli_trmm_ex( BLIS_RIGHT, &BLIS_ONE, &t_l, y_k, cntx, rntm );
+}
+
+// Update the columns [j0,j1) of the trailing matrix by the panel [k0,k1).
+static void bao_geqrf_update( dim_t j0, dim_t j1, void* params_void )
+{
+	bao_geqrf_params_t* params = params_void;
+
+	const obj_t* a  = &params->a;
+	const dim_t  m  = bli_obj_length( a );
+	const dim_t  k0 = params->k0;
+
+	obj_t c;
+	bli_acquire_mpart( k0, j0, m - k0, j1 - j0, a, &c );
+
+	bao_geqrf_larfb_dense( &params->v, &params->y, &c,
+	                       params->cntx, params->rntm_st );
+}
+
+// Update the next panel [k1,k2) by the current panel [k0,k1) and factor it.
+static void bao_geqrf_lookahead( void* params_void )
+{
+	bao_geqrf_params_t* params = params_void;
+
+	bao_geqrf_update( params->k1, params->k2, params );
+
+	bao_geqrf_panel( &params->a, &params->t[ ( params->k + 1 ) % 2 ],
+	                 &params->tau, params->k1, params->k2,
+	                 params->cntx, params->rntm_st );
+}
+
+// -----------------------------------------------------------------------------
+
+void bao_geqrf
+     (
+       const obj_t*  a,
+       const obj_t*  tau
+     )
+{
+	bao_geqrf_ex( a, tau, NULL, NULL );
+}
+
+void bao_geqrf_ex
+     (
+       const obj_t*  a,
+       const obj_t*  tau,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bao_geqrf_check( a, tau );
+
+	bao_geqrf_params_t params;
+	obj_t*             a_l = &params.a;
+
+	// Induce any transposition of A, and access A only through general
+	// submatrices. The elements of tau are accessed as those of a column
+	// vector.
+	bli_obj_alias_to( a, a_l );
+
+	if ( bli_obj_has_trans( a_l ) )
+	{
+		bli_obj_induce_trans( a_l );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, a_l );
+	}
+
+	bli_obj_set_conj( BLIS_NO_CONJUGATE, a_l );
+	bli_obj_set_struc( BLIS_GENERAL, a_l );
+	bli_obj_set_uplo( BLIS_DENSE, a_l );
+
+	bli_obj_alias_to( tau, &params.tau );
+
+	if ( bli_obj_is_row_vector( &params.tau ) )
+		bli_obj_induce_trans( &params.tau );
+
+	const dim_t m  = bli_obj_length( a_l );
+	const dim_t n  = bli_obj_width( a_l );
+	const dim_t mn = bli_min( m, n );
+
+	if ( mn == 0 ) return;
+
+	rntm_t  rntm_mt, rntm_st;
+	timpl_t ti;
+	dim_t   nt;
+	bao_factor_rntm_init( m, n, rntm, &rntm_mt, &rntm_st, &ti, &nt );
+
+	params.cntx    = cntx;
+	params.rntm_st = &rntm_st;
+
+	const dim_t nb = BAO_FACTOR_NB;
+
+	// The triangular factors of the current and of the next panel.
+	bli_obj_create( bli_obj_dt( a_l ), nb, nb, 0, 0, &params.t[0] );
+	bli_obj_create( bli_obj_dt( a_l ), nb, nb, 0, 0, &params.t[1] );
+
+	// The dense copy of the Householder vectors of the current panel, V,
+	// and V T^H.
+	obj_t v, y;
+	bli_obj_create( bli_obj_dt( a_l ), m, nb, 0, 0, &v );
+	bli_obj_create( bli_obj_dt( a_l ), m, nb, 0, 0, &y );
+
+	// Factor the first panel with the multithreaded runtime.
+	bao_geqrf_panel( a_l, &params.t[0], &params.tau,
+	                 0, bli_min( nb, mn ), cntx, &rntm_mt );
+
+	for ( dim_t k0 = 0, k = 0; k0 < mn; k0 += nb, ++k )
+	{
+		params.k  = k;
+		params.k0 = k0;
+		params.k1 = bli_min( k0 + nb, mn );
+		params.k2 = bli_min( k0 + 2*nb, mn );
+
+		// The columns beyond min(m,n) are updated (but never factored).
+		const dim_t n0 = ( params.k1 < mn ? params.k2 : params.k1 );
+
+		if ( params.k1 < n )
+			bao_geqrf_form_vy( a_l, &params.t[ k % 2 ], &v, &y, k0, params.k1,
+			                   &params.v, &params.y, cntx, &rntm_mt );
+
+		bao_factor_step( ti, nt,
+		                 ( params.k1 < mn ? bao_geqrf_lookahead : NULL ),
+		                 bao_geqrf_update, n0, n, nb, &params );
+	}
+
+	bli_obj_free( &params.t[0] );
+	bli_obj_free( &params.t[1] );
+	bli_obj_free( &v );
+	bli_obj_free( &y );
+}
+
@@ -0,0 +1,358 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// LU factorization with partial pivoting. The pivot indices are absolute
+// (zero-based) row indices of A. Within the recursion, the rows of each
+// submatrix P are interchanged according to a pointer to the pivot indices
+// of its first row and the absolute index, off, of that row.
+//
+
+typedef struct
+{
+	obj_t         a;
+	gint_t*       ipiv;
+	inc_t         incp;
+	dim_t         k0;
+	dim_t         k1;
+	dim_t         k2;
+	dim_t         info;
+	const cntx_t* cntx;
+	rntm_t*       rntm_st;
+} bao_getrf_params_t;
+
+// Interchange the rows i and ipiv[i]-off of A for i in [i0,i1).
+static void bao_getrf_laswp
+     (
+       const obj_t*  a,
+             dim_t   i0,
+             dim_t   i1,
+       const gint_t* ipiv,
+             inc_t   incp,
+             dim_t   off,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	const dim_t n = bli_obj_width( a );
+
+	if ( n == 0 ) return;
+
+	for ( dim_t i = i0; i < i1; ++i )
+	{
+		const dim_t ip = ipiv[ i*incp ] - off;
+
+		if ( ip == i ) continue;
+
+		obj_t ai, ap;
+		bli_acquire_mpart( i,  0, 1, n, a, &ai );
+		bli_acquire_mpart( ip, 0, 1, n, a, &ap );
+
+		bli_swapv_ex( &ai, &ap, cntx, rntm );
+	}
+}
+
+// Factor the (tall) panel P with the unblocked right-looking algorithm.
+static dim_t bao_getrf_unb
+     (
+       const obj_t*  p,
+             gint_t* ipiv,
+             inc_t   incp,
+             dim_t   off,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	const dim_t m    = bli_obj_length( p );
+	const dim_t n    = bli_obj_width( p );
+	const dim_t mn   = bli_min( m, n );
+	      dim_t info = 0;
+
+	dim_t ip;
+	obj_t index;
+	bli_obj_create_1x1_with_attached_buffer( BLIS_INT, &ip, &index );
+
+	for ( dim_t j = 0; j < mn; ++j )
+	{
+		obj_t a21, a12, a22, alpha11;
+		bli_acquire_mpart( j,     j, m - j, 1, p, &a21 );
+
+		// Find the pivot and interchange it with the diagonal element.
+		bli_amaxv_ex( &a21, &index, cntx, rntm );
+
+		ip += j;
+		ipiv[ j*incp ] = off + ip;
+
+		bao_getrf_laswp( p, j, j + 1, ipiv, incp, off, cntx, rntm );
+
+		bli_acquire_mpart( j,     j,     1,         1,         p, &alpha11 );
+		bli_acquire_mpart( j + 1, j,     m - j - 1, 1,         p, &a21 );
+		bli_acquire_mpart( j,     j + 1, 1,         n - j - 1, p, &a12 );
+		bli_acquire_mpart( j + 1, j + 1, m - j - 1, n - j - 1, p, &a22 );
+
+		if ( bli_obj_equals( &alpha11, &BLIS_ZERO ) )
+		{
+			// Leave the column as it is, but record the first zero pivot.
+			if ( info == 0 ) info = j + 1;
+		}
+		else
+		{
+			// a21 := a21 / alpha11
+			bli_invscalv_ex( &alpha11, &a21, cntx, rntm );
+		}
+
+		// A22 := A22 - a21 * a12
+		bli_ger_ex( &BLIS_MINUS_ONE, &a21, &a12, &a22, cntx, rntm );
+	}
+
+	return info;
+}
+
+// Factor the (tall) panel P recursively.
+static dim_t bao_getrf_rec
+     (
+       const obj_t*  p,
+             gint_t* ipiv,
+             inc_t   incp,
+             dim_t   off,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	const dim_t m = bli_obj_length( p );
+	const dim_t n = bli_obj_width( p );
+
+	if ( n <= BAO_FACTOR_NB_LEAF )
+		return bao_getrf_unb( p, ipiv, incp, off, cntx, rntm );
+
+	const dim_t n1 = n / 2;
+	const dim_t n2 = n - n1;
+
+	obj_t p_l, p_r, a11, a12, a21, a22;
+	bli_acquire_mpart( 0,  0,  m,      n1, p, &p_l );
+	bli_acquire_mpart( 0,  n1, m,      n2, p, &p_r );
+	bli_acquire_mpart( 0,  0,  n1,     n1, p, &a11 );
+	bli_acquire_mpart( 0,  n1, n1,     n2, p, &a12 );
+	bli_acquire_mpart( n1, 0,  m - n1, n1, p, &a21 );
+	bli_acquire_mpart( n1, n1, m - n1, n2, p, &a22 );
+
+	const dim_t info1 = bao_getrf_rec( &p_l, ipiv, incp, off, cntx, rntm );
+
+	bao_getrf_laswp( &p_r, 0, n1, ipiv, incp, off, cntx, rntm );
+
+	// A12 := inv( L11 ) * A12
+	bli_obj_set_struc( BLIS_TRIANGULAR, &a11 );
+	bli_obj_set_uplo( BLIS_LOWER, &a11 );
+	bli_obj_set_diag( BLIS_UNIT_DIAG, &a11 );
+	bli_trsm_ex( BLIS_LEFT, &BLIS_ONE, &a11, &a12, cntx, rntm );
+
+	// A22 := A22 - A21 * A12
+	bli_gemm_ex( &BLIS_MINUS_ONE, &a21, &a12, &BLIS_ONE, &a22, cntx, rntm );
+
+	const dim_t info2 = bao_getrf_rec( &a22, ipiv + n1*incp, incp, off + n1,
+	                                   cntx, rntm );
+
+	bao_getrf_laswp( &p_l, n1, bli_min( m, n ), ipiv, incp, off, cntx, rntm );
+
+	if ( info1 != 0 ) return info1;
+	if ( info2 != 0 ) return n1 + info2;
+	return 0;
+}
+
+// Factor the panel of columns [k0,k1).
+static dim_t bao_getrf_panel
+     (
+       const obj_t*  a,
+             gint_t* ipiv,
+             inc_t   incp,
+             dim_t   k0,
+             dim_t   k1,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	const dim_t m = bli_obj_length( a );
+
+	obj_t p;
+	bli_acquire_mpart( k0, k0, m - k0, k1 - k0, a, &p );
+
+	const dim_t info = bao_getrf_rec( &p, ipiv + k0*incp, incp, k0, cntx, rntm );
+
+	return ( info != 0 ? k0 + info : 0 );
+}
+
+// Update the columns [j0,j1) of the trailing matrix by the panel [k0,k1).
+static void bao_getrf_update( dim_t j0, dim_t j1, void* params_void )
+{
+	bao_getrf_params_t* params = params_void;
+
+	const obj_t* a  = &params->a;
+	const dim_t  m  = bli_obj_length( a );
+	const dim_t  k0 = params->k0;
+	const dim_t  k1 = params->k1;
+
+	obj_t c, l11, l21, a12, a22;
+	bli_acquire_mpart( 0,  j0, m,       j1 - j0, a, &c );
+	bli_acquire_mpart( k0, k0, k1 - k0, k1 - k0, a, &l11 );
+	bli_acquire_mpart( k1, k0, m  - k1, k1 - k0, a, &l21 );
+	bli_acquire_mpart( k0, j0, k1 - k0, j1 - j0, a, &a12 );
+	bli_acquire_mpart( k1, j0, m  - k1, j1 - j0, a, &a22 );
+
+	bao_getrf_laswp( &c, k0, k1, params->ipiv, params->incp, 0,
+	                 params->cntx, params->rntm_st );
+
+	// A12 := inv( L11 ) * A12
+	bli_obj_set_struc( BLIS_TRIANGULAR, &l11 );
+	bli_obj_set_uplo( BLIS_LOWER, &l11 );
+	bli_obj_set_diag( BLIS_UNIT_DIAG, &l11 );
+	bli_trsm_ex( BLIS_LEFT, &BLIS_ONE, &l11, &a12,
+	             params->cntx, params->rntm_st );
+
+	// A22 := A22 - L21 * A12
+	if ( k1 < m )
+		bli_gemm_ex( &BLIS_MINUS_ONE, &l21, &a12, &BLIS_ONE, &a22,
+		             params->cntx, params->rntm_st );
+}
+
+// Update the next panel [k1,k2) by the current panel [k0,k1) and factor it.
+static void bao_getrf_lookahead( void* params_void )
+{
+	bao_getrf_params_t* params = params_void;
+
+	bao_getrf_update( params->k1, params->k2, params );
+
+	const dim_t info = bao_getrf_panel( &params->a, params->ipiv, params->incp,
+	                                    params->k1, params->k2,
+	                                    params->cntx, params->rntm_st );
+
+	if ( params->info == 0 ) params->info = info;
+}
+
+// -----------------------------------------------------------------------------
+
+dim_t bao_getrf
+     (
+       const obj_t*  a,
+       const obj_t*  p
+     )
+{
+	return bao_getrf_ex( a, p, NULL, NULL );
+}
+
+dim_t bao_getrf_ex
+     (
+       const obj_t*  a,
+       const obj_t*  p,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bao_getrf_check( a, p );
+
+	bao_getrf_params_t params;
+	obj_t*             a_l = &params.a;
+
+	// Induce any transposition of A, and access A only through general
+	// submatrices.
+	bli_obj_alias_to( a, a_l );
+
+	if ( bli_obj_has_trans( a_l ) )
+	{
+		bli_obj_induce_trans( a_l );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, a_l );
+	}
+
+	bli_obj_set_conj( BLIS_NO_CONJUGATE, a_l );
+	bli_obj_set_struc( BLIS_GENERAL, a_l );
+	bli_obj_set_uplo( BLIS_DENSE, a_l );
+
+	const dim_t m  = bli_obj_length( a_l );
+	const dim_t n  = bli_obj_width( a_l );
+	const dim_t mn = bli_min( m, n );
+
+	if ( mn == 0 ) return 0;
+
+	rntm_t  rntm_mt, rntm_st;
+	timpl_t ti;
+	dim_t   nt;
+	bao_factor_rntm_init( m, n, rntm, &rntm_mt, &rntm_st, &ti, &nt );
+
+	params.ipiv    = bli_obj_buffer_at_off( p );
+	params.incp    = bli_obj_vector_inc( p );
+	params.info    = 0;
+	params.cntx    = cntx;
+	params.rntm_st = &rntm_st;
+
+	const dim_t nb = BAO_FACTOR_NB;
+
+	// Factor the first panel with the multithreaded runtime.
+	params.info = bao_getrf_panel( a_l, params.ipiv, params.incp,
+	                               0, bli_min( nb, mn ), cntx, &rntm_mt );
+
+	for ( dim_t k0 = 0; k0 < mn; k0 += nb )
+	{
+		params.k0 = k0;
+		params.k1 = bli_min( k0 + nb, mn );
+		params.k2 = bli_min( k0 + 2*nb, mn );
+
+		// The columns beyond min(m,n) are updated (but never factored).
+		const dim_t n0 = ( params.k1 < mn ? params.k2 : params.k1 );
+
+		bao_factor_step( ti, nt,
+		                 ( params.k1 < mn ? bao_getrf_lookahead : NULL ),
+		                 bao_getrf_update, n0, n, nb, &params );
+	}
+
+	// Apply the interchanges of each panel to the columns to its left.
+	for ( dim_t k0 = nb; k0 < mn; k0 += nb )
+	{
+		obj_t c;
+		bli_acquire_mpart( 0, 0, m, k0, a_l, &c );
+
+		bao_getrf_laswp( &c, k0, bli_min( k0 + nb, mn ), params.ipiv,
+		                 params.incp, 0, cntx, &rntm_mt );
+	}
+
+	return params.info;
+}
+
@@ -0,0 +1,295 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Cholesky factorization. The upper-stored case is reduced to the
+// lower-stored case by inducing a transposition of A: if A = U^H * U, the
+// transpose of A (which is conj(A)) has the factorization conj(L) * conj(L)^H
+// with L = U^H, and the lower triangle of the transpose of A holds exactly
+// conj(L)^T = U once it is overwritten by its Cholesky factor.
+//
+
+typedef struct
+{
+	obj_t         a;
+	dim_t         k0;
+	dim_t         k1;
+	dim_t         k2;
+	dim_t         info;
+	const cntx_t* cntx;
+	rntm_t*       rntm_st;
+} bao_potrf_params_t;
+
+// Factor the lower triangle of A with the unblocked right-looking algorithm.
+static dim_t bao_potrf_unb
+     (
+       const obj_t*  a,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	const dim_t n = bli_obj_length( a );
+
+	obj_t scale;
+	bli_obj_scalar_init_detached( BLIS_DOUBLE, &scale );
+
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		double ar, ai;
+
+		bli_getijm( j, j, a, &ar, &ai );
+
+		// This test also catches NaNs.
+		if ( !( ar > 0.0 ) ) return j + 1;
+
+		ar = sqrt( ar );
+
+		bli_setijm( ar, 0.0, j, j, a );
+
+		if ( j == n - 1 ) break;
+
+		obj_t a21, a22;
+		bli_acquire_mpart( j + 1, j,     n - j - 1, 1,         a, &a21 );
+		bli_acquire_mpart( j + 1, j + 1, n - j - 1, n - j - 1, a, &a22 );
+
+		bli_obj_set_struc( BLIS_HERMITIAN, &a22 );
+		bli_obj_set_uplo( BLIS_LOWER, &a22 );
+
+		// a21 := a21 / alpha11
+		// A22 := A22 - a21 * a21^H
+		bli_setsc( 1.0 / ar, 0.0, &scale );
+		bli_scalv_ex( &scale, &a21, cntx, rntm );
+		bli_her_ex( &BLIS_MINUS_ONE, &a21, &a22, cntx, rntm );
+	}
+
+	return 0;
+}
+
+// Factor the lower triangle of A recursively.
+static dim_t bao_potrf_rec
+     (
+       const obj_t*  a,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	const dim_t n = bli_obj_length( a );
+
+	if ( n <= BAO_FACTOR_NB_LEAF ) return bao_potrf_unb( a, cntx, rntm );
+
+	const dim_t n1 = n / 2;
+	const dim_t n2 = n - n1;
+
+	obj_t a11, a21, a22;
+	bli_acquire_mpart( 0,  0,  n1, n1, a, &a11 );
+	bli_acquire_mpart( n1, 0,  n2, n1, a, &a21 );
+	bli_acquire_mpart( n1, n1, n2, n2, a, &a22 );
+
+	dim_t info = bao_potrf_rec( &a11, cntx, rntm );
+
+	if ( info != 0 ) return info;
+
+	// A21 := A21 * inv( L11 )^H
+	bli_obj_set_struc( BLIS_TRIANGULAR, &a11 );
+	bli_obj_set_uplo( BLIS_LOWER, &a11 );
+	bli_obj_set_conjtrans( BLIS_CONJ_TRANSPOSE, &a11 );
+	bli_trsm_ex( BLIS_RIGHT, &BLIS_ONE, &a11, &a21, cntx, rntm );
+
+	// A22 := A22 - A21 * A21^H
+	bli_obj_set_struc( BLIS_HERMITIAN, &a22 );
+	bli_obj_set_uplo( BLIS_LOWER, &a22 );
+	bli_herk_ex( &BLIS_MINUS_ONE, &a21, &BLIS_ONE, &a22, cntx, rntm );
+
+	bli_obj_set_struc( BLIS_GENERAL, &a22 );
+	bli_obj_set_uplo( BLIS_DENSE, &a22 );
+
+	info = bao_potrf_rec( &a22, cntx, rntm );
+
+	return ( info != 0 ? n1 + info : 0 );
+}
+
+// Factor the panel of columns [k0,k1).
+static dim_t bao_potrf_panel
+     (
+       const obj_t*  a,
+             dim_t   k0,
+             dim_t   k1,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	const dim_t n = bli_obj_length( a );
+
+	obj_t a11, a21;
+	bli_acquire_mpart( k0, k0, k1 - k0, k1 - k0, a, &a11 );
+	bli_acquire_mpart( k1, k0, n  - k1, k1 - k0, a, &a21 );
+
+	const dim_t info = bao_potrf_rec( &a11, cntx, rntm );
+
+	if ( info != 0 ) return k0 + info;
+
+	if ( k1 < n )
+	{
+		bli_obj_set_struc( BLIS_TRIANGULAR, &a11 );
+		bli_obj_set_uplo( BLIS_LOWER, &a11 );
+		bli_obj_set_conjtrans( BLIS_CONJ_TRANSPOSE, &a11 );
+		bli_trsm_ex( BLIS_RIGHT, &BLIS_ONE, &a11, &a21, cntx, rntm );
+	}
+
+	return 0;
+}
+
+// Update the columns [j0,j1) of the trailing matrix by the panel [k0,k1).
+static void bao_potrf_update( dim_t j0, dim_t j1, void* params_void )
+{
+	bao_potrf_params_t* params = params_void;
+
+	const obj_t* a  = &params->a;
+	const dim_t  n  = bli_obj_length( a );
+	const dim_t  k0 = params->k0;
+	const dim_t  kb = params->k1 - k0;
+
+	obj_t l1, l2, c11, c21;
+	bli_acquire_mpart( j0, k0, j1 - j0, kb,      a, &l1 );
+	bli_acquire_mpart( j1, k0, n  - j1, kb,      a, &l2 );
+	bli_acquire_mpart( j0, j0, j1 - j0, j1 - j0, a, &c11 );
+	bli_acquire_mpart( j1, j0, n  - j1, j1 - j0, a, &c21 );
+
+	// C11 := C11 - L1 * L1^H
+	bli_obj_set_struc( BLIS_HERMITIAN, &c11 );
+	bli_obj_set_uplo( BLIS_LOWER, &c11 );
+	bli_herk_ex( &BLIS_MINUS_ONE, &l1, &BLIS_ONE, &c11,
+	             params->cntx, params->rntm_st );
+
+	// C21 := C21 - L2 * L1^H
+	if ( j1 < n )
+	{
+		bli_obj_set_conjtrans( BLIS_CONJ_TRANSPOSE, &l1 );
+		bli_gemm_ex( &BLIS_MINUS_ONE, &l2, &l1, &BLIS_ONE, &c21,
+		             params->cntx, params->rntm_st );
+	}
+}
+
+// Update the next panel [k1,k2) by the current panel [k0,k1) and factor it.
+static void bao_potrf_lookahead( void* params_void )
+{
+	bao_potrf_params_t* params = params_void;
+
+	bao_potrf_update( params->k1, params->k2, params );
+
+	params->info = bao_potrf_panel( &params->a, params->k1, params->k2,
+	                                params->cntx, params->rntm_st );
+}
+
+// -----------------------------------------------------------------------------
+
+dim_t bao_potrf
+     (
+       const obj_t*  a
+     )
+{
+	return bao_potrf_ex( a, NULL, NULL );
+}
+
+dim_t bao_potrf_ex
+     (
+       const obj_t*  a,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bao_potrf_check( a );
+
+	const dim_t n = bli_obj_length( a );
+
+	if ( n == 0 ) return 0;
+
+	rntm_t  rntm_mt, rntm_st;
+	timpl_t ti;
+	dim_t   nt;
+	bao_factor_rntm_init( n, n, rntm, &rntm_mt, &rntm_st, &ti, &nt );
+
+	bao_potrf_params_t params;
+	params.cntx    = cntx;
+	params.rntm_st = &rntm_st;
+	params.info    = 0;
+
+	// Induce any transposition of A, and then reduce the upper-stored case
+	// to the lower-stored case (see above). From here on, A is accessed
+	// only through general submatrices.
+	obj_t* a_l = &params.a;
+	bli_obj_alias_to( a, a_l );
+
+	if ( bli_obj_has_trans( a_l ) )
+	{
+		bli_obj_induce_trans( a_l );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, a_l );
+	}
+
+	if ( bli_obj_is_upper( a_l ) )
+		bli_obj_induce_trans( a_l );
+
+	bli_obj_set_conj( BLIS_NO_CONJUGATE, a_l );
+	bli_obj_set_struc( BLIS_GENERAL, a_l );
+	bli_obj_set_uplo( BLIS_DENSE, a_l );
+
+	const dim_t nb = BAO_FACTOR_NB;
+
+	// Factor the first panel with the multithreaded runtime.
+	params.info = bao_potrf_panel( a_l, 0, bli_min( nb, n ), cntx, &rntm_mt );
+
+	for ( dim_t k0 = 0; k0 < n && params.info == 0; k0 += nb )
+	{
+		params.k0 = k0;
+		params.k1 = bli_min( k0 + nb, n );
+		params.k2 = bli_min( k0 + 2*nb, n );
+
+		if ( params.k1 == n ) break;
+
+		bao_factor_step( ti, nt, bao_potrf_lookahead, bao_potrf_update,
+		                 params.k2, n, nb, &params );
+	}
+
+	return params.info;
+}
+
@@ -0,0 +1,478 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+typedef void (*bao_gemmd_scal2m_diag_vft)
+     (
+             side_t side,
+             conj_t conjx,
+             dim_t  m,
+             dim_t  n,
+       const void*  x, inc_t rs_x, inc_t cs_x,
+       const void*  d, inc_t incd,
+             void*  y, inc_t rs_y, inc_t cs_y
+     );
+
+static bao_gemmd_scal2m_diag_vft GENARRAY_PREF( scal2m_diag_fp, bao_, gemmd_scal2m_diag );
+
+static packm_ker_ft GENARRAY_PREF( packm_ker_fp, bao_, gemmd_packm_ker );
+
+// Determine whether the sup implementation would handle the problem,
+// mirroring the logic of bli_gemmsup(). Note that gemmt (like bli_gemmt())
+// always uses the conventional implementation, since bli_gemmtsup() is not
+// yet functional for all configurations.
+static bool bao_gemmd_is_sup
+     (
+             opid_t  family,
+       const obj_t*  a,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+#ifdef BLIS_DISABLE_SUP_HANDLING
+	return FALSE;
+#endif
+
+	if ( !bli_rntm_l3_sup( rntm ) ) return FALSE;
+
+	const num_t dt = bli_obj_dt( c );
+	const dim_t m  = bli_obj_length( c );
+	const dim_t n  = bli_obj_width( c );
+	const dim_t k  = bli_obj_width_after_trans( a );
+
+	if ( family == BLIS_GEMMT ) return FALSE;
+
+	// Take into account the transposition that would be induced by the
+	// storage preference of the microkernel.
+	if ( bli_cntx_dislikes_storage_of( c, BLIS_GEMM_VIR_UKR, cntx ) )
+		return bli_cntx_l3_sup_thresh_is_met( dt, n, m, k, cntx );
+	else
+		return bli_cntx_l3_sup_thresh_is_met( dt, m, n, k, cntx );
+}
+
+// Execute the operation via the sup implementation. The sup implementation
+// does not necessarily pack A or B, and so diag(d) is instead applied to
+// the smaller of the two while it is copied to a temporary matrix.
+static void bao_gemmd_sup
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	const num_t dt      = bli_obj_dt( c );
+	const bool  scale_a = bli_obj_length( c ) <= bli_obj_width( c );
+
+	// Alias the operand to be scaled, and induce any transposition so that
+	// its view is no longer transposed.
+	obj_t x;
+	bli_obj_alias_to( scale_a ? a : b, &x );
+
+	if ( bli_obj_has_trans( &x ) )
+	{
+		bli_obj_induce_trans( &x );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &x );
+	}
+
+	const dim_t m_x  = bli_obj_length( &x );
+	const dim_t n_x  = bli_obj_width( &x );
+
+	// Store the temporary matrix in the same orientation as the operand, so
+	// that the sup implementation chooses the same variant that it would for
+	// the original problem.
+	const bool  rowx = bli_obj_is_row_stored( &x );
+	const inc_t rs_t = ( rowx ? n_x : 1   );
+	const inc_t cs_t = ( rowx ? 1   : m_x );
+
+	pba_t* pba = bli_pba_query();
+	mem_t  mem = BLIS_MEM_INITIALIZER;
+
+	bli_pba_acquire_m
+	(
+	  pba,
+	  m_x * n_x * bli_dt_size( dt ),
+	  BLIS_BUFFER_FOR_GEN_USE,
+	  &mem
+	);
+
+	obj_t t;
+	bli_obj_create_with_attached_buffer( dt, m_x, n_x, bli_mem_buffer( &mem ), rs_t, cs_t, &t );
+
+	scal2m_diag_fp[ dt ]
+	(
+	  scale_a ? BLIS_RIGHT : BLIS_LEFT,
+	  bli_obj_conj_status( &x ),
+	  m_x, n_x,
+	  bli_obj_buffer_at_off( &x ), bli_obj_row_stride( &x ), bli_obj_col_stride( &x ),
+	  bli_obj_buffer_at_off( d ), bli_obj_vector_inc( d ),
+	  bli_obj_buffer( &t ), rs_t, cs_t
+	);
+
+	const obj_t* a_use = ( scale_a ? &t : a  );
+	const obj_t* b_use = ( scale_a ? b  : &t );
+
+	// Note that bli_gemm_ex() tries the sup implementation first.
+	bli_gemm_ex( alpha, a_use, b_use, beta, c, cntx, rntm );
+
+	bli_pba_release( pba, &mem );
+}
+
+static void bao_gemmd_front
+     (
+             opid_t  family,
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	// If C has a zero dimension, return early.
+	if ( bli_obj_has_zero_dim( c ) ) return;
+
+	// If alpha is zero, or if A or B has a zero dimension, scale C by beta
+	// and return early.
+	if ( bli_obj_equals( alpha, &BLIS_ZERO ) ||
+	     bli_obj_has_zero_dim( a ) ||
+	     bli_obj_has_zero_dim( b ) )
+	{
+		bli_scalm( beta, c );
+		return;
+	}
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); }
+	else                { rntm_l = *rntm;                       }
+
+	if ( bao_gemmd_is_sup( family, a, c, cntx, &rntm_l ) )
+	{
+		bao_gemmd_sup( alpha, a, d, b, beta, c, cntx, &rntm_l );
+		return;
+	}
+
+	// Otherwise, attach d to B along with the packm kernel that applies it.
+	// (If bli_gemm_front() transposes the operation, then B^T is packed as
+	// the left operand, which works just as well since the kernel applies
+	// d along the k dimension in either case.)
+	const num_t dt = bli_obj_dt( c );
+
+	bao_gemmd_params_t params;
+	memset( &params.pack, 0, sizeof( params.pack ) );
+
+	params.pack.ukr_fn[ dt ][ dt ] = packm_ker_fp[ dt ];
+	params.d                       = bli_obj_buffer_at_off( d );
+	params.incd                    = bli_obj_vector_inc( d );
+
+	obj_t b_local;
+	bli_obj_alias_to( b, &b_local );
+	bli_obj_set_pack_params( &params, &b_local );
+
+	// Having ruled out the sup implementation above, we disable it so that
+	// B is always packed.
+	bli_rntm_disable_l3_sup( &rntm_l );
+
+	if ( family == BLIS_GEMM )
+		bli_gemm_ex( alpha, a, &b_local, beta, c, cntx, &rntm_l );
+	else
+		bli_gemmt_ex( alpha, a, &b_local, beta, c, cntx, &rntm_l );
+}
+
+//
+// -- Define the object API ----------------------------------------------------
+//
+
+void bao_gemmd
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c
+     )
+{
+	bao_gemmd_ex( alpha, a, d, b, beta, c, NULL, NULL );
+}
+
+void bao_gemmd_ex
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	// Obtain a valid (native) context from the gks if necessary. Note that
+	// induced methods are never used, since the packm kernel only produces
+	// the native packing format.
+	// NOTE: This must be done before calling the _check() function, since
+	// that function assumes the context pointer is valid.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bao_gemmd_check( alpha, a, d, b, beta, c, cntx );
+
+	bao_gemmd_front( BLIS_GEMM, alpha, a, d, b, beta, c, cntx, rntm );
+}
+
+void bao_gemmtd
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c
+     )
+{
+	bao_gemmtd_ex( alpha, a, d, b, beta, c, NULL, NULL );
+}
+
+void bao_gemmtd_ex
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	if ( bli_error_checking_is_enabled() )
+		bao_gemmtd_check( alpha, a, d, b, beta, c, cntx );
+
+	bao_gemmd_front( BLIS_GEMMT, alpha, a, d, b, beta, c, cntx, rntm );
+}
+
+void bao_syrkd
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+       const obj_t*  beta,
+       const obj_t*  c
+     )
+{
+	bao_syrkd_ex( alpha, a, d, beta, c, NULL, NULL );
+}
+
+void bao_syrkd_ex
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	if ( bli_error_checking_is_enabled() )
+		bao_syrkd_check( alpha, a, d, beta, c, cntx );
+
+	obj_t at;
+	bli_obj_alias_to( a, &at );
+	bli_obj_toggle_trans( &at );
+
+	bao_gemmd_front( BLIS_GEMMT, alpha, a, d, &at, beta, c, cntx, rntm );
+}
+
+//
+// -- Define the typed API -----------------------------------------------------
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             trans_t transa, \
+             trans_t transb, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  d, inc_t incd, \
+       const ctype*  b, inc_t rs_b, inc_t cs_b, \
+       const ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	obj_t alphao, ao, dd, bo, betao, co; \
+\
+	dim_t m_a, n_a; \
+	dim_t m_b, n_b; \
+\
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a ); \
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b ); \
+\
+	bli_obj_create_1x1_with_attached_buffer( dt, ( ctype* )alpha, &alphao ); \
+	bli_obj_create_1x1_with_attached_buffer( dt, ( ctype* )beta,  &betao  ); \
+\
+	bli_obj_create_with_attached_buffer( dt, m_a, n_a, ( ctype* )a, rs_a, cs_a, &ao ); \
+	bli_obj_create_with_attached_buffer( dt, k,   1,   ( ctype* )d, incd, k,    &dd ); \
+	bli_obj_create_with_attached_buffer( dt, m_b, n_b, ( ctype* )b, rs_b, cs_b, &bo ); \
+	bli_obj_create_with_attached_buffer( dt, m,   n,   c,           rs_c, cs_c, &co ); \
+\
+	bli_obj_set_conjtrans( transa, &ao ); \
+	bli_obj_set_conjtrans( transb, &bo ); \
+\
+	PASTECH(bao_,opname)( &alphao, &ao, &dd, &bo, &betao, &co ); \
+}
+
+INSERT_GENTFUNC_BASIC( gemmd )
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             uplo_t  uploc, \
+             trans_t transa, \
+             trans_t transb, \
+             dim_t   m, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  d, inc_t incd, \
+       const ctype*  b, inc_t rs_b, inc_t cs_b, \
+       const ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	obj_t alphao, ao, dd, bo, betao, co; \
+\
+	dim_t m_a, n_a; \
+	dim_t m_b, n_b; \
+\
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a ); \
+	bli_set_dims_with_trans( transb, k, m, &m_b, &n_b ); \
+\
+	bli_obj_create_1x1_with_attached_buffer( dt, ( ctype* )alpha, &alphao ); \
+	bli_obj_create_1x1_with_attached_buffer( dt, ( ctype* )beta,  &betao  ); \
+\
+	bli_obj_create_with_attached_buffer( dt, m_a, n_a, ( ctype* )a, rs_a, cs_a, &ao ); \
+	bli_obj_create_with_attached_buffer( dt, k,   1,   ( ctype* )d, incd, k,    &dd ); \
+	bli_obj_create_with_attached_buffer( dt, m_b, n_b, ( ctype* )b, rs_b, cs_b, &bo ); \
+	bli_obj_create_with_attached_buffer( dt, m,   m,   c,           rs_c, cs_c, &co ); \
+\
+	bli_obj_set_uplo( uploc, &co ); \
+	bli_obj_set_conjtrans( transa, &ao ); \
+	bli_obj_set_conjtrans( transb, &bo ); \
+\
+	PASTECH(bao_,opname)( &alphao, &ao, &dd, &bo, &betao, &co ); \
+}
+
+INSERT_GENTFUNC_BASIC( gemmtd )
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             uplo_t  uploc, \
+             trans_t transa, \
+             dim_t   m, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  d, inc_t incd, \
+       const ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	obj_t alphao, ao, dd, betao, co; \
+\
+	dim_t m_a, n_a; \
+\
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a ); \
+\
+	bli_obj_create_1x1_with_attached_buffer( dt, ( ctype* )alpha, &alphao ); \
+	bli_obj_create_1x1_with_attached_buffer( dt, ( ctype* )beta,  &betao  ); \
+\
+	bli_obj_create_with_attached_buffer( dt, m_a, n_a, ( ctype* )a, rs_a, cs_a, &ao ); \
+	bli_obj_create_with_attached_buffer( dt, k,   1,   ( ctype* )d, incd, k,    &dd ); \
+	bli_obj_create_with_attached_buffer( dt, m,   m,   c,           rs_c, cs_c, &co ); \
+\
+	bli_obj_set_struc( BLIS_SYMMETRIC, &co ); \
+	bli_obj_set_uplo( uploc, &co ); \
+	bli_obj_set_conjtrans( transa, &ao ); \
+\
+	PASTECH(bao_,opname)( &alphao, &ao, &dd, &betao, &co ); \
+}
+
+INSERT_GENTFUNC_BASIC( syrkd )
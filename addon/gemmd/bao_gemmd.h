@@ -0,0 +1,192 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Matrix products with an interior diagonal factor:
+//
+//   bao_gemmd():   C := beta * C + alpha * A * diag(d) * B
+//   bao_gemmtd():  C := beta * C + alpha * A * diag(d) * B
+//                  (updating only the lower or upper triangle of C)
+//   bao_syrkd():   C := beta * C + alpha * A * diag(d) * A^T
+//                  (updating only the lower or upper triangle of C)
+//
+// where d is a vector of length k (the width of A after transposition).
+// The triangle of C updated by bao_gemmtd() and bao_syrkd() is given by
+// the uplo property of C. A product of the form A * diag(d) * A^H may be
+// computed with bao_gemmtd() by passing A with its conjugate-transpose
+// property set as the B operand (in which case d should be real-valued for
+// the result to be Hermitian).
+//
+// Large problems execute the conventional gemm (or gemmt) implementation,
+// with diag(d) applied to the micropanels of B as they are packed, and
+// thus all of the framework's threading and packing memory management
+// applies. Problems of bao_gemmd() that fall within the sup thresholds
+// instead scale the smaller of A and B by diag(d) into a temporary matrix
+// (acquired from the packed block allocator) and execute the sup
+// implementation. (Like bli_gemmt(), bao_gemmtd() and bao_syrkd() always
+// use the conventional implementation.)
+//
+// All operands must be of the same datatype.
+//
+
+//
+// -- Prototype the object API -------------------------------------------------
+//
+
+BLIS_EXPORT_ADDON void bao_gemmd
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c
+     );
+
+BLIS_EXPORT_ADDON void bao_gemmd_ex
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     );
+
+BLIS_EXPORT_ADDON void bao_gemmtd
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c
+     );
+
+BLIS_EXPORT_ADDON void bao_gemmtd_ex
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     );
+
+BLIS_EXPORT_ADDON void bao_syrkd
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+       const obj_t*  beta,
+       const obj_t*  c
+     );
+
+BLIS_EXPORT_ADDON void bao_syrkd_ex
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  d,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     );
+
+//
+// -- Prototype the typed API --------------------------------------------------
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_ADDON void PASTECH2(bao_,ch,opname) \
+     ( \
+             trans_t transa, \
+             trans_t transb, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  d, inc_t incd, \
+       const ctype*  b, inc_t rs_b, inc_t cs_b, \
+       const ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c  \
+     );
+
+INSERT_GENTPROT_BASIC( gemmd )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_ADDON void PASTECH2(bao_,ch,opname) \
+     ( \
+             uplo_t  uploc, \
+             trans_t transa, \
+             trans_t transb, \
+             dim_t   m, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  d, inc_t incd, \
+       const ctype*  b, inc_t rs_b, inc_t cs_b, \
+       const ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c  \
+     );
+
+INSERT_GENTPROT_BASIC( gemmtd )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_ADDON void PASTECH2(bao_,ch,opname) \
+     ( \
+             uplo_t  uploc, \
+             trans_t transa, \
+             dim_t   m, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  d, inc_t incd, \
+       const ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c  \
+     );
+
+INSERT_GENTPROT_BASIC( syrkd )
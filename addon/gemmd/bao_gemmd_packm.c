@@ -0,0 +1,157 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+       packm_params, \
+       BLIS_CNTX_PARAM  \
+     ) \
+{ \
+	const num_t                dt          = PASTEMAC(ch,type); \
+	const bao_gemmd_params_t*  params_cast = params; \
+	const ctype*      restrict d_cast      = params_cast->d; \
+	const inc_t                incd        = params_cast->incd; \
+	      ctype*      restrict p_cast      = p; \
+\
+	/* The operand is required to be general (see bao_gemmd_check()), and so
+	   we can skip straight to the packm microkernel, which also zero-pads
+	   the micropanel as needed. */ \
+	const ukr_t ker_id = bli_is_col_packed( schema ) ? BLIS_PACKM_NRXK_KER \
+	                                                 : BLIS_PACKM_MRXK_KER; \
+\
+	packm_cxk_ker_ft f_cxk = bli_cntx_get_ukr_dt( dt, ker_id, cntx ); \
+\
+	f_cxk \
+	( \
+	  conjc, \
+	  schema, \
+	  panel_dim, \
+	  panel_len, \
+	  panel_len_max, \
+	  kappa, \
+	  c, incc, ldc, \
+	  p,       ldp, \
+	  cntx  \
+	); \
+\
+	/* Scale each column of the micropanel by the element of d that
+	   corresponds to its index along the k dimension. The micropanel is
+	   still resident in the L1 cache at this point, so this second pass is
+	   cheap relative to the first. */ \
+	d_cast += panel_len_off * incd; \
+\
+	for ( dim_t j = 0; j < panel_len; ++j ) \
+	{ \
+		const ctype           dj  = d_cast[ j*incd ]; \
+		      ctype* restrict p_j = p_cast + j*ldp; \
+\
+		for ( dim_t i = 0; i < panel_dim; ++i ) \
+			PASTEMAC(ch,scals)( dj, p_j[ i ] ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( gemmd_packm_ker )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             side_t side, \
+             conj_t conjx, \
+             dim_t  m, \
+             dim_t  n, \
+       const void*  x, inc_t rs_x, inc_t cs_x, \
+       const void*  d, inc_t incd, \
+             void*  y, inc_t rs_y, inc_t cs_y  \
+     ) \
+{ \
+	const ctype* restrict x_cast = x; \
+	const ctype* restrict d_cast = d; \
+	      ctype* restrict y_cast = y; \
+\
+	/* If Y is row-stored, operate on the transposed problem so that the
+	   inner loop accesses Y with unit stride. */ \
+	if ( bli_is_row_stored( rs_y, cs_y ) ) \
+	{ \
+		bli_swap_dims( &m, &n ); \
+		bli_swap_incs( &rs_x, &cs_x ); \
+		bli_swap_incs( &rs_y, &cs_y ); \
+		side = bli_side_toggled( side ); \
+	} \
+\
+	if ( bli_is_right( side ) ) \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		{ \
+			const ctype dj = d_cast[ j*incd ]; \
+\
+			if ( bli_is_conj( conjx ) ) \
+			{ \
+				for ( dim_t i = 0; i < m; ++i ) \
+					PASTEMAC(ch,scal2js)( dj, x_cast[ i*rs_x + j*cs_x ], y_cast[ i*rs_y + j*cs_y ] ); \
+			} \
+			else \
+			{ \
+				for ( dim_t i = 0; i < m; ++i ) \
+					PASTEMAC(ch,scal2s)( dj, x_cast[ i*rs_x + j*cs_x ], y_cast[ i*rs_y + j*cs_y ] ); \
+			} \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		{ \
+			if ( bli_is_conj( conjx ) ) \
+			{ \
+				for ( dim_t i = 0; i < m; ++i ) \
+					PASTEMAC(ch,scal2js)( d_cast[ i*incd ], x_cast[ i*rs_x + j*cs_x ], y_cast[ i*rs_y + j*cs_y ] ); \
+			} \
+			else \
+			{ \
+				for ( dim_t i = 0; i < m; ++i ) \
+					PASTEMAC(ch,scal2s)( d_cast[ i*incd ], x_cast[ i*rs_x + j*cs_x ], y_cast[ i*rs_y + j*cs_y ] ); \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( gemmd_scal2m_diag )
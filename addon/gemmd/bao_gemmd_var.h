@@ -4,7 +4,7 @@
    An object-based framework for developing high-performance BLAS-like
    libraries.
 
-   Copyright (C) 2021, The University of Texas at Austin
+   Copyright (C) 2022, The University of Texas at Austin
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -32,74 +32,59 @@
 
 */
 
+
+
 //
-// -- Prototype the gemmd operation's object API -------------------------------
+// The packm parameters attached to the operand whose micropanels are
+// scaled by diag(d) as they are packed. The packm_blk_var1_params_t member
+// must come first, since bli_packm_blk_var1() interprets the parameters as
+// such in order to find the packm kernel.
 //
 
-BLIS_EXPORT_ADDON void bao_gemmd
-     (
-       obj_t*  alpha,
-       obj_t*  a,
-       obj_t*  d,
-       obj_t*  b,
-       obj_t*  beta,
-       obj_t*  c
-     );
-
-BLIS_EXPORT_ADDON void bao_gemmd_ex
-     (
-       obj_t*  alpha,
-       obj_t*  a,
-       obj_t*  d,
-       obj_t*  b,
-       obj_t*  beta,
-       obj_t*  c,
-       cntx_t* cntx,
-       rntm_t* rntm
-     );
+typedef struct
+{
+	packm_blk_var1_params_t pack;
+	const void*             d;
+	inc_t                   incd;
+} bao_gemmd_params_t;
 
 //
-// -- Prototype the gemmd operation's thread entry point -----------------------
+// Prototype the packm kernel, which packs a micropanel as usual and then
+// scales each of its columns (i.e. each index along the k dimension) by
+// the corresponding element of d.
 //
 
-void bao_gemmd_int
-     (
-       obj_t*  alpha,
-       obj_t*  a,
-       obj_t*  d,
-       obj_t*  b,
-       obj_t*  beta,
-       obj_t*  c,
-       cntx_t* cntx,
-       rntm_t* rntm,
-       thrinfo_t* thread
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+       packm_params, \
+       BLIS_CNTX_PARAM  \
      );
 
+INSERT_GENTPROT_BASIC( gemmd_packm_ker )
+
+//
+// Prototype the function used by the sup code path to form the product of
+// a matrix with diag(d), where d is applied to the columns (if side is
+// BLIS_RIGHT) or rows (if side is BLIS_LEFT) of X:
 //
-// -- Prototype the gemmd operation's typed API --------------------------------
+//   Y := conjx( X ) * diag(d)   or   Y := diag(d) * conjx( X )
 //
 
 #undef  GENTPROT
 #define GENTPROT( ctype, ch, opname ) \
 \
-BLIS_EXPORT_ADDON void PASTECH2(bao_,ch,opname) \
+void PASTECH2(bao_,ch,opname) \
      ( \
-       trans_t transa, \
-       trans_t transb, \
-       dim_t   m, \
-       dim_t   n, \
-       dim_t   k, \
-       ctype*  alpha, \
-       ctype*  a, inc_t rs_a, inc_t cs_a, \
-       ctype*  d, inc_t incd, \
-       ctype*  b, inc_t rs_b, inc_t cs_b, \
-       ctype*  beta, \
-       ctype*  c, inc_t rs_c, inc_t cs_c  \
+             side_t side, \
+             conj_t conjx, \
+             dim_t  m, \
+             dim_t  n, \
+       const void*  x, inc_t rs_x, inc_t cs_x, \
+       const void*  d, inc_t incd, \
+             void*  y, inc_t rs_y, inc_t cs_y  \
      );
 
-//INSERT_GENTPROT_BASIC0( gemmd )
-GENTPROT( float,    s, gemmd )
-GENTPROT( double,   d, gemmd )
-GENTPROT( scomplex, c, gemmd )
-GENTPROT( dcomplex, z, gemmd )
-
+INSERT_GENTPROT_BASIC( gemmd_scal2m_diag )
@@ -4,7 +4,7 @@
    An object-based framework for developing high-performance BLAS-like
    libraries.
 
-   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2022, The University of Texas at Austin
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -14,7 +14,7 @@
     - Redistributions in binary form must reproduce the above copyright
       notice, this list of conditions and the following disclaimer in the
       documentation and/or other materials provided with the distribution.
-    - Neither the name of copyright holder(s) nor the names
+    - Neither the name(s) of the copyright holder(s) nor the names of its
       contributors may be used to endorse or promote products derived
       from this software without specific prior written permission.
 
@@ -32,6 +32,7 @@
 
 */
 
+
 #ifndef GEMMD_H
 #define GEMMD_H
 
@@ -42,13 +43,5 @@
 #include "bao_gemmd_check.h"
 #include "bao_gemmd_var.h"
 
-#include "bao_l3_packm_a.h"
-#include "bao_l3_packm_b.h"
-#include "bao_l3_packm_var.h"
-
-#include "bao_packm_cxk.h"
-
-#include "bao_l3_decor.h"
-
 
 #endif
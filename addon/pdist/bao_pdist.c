@@ -0,0 +1,392 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+struct bao_pdist_decor_params_s
+{
+	const bao_pdist_params_t* params;
+	const cntx_t*             cntx;
+	      rntm_t*             rntm;
+	      array_t*            array;
+};
+typedef struct bao_pdist_decor_params_s bao_pdist_decor_params_t;
+
+static void bao_pdist_thread_entry( thrcomm_t* gl_comm, dim_t tid, const void* data_void )
+{
+	const bao_pdist_decor_params_t* data = data_void;
+
+	bli_l3_thread_decorator_thread_check( gl_comm, data->rntm );
+
+	// Create the root node of the thread's thrinfo_t structure. The sup
+	// thrinfo_t tree has exactly the shape needed by the block-panel variant
+	// (including the packm prenodes).
+	pool_t*    pool   = bli_apool_array_elem( tid, data->array );
+	thrinfo_t* thread = bli_l3_sup_thrinfo_create( tid, gl_comm, pool, data->rntm );
+
+	bao_pdist_bp_var1( data->params, data->cntx, thread );
+
+	// Free the current thread's thrinfo_t structure (after a barrier, so that
+	// no thread releases packing memory still in use by its peers).
+	bli_thrinfo_barrier( thread );
+	bli_thrinfo_free( thread );
+}
+
+static void bao_pdist_front
+     (
+             bao_pdist_params_t* params,
+       const cntx_t*             cntx,
+       const rntm_t*             rntm
+     )
+{
+	// If there is nothing to compute, return early.
+	if ( params->m == 0 || params->n == 0 ) return;
+	if ( params->c == NULL && params->t == 0 ) return;
+
+	// If k is zero, then all of the points coincide. We handle this case by
+	// viewing them as points at the origin of a one-dimensional space.
+	if ( params->k == 0 )
+	{
+		const void* zero = bli_obj_buffer_for_const( params->dt, &BLIS_ZERO );
+
+		params->k    = 1;
+		params->x    = zero; params->rs_x = 0; params->cs_x = 0;
+		params->y    = zero; params->rs_y = 0; params->cs_y = 0;
+	}
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); }
+	else                { rntm_l = *rntm;                       }
+
+	// X and Y must always be packed. Setting these fields also prevents
+	// bli_l3_sup_thrinfo_create() from assuming a sup-style (unpacked)
+	// execution.
+	bli_rntm_set_pack_a( TRUE, &rntm_l );
+	bli_rntm_set_pack_b( TRUE, &rntm_l );
+
+	// Parse and interpret the contents of the rntm_t object to properly
+	// set the ways of parallelism for each loop.
+	bli_rntm_set_ways_for_op
+	(
+	  BLIS_GEMM,
+	  BLIS_LEFT, // ignored for gemm/hemm/symm
+	  params->m,
+	  params->n,
+	  params->k,
+	  &rntm_l
+	);
+
+	// Query the threading implementation and the number of threads requested.
+	timpl_t ti = bli_rntm_thread_impl( &rntm_l );
+	dim_t   nt = bli_rntm_num_threads( &rntm_l );
+
+	if ( bli_error_checking_is_enabled() )
+		bli_l3_thread_decorator_check( &rntm_l );
+
+#ifdef BLIS_ENABLE_NT1_VIA_SINGLE
+	if ( nt == 1 )
+	{
+		// An optimization. If the caller requests only one thread, force
+		// the sequential implementation.
+		ti = BLIS_SINGLE;
+		bli_rntm_set_thread_impl( BLIS_SINGLE, &rntm_l );
+	}
+#endif
+
+	if ( 1 < nt && ti == BLIS_SINGLE )
+	{
+		// Favor the requested (sequential) threading implementation over the
+		// number of threads, and reset all parallelism parameters to 1.
+		nt = 1;
+		bli_rntm_set_ways_only( 1, 1, 1, 1, 1, &rntm_l );
+		bli_rntm_set_num_threads_only( 1, &rntm_l );
+	}
+
+	// When computing nearest neighbors, each row of X must be processed by
+	// a single thread, and so all of the threads are assigned to the ic
+	// loop.
+	if ( params->c == NULL )
+		bli_rntm_set_ways_only( 1, 1, nt, 1, 1, &rntm_l );
+
+	// Allocate the buffers for the squared norms of the rows of X and Y.
+	err_t r_val;
+	const siz_t es = bli_dt_size( params->dt );
+	char*       nrm = bli_malloc_intl( ( params->m + params->n ) * es, &r_val );
+
+	params->nrm_x = nrm;
+	params->nrm_y = nrm + params->m * es;
+
+	// Check out an array_t from the small block allocator for the threads'
+	// thrinfo_t trees.
+	array_t* array = bli_sba_checkout_array( nt );
+
+	bao_pdist_decor_params_t decor_params;
+	decor_params.params = params;
+	decor_params.cntx   = cntx;
+	decor_params.rntm   = &rntm_l;
+	decor_params.array  = array;
+
+	bli_thread_launch( ti, nt, bao_pdist_thread_entry, &decor_params );
+
+	bli_sba_checkin_array( array );
+
+	bli_free_intl( nrm );
+}
+
+// Initialize the parameters common to bao_pdist() and bao_pdist_topk() from
+// the function, the bandwidth, and the point sets X and Y.
+static void bao_pdist_params_init
+     (
+             bao_pdist_func_t    func,
+       const obj_t*              h,
+       const obj_t*              x,
+       const obj_t*              y,
+             bao_pdist_params_t* params
+     )
+{
+	obj_t x_local;
+	obj_t y_local;
+
+	// Induce any transpositions of X and Y.
+	bli_obj_alias_to( x, &x_local );
+	bli_obj_alias_to( y, &y_local );
+
+	if ( bli_obj_has_trans( &x_local ) ) bli_obj_induce_trans( &x_local );
+	if ( bli_obj_has_trans( &y_local ) ) bli_obj_induce_trans( &y_local );
+
+	const num_t dt = bli_obj_dt( x );
+
+	memset( params, 0, sizeof( *params ) );
+
+	params->dt   = dt;
+	params->func = func;
+	params->h    = ( func == BAO_GAUSSIAN || func == BAO_LAPLACIAN
+	                 ? bli_obj_buffer_for_1x1( dt, h ) : NULL );
+
+	params->m    = bli_obj_length( &x_local );
+	params->n    = bli_obj_length( &y_local );
+	params->k    = bli_obj_width( &x_local );
+
+	params->x    = bli_obj_buffer_at_off( &x_local );
+	params->rs_x = bli_obj_row_stride( &x_local );
+	params->cs_x = bli_obj_col_stride( &x_local );
+
+	params->y    = bli_obj_buffer_at_off( &y_local );
+	params->rs_y = bli_obj_row_stride( &y_local );
+	params->cs_y = bli_obj_col_stride( &y_local );
+}
+
+//
+// -- Define the object API ----------------------------------------------------
+//
+
+void bao_pdist
+     (
+             bao_pdist_func_t func,
+       const obj_t*           h,
+       const obj_t*           x,
+       const obj_t*           y,
+       const obj_t*           c
+     )
+{
+	bao_pdist_ex( func, h, x, y, c, NULL, NULL );
+}
+
+void bao_pdist_ex
+     (
+             bao_pdist_func_t func,
+       const obj_t*           h,
+       const obj_t*           x,
+       const obj_t*           y,
+       const obj_t*           c,
+       const cntx_t*          cntx,
+       const rntm_t*          rntm
+     )
+{
+	bli_init_once();
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bao_pdist_check( func, h, x, y, c );
+
+	bao_pdist_params_t params;
+	bao_pdist_params_init( func, h, x, y, &params );
+
+	obj_t c_local;
+	bli_obj_alias_to( c, &c_local );
+	if ( bli_obj_has_trans( &c_local ) ) bli_obj_induce_trans( &c_local );
+
+	params.c    = bli_obj_buffer_at_off( &c_local );
+	params.rs_c = bli_obj_row_stride( &c_local );
+	params.cs_c = bli_obj_col_stride( &c_local );
+
+	bao_pdist_front( &params, cntx, rntm );
+}
+
+void bao_pdist_topk
+     (
+             bao_pdist_func_t func,
+       const obj_t*           h,
+       const obj_t*           x,
+       const obj_t*           y,
+       const obj_t*           dist,
+       const obj_t*           idx
+     )
+{
+	bao_pdist_topk_ex( func, h, x, y, dist, idx, NULL, NULL );
+}
+
+void bao_pdist_topk_ex
+     (
+             bao_pdist_func_t func,
+       const obj_t*           h,
+       const obj_t*           x,
+       const obj_t*           y,
+       const obj_t*           dist,
+       const obj_t*           idx,
+       const cntx_t*          cntx,
+       const rntm_t*          rntm
+     )
+{
+	bli_init_once();
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bao_pdist_topk_check( func, h, x, y, dist, idx );
+
+	bao_pdist_params_t params;
+	bao_pdist_params_init( func, h, x, y, &params );
+
+	obj_t d_local;
+	obj_t i_local;
+	bli_obj_alias_to( dist, &d_local );
+	bli_obj_alias_to( idx,  &i_local );
+	if ( bli_obj_has_trans( &d_local ) ) bli_obj_induce_trans( &d_local );
+	if ( bli_obj_has_trans( &i_local ) ) bli_obj_induce_trans( &i_local );
+
+	params.t       = bli_obj_width( &d_local );
+
+	params.dist    = bli_obj_buffer_at_off( &d_local );
+	params.rs_dist = bli_obj_row_stride( &d_local );
+	params.cs_dist = bli_obj_col_stride( &d_local );
+
+	params.idx     = bli_obj_buffer_at_off( &i_local );
+	params.rs_idx  = bli_obj_row_stride( &i_local );
+	params.cs_idx  = bli_obj_col_stride( &i_local );
+
+	bao_pdist_front( &params, cntx, rntm );
+}
+
+//
+// -- Define the typed API -----------------------------------------------------
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             bao_pdist_func_t func, \
+             dim_t            m, \
+             dim_t            n, \
+             dim_t            k, \
+       const ctype*           h, \
+       const ctype*           x, inc_t rs_x, inc_t cs_x, \
+       const ctype*           y, inc_t rs_y, inc_t cs_y, \
+             ctype*           c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	obj_t ho, xo, yo, co; \
+\
+	bli_obj_create_1x1_with_attached_buffer( dt, ( ctype* )h, &ho ); \
+\
+	bli_obj_create_with_attached_buffer( dt, m, k, ( ctype* )x, rs_x, cs_x, &xo ); \
+	bli_obj_create_with_attached_buffer( dt, n, k, ( ctype* )y, rs_y, cs_y, &yo ); \
+	bli_obj_create_with_attached_buffer( dt, m, n, c,           rs_c, cs_c, &co ); \
+\
+	PASTECH(bao_,opname)( func, ( h != NULL ? &ho : NULL ), &xo, &yo, &co ); \
+}
+
+GENTFUNC( float,  s, pdist )
+GENTFUNC( double, d, pdist )
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             bao_pdist_func_t func, \
+             dim_t            m, \
+             dim_t            n, \
+             dim_t            k, \
+             dim_t            t, \
+       const ctype*           h, \
+       const ctype*           x,    inc_t rs_x,    inc_t cs_x, \
+       const ctype*           y,    inc_t rs_y,    inc_t cs_y, \
+             ctype*           dist, inc_t rs_dist, inc_t cs_dist, \
+             gint_t*          idx,  inc_t rs_idx,  inc_t cs_idx  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	obj_t ho, xo, yo, disto, idxo; \
+\
+	bli_obj_create_1x1_with_attached_buffer( dt, ( ctype* )h, &ho ); \
+\
+	bli_obj_create_with_attached_buffer( dt,       m, k, ( ctype* )x, rs_x,    cs_x,    &xo    ); \
+	bli_obj_create_with_attached_buffer( dt,       n, k, ( ctype* )y, rs_y,    cs_y,    &yo    ); \
+	bli_obj_create_with_attached_buffer( dt,       m, t, dist,        rs_dist, cs_dist, &disto ); \
+	bli_obj_create_with_attached_buffer( BLIS_INT, m, t, idx,         rs_idx,  cs_idx,  &idxo  ); \
+\
+	PASTECH(bao_,opname)( func, ( h != NULL ? &ho : NULL ), &xo, &yo, &disto, &idxo ); \
+}
+
+GENTFUNC( float,  s, pdist_topk )
+GENTFUNC( double, d, pdist_topk )
+
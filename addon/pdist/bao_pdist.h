@@ -0,0 +1,170 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Pairwise distance and kernel matrices:
+//
+//   C(i,j) := f( || x_i - y_j ||^2 )
+//
+// where x_i is the ith row of the m x k matrix X, y_j is the jth row of the
+// n x k matrix Y, and f is one of the functions enumerated by
+// bao_pdist_func_t below (which take the bandwidth h as a parameter).
+//
+// The squared distances are expanded as ||x_i||^2 + ||y_j||^2 - 2 x_i y_j^T,
+// and so the bulk of the computation is the gemm-like product X Y^T, which
+// is computed by a block-panel algorithm modeled after that of the gemmlike
+// sandbox. Rather than writing X Y^T to C and then making separate passes
+// over C to add the norms and apply f, each microtile is computed into a
+// local buffer by the gemm microkernel and then finished (norms added, f
+// applied) and written to C while it is still in registers or the L1
+// cache. The k dimension is not partitioned into KC-sized blocks, so that
+// every microtile is complete after one microkernel call; instead, when k
+// exceeds KC, the MC and NC blocksizes are reduced proportionally so that
+// the packed blocks of X and Y occupy the same cache footprint as for gemm.
+//
+// bao_pdist_topk() instead computes, for each row x_i, the t columns j with
+// the smallest distances (ordered by increasing distance, with ties broken
+// in favor of the smaller index j) along with f applied to those distances.
+// Each microtile is merged into a per-row heap kept in the output matrices
+// as soon as it is computed, and so the full m x n distance matrix is never
+// formed in memory. (For the kernel functions, the t neighbors are those
+// with the largest kernel values, listed in decreasing order.) So that
+// every row is owned by one thread, bao_pdist_topk() parallelizes only
+// the m dimension.
+//
+// Only real datatypes are supported, and X, Y, and the outputs must share
+// the same datatype (except for the index matrix, which must be of type
+// BLIS_INT).
+//
+
+typedef enum
+{
+	BAO_SQEUCLIDEAN = 0, // f(d2) = d2
+	BAO_EUCLIDEAN,       // f(d2) = sqrt( d2 )
+	BAO_GAUSSIAN,        // f(d2) = exp( -d2 / h )
+	BAO_LAPLACIAN        // f(d2) = exp( -sqrt( d2 ) / h )
+} bao_pdist_func_t;
+
+//
+// -- Prototype the object API -------------------------------------------------
+//
+
+BLIS_EXPORT_ADDON void bao_pdist
+     (
+             bao_pdist_func_t func,
+       const obj_t*           h,
+       const obj_t*           x,
+       const obj_t*           y,
+       const obj_t*           c
+     );
+
+BLIS_EXPORT_ADDON void bao_pdist_ex
+     (
+             bao_pdist_func_t func,
+       const obj_t*           h,
+       const obj_t*           x,
+       const obj_t*           y,
+       const obj_t*           c,
+       const cntx_t*          cntx,
+       const rntm_t*          rntm
+     );
+
+BLIS_EXPORT_ADDON void bao_pdist_topk
+     (
+             bao_pdist_func_t func,
+       const obj_t*           h,
+       const obj_t*           x,
+       const obj_t*           y,
+       const obj_t*           dist,
+       const obj_t*           idx
+     );
+
+BLIS_EXPORT_ADDON void bao_pdist_topk_ex
+     (
+             bao_pdist_func_t func,
+       const obj_t*           h,
+       const obj_t*           x,
+       const obj_t*           y,
+       const obj_t*           dist,
+       const obj_t*           idx,
+       const cntx_t*          cntx,
+       const rntm_t*          rntm
+     );
+
+//
+// -- Prototype the typed API --------------------------------------------------
+//
+
+// The bandwidth h is referenced only by the kernel functions (BAO_GAUSSIAN
+// and BAO_LAPLACIAN) and may be NULL otherwise.
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_ADDON void PASTECH2(bao_,ch,opname) \
+     ( \
+             bao_pdist_func_t func, \
+             dim_t            m, \
+             dim_t            n, \
+             dim_t            k, \
+       const ctype*           h, \
+       const ctype*           x, inc_t rs_x, inc_t cs_x, \
+       const ctype*           y, inc_t rs_y, inc_t cs_y, \
+             ctype*           c, inc_t rs_c, inc_t cs_c  \
+     );
+
+GENTPROT( float,  s, pdist )
+GENTPROT( double, d, pdist )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_ADDON void PASTECH2(bao_,ch,opname) \
+     ( \
+             bao_pdist_func_t func, \
+             dim_t            m, \
+             dim_t            n, \
+             dim_t            k, \
+             dim_t            t, \
+       const ctype*           h, \
+       const ctype*           x,    inc_t rs_x,    inc_t cs_x, \
+       const ctype*           y,    inc_t rs_y,    inc_t cs_y, \
+             ctype*           dist, inc_t rs_dist, inc_t cs_dist, \
+             gint_t*          idx,  inc_t rs_idx,  inc_t cs_idx  \
+     );
+
+GENTPROT( float,  s, pdist_topk )
+GENTPROT( double, d, pdist_topk )
+
@@ -0,0 +1,516 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// The pdist block-panel algorithm. This variant mirrors the five-loop
+// algorithm of the gemmlike sandbox, with X and Y^T in the roles of A and
+// B, except that the k dimension is not partitioned (and so the pc loop is
+// absent). Each microtile of -2 X Y^T is therefore complete after a single
+// microkernel call, which computes it into a local buffer so that it may be
+// finished (or merged into the neighbor heaps) while it is still in cache.
+//
+
+typedef void (*norms_ft)
+     (
+             dim_t   m,
+             dim_t   k,
+       const void*   x, inc_t rs_x, inc_t cs_x,
+             void*   nrm,
+       const cntx_t* cntx
+     );
+
+typedef void (*tile_ft)
+     (
+             bao_pdist_func_t func,
+       const void*            h,
+             dim_t            m,
+             dim_t            n,
+       const void*            tile, inc_t rs_tile, inc_t cs_tile,
+       const void*            nrm_x,
+       const void*            nrm_y,
+             void*            c, inc_t rs_c, inc_t cs_c
+     );
+
+typedef void (*topk_init_ft)
+     (
+             dim_t   m,
+             dim_t   t,
+             void*   dist, inc_t rs_dist, inc_t cs_dist,
+             gint_t* idx,  inc_t rs_idx,  inc_t cs_idx
+     );
+
+typedef void (*topk_tile_ft)
+     (
+             dim_t   m,
+             dim_t   n,
+             dim_t   j_off,
+             dim_t   t,
+       const void*   tile, inc_t rs_tile, inc_t cs_tile,
+       const void*   nrm_x,
+       const void*   nrm_y,
+             void*   dist, inc_t rs_dist, inc_t cs_dist,
+             gint_t* idx,  inc_t rs_idx,  inc_t cs_idx
+     );
+
+typedef void (*topk_finish_ft)
+     (
+             bao_pdist_func_t func,
+       const void*            h,
+             dim_t            m,
+             dim_t            t,
+             void*            dist, inc_t rs_dist, inc_t cs_dist,
+             gint_t*          idx,  inc_t rs_idx,  inc_t cs_idx
+     );
+
+typedef void (*packm_var1_ft)
+     (
+       trans_t    transc,
+       pack_t     schema,
+       dim_t      m,
+       dim_t      n,
+       dim_t      m_max,
+       dim_t      n_max,
+       void*      kappa,
+       void*      c, inc_t rs_c, inc_t cs_c,
+       void*      p, inc_t rs_p, inc_t cs_p,
+                     dim_t pd_p, inc_t ps_p,
+       cntx_t*    cntx,
+       thrinfo_t* thread
+     );
+
+static packm_var1_ft GENARRAY(packm_var1_fp,packm_sup_var1);
+
+// Only the real datatypes are supported, so the complex entries are NULL.
+static norms_ft       norms_fp[ BLIS_NUM_FP_TYPES ]
+                      = { bao_spdist_norms,       NULL, bao_dpdist_norms,       NULL };
+static tile_ft        tile_fp[ BLIS_NUM_FP_TYPES ]
+                      = { bao_spdist_tile,        NULL, bao_dpdist_tile,        NULL };
+static topk_init_ft   topk_init_fp[ BLIS_NUM_FP_TYPES ]
+                      = { bao_spdist_topk_init,   NULL, bao_dpdist_topk_init,   NULL };
+static topk_tile_ft   topk_tile_fp[ BLIS_NUM_FP_TYPES ]
+                      = { bao_spdist_topk_tile,   NULL, bao_dpdist_topk_tile,   NULL };
+static topk_finish_ft topk_finish_fp[ BLIS_NUM_FP_TYPES ]
+                      = { bao_spdist_topk_finish, NULL, bao_dpdist_topk_finish, NULL };
+
+// Pack an mn x k matrix of points (whose elements are separated by inc
+// along the mn dimension and by ld along the k dimension) into consecutive
+// micropanels of mnr points each, partitioning the micropanels among the
+// threads of the packm thrinfo_t node. The points of X are packed to row
+// panels (the A operand of the microkernel), while those of Y are packed
+// to column panels of Y^T (the B operand). The packing buffer is acquired
+// from the pba and cached in the thrinfo_t node, where it persists across
+// calls. The panel stride is returned in units of elements.
+static void bao_pdist_packm
+     (
+             packbuf_t  pack_buf_type,
+             pack_t     schema,
+             num_t      dt,
+             dim_t      mn_alloc,
+             dim_t      mn,
+             dim_t      k,
+             dim_t      mnr,
+             dim_t      packmnr,
+       const void*      x, inc_t inc, inc_t ld,
+             char**     p, inc_t* ps_p,
+       const cntx_t*    cntx,
+             thrinfo_t* thread
+     )
+{
+	// Size the buffer for the largest block the caller expects to pack, so
+	// that it need not be re-acquired for edge cases.
+	const dim_t mn_pack = ( ( mn_alloc + mnr - 1 ) / mnr ) * packmnr;
+
+	bli_packm_sup_init_mem( TRUE, pack_buf_type, dt, mn_pack, k, 1, thread );
+
+	*p    = bli_mem_buffer( bli_thrinfo_mem( thread ) );
+	*ps_p = packmnr * k;
+
+	const double t_trace = bli_trace_pack_begin();
+
+	void* one = ( void* )bli_obj_buffer_for_const( dt, &BLIS_ONE );
+
+	if ( bli_is_row_packed( schema ) )
+	{
+		packm_var1_fp[ dt ]
+		(
+		  BLIS_NO_TRANSPOSE, schema,
+		  mn, k, mn, k,
+		  one,
+		  ( void* )x, inc, ld,
+		  *p, 1, packmnr,
+		  mnr, *ps_p,
+		  ( cntx_t* )cntx,
+		  bli_thrinfo_sub_prenode( thread )
+		);
+	}
+	else
+	{
+		packm_var1_fp[ dt ]
+		(
+		  BLIS_NO_TRANSPOSE, schema,
+		  k, mn, k, mn,
+		  one,
+		  ( void* )x, ld, inc,
+		  *p, packmnr, 1,
+		  mnr, *ps_p,
+		  ( cntx_t* )cntx,
+		  bli_thrinfo_sub_prenode( thread )
+		);
+	}
+
+	bli_trace_pack_end( t_trace );
+
+	// Barrier so that packing is done before computation.
+	bli_thrinfo_barrier( thread );
+}
+
+void bao_pdist_bp_var1
+     (
+       const bao_pdist_params_t* params,
+       const cntx_t*             cntx,
+             thrinfo_t*          thread
+     )
+{
+	const num_t            dt      = params->dt;
+	const siz_t            es      = bli_dt_size( dt );
+
+	const bao_pdist_func_t func    = params->func;
+	const void*            h       = params->h;
+
+	const dim_t            m       = params->m;
+	const dim_t            n       = params->n;
+	const dim_t            k       = params->k;
+	const dim_t            t       = params->t;
+
+	const char* restrict   x_00    = params->x;
+	const inc_t            rs_x    = params->rs_x;
+	const inc_t            cs_x    = params->cs_x;
+
+	const char* restrict   y_00    = params->y;
+	const inc_t            rs_y    = params->rs_y;
+	const inc_t            cs_y    = params->cs_y;
+
+	char* restrict         c_00    = params->c;
+	const inc_t            rs_c    = params->rs_c;
+	const inc_t            cs_c    = params->cs_c;
+
+	char* restrict         d_00    = params->dist;
+	const inc_t            rs_d    = params->rs_dist;
+	const inc_t            cs_d    = params->cs_dist;
+
+	gint_t* restrict       i_00    = params->idx;
+	const inc_t            rs_i    = params->rs_idx;
+	const inc_t            cs_i    = params->cs_idx;
+
+	char* restrict         nrm_x   = params->nrm_x;
+	char* restrict         nrm_y   = params->nrm_y;
+
+	const bool             is_topk = ( c_00 == NULL );
+
+	// Query the context for various blocksizes.
+	const dim_t NR = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t MR = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t NC = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx );
+	const dim_t MC = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx );
+	const dim_t KC = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx );
+
+	const dim_t PACKMR = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx );
+	const dim_t PACKNR = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx );
+
+	// Since the k dimension is not partitioned, reduce MC and NC when k
+	// exceeds KC so that the packed blocks of X and Y occupy (roughly) the
+	// same amount of cache as they would for gemm.
+	dim_t MC_use = MC;
+	dim_t NC_use = NC;
+
+	if ( KC < k )
+	{
+		MC_use = bli_max( MR, ( MC * KC / k ) / MR * MR );
+		NC_use = bli_max( NR, ( NC * KC / k ) / NR * NR );
+	}
+
+	// Query the context for the microkernel and its storage preference. The
+	// local microtile buffer is stored in the same orientation as C, so that
+	// the microtiles are finished with unit-stride loops, and otherwise in
+	// the orientation preferred by the microkernel.
+	gemm_ukr_ft gemm_ukr = bli_cntx_get_ukr_dt( dt, BLIS_GEMM_UKR, cntx );
+
+	const bool  row_pref = ( is_topk ? bli_cntx_ukr_prefers_rows_dt( dt, BLIS_GEMM_UKR, cntx )
+	                                 : bli_abs( cs_c ) <= bli_abs( rs_c ) );
+	const inc_t rs_ct    = ( row_pref ? NR : 1  );
+	const inc_t cs_ct    = ( row_pref ? 1  : MR );
+
+	char        ct[ BLIS_STACK_BUF_MAX_SIZE ]
+	            __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+
+	const void* minus_two = bli_obj_buffer_for_const( dt, &BLIS_MINUS_TWO );
+	const void* zero      = bli_obj_buffer_for_const( dt, &BLIS_ZERO );
+
+	// Save the pack schemas and microkernel address to the auxinfo_t object.
+	auxinfo_t aux;
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux );
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux );
+	bli_auxinfo_set_is_a( 1, &aux );
+	bli_auxinfo_set_is_b( 1, &aux );
+	bli_auxinfo_set_ukr( ( void_fp )gemm_ukr, &aux );
+	bli_auxinfo_set_params( NULL, &aux );
+
+	thrinfo_t* restrict thread_jc = bli_thrinfo_sub_node( thread );
+	thrinfo_t* restrict thread_pc = bli_thrinfo_sub_node( thread_jc );
+	thrinfo_t* restrict thread_pb = bli_thrinfo_sub_node( thread_pc );
+	thrinfo_t* restrict thread_ic = bli_thrinfo_sub_node( thread_pb );
+	thrinfo_t* restrict thread_pa = bli_thrinfo_sub_node( thread_ic );
+	thrinfo_t* restrict thread_jr = bli_thrinfo_sub_node( thread_pa );
+	thrinfo_t* restrict thread_ir = bli_thrinfo_sub_node( thread_jr );
+
+	// Compute the squared norms of the rows of X and Y, with the rows
+	// partitioned among all of the threads.
+	{
+		const dim_t nt  = bli_thrinfo_num_threads( thread );
+		const dim_t tid = bli_thrinfo_thread_id( thread );
+
+		const dim_t x_start = ( m *   tid       ) / nt;
+		const dim_t x_end   = ( m * ( tid + 1 ) ) / nt;
+		const dim_t y_start = ( n *   tid       ) / nt;
+		const dim_t y_end   = ( n * ( tid + 1 ) ) / nt;
+
+		norms_fp[ dt ]( x_end - x_start, k, x_00 + x_start * rs_x * es, rs_x, cs_x,
+		                nrm_x + x_start * es, cntx );
+		norms_fp[ dt ]( y_end - y_start, k, y_00 + y_start * rs_y * es, rs_y, cs_y,
+		                nrm_y + y_start * es, cntx );
+
+		bli_thrinfo_barrier( thread );
+	}
+
+	// Compute the IC loop thread range for the current thread. Note that
+	// when computing nearest neighbors, the ic loop is the only one that is
+	// parallelized, and so the current thread owns these rows.
+	dim_t ic_start, ic_end;
+	bli_thread_range_sub( thread_ic, m, MR, FALSE, &ic_start, &ic_end );
+
+	if ( is_topk )
+	{
+		topk_init_fp[ dt ]
+		(
+		  ic_end - ic_start, t,
+		  d_00 + ic_start * rs_d * es, rs_d, cs_d,
+		  i_00 + ic_start * rs_i,      rs_i, cs_i
+		);
+	}
+
+	// Compute the JC loop thread range for the current thread.
+	dim_t jc_start, jc_end;
+	bli_thread_range_sub( thread_jc, n, NR, FALSE, &jc_start, &jc_end );
+
+	// Loop over the n dimension (NC columns at a time).
+	for ( dim_t jj = jc_start; jj < jc_end; jj += NC_use )
+	{
+		const dim_t nc_cur = bli_min( NC_use, jc_end - jj );
+
+		char* b_use;
+		inc_t ps_b_use;
+
+		// Pack the current NC x k block of Y into column micropanels of
+		// Y^T.
+		bao_pdist_packm
+		(
+		  BLIS_BUFFER_FOR_B_PANEL,
+		  BLIS_PACKED_COL_PANELS,
+		  dt,
+		  NC_use, nc_cur, k,
+		  NR, PACKNR,
+		  y_00 + jj * rs_y * es, rs_y, cs_y,
+		  &b_use, &ps_b_use,
+		  cntx,
+		  thread_pb
+		);
+
+		char* restrict b_pc_use = b_use;
+
+		// Loop over the m dimension (MC rows at a time).
+		for ( dim_t ii = ic_start; ii < ic_end; ii += MC_use )
+		{
+			const dim_t mc_cur = bli_min( MC_use, ic_end - ii );
+
+			char* a_use;
+			inc_t ps_a_use;
+
+			// Pack the current MC x k block of X into row micropanels.
+			bao_pdist_packm
+			(
+			  BLIS_BUFFER_FOR_A_BLOCK,
+			  BLIS_PACKED_ROW_PANELS,
+			  dt,
+			  MC_use, mc_cur, k,
+			  MR, PACKMR,
+			  x_00 + ii * rs_x * es, rs_x, cs_x,
+			  &a_use, &ps_a_use,
+			  cntx,
+			  thread_pa
+			);
+
+			char* restrict a_ic_use = a_use;
+
+			// Query the number of threads and thread ids for the JR loop.
+			const dim_t jr_nt  = bli_thrinfo_n_way( thread_jr );
+			const dim_t jr_tid = bli_thrinfo_work_id( thread_jr );
+
+			// Compute number of primary and leftover components of the JR
+			// loop.
+			const dim_t jr_iter = ( nc_cur + NR - 1 ) / NR;
+			const dim_t jr_left =   nc_cur % NR;
+
+			// Compute the JR loop thread range for the current thread.
+			dim_t jr_start, jr_end;
+			bli_thread_range_sub( thread_jr, jr_iter, 1, FALSE, &jr_start, &jr_end );
+
+			// Loop over the n dimension (NR columns at a time).
+			for ( dim_t j = jr_start; j < jr_end; j += 1 )
+			{
+				const dim_t nr_cur
+				= ( bli_is_not_edge_f( j, jr_iter, jr_left ) ? NR : jr_left );
+
+				// The (absolute) index of the first column of the microtile.
+				const dim_t jt = jj + j * NR;
+
+				char* restrict b_jr = b_pc_use + j * ps_b_use * es;
+
+				// Assume for now that our next panel of B to be the current
+				// panel of B.
+				char* restrict b2 = b_jr;
+
+				// Query the number of threads and thread ids for the IR loop.
+				const dim_t ir_nt  = bli_thrinfo_n_way( thread_ir );
+				const dim_t ir_tid = bli_thrinfo_work_id( thread_ir );
+
+				// Compute number of primary and leftover components of the
+				// IR loop.
+				const dim_t ir_iter = ( mc_cur + MR - 1 ) / MR;
+				const dim_t ir_left =   mc_cur % MR;
+
+				// Compute the IR loop thread range for the current thread.
+				dim_t ir_start, ir_end;
+				bli_thread_range_sub( thread_ir, ir_iter, 1, FALSE, &ir_start, &ir_end );
+
+				// Loop over the m dimension (MR rows at a time).
+				for ( dim_t i = ir_start; i < ir_end; i += 1 )
+				{
+					const dim_t mr_cur
+					= ( bli_is_not_edge_f( i, ir_iter, ir_left ) ? MR : ir_left );
+
+					// The (absolute) index of the first row of the microtile.
+					const dim_t it = ii + i * MR;
+
+					char* restrict a_ir = a_ic_use + i * ps_a_use * es;
+
+					// Compute the addresses of the next micropanels of A and B.
+					char* restrict a2 = a_ir + ps_a_use * es;
+					if ( bli_is_last_iter_slrr( i, ir_end, ir_tid, ir_nt ) )
+					{
+						a2 = a_ic_use;
+						b2 = b_jr + ps_b_use * es;
+						if ( bli_is_last_iter_slrr( j, jr_end, jr_tid, jr_nt ) )
+							b2 = b_pc_use;
+					}
+
+					// Save the addresses of next micropanels of A and B to the
+					// auxinfo_t object.
+					bli_auxinfo_set_next_a( a2, &aux );
+					bli_auxinfo_set_next_b( b2, &aux );
+
+					// Compute the microtile of -2 X Y^T.
+					gemm_ukr
+					(
+					  mr_cur,
+					  nr_cur,
+					  k,
+					  ( void* )minus_two,
+					  a_ir,
+					  b_jr,
+					  ( void* )zero,
+					  ct, rs_ct, cs_ct,
+					  &aux,
+					  ( cntx_t* )cntx
+					);
+
+					if ( is_topk )
+					{
+						topk_tile_fp[ dt ]
+						(
+						  mr_cur, nr_cur, jt, t,
+						  ct, rs_ct, cs_ct,
+						  nrm_x + it * es,
+						  nrm_y + jt * es,
+						  d_00 + it * rs_d * es, rs_d, cs_d,
+						  i_00 + it * rs_i,      rs_i, cs_i
+						);
+					}
+					else
+					{
+						tile_fp[ dt ]
+						(
+						  func, h,
+						  mr_cur, nr_cur,
+						  ct, rs_ct, cs_ct,
+						  nrm_x + it * es,
+						  nrm_y + jt * es,
+						  c_00 + ( it * rs_c + jt * cs_c ) * es, rs_c, cs_c
+						);
+					}
+				}
+			}
+		}
+
+		// This barrier is needed to prevent threads from starting to pack
+		// the next block of Y before the current block is fully computed
+		// upon.
+		bli_thrinfo_barrier( thread_pb );
+	}
+
+	// Sort the neighbors of the rows owned by the current thread.
+	if ( is_topk )
+	{
+		topk_finish_fp[ dt ]
+		(
+		  func, h,
+		  ic_end - ic_start, t,
+		  d_00 + ic_start * rs_d * es, rs_d, cs_d,
+		  i_00 + ic_start * rs_i,      rs_i, cs_i
+		);
+	}
+}
+
@@ -0,0 +1,177 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Check the function, the bandwidth, and the point sets X and Y, whose rows
+// (after any transposition) must have the same length.
+static void bao_pdist_check_points
+     (
+             bao_pdist_func_t func,
+       const obj_t*           h,
+       const obj_t*           x,
+       const obj_t*           y
+     )
+{
+	err_t e_val;
+
+	if ( func != BAO_SQEUCLIDEAN && func != BAO_EUCLIDEAN &&
+	     func != BAO_GAUSSIAN    && func != BAO_LAPLACIAN )
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+
+	// Check object datatypes.
+
+	e_val = bli_check_real_object( x );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_object_datatypes( x, y );
+	bli_check_error_code( e_val );
+
+	// Check scalar/vector/matrix type.
+
+	e_val = bli_check_matrix_object( x );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( y );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions.
+
+	e_val = bli_check_object_width_equals( y, bli_obj_width_after_trans( x ) );
+	bli_check_error_code( e_val );
+
+	// Check object buffers (for non-NULLness).
+
+	e_val = bli_check_object_buffer( x );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( y );
+	bli_check_error_code( e_val );
+
+	// The kernel functions require a bandwidth.
+
+	if ( func == BAO_GAUSSIAN || func == BAO_LAPLACIAN )
+	{
+		e_val = bli_check_null_pointer( h );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_scalar_object( h );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_consistent_object_datatypes( x, h );
+		bli_check_error_code( e_val );
+	}
+}
+
+void bao_pdist_check
+     (
+             bao_pdist_func_t func,
+       const obj_t*           h,
+       const obj_t*           x,
+       const obj_t*           y,
+       const obj_t*           c
+     )
+{
+	err_t e_val;
+
+	bao_pdist_check_points( func, h, x, y );
+
+	e_val = bli_check_consistent_object_datatypes( x, c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_length_equals( c, bli_obj_length_after_trans( x ) );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_width_equals( c, bli_obj_length_after_trans( y ) );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( c );
+	bli_check_error_code( e_val );
+}
+
+void bao_pdist_topk_check
+     (
+             bao_pdist_func_t func,
+       const obj_t*           h,
+       const obj_t*           x,
+       const obj_t*           y,
+       const obj_t*           dist,
+       const obj_t*           idx
+     )
+{
+	err_t e_val;
+
+	bao_pdist_check_points( func, h, x, y );
+
+	// Check object datatypes.
+
+	e_val = bli_check_consistent_object_datatypes( x, dist );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_integer_object( idx );
+	bli_check_error_code( e_val );
+
+	// Check scalar/vector/matrix type.
+
+	e_val = bli_check_matrix_object( dist );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( idx );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions. The number of neighbors t (the width of
+	// dist and idx) may not exceed the number of points in Y.
+
+	e_val = bli_check_object_length_equals( dist, bli_obj_length_after_trans( x ) );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_conformal_dims( dist, idx );
+	bli_check_error_code( e_val );
+
+	if ( bli_obj_width_after_trans( dist ) > bli_obj_length_after_trans( y ) )
+		bli_check_error_code( BLIS_NONCONFORMAL_DIMENSIONS );
+
+	// Check object buffers (for non-NULLness).
+
+	e_val = bli_check_object_buffer( dist );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( idx );
+	bli_check_error_code( e_val );
+}
+
@@ -0,0 +1,348 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// The typed functions that finish the microtiles computed by the
+// block-panel algorithm. The neighbors of each row are kept in a max-heap
+// stored in the corresponding row of dist and idx, ordered by distance and
+// then by index, so that the root holds the farthest of the current
+// neighbors. Since the columns of each row are visited in increasing order,
+// a candidate replaces the root only if it is strictly closer, which breaks
+// ties in favor of smaller indices independently of the blocking.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, sqrtfn, expfn ) \
+\
+BLIS_INLINE ctype PASTECH2(bao_,ch,opname) \
+     ( \
+       bao_pdist_func_t func, \
+       ctype            rh, \
+       ctype            d2  \
+     ) \
+{ \
+	switch ( func ) \
+	{ \
+		case BAO_EUCLIDEAN:  return sqrtfn( d2 ); \
+		case BAO_GAUSSIAN:   return expfn( -d2 * rh ); \
+		case BAO_LAPLACIAN:  return expfn( -sqrtfn( d2 ) * rh ); \
+		default:             return d2; \
+	} \
+}
+
+GENTFUNC( float,  s, pdist_apply, sqrtf, expf )
+GENTFUNC( double, d, pdist_apply, sqrt,  exp  )
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTECH2(bao_,ch,opname) \
+     ( \
+       dim_t   p, \
+       dim_t   size, \
+       ctype*  d, inc_t incd, \
+       gint_t* ix, inc_t incx  \
+     ) \
+{ \
+	/* Sift element p of the heap down until neither of its children is
+	   greater. */ \
+	while ( TRUE ) \
+	{ \
+		const dim_t l = 2*p + 1; \
+		const dim_t r = l + 1; \
+\
+		if ( size <= l ) break; \
+\
+		dim_t g = l; \
+		if ( r < size && \
+		     ( d[ r*incd ] > d[ l*incd ] || \
+		       ( d[ r*incd ] == d[ l*incd ] && ix[ r*incx ] > ix[ l*incx ] ) ) ) \
+			g = r; \
+\
+		if ( d[ g*incd ] < d[ p*incd ] || \
+		     ( d[ g*incd ] == d[ p*incd ] && ix[ g*incx ] < ix[ p*incx ] ) ) \
+			break; \
+\
+		const ctype  dp = d[ p*incd ];  d[ p*incd ]  = d[ g*incd ];  d[ g*incd ]  = dp; \
+		const gint_t ip = ix[ p*incx ]; ix[ p*incx ] = ix[ g*incx ]; ix[ g*incx ] = ip; \
+\
+		p = g; \
+	} \
+}
+
+GENTFUNC( float,  s, pdist_sift_down )
+GENTFUNC( double, d, pdist_sift_down )
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t   m, \
+             dim_t   k, \
+       const void*   x, inc_t rs_x, inc_t cs_x, \
+             void*   nrm, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const num_t  dt     = PASTEMAC(ch,type); \
+	const ctype* x_cast = x; \
+	      ctype* n_cast = nrm; \
+\
+	dotv_ker_ft kfp_dv = bli_cntx_get_ukr_dt( dt, BLIS_DOTV_KER, cntx ); \
+\
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		const ctype* xi = x_cast + i*rs_x; \
+\
+		kfp_dv \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  BLIS_NO_CONJUGATE, \
+		  k, \
+		  ( ctype* )xi, cs_x, \
+		  ( ctype* )xi, cs_x, \
+		  n_cast + i, \
+		  ( cntx_t* )cntx  \
+		); \
+	} \
+}
+
+GENTFUNC( float,  s, pdist_norms )
+GENTFUNC( double, d, pdist_norms )
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+BLIS_INLINE void PASTECH2(bao_,ch,opname) \
+     ( \
+             bao_pdist_func_t func, \
+             ctype            rh, \
+             dim_t            m, \
+             dim_t            n, \
+       const ctype*  restrict tile, inc_t rs_tile, inc_t cs_tile, \
+       const ctype*  restrict nrm_x, \
+       const ctype*  restrict nrm_y, \
+             ctype*  restrict c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	for ( dim_t i = 0; i < m; ++i ) \
+	for ( dim_t j = 0; j < n; ++j ) \
+	{ \
+		/* Guard against small negative values due to cancellation. */ \
+		ctype d2 = tile[ i*rs_tile + j*cs_tile ] + nrm_x[ i ] + nrm_y[ j ]; \
+		d2 = ( d2 < 0.0 ? 0.0 : d2 ); \
+\
+		c[ i*rs_c + j*cs_c ] = PASTECH2(bao_,ch,pdist_apply)( func, rh, d2 ); \
+	} \
+}
+
+GENTFUNC( float,  s, pdist_tile_loop )
+GENTFUNC( double, d, pdist_tile_loop )
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             bao_pdist_func_t func, \
+       const void*            h, \
+             dim_t            m, \
+             dim_t            n, \
+       const void*            tile, inc_t rs_tile, inc_t cs_tile, \
+       const void*            nrm_x, \
+       const void*            nrm_y, \
+             void*            c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	const ctype* t_cast = tile; \
+	const ctype* x_cast = nrm_x; \
+	const ctype* y_cast = nrm_y; \
+	      ctype* c_cast = c; \
+\
+	const ctype rh = ( h != NULL ? 1.0 / *( const ctype* )h : 1.0 ); \
+\
+	/* Traverse the tile so that the inner loop walks C with its smaller
+	   stride, viewing the tile as transposed if C is stored by columns. */ \
+	if ( bli_abs( rs_c ) < bli_abs( cs_c ) ) \
+	{ \
+		bli_swap_dims( &m, &n ); \
+		bli_swap_incs( &rs_tile, &cs_tile ); \
+		bli_swap_incs( &rs_c, &cs_c ); \
+		const ctype* tmp = x_cast; x_cast = y_cast; y_cast = tmp; \
+	} \
+\
+	/* Expand the loop for each function (and for the common case of
+	   unit-stride rows) so that the function is not selected for each
+	   element. */ \
+	const bool unit = ( cs_tile == 1 && cs_c == 1 ); \
+\
+	switch ( func ) \
+	{ \
+		case BAO_SQEUCLIDEAN: \
+			if ( unit ) PASTECH2(bao_,ch,pdist_tile_loop)( BAO_SQEUCLIDEAN, rh, m, n, t_cast, rs_tile, 1, x_cast, y_cast, c_cast, rs_c, 1 ); \
+			else        PASTECH2(bao_,ch,pdist_tile_loop)( BAO_SQEUCLIDEAN, rh, m, n, t_cast, rs_tile, cs_tile, x_cast, y_cast, c_cast, rs_c, cs_c ); \
+			break; \
+		case BAO_EUCLIDEAN: \
+			if ( unit ) PASTECH2(bao_,ch,pdist_tile_loop)( BAO_EUCLIDEAN, rh, m, n, t_cast, rs_tile, 1, x_cast, y_cast, c_cast, rs_c, 1 ); \
+			else        PASTECH2(bao_,ch,pdist_tile_loop)( BAO_EUCLIDEAN, rh, m, n, t_cast, rs_tile, cs_tile, x_cast, y_cast, c_cast, rs_c, cs_c ); \
+			break; \
+		case BAO_GAUSSIAN: \
+			if ( unit ) PASTECH2(bao_,ch,pdist_tile_loop)( BAO_GAUSSIAN, rh, m, n, t_cast, rs_tile, 1, x_cast, y_cast, c_cast, rs_c, 1 ); \
+			else        PASTECH2(bao_,ch,pdist_tile_loop)( BAO_GAUSSIAN, rh, m, n, t_cast, rs_tile, cs_tile, x_cast, y_cast, c_cast, rs_c, cs_c ); \
+			break; \
+		case BAO_LAPLACIAN: \
+			if ( unit ) PASTECH2(bao_,ch,pdist_tile_loop)( BAO_LAPLACIAN, rh, m, n, t_cast, rs_tile, 1, x_cast, y_cast, c_cast, rs_c, 1 ); \
+			else        PASTECH2(bao_,ch,pdist_tile_loop)( BAO_LAPLACIAN, rh, m, n, t_cast, rs_tile, cs_tile, x_cast, y_cast, c_cast, rs_c, cs_c ); \
+			break; \
+	} \
+}
+
+GENTFUNC( float,  s, pdist_tile )
+GENTFUNC( double, d, pdist_tile )
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t   m, \
+             dim_t   t, \
+             void*   dist, inc_t rs_dist, inc_t cs_dist, \
+             gint_t* idx,  inc_t rs_idx,  inc_t cs_idx  \
+     ) \
+{ \
+	ctype* d_cast = dist; \
+\
+	for ( dim_t i = 0; i < m; ++i ) \
+	for ( dim_t l = 0; l < t; ++l ) \
+	{ \
+		d_cast[ i*rs_dist + l*cs_dist ] = ( ctype )INFINITY; \
+		idx[ i*rs_idx + l*cs_idx ] = -1; \
+	} \
+}
+
+GENTFUNC( float,  s, pdist_topk_init )
+GENTFUNC( double, d, pdist_topk_init )
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   j_off, \
+             dim_t   t, \
+       const void*   tile, inc_t rs_tile, inc_t cs_tile, \
+       const void*   nrm_x, \
+       const void*   nrm_y, \
+             void*   dist, inc_t rs_dist, inc_t cs_dist, \
+             gint_t* idx,  inc_t rs_idx,  inc_t cs_idx  \
+     ) \
+{ \
+	const ctype* restrict t_cast = tile; \
+	const ctype* restrict x_cast = nrm_x; \
+	const ctype* restrict y_cast = nrm_y; \
+	      ctype*          d_cast = dist; \
+\
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		ctype*  di = d_cast + i*rs_dist; \
+		gint_t* ii = idx    + i*rs_idx; \
+\
+		for ( dim_t j = 0; j < n; ++j ) \
+		{ \
+			ctype d2 = t_cast[ i*rs_tile + j*cs_tile ] + x_cast[ i ] + y_cast[ j ]; \
+			d2 = bli_max( d2, 0.0 ); \
+\
+			/* Replace the farthest neighbor (the root of the heap) if the
+			   candidate is strictly closer. */ \
+			if ( d2 < di[ 0 ] ) \
+			{ \
+				di[ 0 ] = d2; \
+				ii[ 0 ] = j_off + j; \
+\
+				PASTECH2(bao_,ch,pdist_sift_down)( 0, t, di, cs_dist, ii, cs_idx ); \
+			} \
+		} \
+	} \
+}
+
+GENTFUNC( float,  s, pdist_topk_tile )
+GENTFUNC( double, d, pdist_topk_tile )
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             bao_pdist_func_t func, \
+       const void*            h, \
+             dim_t            m, \
+             dim_t            t, \
+             void*            dist, inc_t rs_dist, inc_t cs_dist, \
+             gint_t*          idx,  inc_t rs_idx,  inc_t cs_idx  \
+     ) \
+{ \
+	ctype* d_cast = dist; \
+\
+	const ctype rh = ( h != NULL ? 1.0 / *( const ctype* )h : 1.0 ); \
+\
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		ctype*  di = d_cast + i*rs_dist; \
+		gint_t* ii = idx    + i*rs_idx; \
+\
+		/* Sort the heap in place by repeatedly moving its root (the
+		   farthest remaining neighbor) to the end. */ \
+		for ( dim_t l = t - 1; 0 < l; --l ) \
+		{ \
+			const ctype  d0 = di[ 0 ]; di[ 0 ] = di[ l*cs_dist ]; di[ l*cs_dist ] = d0; \
+			const gint_t i0 = ii[ 0 ]; ii[ 0 ] = ii[ l*cs_idx ];  ii[ l*cs_idx ]  = i0; \
+\
+			PASTECH2(bao_,ch,pdist_sift_down)( 0, l, di, cs_dist, ii, cs_idx ); \
+		} \
+\
+		for ( dim_t l = 0; l < t; ++l ) \
+			di[ l*cs_dist ] = PASTECH2(bao_,ch,pdist_apply)( func, rh, di[ l*cs_dist ] ); \
+	} \
+}
+
+GENTFUNC( float,  s, pdist_topk_finish )
+GENTFUNC( double, d, pdist_topk_finish )
+
@@ -0,0 +1,168 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// The parameters of a pdist (or pdist_topk) operation, shared by all
+// threads. X (m x k) and Y (n x k) hold the points as rows. If c is NULL,
+// the t nearest neighbors of each row of X are stored to dist and idx
+// instead of the full matrix C. The squared norms of the rows of X and Y
+// are computed by the threads into the nrm_x and nrm_y buffers.
+//
+
+typedef struct
+{
+	num_t            dt;
+	bao_pdist_func_t func;
+	const void*      h;
+
+	dim_t            m;
+	dim_t            n;
+	dim_t            k;
+	dim_t            t;
+
+	const void*      x;    inc_t rs_x;    inc_t cs_x;
+	const void*      y;    inc_t rs_y;    inc_t cs_y;
+	      void*      c;    inc_t rs_c;    inc_t cs_c;
+	      void*      dist; inc_t rs_dist; inc_t cs_dist;
+	      gint_t*    idx;  inc_t rs_idx;  inc_t cs_idx;
+
+	      void*      nrm_x;
+	      void*      nrm_y;
+} bao_pdist_params_t;
+
+//
+// Prototype the block-panel algorithm.
+//
+
+void bao_pdist_bp_var1
+     (
+       const bao_pdist_params_t* params,
+       const cntx_t*             cntx,
+             thrinfo_t*          thread
+     );
+
+//
+// Prototype the typed functions used by the block-panel algorithm.
+//
+
+// Compute the squared norms of the m rows of X.
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t   m, \
+             dim_t   k, \
+       const void*   x, inc_t rs_x, inc_t cs_x, \
+             void*   nrm, \
+       const cntx_t* cntx  \
+     );
+
+GENTPROT( float,  s, pdist_norms )
+GENTPROT( double, d, pdist_norms )
+
+// Finish an m x n microtile of -2 X Y^T by adding the squared norms of the
+// corresponding rows of X and Y and applying f, storing the result to C.
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             bao_pdist_func_t func, \
+       const void*            h, \
+             dim_t            m, \
+             dim_t            n, \
+       const void*            tile, inc_t rs_tile, inc_t cs_tile, \
+       const void*            nrm_x, \
+       const void*            nrm_y, \
+             void*            c, inc_t rs_c, inc_t cs_c  \
+     );
+
+GENTPROT( float,  s, pdist_tile )
+GENTPROT( double, d, pdist_tile )
+
+// Initialize the neighbor heaps of m rows (with t entries each).
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t   m, \
+             dim_t   t, \
+             void*   dist, inc_t rs_dist, inc_t cs_dist, \
+             gint_t* idx,  inc_t rs_idx,  inc_t cs_idx  \
+     );
+
+GENTPROT( float,  s, pdist_topk_init )
+GENTPROT( double, d, pdist_topk_init )
+
+// Merge an m x n microtile of -2 X Y^T, whose first column corresponds to
+// row j_off of Y, into the neighbor heaps of its m rows.
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   j_off, \
+             dim_t   t, \
+       const void*   tile, inc_t rs_tile, inc_t cs_tile, \
+       const void*   nrm_x, \
+       const void*   nrm_y, \
+             void*   dist, inc_t rs_dist, inc_t cs_dist, \
+             gint_t* idx,  inc_t rs_idx,  inc_t cs_idx  \
+     );
+
+GENTPROT( float,  s, pdist_topk_tile )
+GENTPROT( double, d, pdist_topk_tile )
+
+// Sort the neighbor heaps of m rows by increasing distance and apply f.
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             bao_pdist_func_t func, \
+       const void*            h, \
+             dim_t            m, \
+             dim_t            t, \
+             void*            dist, inc_t rs_dist, inc_t cs_dist, \
+             gint_t*          idx,  inc_t rs_idx,  inc_t cs_idx  \
+     );
+
+GENTPROT( float,  s, pdist_topk_finish )
+GENTPROT( double, d, pdist_topk_finish )
+
@@ -0,0 +1,494 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// -- Tensor creation ----------------------------------------------------------
+//
+
+void bao_tensor_create
+     (
+             num_t         dt,
+             dim_t         ndim,
+       const dim_t*        len,
+             bao_tensor_t* t
+     )
+{
+	err_t r_val;
+
+	bao_tensor_create_with_attached_buffer( dt, ndim, len, NULL, NULL, t );
+
+	// Allocate at least one element so that the buffer is never NULL.
+	const siz_t size = bli_max( bao_tensor_size( t ), 1 ) * bli_dt_size( dt );
+
+	t->buffer = bli_malloc_user( size, &r_val );
+}
+
+void bao_tensor_create_with_attached_buffer
+     (
+             num_t         dt,
+             dim_t         ndim,
+       const dim_t*        len,
+       const inc_t*        stride,
+             void*         buffer,
+             bao_tensor_t* t
+     )
+{
+	bli_init_once();
+
+	if ( bli_error_checking_is_enabled() )
+	{
+		if ( ndim < 0 || BAO_TENSOR_MAX_NDIM < ndim )
+			bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+
+		for ( dim_t d = 0; d < ndim; ++d )
+			if ( len[ d ] < 0 )
+				bli_check_error_code( BLIS_NEGATIVE_DIMENSION );
+	}
+
+	t->dt     = dt;
+	t->ndim   = ndim;
+	t->buffer = buffer;
+
+	inc_t s = 1;
+
+	for ( dim_t d = 0; d < ndim; ++d )
+	{
+		t->len[ d ]    = len[ d ];
+		t->stride[ d ] = ( stride != NULL ? stride[ d ] : s );
+
+		s *= bli_max( len[ d ], 1 );
+	}
+}
+
+void bao_tensor_free
+     (
+       bao_tensor_t* t
+     )
+{
+	bli_free_user( t->buffer );
+
+	t->buffer = NULL;
+}
+
+dim_t bao_tensor_size
+     (
+       const bao_tensor_t* t
+     )
+{
+	dim_t size = 1;
+
+	for ( dim_t d = 0; d < t->ndim; ++d )
+		size *= t->len[ d ];
+
+	return size;
+}
+
+//
+// -- Tensor contraction -------------------------------------------------------
+//
+
+// A group of indices (the m, n, or k dimension of the contraction), each with
+// its length and its strides within the two tensors that share it.
+typedef struct
+{
+	dim_t ndim;
+	dim_t len[ BAO_TENSOR_MAX_NDIM ];
+	inc_t stride[ 2 ][ BAO_TENSOR_MAX_NDIM ];
+} bao_tcontract_group_t;
+
+static void bao_tcontract_group_add
+     (
+       dim_t                  len,
+       inc_t                  stride0,
+       inc_t                  stride1,
+       bao_tcontract_group_t* g
+     )
+{
+	// Indices of unit length do not affect the contraction.
+	if ( len == 1 ) return;
+
+	g->len[ g->ndim ]         = len;
+	g->stride[ 0 ][ g->ndim ] = stride0;
+	g->stride[ 1 ][ g->ndim ] = stride1;
+	g->ndim += 1;
+}
+
+static bool bao_tcontract_group_has_unit_stride
+     (
+       dim_t                        t,
+       const bao_tcontract_group_t* g
+     )
+{
+	for ( dim_t d = 0; d < g->ndim; ++d )
+		if ( bli_abs( g->stride[ t ][ d ] ) == 1 ) return TRUE;
+
+	return FALSE;
+}
+
+static void bao_tcontract_group_swap
+     (
+       dim_t                  d0,
+       dim_t                  d1,
+       bao_tcontract_group_t* g
+     )
+{
+	dim_t len            = g->len[ d0 ];
+	inc_t s0             = g->stride[ 0 ][ d0 ];
+	inc_t s1             = g->stride[ 1 ][ d0 ];
+
+	g->len[ d0 ]         = g->len[ d1 ];
+	g->stride[ 0 ][ d0 ] = g->stride[ 0 ][ d1 ];
+	g->stride[ 1 ][ d0 ] = g->stride[ 1 ][ d1 ];
+
+	g->len[ d1 ]         = len;
+	g->stride[ 0 ][ d1 ] = s0;
+	g->stride[ 1 ][ d1 ] = s1;
+}
+
+// Order the indices of a group by increasing stride within one of its two
+// tensors (preferring the tensor in which the group has a unit stride, and
+// otherwise the first tensor), and then fold together adjacent indices that
+// are laid out contiguously with respect to one another in both tensors.
+// The fewer (and longer) indices that remain, the fewer the boundaries at
+// which the block-scatter vectors become irregular.
+static void bao_tcontract_group_fold
+     (
+       bao_tcontract_group_t* g
+     )
+{
+	const dim_t t = ( !bao_tcontract_group_has_unit_stride( 0, g ) &&
+	                   bao_tcontract_group_has_unit_stride( 1, g ) ? 1 : 0 );
+
+	for ( dim_t i = 1; i < g->ndim; ++i )
+	for ( dim_t d = i; d > 0; --d )
+	{
+		if ( bli_abs( g->stride[ t ][ d - 1 ] ) <=
+		     bli_abs( g->stride[ t ][ d     ] ) ) break;
+
+		bao_tcontract_group_swap( d - 1, d, g );
+	}
+
+	dim_t ndim = 0;
+
+	for ( dim_t d = 0; d < g->ndim; ++d )
+	{
+		if ( ndim > 0 &&
+		     g->stride[ 0 ][ d ] == g->stride[ 0 ][ ndim - 1 ] * g->len[ ndim - 1 ] &&
+		     g->stride[ 1 ][ d ] == g->stride[ 1 ][ ndim - 1 ] * g->len[ ndim - 1 ] )
+		{
+			g->len[ ndim - 1 ] *= g->len[ d ];
+			continue;
+		}
+
+		g->len[ ndim ]         = g->len[ d ];
+		g->stride[ 0 ][ ndim ] = g->stride[ 0 ][ d ];
+		g->stride[ 1 ][ ndim ] = g->stride[ 1 ][ d ];
+		ndim += 1;
+	}
+
+	// An empty group is represented by a single index of unit length (and
+	// unit stride).
+	if ( ndim == 0 )
+	{
+		g->len[ 0 ]         = 1;
+		g->stride[ 0 ][ 0 ] = 1;
+		g->stride[ 1 ][ 0 ] = 1;
+		ndim = 1;
+	}
+
+	g->ndim = ndim;
+}
+
+static dim_t bao_tcontract_group_size
+     (
+       const bao_tcontract_group_t* g
+     )
+{
+	dim_t size = 1;
+
+	for ( dim_t d = 0; d < g->ndim; ++d )
+		size *= g->len[ d ];
+
+	return size;
+}
+
+static dim_t bao_tcontract_find_index
+     (
+       char        index,
+       const char* idx
+     )
+{
+	for ( dim_t d = 0; idx[ d ] != '\0'; ++d )
+		if ( idx[ d ] == index ) return d;
+
+	return -1;
+}
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t  m, \
+             dim_t  n, \
+       const void*  beta, \
+             void*  y, const inc_t* rscat_y, const inc_t* cscat_y \
+     ) \
+{ \
+	const ctype* restrict b_cast = beta; \
+	      ctype* restrict y_cast = y; \
+\
+	if ( PASTEMAC(ch,eq1)( *b_cast ) ) return; \
+\
+	if ( PASTEMAC(ch,eq0)( *b_cast ) ) \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+			PASTEMAC(ch,set0s)( y_cast[ rscat_y[ i ] + cscat_y[ j ] ] ); \
+	} \
+	else \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+			PASTEMAC(ch,scals)( *b_cast, y_cast[ rscat_y[ i ] + cscat_y[ j ] ] ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( tcontract_scalm )
+
+typedef void (*bao_tcontract_scalm_vft)
+     (
+             dim_t  m,
+             dim_t  n,
+       const void*  beta,
+             void*  y, const inc_t* rscat_y, const inc_t* cscat_y
+     );
+
+static bao_tcontract_scalm_vft GENARRAY_PREF( scalm_fp, bao_, tcontract_scalm );
+
+// Scale the tensor C by beta, where the m and n groups describe the matrix
+// view of C (via the second stride of each group).
+static void bao_tcontract_scalm
+     (
+       const obj_t*                 beta,
+       const bao_tensor_t*          c,
+       const bao_tcontract_group_t* gm,
+       const bao_tcontract_group_t* gn
+     )
+{
+	err_t       r_val;
+
+	const dim_t m     = bao_tcontract_group_size( gm );
+	const dim_t n     = bao_tcontract_group_size( gn );
+	inc_t*      rscat = bli_malloc_intl( 2 * ( m + n ) * sizeof( inc_t ), &r_val );
+	inc_t*      rbs   = rscat + m;
+	inc_t*      cscat = rbs   + m;
+	inc_t*      cbs   = cscat + n;
+
+	bao_tcontract_fill_scatter( gm->ndim, gm->len, gm->stride[ 1 ], m, 0, m, rscat, rbs );
+	bao_tcontract_fill_scatter( gn->ndim, gn->len, gn->stride[ 1 ], n, 0, n, cscat, cbs );
+
+	// Typecast beta to the datatype of C.
+	obj_t beta_local;
+	bli_obj_scalar_init_detached( c->dt, &beta_local );
+	bli_copysc( beta, &beta_local );
+
+	scalm_fp[ c->dt ]
+	(
+	  m, n,
+	  bli_obj_buffer_at_off( &beta_local ),
+	  c->buffer, rscat, cscat
+	);
+
+	bli_free_intl( rscat );
+}
+
+void bao_tcontract
+     (
+       const obj_t*        alpha,
+       const bao_tensor_t* a, const char* idx_a,
+       const bao_tensor_t* b, const char* idx_b,
+       const obj_t*        beta,
+       const bao_tensor_t* c, const char* idx_c
+     )
+{
+	bao_tcontract_ex( alpha, a, idx_a, b, idx_b, beta, c, idx_c, NULL, NULL );
+}
+
+void bao_tcontract_ex
+     (
+       const obj_t*        alpha,
+       const bao_tensor_t* a, const char* idx_a,
+       const bao_tensor_t* b, const char* idx_b,
+       const obj_t*        beta,
+       const bao_tensor_t* c, const char* idx_c,
+       const cntx_t*       cntx,
+       const rntm_t*       rntm
+     )
+{
+	bli_init_once();
+
+	// Check the operands.
+	if ( bli_error_checking_is_enabled() )
+		bao_tcontract_check( alpha, a, idx_a, b, idx_b, beta, c, idx_c );
+
+	// Obtain a valid (native) context from the gks if necessary. Note that
+	// induced methods are never used, since the packm variant only produces
+	// the native packing format.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	const num_t dt = c->dt;
+
+	// Sort the indices into the m (A and C), n (B and C), and k (A and B)
+	// groups.
+	bao_tcontract_group_t gm = { 0 };
+	bao_tcontract_group_t gn = { 0 };
+	bao_tcontract_group_t gk = { 0 };
+
+	for ( dim_t d = 0; d < a->ndim; ++d )
+	{
+		const dim_t dc = bao_tcontract_find_index( idx_a[ d ], idx_c );
+		const dim_t db = bao_tcontract_find_index( idx_a[ d ], idx_b );
+
+		if ( dc >= 0 ) bao_tcontract_group_add( a->len[ d ], a->stride[ d ], c->stride[ dc ], &gm );
+		else           bao_tcontract_group_add( a->len[ d ], a->stride[ d ], b->stride[ db ], &gk );
+	}
+
+	for ( dim_t d = 0; d < b->ndim; ++d )
+	{
+		const dim_t dc = bao_tcontract_find_index( idx_b[ d ], idx_c );
+
+		if ( dc >= 0 ) bao_tcontract_group_add( b->len[ d ], b->stride[ d ], c->stride[ dc ], &gn );
+	}
+
+	bao_tcontract_group_fold( &gm );
+	bao_tcontract_group_fold( &gn );
+	bao_tcontract_group_fold( &gk );
+
+	const dim_t m = bao_tcontract_group_size( &gm );
+	const dim_t n = bao_tcontract_group_size( &gn );
+	const dim_t k = bao_tcontract_group_size( &gk );
+
+	// If C is empty, return early.
+	if ( m == 0 || n == 0 ) return;
+
+	// If alpha is zero or the k dimension is empty, scale C by beta and
+	// return early.
+	if ( k == 0 || bli_obj_equals( alpha, &BLIS_ZERO ) )
+	{
+		bao_tcontract_scalm( beta, c, &gm, &gn );
+		return;
+	}
+
+	// The contraction C = A * B is equivalent to C^T = B^T * A^T. If the
+	// microkernel prefers to access C by rows (columns), but C has a unit
+	// stride only among the m (n) indices, we swap the roles of A and B (and
+	// thus those of m and n) so that the microkernel can update C in its
+	// preferred manner. (This is the analogue of the transposition that
+	// bli_gemm_front() would otherwise apply based on the storage of C.)
+	const bool row_pref = bli_cntx_ukr_prefers_rows_dt( dt, BLIS_GEMM_VIR_UKR, cntx );
+	const bool unit_m_c = bao_tcontract_group_has_unit_stride( 1, &gm );
+	const bool unit_n_c = bao_tcontract_group_has_unit_stride( 1, &gn );
+
+	const bao_tcontract_group_t* gm_use = &gm;
+	const bao_tcontract_group_t* gn_use = &gn;
+	const bao_tensor_t*          a_use  = a;
+	const bao_tensor_t*          b_use  = b;
+	      dim_t                  m_use  = m;
+	      dim_t                  n_use  = n;
+	      dim_t                  ka     = 0;
+
+	if ( (  row_pref && unit_m_c && !unit_n_c ) ||
+	     ( !row_pref && unit_n_c && !unit_m_c ) )
+	{
+		gm_use = &gn; gn_use = &gm;
+		a_use  = b;   b_use  = a;
+		m_use  = n;   n_use  = m;
+		ka     = 1;
+	}
+
+	// Describe the matrix view of each tensor to the packm variant and the
+	// macrokernel. Note that the k group holds the strides of the original
+	// A and B in that order.
+	bao_tcontract_params_t params_a =
+	{
+	  gm_use->ndim, gm_use->len, gm_use->stride[ 0 ],
+	  gk.ndim,      gk.len,      gk.stride[ ka ]
+	};
+	bao_tcontract_params_t params_b =
+	{
+	  gn_use->ndim, gn_use->len, gn_use->stride[ 0 ],
+	  gk.ndim,      gk.len,      gk.stride[ 1 - ka ]
+	};
+	bao_tcontract_params_t params_c =
+	{
+	  gm_use->ndim, gm_use->len, gm_use->stride[ 1 ],
+	  gn_use->ndim, gn_use->len, gn_use->stride[ 1 ]
+	};
+
+	// Create matrix objects for the tensors. The strides of these objects
+	// are never used to locate elements, since the packm variant and the
+	// macrokernel use the parameters above; they are chosen only to be valid
+	// and (in the case of C) to match the preference of the microkernel, so
+	// that bli_gemm_front() does not transpose the operation.
+	obj_t ao, bo, co;
+
+	bli_obj_create_with_attached_buffer( dt, m_use, k, a_use->buffer, 1, m_use, &ao );
+	bli_obj_create_with_attached_buffer( dt, k, n_use, b_use->buffer, 1, k,     &bo );
+
+	if ( row_pref ) bli_obj_create_with_attached_buffer( dt, m_use, n_use, c->buffer, n_use, 1, &co );
+	else            bli_obj_create_with_attached_buffer( dt, m_use, n_use, c->buffer, 1, m_use, &co );
+
+	bli_obj_set_pack_fn( bao_tcontract_packm, &ao );
+	bli_obj_set_pack_fn( bao_tcontract_packm, &bo );
+	bli_obj_set_pack_params( &params_a, &ao );
+	bli_obj_set_pack_params( &params_b, &bo );
+	bli_obj_set_ker_fn( bao_tcontract_ker, &co );
+	bli_obj_set_ker_params( &params_c, &co );
+
+	// Initialize a local runtime with global settings if necessary, and
+	// disable the sup implementation, which does not use the packm variant
+	// and macrokernel above.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); }
+	else                { rntm_l = *rntm;                       }
+
+	bli_rntm_disable_l3_sup( &rntm_l );
+
+	bli_gemm_ex( alpha, &ao, &bo, beta, &co, cntx, &rntm_l );
+}
+
@@ -0,0 +1,133 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Tensor contraction without explicit transposition:
+//
+//   C[idx_c] := beta * C[idx_c] + alpha * sum_k A[idx_a] * B[idx_b]
+//
+// where each tensor is described by its lengths and (arbitrary) strides and
+// each of its dimensions is labeled by one character of the corresponding
+// index string. Every index must appear in exactly two of the three index
+// strings: indices shared by A and C form the m dimension of the contraction,
+// indices shared by B and C form the n dimension, and indices shared by A
+// and B form the k dimension (which is summed over). For example, the
+// contraction C_{abcd} = sum_{ef} A_{aebf} B_{dfce} is requested with the
+// index strings "aebf", "dfce", and "abcd".
+//
+// The contraction is computed by the conventional gemm implementation,
+// with each tensor viewed as a matrix whose rows and columns enumerate the
+// corresponding groups of indices. Rather than permuting the tensors into
+// matrices (which reads and writes each operand an additional time), the
+// packing and macrokernel stages locate the elements of each block via
+// scatter vectors, which hold the offset of every row and column of the
+// current block, and block-scatter vectors, which hold the common stride of
+// each group of consecutive rows or columns (or zero if their offsets are
+// not evenly spaced). Wherever a group of rows and columns has a regular
+// stride, the native packm kernels and gemm microkernel are used directly;
+// elements are gathered or scattered individually only at the irregular
+// boundaries between tensor dimensions.
+//
+// Batched contractions (indices shared by all three tensors) and traces
+// (indices appearing in only one tensor) are not supported.
+//
+
+#ifndef BAO_TENSOR_MAX_NDIM
+#define BAO_TENSOR_MAX_NDIM 8
+#endif
+
+typedef struct
+{
+	num_t dt;
+	dim_t ndim;
+	dim_t len[ BAO_TENSOR_MAX_NDIM ];
+	inc_t stride[ BAO_TENSOR_MAX_NDIM ];
+	void* buffer;
+} bao_tensor_t;
+
+// Create a tensor and allocate its buffer, using a "generalized column-major"
+// layout (the first dimension has unit stride, the second has a stride equal
+// to the length of the first, and so on).
+BLIS_EXPORT_ADDON void bao_tensor_create
+     (
+             num_t         dt,
+             dim_t         ndim,
+       const dim_t*        len,
+             bao_tensor_t* t
+     );
+
+// Initialize a tensor with an existing buffer. If stride is NULL, the
+// generalized column-major layout is assumed.
+BLIS_EXPORT_ADDON void bao_tensor_create_with_attached_buffer
+     (
+             num_t         dt,
+             dim_t         ndim,
+       const dim_t*        len,
+       const inc_t*        stride,
+             void*         buffer,
+             bao_tensor_t* t
+     );
+
+BLIS_EXPORT_ADDON void bao_tensor_free
+     (
+       bao_tensor_t* t
+     );
+
+// Return the number of elements in the tensor.
+BLIS_EXPORT_ADDON dim_t bao_tensor_size
+     (
+       const bao_tensor_t* t
+     );
+
+BLIS_EXPORT_ADDON void bao_tcontract
+     (
+       const obj_t*        alpha,
+       const bao_tensor_t* a, const char* idx_a,
+       const bao_tensor_t* b, const char* idx_b,
+       const obj_t*        beta,
+       const bao_tensor_t* c, const char* idx_c
+     );
+
+BLIS_EXPORT_ADDON void bao_tcontract_ex
+     (
+       const obj_t*        alpha,
+       const bao_tensor_t* a, const char* idx_a,
+       const bao_tensor_t* b, const char* idx_b,
+       const obj_t*        beta,
+       const bao_tensor_t* c, const char* idx_c,
+       const cntx_t*       cntx,
+       const rntm_t*       rntm
+     );
+
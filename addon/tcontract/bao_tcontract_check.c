@@ -0,0 +1,155 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+static err_t bao_tcontract_check_tensor
+     (
+       const bao_tensor_t* t,
+       const char*         idx
+     )
+{
+	err_t e_val;
+
+	e_val = bli_check_floating_datatype( t->dt );
+	if ( e_val != BLIS_SUCCESS ) return e_val;
+
+	if ( t->ndim < 0 || BAO_TENSOR_MAX_NDIM < t->ndim )
+		return BLIS_NOT_YET_IMPLEMENTED;
+
+	// Each dimension must be labeled by exactly one index.
+	if ( strlen( idx ) != ( size_t )t->ndim )
+		return BLIS_NONCONFORMAL_DIMENSIONS;
+
+	for ( dim_t d = 0; d < t->ndim; ++d )
+	{
+		if ( t->len[ d ] < 0 )
+			return BLIS_NEGATIVE_DIMENSION;
+
+		// Repeated indices (which would refer to diagonals of the tensor)
+		// are not supported.
+		if ( strchr( idx + d + 1, idx[ d ] ) != NULL )
+			return BLIS_NOT_YET_IMPLEMENTED;
+	}
+
+	if ( t->buffer == NULL && bao_tensor_size( t ) > 0 )
+		return BLIS_EXPECTED_NONNULL_OBJECT_BUFFER;
+
+	return BLIS_SUCCESS;
+}
+
+// Check that each index of the tensor t appears in exactly one of the other
+// two tensors, and that its lengths agree.
+static err_t bao_tcontract_check_indices
+     (
+       const bao_tensor_t* t,  const char* idx_t,
+       const bao_tensor_t* u,  const char* idx_u,
+       const bao_tensor_t* v,  const char* idx_v
+     )
+{
+	for ( dim_t d = 0; d < t->ndim; ++d )
+	{
+		const char* pu = strchr( idx_u, idx_t[ d ] );
+		const char* pv = strchr( idx_v, idx_t[ d ] );
+
+		// Batched indices (which appear in all three tensors) and traced
+		// indices (which appear in only one) are not supported.
+		if ( ( pu == NULL ) == ( pv == NULL ) )
+			return BLIS_NOT_YET_IMPLEMENTED;
+
+		const dim_t len = ( pu != NULL ? u->len[ pu - idx_u ]
+		                               : v->len[ pv - idx_v ] );
+
+		if ( len != t->len[ d ] )
+			return BLIS_NONCONFORMAL_DIMENSIONS;
+	}
+
+	return BLIS_SUCCESS;
+}
+
+void bao_tcontract_check
+     (
+       const obj_t*        alpha,
+       const bao_tensor_t* a, const char* idx_a,
+       const bao_tensor_t* b, const char* idx_b,
+       const obj_t*        beta,
+       const bao_tensor_t* c, const char* idx_c
+     )
+{
+	err_t e_val;
+
+	// Check object datatypes.
+
+	e_val = bli_check_noninteger_object( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_noninteger_object( beta );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_datatypes( a->dt, c->dt );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_datatypes( b->dt, c->dt );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions.
+
+	e_val = bli_check_scalar_object( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_scalar_object( beta );
+	bli_check_error_code( e_val );
+
+	// Check the tensors and their indices.
+
+	e_val = bao_tcontract_check_tensor( a, idx_a );
+	bli_check_error_code( e_val );
+
+	e_val = bao_tcontract_check_tensor( b, idx_b );
+	bli_check_error_code( e_val );
+
+	e_val = bao_tcontract_check_tensor( c, idx_c );
+	bli_check_error_code( e_val );
+
+	e_val = bao_tcontract_check_indices( a, idx_a, b, idx_b, c, idx_c );
+	bli_check_error_code( e_val );
+
+	e_val = bao_tcontract_check_indices( b, idx_b, c, idx_c, a, idx_a );
+	bli_check_error_code( e_val );
+
+	e_val = bao_tcontract_check_indices( c, idx_c, a, idx_a, b, idx_b );
+	bli_check_error_code( e_val );
+}
+
@@ -4,7 +4,7 @@
    An object-based framework for developing high-performance BLAS-like
    libraries.
 
-   Copyright (C) 2021, The University of Texas at Austin
+   Copyright (C) 2022, The University of Texas at Austin
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -32,22 +32,13 @@
 
 */
 
-// Definitions specific to situations when OpenMP multithreading is enabled.
-#ifdef BLIS_ENABLE_OPENMP
 
-void bao_l3_thread_decorator_openmp
+void bao_tcontract_check
      (
-       l3aoint_ft func,
-       opid_t     family,
-       obj_t*     alpha,
-       obj_t*     a,
-       obj_t*     d,
-       obj_t*     b,
-       obj_t*     beta,
-       obj_t*     c,
-       cntx_t*    cntx,
-       rntm_t*    rntm
+       const obj_t*        alpha,
+       const bao_tensor_t* a, const char* idx_a,
+       const bao_tensor_t* b, const char* idx_b,
+       const obj_t*        beta,
+       const bao_tensor_t* c, const char* idx_c
      );
 
-#endif
-
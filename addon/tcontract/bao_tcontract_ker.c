@@ -0,0 +1,366 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+typedef void (*bao_tcontract_scatter_mxn_vft)
+     (
+             dim_t  m,
+             dim_t  n,
+       const void*  x, inc_t rs_x, inc_t cs_x,
+       const void*  beta,
+             void*  y, const inc_t* rscat_y, const inc_t* cscat_y
+     );
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t  m, \
+             dim_t  n, \
+       const void*  x, inc_t rs_x, inc_t cs_x, \
+       const void*  beta, \
+             void*  y, const inc_t* rscat_y, const inc_t* cscat_y \
+     ) \
+{ \
+	const ctype* restrict x_cast = x; \
+	const ctype* restrict b_cast = beta; \
+	      ctype* restrict y_cast = y; \
+\
+	if ( PASTEMAC(ch,eq0)( *b_cast ) ) \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+			PASTEMAC(ch,copys)( x_cast[ i*rs_x + j*cs_x ], \
+			                    y_cast[ rscat_y[ i ] + cscat_y[ j ] ] ); \
+	} \
+	else \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+			PASTEMAC(ch,xpbys)( x_cast[ i*rs_x + j*cs_x ], *b_cast, \
+			                    y_cast[ rscat_y[ i ] + cscat_y[ j ] ] ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( tcontract_scatter_mxn )
+
+static bao_tcontract_scatter_mxn_vft GENARRAY_PREF( scatter_fp, bao_, tcontract_scatter_mxn );
+
+
+void bao_tcontract_ker
+     (
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+       const cntl_t*    cntl,
+             thrinfo_t* thread_par
+     )
+{
+	const num_t  dt        = bli_obj_dt( c );
+	const siz_t  dt_size   = bli_dt_size( dt );
+
+	const pack_t schema_a  = bli_obj_pack_schema( a );
+	const pack_t schema_b  = bli_obj_pack_schema( b );
+
+	const dim_t  m         = bli_obj_length( c );
+	const dim_t  n         = bli_obj_width( c );
+	const dim_t  k         = bli_obj_width( a );
+
+	const char*  a_cast    = bli_obj_buffer_at_off( a );
+	const inc_t  is_a      = bli_obj_imag_stride( a );
+	const dim_t  pd_a      = bli_obj_panel_dim( a );
+	const inc_t  ps_a      = bli_obj_panel_stride( a );
+
+	const char*  b_cast    = bli_obj_buffer_at_off( b );
+	const inc_t  is_b      = bli_obj_imag_stride( b );
+	const dim_t  pd_b      = bli_obj_panel_dim( b );
+	const inc_t  ps_b      = bli_obj_panel_stride( b );
+
+	// Note that the offsets of C locate the current block within the matrix
+	// view of the tensor, whose buffer is that of the obj_t.
+	      char*  c_cast    = bli_obj_buffer( c );
+	const dim_t  off_m     = bli_obj_row_off( c );
+	const dim_t  off_n     = bli_obj_col_off( c );
+
+	const bao_tcontract_params_t* params = bli_obj_ker_params( c );
+
+	// If any dimension is zero, return immediately.
+	if ( bli_zero_dim3( m, n, k ) ) return;
+
+	// Detach and multiply the scalars attached to A and B.
+	obj_t scalar_a, scalar_b;
+	bli_obj_scalar_detach( a, &scalar_a );
+	bli_obj_scalar_detach( b, &scalar_b );
+	bli_mulsc( &scalar_a, &scalar_b );
+
+	// Grab the addresses of the internal scalar buffers for the scalar
+	// merged above and the scalar attached to C.
+	const char* alpha_cast = bli_obj_internal_scalar_buffer( &scalar_b );
+	const char* beta_cast  = bli_obj_internal_scalar_buffer( c );
+
+	// Alias some constants to simpler names.
+	const dim_t MR = pd_a;
+	const dim_t NR = pd_b;
+
+	// Query the context for the micro-kernel address and cast it to its
+	// function pointer type.
+	gemm_ukr_ft gemm_ukr = bli_cntx_get_l3_vir_ukr_dt( dt, BLIS_GEMM_UKR, cntx );
+
+	// Temporary C buffer for microtiles of C whose rows or columns are not
+	// evenly spaced. The strides of this buffer match the preference of the
+	// microkernel.
+	char        ct[ BLIS_STACK_BUF_MAX_SIZE ]
+	                __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+	const bool  col_pref    = bli_cntx_ukr_prefers_cols_dt( dt, BLIS_GEMM_VIR_UKR, cntx );
+	const inc_t rs_ct       = ( col_pref ? 1 : NR );
+	const inc_t cs_ct       = ( col_pref ? MR : 1 );
+	const char* zero        = bli_obj_buffer_for_const( dt, &BLIS_ZERO );
+
+	bao_tcontract_scatter_mxn_vft scatter = scatter_fp[ dt ];
+
+	// The thrinfo_t node for the jr loop, whose team consists of all of the
+	// threads that share the current block of A.
+	thrinfo_t* thread = bli_thrinfo_sub_node( thread_par );
+
+	// Acquire space for the scatter and block-scatter vectors of the rows and
+	// columns of the current block of C from the jr node's mem_t entry, and
+	// have the chief thread fill them in. (No thread can still be reading the
+	// vectors filled in by the previous call, since the packing of the current
+	// block of A, which is shared by the same team, begins with a barrier.)
+	const siz_t size_s  = 2 * ( m + n ) * sizeof( inc_t );
+	inc_t*      rscat_c = bli_packm_alloc_ex( size_s, BLIS_BUFFER_FOR_GEN_USE, thread );
+	inc_t*      rbs_c   = rscat_c + m;
+	inc_t*      cscat_c = rbs_c   + m;
+	inc_t*      cbs_c   = cscat_c + n;
+
+	if ( bli_thrinfo_am_chief( thread ) )
+	{
+		bao_tcontract_fill_scatter
+		(
+		  params->ndim_m, params->len_m, params->stride_m,
+		  MR, off_m, m,
+		  rscat_c, rbs_c
+		);
+
+		bao_tcontract_fill_scatter
+		(
+		  params->ndim_n, params->len_n, params->stride_n,
+		  NR, off_n, n,
+		  cscat_c, cbs_c
+		);
+	}
+
+	// Wait for the scatter vectors to be filled in.
+	bli_thrinfo_barrier( thread );
+
+	// Compute number of primary and leftover components of the m and n
+	// dimensions.
+	const dim_t n_iter = n / NR + ( n % NR ? 1 : 0 );
+	const dim_t n_left = n % NR;
+
+	const dim_t m_iter = m / MR + ( m % MR ? 1 : 0 );
+	const dim_t m_left = m % MR;
+
+	// Determine some increments used to step through A and B.
+	const inc_t rstep_a = ps_a * dt_size;
+	const inc_t cstep_b = ps_b * dt_size;
+
+	auxinfo_t aux;
+
+	// Save the pack schemas of A and B to the auxinfo_t object.
+	bli_auxinfo_set_schema_a( schema_a, &aux );
+	bli_auxinfo_set_schema_b( schema_b, &aux );
+
+	// Save the imaginary stride of A and B to the auxinfo_t object.
+	bli_auxinfo_set_is_a( is_a, &aux );
+	bli_auxinfo_set_is_b( is_b, &aux );
+
+	// Save the virtual microkernel address and clear the params.
+	bli_auxinfo_set_ukr( gemm_ukr, &aux );
+	bli_auxinfo_set_params( NULL, &aux );
+
+	dim_t jr_start, jr_end, jr_inc;
+	dim_t ir_start, ir_end, ir_inc;
+
+#ifdef BLIS_ENABLE_JRIR_TLB
+
+	// Query the number of threads and thread ids for the jr loop around
+	// the microkernel.
+	const dim_t jr_nt  = bli_thrinfo_n_way( thread );
+	const dim_t jr_tid = bli_thrinfo_work_id( thread );
+
+	const dim_t ir_nt  = 1;
+	const dim_t ir_tid = 0;
+
+	dim_t n_ut_for_me
+	=
+	bli_thread_range_tlb_d( jr_nt, jr_tid, m_iter, n_iter, MR, NR,
+	                        &jr_start, &ir_start );
+
+	// Always increment by 1 in both dimensions.
+	jr_inc = 1;
+	ir_inc = 1;
+
+	// Each thread iterates over the entire panel of C until it exhausts its
+	// assigned set of microtiles.
+	jr_end = n_iter;
+	ir_end = m_iter;
+
+	// Successive iterations of the ir loop should start at 0.
+	const dim_t ir_next = 0;
+
+#else // ifdef ( _SLAB || _RR )
+
+	// Query the number of threads and thread ids for the ir loop around
+	// the microkernel.
+	thrinfo_t* caucus = bli_thrinfo_sub_node( thread );
+	const dim_t ir_nt  = bli_thrinfo_n_way( caucus );
+	const dim_t ir_tid = bli_thrinfo_work_id( caucus );
+
+	// Determine the thread range and increment for the 2nd and 1st loops.
+	bli_thread_range_slrr( thread, n_iter, 1, FALSE, &jr_start, &jr_end, &jr_inc );
+	bli_thread_range_slrr( caucus, m_iter, 1, FALSE, &ir_start, &ir_end, &ir_inc );
+
+	// Calculate the total number of microtiles assigned to this thread.
+	dim_t n_ut_for_me = ( ( ir_end + ir_inc - 1 - ir_start ) / ir_inc ) *
+	                    ( ( jr_end + jr_inc - 1 - jr_start ) / jr_inc );
+
+	// Each succesive iteration of the ir loop always starts at ir_start.
+	const dim_t ir_next = ir_start;
+
+#endif
+
+	// It's possible that there are so few microtiles relative to the number
+	// of threads that one or more threads gets no work. If that happens, those
+	// threads can return early.
+	if ( n_ut_for_me == 0 ) return;
+
+	// Loop over the n dimension (NR columns at a time).
+	for ( dim_t j = jr_start; j < jr_end; j += jr_inc )
+	{
+		const char*  b1       = b_cast  + j * cstep_b;
+		const inc_t* cscat_c1 = cscat_c + j * NR;
+		const inc_t  cs_c     = cbs_c[ j * NR ];
+
+		// Compute the current microtile's width.
+		const dim_t n_cur = ( bli_is_not_edge_f( j, n_iter, n_left )
+		                      ? NR : n_left );
+
+		// Initialize our next panel of B to be the current panel of B.
+		const char* b2 = b1;
+
+		// Loop over the m dimension (MR rows at a time).
+		for ( dim_t i = ir_start; i < ir_end; i += ir_inc )
+		{
+			const char*  a1       = a_cast  + i * rstep_a;
+			const inc_t* rscat_c1 = rscat_c + i * MR;
+			const inc_t  rs_c     = rbs_c[ i * MR ];
+
+			// Compute the current microtile's length.
+			const dim_t m_cur = ( bli_is_not_edge_f( i, m_iter, m_left )
+			                      ? MR : m_left );
+
+			// Compute the addresses of the next panels of A and B.
+			const char* a2 = bli_gemm_get_next_a_upanel( a1, rstep_a, ir_inc );
+			if ( bli_is_last_iter_slrr( i, ir_end, ir_tid, ir_nt ) )
+			{
+				a2 = a_cast;
+				b2 = bli_gemm_get_next_b_upanel( b1, cstep_b, jr_inc );
+			}
+
+			// Save addresses of next panels of A and B to the auxinfo_t
+			// object.
+			bli_auxinfo_set_next_a( a2, &aux );
+			bli_auxinfo_set_next_b( b2, &aux );
+
+			if ( rs_c != 0 && cs_c != 0 )
+			{
+				// The rows and columns of the microtile are evenly spaced, so
+				// the microkernel can update the tensor directly.
+				char* c11 = c_cast + ( rscat_c1[ 0 ] + cscat_c1[ 0 ] ) * dt_size;
+
+				gemm_ukr
+				(
+				  m_cur,
+				  n_cur,
+				  k,
+				  ( void* )alpha_cast,
+				  ( void* )a1,
+				  ( void* )b1,
+				  ( void* )beta_cast,
+				           c11, rs_c, cs_c,
+				  &aux,
+				  ( cntx_t* )cntx
+				);
+			}
+			else
+			{
+				// Otherwise, compute the product in a temporary microtile and
+				// scatter it to the tensor.
+				gemm_ukr
+				(
+				  MR,
+				  NR,
+				  k,
+				  ( void* )alpha_cast,
+				  ( void* )a1,
+				  ( void* )b1,
+				  ( void* )zero,
+				           &ct, rs_ct, cs_ct,
+				  &aux,
+				  ( cntx_t* )cntx
+				);
+
+				scatter
+				(
+				  m_cur, n_cur,
+				  &ct, rs_ct, cs_ct,
+				  beta_cast,
+				  c_cast, rscat_c1, cscat_c1
+				);
+			}
+
+			// Decrement the number of microtiles assigned to the thread; once
+			// it reaches zero, return immediately.
+			n_ut_for_me -= 1; if ( n_ut_for_me == 0 ) return;
+		}
+
+		ir_start = ir_next;
+	}
+}
+
@@ -0,0 +1,283 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+typedef void (*bao_tcontract_packm_panel_vft)
+     (
+             conj_t  conja,
+             pack_t  schema,
+             dim_t   panel_dim,
+             dim_t   panel_len,
+             dim_t   panel_dim_max,
+             dim_t   panel_len_max,
+       const void*   kappa,
+       const void*   a, inc_t inca,
+       const inc_t*  rscat,
+       const inc_t*  cscat,
+       const inc_t*  cbs,
+             void*   p, inc_t ldp,
+       const cntx_t* cntx
+     );
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             conj_t  conja, \
+             pack_t  schema, \
+             dim_t   panel_dim, \
+             dim_t   panel_len, \
+             dim_t   panel_dim_max, \
+             dim_t   panel_len_max, \
+       const void*   kappa, \
+       const void*   a, inc_t inca, \
+       const inc_t*  rscat, \
+       const inc_t*  cscat, \
+       const inc_t*  cbs, \
+             void*   p, inc_t ldp, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const ctype* restrict kappa_cast = kappa; \
+	const ctype* restrict a_cast     = a; \
+	      ctype* restrict p_cast     = p; \
+\
+	const num_t dt   = PASTEMAC(ch,type); \
+	const dim_t bs_k = BAO_TCONTRACT_BS_K; \
+\
+	/* The native packm kernel, which is used whenever both the rows of the
+	   micropanel and a group of its columns are evenly spaced. */ \
+	const ukr_t ker_id = bli_is_col_packed( schema ) ? BLIS_PACKM_NRXK_KER \
+	                                                 : BLIS_PACKM_MRXK_KER; \
+	packm_cxk_ker_ft f_cxk = bli_cntx_get_ukr_dt( dt, ker_id, cntx ); \
+\
+	dim_t j0 = 0; \
+\
+	while ( j0 < panel_len ) \
+	{ \
+		const dim_t n_j = bli_min( bs_k, panel_len - j0 ); \
+		const inc_t lda = cbs[ j0 ]; \
+\
+		if ( inca != 0 && lda != 0 ) \
+		{ \
+			/* Extend the current group of columns across any subsequent
+			   blocks that continue it with the same stride. */ \
+			dim_t n_run = n_j; \
+\
+			while ( j0 + n_run < panel_len && \
+			        cbs[ j0 + n_run ] == lda && \
+			        cscat[ j0 + n_run ] == cscat[ j0 ] + n_run * lda ) \
+				n_run += bli_min( bs_k, panel_len - j0 - n_run ); \
+\
+			f_cxk \
+			( \
+			  conja, \
+			  schema, \
+			  panel_dim, \
+			  n_run, \
+			  n_run, \
+			  kappa, \
+			  a_cast + rscat[ 0 ] + cscat[ j0 ], inca, lda, \
+			  p_cast,                                  ldp, \
+			  ( cntx_t* )cntx  \
+			); \
+\
+			j0 += n_run; \
+			p_cast += n_run * ldp; \
+		} \
+		else \
+		{ \
+			/* Gather the elements of the block individually. */ \
+			for ( dim_t j = j0; j < j0 + n_j; ++j ) \
+			{ \
+				const ctype* restrict aj = a_cast + cscat[ j ]; \
+\
+				if ( bli_is_conj( conja ) ) \
+				{ \
+					for ( dim_t i = 0; i < panel_dim; ++i ) \
+						PASTEMAC(ch,scal2js)( *kappa_cast, aj[ rscat[ i ] ], p_cast[ i ] ); \
+				} \
+				else \
+				{ \
+					for ( dim_t i = 0; i < panel_dim; ++i ) \
+						PASTEMAC(ch,scal2s)( *kappa_cast, aj[ rscat[ i ] ], p_cast[ i ] ); \
+				} \
+\
+				for ( dim_t i = panel_dim; i < panel_dim_max; ++i ) \
+					PASTEMAC(ch,set0s)( p_cast[ i ] ); \
+\
+				p_cast += ldp; \
+			} \
+\
+			j0 += n_j; \
+		} \
+	} \
+\
+	/* Zero the columns of the micropanel beyond the edge of the matrix. */ \
+	for ( dim_t j = panel_len; j < panel_len_max; ++j ) \
+	{ \
+		for ( dim_t i = 0; i < panel_dim_max; ++i ) \
+			PASTEMAC(ch,set0s)( p_cast[ i ] ); \
+\
+		p_cast += ldp; \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( tcontract_packm_panel )
+
+static bao_tcontract_packm_panel_vft GENARRAY_PREF( panel_fp, bao_, tcontract_packm_panel );
+
+
+void bao_tcontract_packm
+     (
+       const obj_t*     a,
+             obj_t*     p,
+       const cntx_t*    cntx,
+       const cntl_t*    cntl,
+             thrinfo_t* thread_par
+     )
+{
+	// The team of threads that packs the current block (used for barriers
+	// and the allocation of the packed buffer), and the same team viewed as
+	// a group of single-member teams (used for partitioning the work).
+	thrinfo_t* team   = bli_thrinfo_sub_node( thread_par );
+	thrinfo_t* thread = bli_thrinfo_sub_prenode( thread_par );
+
+	// Initialize P and acquire the packed buffer just as the default packm
+	// variant would. Return early if no packing is required.
+	if ( !bli_packm_init( a, p, cntx, cntl, team ) )
+		return;
+
+	const num_t  dt             = bli_obj_dt( p );
+	const siz_t  dt_size        = bli_dt_size( dt );
+	const pack_t schema         = bli_obj_pack_schema( p );
+	const conj_t conja          = bli_obj_conj_status( a );
+
+	const dim_t  iter_dim       = bli_obj_length( p );
+	const dim_t  panel_len_full = bli_obj_width( p );
+	const dim_t  panel_len_max  = bli_obj_padded_width( p );
+	const dim_t  panel_dim_max  = bli_obj_panel_dim( p );
+	const inc_t  ldp            = bli_obj_col_stride( p );
+	const inc_t  ps_p           = bli_obj_panel_stride( p );
+
+	const dim_t  n_iter         = iter_dim / panel_dim_max +
+	                              ( iter_dim % panel_dim_max ? 1 : 0 );
+
+	// The scatter and block-scatter vectors of the rows and columns of the
+	// current block are stored just beyond the packed matrix (whose size is
+	// always a multiple of sizeof( inc_t ), since ps_p is even), and so we
+	// grow the packed buffer to accommodate them. (This is usually a no-op,
+	// since blocks from the pba's pools are sized for the largest packed
+	// matrix.)
+	const siz_t  size_p         = ps_p * ( n_iter ) * dt_size;
+	const siz_t  size_s         = 2 * ( iter_dim + panel_len_full ) * sizeof( inc_t );
+
+	char*        p_cast         = bli_packm_alloc( size_p + size_s, cntl, team );
+	bli_obj_set_buffer( p_cast, p );
+
+	inc_t*       rscat          = ( inc_t* )( p_cast + size_p );
+	inc_t*       rbs            = rscat + iter_dim;
+	inc_t*       cscat          = rbs   + iter_dim;
+	inc_t*       cbs            = cscat + panel_len_full;
+
+	// Note that the offsets of A locate the current block within the matrix
+	// view of the tensor, whose buffer is that of the obj_t.
+	const bao_tcontract_params_t* params = bli_obj_pack_params( a );
+	const char*  a_cast         = bli_obj_buffer( a );
+
+	obj_t        kappa_local;
+	const char*  kappa_cast     = bli_packm_scalar( &kappa_local, p );
+
+	if ( bli_thrinfo_am_chief( team ) )
+	{
+		bao_tcontract_fill_scatter
+		(
+		  params->ndim_m, params->len_m, params->stride_m,
+		  panel_dim_max,
+		  bli_obj_row_off( a ), iter_dim,
+		  rscat, rbs
+		);
+
+		bao_tcontract_fill_scatter
+		(
+		  params->ndim_n, params->len_n, params->stride_n,
+		  BAO_TCONTRACT_BS_K,
+		  bli_obj_col_off( a ), panel_len_full,
+		  cscat, cbs
+		);
+	}
+
+	// Wait for the scatter vectors to be filled in.
+	bli_thrinfo_barrier( team );
+
+	bao_tcontract_packm_panel_vft f = panel_fp[ dt ];
+
+	// Query the number of threads (single-member thread teams) and the thread
+	// team ids, and determine the thread range and increment.
+	const dim_t nt  = bli_thrinfo_n_way( thread );
+	const dim_t tid = bli_thrinfo_work_id( thread );
+
+	dim_t it_start, it_end, it_inc;
+	bli_thread_range_slrr( thread, n_iter, 1, FALSE, &it_start, &it_end, &it_inc );
+
+	// Iterate over every logical micropanel in the source matrix.
+	for ( dim_t it = 0; it < n_iter; it += 1 )
+	{
+		if ( !bli_is_my_iter( it, it_start, it_end, tid, nt ) ) continue;
+
+		const dim_t ic          = it * panel_dim_max;
+		const dim_t panel_dim_i = bli_min( panel_dim_max, iter_dim - ic );
+
+		f
+		(
+		  conja,
+		  schema,
+		  panel_dim_i,
+		  panel_len_full,
+		  panel_dim_max,
+		  panel_len_max,
+		  kappa_cast,
+		  a_cast, rbs[ ic ],
+		  rscat + ic,
+		  cscat,
+		  cbs,
+		  p_cast + it * ps_p * dt_size, ldp,
+		  cntx
+		);
+	}
+}
+
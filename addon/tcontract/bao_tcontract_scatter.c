@@ -0,0 +1,102 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+void bao_tcontract_fill_scatter
+     (
+             dim_t  ndim,
+       const dim_t* len,
+       const inc_t* stride,
+             dim_t  bs_len,
+             dim_t  off,
+             dim_t  size,
+             inc_t* scat,
+             inc_t* bs
+     )
+{
+	if ( size == 0 ) return;
+
+	// Decompose the starting position into a multi-index (with the first
+	// dimension varying fastest) and compute its offset.
+	dim_t idx[ BAO_TENSOR_MAX_NDIM ];
+	inc_t pos = 0;
+
+	for ( dim_t d = 0; d < ndim; ++d )
+	{
+		idx[ d ] = off % len[ d ];
+		off      = off / len[ d ];
+		pos     += idx[ d ] * stride[ d ];
+	}
+
+	// Enumerate the offsets of the requested positions, advancing the
+	// multi-index as an odometer.
+	for ( dim_t i = 0; i < size; ++i )
+	{
+		scat[ i ] = pos;
+
+		for ( dim_t d = 0; d < ndim; ++d )
+		{
+			if ( idx[ d ] < len[ d ] - 1 )
+			{
+				idx[ d ] += 1;
+				pos      += stride[ d ];
+				break;
+			}
+
+			pos     -= idx[ d ] * stride[ d ];
+			idx[ d ] = 0;
+		}
+	}
+
+	// Determine the stride (if any) shared by each block of positions. A
+	// block that consists of a single position is given the stride of the
+	// first dimension so that it is never treated as irregular.
+	const inc_t stride0 = ( ndim > 0 && stride[ 0 ] != 0 ? stride[ 0 ] : 1 );
+
+	for ( dim_t i0 = 0; i0 < size; i0 += bs_len )
+	{
+		const dim_t n_i = bli_min( bs_len, size - i0 );
+		      inc_t s   = ( n_i == 1 ? stride0 : scat[ i0 + 1 ] - scat[ i0 ] );
+
+		for ( dim_t i = i0 + 1; i < i0 + n_i; ++i )
+		{
+			if ( scat[ i ] - scat[ i - 1 ] != s ) { s = 0; break; }
+		}
+
+		bs[ i0 ] = s;
+	}
+}
+
@@ -0,0 +1,139 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// The packm and macrokernel parameters. Each describes the matrix view of
+// one tensor: the rows enumerate the (m or n) dimensions given by len_m and
+// stride_m, and the columns enumerate those given by len_n and stride_n,
+// with the first dimension of each group varying fastest. Note that the
+// parameters of B describe the matrix B^T, since B is packed as though it
+// were transposed.
+//
+
+typedef struct
+{
+	dim_t        ndim_m;
+	const dim_t* len_m;
+	const inc_t* stride_m;
+
+	dim_t        ndim_n;
+	const dim_t* len_n;
+	const inc_t* stride_n;
+} bao_tcontract_params_t;
+
+// The number of columns (along the k dimension) covered by each entry of the
+// block-scatter vectors used when packing.
+#ifndef BAO_TCONTRACT_BS_K
+#define BAO_TCONTRACT_BS_K 4
+#endif
+
+// Fill in the scatter and block-scatter vectors for positions [off,off+size)
+// of a group of tensor dimensions. Entry i of scat receives the offset of
+// position off+i, and entry i of bs (for i a multiple of bs_len) receives
+// the stride shared by positions off+i through off+i+bs_len-1, or zero if
+// they are not evenly spaced.
+void bao_tcontract_fill_scatter
+     (
+             dim_t  ndim,
+       const dim_t* len,
+       const inc_t* stride,
+             dim_t  bs_len,
+             dim_t  off,
+             dim_t  size,
+             inc_t* scat,
+             inc_t* bs
+     );
+
+// The packm variant and macrokernel installed (via the pack_fn and ker_fn
+// fields of the obj_t) into the conventional gemm implementation.
+void bao_tcontract_packm
+     (
+       const obj_t*     a,
+             obj_t*     p,
+       const cntx_t*    cntx,
+       const cntl_t*    cntl,
+             thrinfo_t* thread_par
+     );
+
+void bao_tcontract_ker
+     (
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+       const cntl_t*    cntl,
+             thrinfo_t* thread_par
+     );
+
+//
+// Prototype the datatype-specific kernels.
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             conj_t  conja, \
+             pack_t  schema, \
+             dim_t   panel_dim, \
+             dim_t   panel_len, \
+             dim_t   panel_dim_max, \
+             dim_t   panel_len_max, \
+       const void*   kappa, \
+       const void*   a, inc_t inca, \
+       const inc_t*  rscat, \
+       const inc_t*  cscat, \
+       const inc_t*  cbs, \
+             void*   p, inc_t ldp, \
+       const cntx_t* cntx  \
+     );
+
+INSERT_GENTPROT_BASIC( tcontract_packm_panel )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTECH2(bao_,ch,opname) \
+     ( \
+             dim_t  m, \
+             dim_t  n, \
+       const void*  x, inc_t rs_x, inc_t cs_x, \
+       const void*  beta, \
+             void*  y, const inc_t* rscat_y, const inc_t* cscat_y \
+     );
+
+INSERT_GENTPROT_BASIC( tcontract_scatter_mxn )
+
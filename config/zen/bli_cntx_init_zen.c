@@ -56,15 +56,29 @@ void bli_cntx_init_zen( cntx_t* cntx )
 	  BLIS_GEMM_UKR,       BLIS_DOUBLE,   bli_dgemm_haswell_asm_6x8,
 	  BLIS_GEMM_UKR,       BLIS_SCOMPLEX, bli_cgemm_haswell_asm_3x8,
 	  BLIS_GEMM_UKR,       BLIS_DCOMPLEX, bli_zgemm_haswell_asm_3x4,
+	  BLIS_GEMM_U8S8S32_UKR,   BLIS_FLOAT, bli_igemm_u8s8s32_zen_int_6x16,
+	  BLIS_GEMM_S16S16S32_UKR, BLIS_FLOAT, bli_igemm_s16s16s32_zen_int_6x16,
 
 	  // gemmtrsm_l
 	  BLIS_GEMMTRSM_L_UKR, BLIS_FLOAT,    bli_sgemmtrsm_l_haswell_asm_6x16,
 	  BLIS_GEMMTRSM_L_UKR, BLIS_DOUBLE,   bli_dgemmtrsm_l_haswell_asm_6x8,
+	  BLIS_GEMMTRSM_L_UKR, BLIS_SCOMPLEX, bli_cgemmtrsm_l_haswell_int_3x8,
+	  BLIS_GEMMTRSM_L_UKR, BLIS_DCOMPLEX, bli_zgemmtrsm_l_haswell_int_3x4,
 
 	  // gemmtrsm_u
 
 	  BLIS_GEMMTRSM_U_UKR, BLIS_FLOAT,    bli_sgemmtrsm_u_haswell_asm_6x16,
 	  BLIS_GEMMTRSM_U_UKR, BLIS_DOUBLE,   bli_dgemmtrsm_u_haswell_asm_6x8,
+	  BLIS_GEMMTRSM_U_UKR, BLIS_SCOMPLEX, bli_cgemmtrsm_u_haswell_int_3x8,
+	  BLIS_GEMMTRSM_U_UKR, BLIS_DCOMPLEX, bli_zgemmtrsm_u_haswell_int_3x4,
+
+	  // trsm_l
+	  BLIS_TRSM_L_UKR,     BLIS_SCOMPLEX, bli_ctrsm_l_haswell_int_3x8,
+	  BLIS_TRSM_L_UKR,     BLIS_DCOMPLEX, bli_ztrsm_l_haswell_int_3x4,
+
+	  // trsm_u
+	  BLIS_TRSM_U_UKR,     BLIS_SCOMPLEX, bli_ctrsm_u_haswell_int_3x8,
+	  BLIS_TRSM_U_UKR,     BLIS_DCOMPLEX, bli_ztrsm_u_haswell_int_3x4,
 
 	  // gemmsup
 	  BLIS_GEMMSUP_RRR_UKR, BLIS_DOUBLE, bli_dgemmsup_rv_haswell_asm_6x8m,
@@ -113,15 +127,20 @@ void bli_cntx_init_zen( cntx_t* cntx )
 #endif
 
 	  // packm
-	  BLIS_PACKM_MRXK_KER, BLIS_FLOAT,    bli_spackm_haswell_asm_6xk,
-	  BLIS_PACKM_NRXK_KER, BLIS_FLOAT,    bli_spackm_haswell_asm_16xk,
-	  BLIS_PACKM_MRXK_KER, BLIS_DOUBLE,   bli_dpackm_haswell_asm_6xk,
-	  BLIS_PACKM_NRXK_KER, BLIS_DOUBLE,   bli_dpackm_haswell_asm_8xk,
+	  BLIS_PACKM_MRXK_KER, BLIS_FLOAT,    bli_spackm_6xk_zen_int,
+	  BLIS_PACKM_NRXK_KER, BLIS_FLOAT,    bli_spackm_16xk_zen_int,
+	  BLIS_PACKM_MRXK_KER, BLIS_DOUBLE,   bli_dpackm_6xk_zen_int,
+	  BLIS_PACKM_NRXK_KER, BLIS_DOUBLE,   bli_dpackm_8xk_zen_int,
 	  BLIS_PACKM_MRXK_KER, BLIS_SCOMPLEX, bli_cpackm_haswell_asm_3xk,
 	  BLIS_PACKM_NRXK_KER, BLIS_SCOMPLEX, bli_cpackm_haswell_asm_8xk,
 	  BLIS_PACKM_MRXK_KER, BLIS_DCOMPLEX, bli_zpackm_haswell_asm_3xk,
 	  BLIS_PACKM_NRXK_KER, BLIS_DCOMPLEX, bli_zpackm_haswell_asm_4xk,
 
+	  BLIS_PACKM_MRXK_BF16_KER, BLIS_FLOAT, bli_spackm_mrxk_bf16_zen_int,
+	  BLIS_PACKM_NRXK_BF16_KER, BLIS_FLOAT, bli_spackm_nrxk_bf16_zen_int,
+	  BLIS_PACKM_MRXK_F16_KER,  BLIS_FLOAT, bli_spackm_mrxk_f16_zen_int,
+	  BLIS_PACKM_NRXK_F16_KER,  BLIS_FLOAT, bli_spackm_nrxk_f16_zen_int,
+
 	  // axpyf
 	  BLIS_AXPYF_KER,  BLIS_FLOAT,  bli_saxpyf_zen_int_8,
 	  BLIS_AXPYF_KER,  BLIS_DOUBLE, bli_daxpyf_zen_int_8,
@@ -134,6 +153,12 @@ void bli_cntx_init_zen( cntx_t* cntx )
 	  BLIS_AMAXV_KER,  BLIS_FLOAT,  bli_samaxv_zen_int,
 	  BLIS_AMAXV_KER,  BLIS_DOUBLE, bli_damaxv_zen_int,
 
+	  // asumv
+	  BLIS_ASUMV_KER,  BLIS_FLOAT,    bli_sasumv_zen_int,
+	  BLIS_ASUMV_KER,  BLIS_DOUBLE,   bli_dasumv_zen_int,
+	  BLIS_ASUMV_KER,  BLIS_SCOMPLEX, bli_casumv_zen_int,
+	  BLIS_ASUMV_KER,  BLIS_DCOMPLEX, bli_zasumv_zen_int,
+
 	  // axpyv
 	  BLIS_AXPYV_KER,  BLIS_FLOAT,  bli_saxpyv_zen_int10,
 	  BLIS_AXPYV_KER,  BLIS_DOUBLE, bli_daxpyv_zen_int10,
@@ -150,6 +175,24 @@ void bli_cntx_init_zen( cntx_t* cntx )
 	  BLIS_DOTXV_KER,  BLIS_FLOAT,  bli_sdotxv_zen_int,
 	  BLIS_DOTXV_KER,  BLIS_DOUBLE, bli_ddotxv_zen_int,
 
+	  // normfv
+	  BLIS_NORMFV_KER, BLIS_FLOAT,    bli_snormfv_zen_int,
+	  BLIS_NORMFV_KER, BLIS_DOUBLE,   bli_dnormfv_zen_int,
+	  BLIS_NORMFV_KER, BLIS_SCOMPLEX, bli_cnormfv_zen_int,
+	  BLIS_NORMFV_KER, BLIS_DCOMPLEX, bli_znormfv_zen_int,
+
+	  // rotmv
+	  BLIS_ROTMV_KER,  BLIS_FLOAT,    bli_srotmv_zen_int,
+	  BLIS_ROTMV_KER,  BLIS_DOUBLE,   bli_drotmv_zen_int,
+	  BLIS_ROTMV_KER,  BLIS_SCOMPLEX, bli_crotmv_zen_int,
+	  BLIS_ROTMV_KER,  BLIS_DCOMPLEX, bli_zrotmv_zen_int,
+
+	  // rotv
+	  BLIS_ROTV_KER,   BLIS_FLOAT,    bli_srotv_zen_int,
+	  BLIS_ROTV_KER,   BLIS_DOUBLE,   bli_drotv_zen_int,
+	  BLIS_ROTV_KER,   BLIS_SCOMPLEX, bli_crotv_zen_int,
+	  BLIS_ROTV_KER,   BLIS_DCOMPLEX, bli_zrotv_zen_int,
+
 	  // scalv
 	  BLIS_SCALV_KER,  BLIS_FLOAT,  bli_sscalv_zen_int10,
 	  BLIS_SCALV_KER,  BLIS_DOUBLE, bli_dscalv_zen_int10,
@@ -179,10 +222,14 @@ void bli_cntx_init_zen( cntx_t* cntx )
 	  // gemmtrsm_l
 	  BLIS_GEMMTRSM_L_UKR_ROW_PREF, BLIS_FLOAT,    TRUE,
 	  BLIS_GEMMTRSM_L_UKR_ROW_PREF, BLIS_DOUBLE,   TRUE,
+	  BLIS_GEMMTRSM_L_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMTRSM_L_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
 
 	  // gemmtrsm_u
 	  BLIS_GEMMTRSM_U_UKR_ROW_PREF, BLIS_FLOAT,    TRUE,
 	  BLIS_GEMMTRSM_U_UKR_ROW_PREF, BLIS_DOUBLE,   TRUE,
+	  BLIS_GEMMTRSM_U_UKR_ROW_PREF, BLIS_SCOMPLEX, TRUE,
+	  BLIS_GEMMTRSM_U_UKR_ROW_PREF, BLIS_DCOMPLEX, TRUE,
 
 	  // gemmsup
 	  BLIS_GEMMSUP_RRR_UKR_ROW_PREF, BLIS_DOUBLE, TRUE,
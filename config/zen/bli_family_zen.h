@@ -41,10 +41,13 @@
 
 #define BLIS_ENABLE_ZEN_BLOCK_SIZES
 
-// Vanilla BLIS disables AMD's small matrix handling by default.
-#if 0
+// Vanilla BLIS disables AMD's small matrix handling by default. It may be
+// enabled for gemm and trsm via --enable-small-matrix, in which case it is
+// only used when a single thread is requested.
+#ifdef BLIS_ENABLE_SMALL_MATRIX_PATHS
 #define BLIS_ENABLE_SMALL_MATRIX
 #define BLIS_ENABLE_SMALL_MATRIX_TRSM
+#endif
 
 // This will select the threshold below which small matrix code will be called.
 #define BLIS_SMALL_MATRIX_THRES        700
@@ -63,7 +66,6 @@
 #define D_BLIS_SMALL_MATRIX_THRES_TRSM_ALXB_NAPLES 90
 
 #define D_BLIS_SMALL_MATRIX_THRES_TRSM_DIM_RATIO 22
-#endif
 
 
 #if 0
@@ -39,10 +39,13 @@
 #define BLIS_THREAD_MAX_IR      1
 #define BLIS_THREAD_MAX_JR      1
 
-// Vanilla BLIS disables AMD's small matrix handling by default.
-#if 0
+// Vanilla BLIS disables AMD's small matrix handling by default. It may be
+// enabled for gemm and trsm via --enable-small-matrix, in which case it is
+// only used when a single thread is requested.
+#ifdef BLIS_ENABLE_SMALL_MATRIX_PATHS
 #define BLIS_ENABLE_SMALL_MATRIX
 #define BLIS_ENABLE_SMALL_MATRIX_TRSM
+#endif
 
 // This will select the threshold below which small matrix code will be called.
 #define BLIS_SMALL_MATRIX_THRES        700
@@ -82,5 +85,4 @@
 // When running HPL with pure MPI without DGEMM threading (Single-threaded
 // BLIS), defining this macro as 1 yields better performance.
 #define AOCL_BLIS_MULTIINSTANCE   0
-#endif
 
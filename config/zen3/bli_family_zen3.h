@@ -52,8 +52,13 @@
 // All zen3 specific code should be included in this macro
 #define BLIS_CONFIG_ZEN3
 
-//#define BLIS_ENABLE_SMALL_MATRIX
-//#define BLIS_ENABLE_SMALL_MATRIX_TRSM
+// Vanilla BLIS disables AMD's small matrix handling by default. It may be
+// enabled for gemm and trsm via --enable-small-matrix, in which case it is
+// only used when a single thread is requested.
+#ifdef BLIS_ENABLE_SMALL_MATRIX_PATHS
+#define BLIS_ENABLE_SMALL_MATRIX
+#define BLIS_ENABLE_SMALL_MATRIX_TRSM
+#endif
 
 
 // This will select the threshold below which small matrix code will be called.
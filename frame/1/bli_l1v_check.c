@@ -170,6 +170,39 @@ GENFRONT( scalv )
 GENFRONT( setv )
 
 
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       const obj_t* x, \
+       const obj_t* y, \
+       const obj_t* param  \
+     ) \
+{ \
+	bli_l1v_xyp_check( x, y, param ); \
+}
+
+GENFRONT( rotmv )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       const obj_t* x, \
+       const obj_t* y, \
+       const obj_t* c, \
+       const obj_t* s  \
+     ) \
+{ \
+	bli_l1v_xycs_check( x, y, c, s ); \
+}
+
+GENFRONT( rotv )
+
+
 #undef  GENFRONT
 #define GENFRONT( opname ) \
 \
@@ -558,3 +591,80 @@ void bli_l1v_xi_check
 	bli_check_error_code( e_val );
 }
 
+
+void bli_l1v_xycs_check
+     (
+       const obj_t* x,
+       const obj_t* y,
+       const obj_t* c,
+       const obj_t* s
+     )
+{
+	err_t e_val;
+
+	// Check x and y.
+
+	bli_l1v_xy_check( x, y );
+
+	// Check object datatypes.
+
+	e_val = bli_check_noninteger_object( c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_noninteger_object( s );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_real_valued_object( c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_real_valued_object( s );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions.
+
+	e_val = bli_check_scalar_object( c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_scalar_object( s );
+	bli_check_error_code( e_val );
+
+	// Check object buffers (for non-NULLness).
+
+	e_val = bli_check_object_buffer( c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( s );
+	bli_check_error_code( e_val );
+}
+
+void bli_l1v_xyp_check
+     (
+       const obj_t* x,
+       const obj_t* y,
+       const obj_t* param
+     )
+{
+	err_t e_val;
+
+	// Check x and y.
+
+	bli_l1v_xy_check( x, y );
+
+	// Check object datatypes.
+
+	e_val = bli_check_real_object( param );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions.
+
+	e_val = bli_check_vector_object( param );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_vector_dim_equals( param, 5 );
+	bli_check_error_code( e_val );
+
+	// Check object buffers (for non-NULLness).
+
+	e_val = bli_check_object_buffer( param );
+	bli_check_error_code( e_val );
+}
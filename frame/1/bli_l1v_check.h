@@ -145,6 +145,33 @@ GENTPROT( scalv )
 GENTPROT( setv )
 
 
+#undef  GENTPROT
+#define GENTPROT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       const obj_t* x, \
+       const obj_t* y, \
+       const obj_t* param  \
+     );
+
+GENTPROT( rotmv )
+
+
+#undef  GENTPROT
+#define GENTPROT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       const obj_t* x, \
+       const obj_t* y, \
+       const obj_t* c, \
+       const obj_t* s  \
+     );
+
+GENTPROT( rotv )
+
+
 #undef  GENTPROT
 #define GENTPROT( opname ) \
 \
@@ -215,3 +242,18 @@ void bli_l1v_xi_check
        const obj_t* index
      );
 
+
+void bli_l1v_xycs_check
+     (
+       const obj_t* x,
+       const obj_t* y,
+       const obj_t* c,
+       const obj_t* s
+     );
+
+void bli_l1v_xyp_check
+     (
+       const obj_t* x,
+       const obj_t* y,
+       const obj_t* param
+     );
@@ -63,6 +63,8 @@ GENFRONT( invertv )
 GENFRONT( invscalv )
 GENFRONT( scalv )
 GENFRONT( setv )
+GENFRONT( rotmv )
+GENFRONT( rotv )
 GENFRONT( swapv )
 GENFRONT( xpbyv )
 
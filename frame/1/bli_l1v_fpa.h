@@ -55,6 +55,8 @@ GENPROT( invertv )
 GENPROT( invscalv )
 GENPROT( scalv )
 GENPROT( setv )
+GENPROT( rotmv )
+GENPROT( rotv )
 GENPROT( swapv )
 GENPROT( xpbyv )
 
@@ -176,6 +176,39 @@ INSERT_GENTDEF( invscalv )
 INSERT_GENTDEF( scalv )
 INSERT_GENTDEF( setv )
 
+// rotmv
+
+#undef  GENTDEFR
+#define GENTDEFR( ctype, ctype_r, ch, chr, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,EX_SUF,tsuf)) \
+     ( \
+             dim_t    n, \
+             ctype*   x, inc_t incx, \
+             ctype*   y, inc_t incy, \
+       const ctype_r* param  \
+       BLIS_TAPI_EX_PARAMS  \
+     );
+
+INSERT_GENTDEFR( rotmv )
+
+// rotv
+
+#undef  GENTDEFR
+#define GENTDEFR( ctype, ctype_r, ch, chr, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,EX_SUF,tsuf)) \
+     ( \
+             dim_t    n, \
+             ctype*   x, inc_t incx, \
+             ctype*   y, inc_t incy, \
+       const ctype_r* c, \
+       const ctype_r* s  \
+       BLIS_TAPI_EX_PARAMS  \
+     );
+
+INSERT_GENTDEFR( rotv )
+
 // swapv
 
 #undef  GENTDEF
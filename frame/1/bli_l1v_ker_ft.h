@@ -51,6 +51,7 @@ typedef void (*PASTECH(opname,_ker_ft)) \
 
 GENTDEF( addv )
 GENTDEF( amaxv )
+GENTDEF( asumv )
 GENTDEF( axpbyv )
 GENTDEF( axpyv )
 GENTDEF( copyv )
@@ -58,6 +59,9 @@ GENTDEF( dotv )
 GENTDEF( dotxv )
 GENTDEF( invertv )
 GENTDEF( invscalv )
+GENTDEF( normfv )
+GENTDEF( rotmv )
+GENTDEF( rotv )
 GENTDEF( scalv )
 GENTDEF( scal2v )
 GENTDEF( setv )
@@ -49,6 +49,12 @@
        const void*   x, inc_t incx, \
              dim_t*  index
 
+#define asumv_params \
+\
+             dim_t   n, \
+       const void*   x, inc_t incx, \
+             void*   asum
+
 #define axpbyv_params \
 \
              conj_t  conjx, \
@@ -105,6 +111,27 @@
        const void*   alpha, \
              void*   x, inc_t incx
 
+#define normfv_params \
+\
+             dim_t   n, \
+       const void*   x, inc_t incx, \
+             void*   norm
+
+#define rotmv_params \
+\
+             dim_t   n, \
+             void*   x, inc_t incx, \
+             void*   y, inc_t incy, \
+       const void*   param
+
+#define rotv_params \
+\
+             dim_t   n, \
+             void*   x, inc_t incx, \
+             void*   y, inc_t incy, \
+       const void*   c, \
+       const void*   s
+
 #define scalv_params \
 \
              conj_t  conjalpha, \
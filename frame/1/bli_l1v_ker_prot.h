@@ -50,6 +50,7 @@ void PASTEMAC(ch,funcname) \
 
 #define ADDV_KER_PROT(     ctype, ch, fn )  L1VTPROT( ctype, ch, fn, addv );
 #define AMAXV_KER_PROT(    ctype, ch, fn )  L1VTPROT( ctype, ch, fn, amaxv );
+#define ASUMV_KER_PROT(    ctype, ch, fn )  L1VTPROT( ctype, ch, fn, asumv );
 #define AXPBYV_KER_PROT(   ctype, ch, fn )  L1VTPROT( ctype, ch, fn, axpbyv );
 #define AXPYV_KER_PROT(    ctype, ch, fn )  L1VTPROT( ctype, ch, fn, axpyv );
 #define COPYV_KER_PROT(    ctype, ch, fn )  L1VTPROT( ctype, ch, fn, copyv );
@@ -57,6 +58,9 @@ void PASTEMAC(ch,funcname) \
 #define DOTXV_KER_PROT(    ctype, ch, fn )  L1VTPROT( ctype, ch, fn, dotxv );
 #define INVERTV_KER_PROT(  ctype, ch, fn )  L1VTPROT( ctype, ch, fn, invertv );
 #define INVSCALV_KER_PROT( ctype, ch, fn )  L1VTPROT( ctype, ch, fn, invscalv );
+#define NORMFV_KER_PROT(   ctype, ch, fn )  L1VTPROT( ctype, ch, fn, normfv );
+#define ROTMV_KER_PROT(    ctype, ch, fn )  L1VTPROT( ctype, ch, fn, rotmv );
+#define ROTV_KER_PROT(     ctype, ch, fn )  L1VTPROT( ctype, ch, fn, rotv );
 #define SCALV_KER_PROT(    ctype, ch, fn )  L1VTPROT( ctype, ch, fn, scalv );
 #define SCAL2V_KER_PROT(   ctype, ch, fn )  L1VTPROT( ctype, ch, fn, scal2v );
 #define SETV_KER_PROT(     ctype, ch, fn )  L1VTPROT( ctype, ch, fn, setv );
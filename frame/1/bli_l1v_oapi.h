@@ -152,6 +152,35 @@ GENTPROT( scalv )
 GENTPROT( setv )
 
 
+#undef  GENTPROT
+#define GENTPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,EX_SUF) \
+     ( \
+       const obj_t* x, \
+       const obj_t* y, \
+       const obj_t* param  \
+       BLIS_OAPI_EX_PARAMS  \
+     );
+
+GENTPROT( rotmv )
+
+
+#undef  GENTPROT
+#define GENTPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,EX_SUF) \
+     ( \
+       const obj_t* x, \
+       const obj_t* y, \
+       const obj_t* c, \
+       const obj_t* s  \
+       BLIS_OAPI_EX_PARAMS  \
+     );
+
+GENTPROT( rotv )
+
+
 #undef  GENTPROT
 #define GENTPROT( opname ) \
 \
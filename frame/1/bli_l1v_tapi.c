@@ -346,6 +346,80 @@ INSERT_GENTFUNC_BASIC( scalv, BLIS_SCALV_KER )
 INSERT_GENTFUNC_BASIC( setv,  BLIS_SETV_KER )
 
 
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, kerid ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+             dim_t    n, \
+             ctype*   x, inc_t incx, \
+             ctype*   y, inc_t incy, \
+       const ctype_r* param  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	PASTECH(opname,_ker_ft) f = bli_cntx_get_ukr_dt( dt, kerid, cntx ); \
+\
+	f \
+	( \
+	  n, \
+	  x, incx, \
+	  y, incy, \
+	  ( ctype_r* )param, \
+	  ( cntx_t* )cntx  \
+	); \
+}
+
+INSERT_GENTFUNCR_BASIC( rotmv, BLIS_ROTMV_KER )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, kerid ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+             dim_t    n, \
+             ctype*   x, inc_t incx, \
+             ctype*   y, inc_t incy, \
+       const ctype_r* c, \
+       const ctype_r* s  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	PASTECH(opname,_ker_ft) f = bli_cntx_get_ukr_dt( dt, kerid, cntx ); \
+\
+	f \
+	( \
+	  n, \
+	  x, incx, \
+	  y, incy, \
+	  ( ctype_r* )c, \
+	  ( ctype_r* )s, \
+	  ( cntx_t* )cntx  \
+	); \
+}
+
+INSERT_GENTFUNCR_BASIC( rotv, BLIS_ROTV_KER )
+
+
 #undef  GENTFUNC
 #define GENTFUNC( ctype, ch, opname, kerid ) \
 \
@@ -168,6 +168,37 @@ INSERT_GENTPROT_BASIC( scalv )
 INSERT_GENTPROT_BASIC( setv )
 
 
+#undef  GENTPROTR
+#define GENTPROTR( ctype, ctype_r, ch, chr, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+             dim_t    n, \
+             ctype*   x, inc_t incx, \
+             ctype*   y, inc_t incy, \
+       const ctype_r* param  \
+       BLIS_TAPI_EX_PARAMS  \
+     ); \
+
+INSERT_GENTPROTR_BASIC( rotmv )
+
+
+#undef  GENTPROTR
+#define GENTPROTR( ctype, ctype_r, ch, chr, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+             dim_t    n, \
+             ctype*   x, inc_t incx, \
+             ctype*   y, inc_t incy, \
+       const ctype_r* c, \
+       const ctype_r* s  \
+       BLIS_TAPI_EX_PARAMS  \
+     ); \
+
+INSERT_GENTPROTR_BASIC( rotv )
+
+
 #undef  GENTPROT
 #define GENTPROT( ctype, ch, opname ) \
 \
@@ -48,6 +48,9 @@ static func_t packm_struc_cxk_kers[BLIS_NUM_PACK_SCHEMA_TYPES] =
 // 0010 row/col panels: 1m-reordered (1r)
     { { NULL,                      bli_cpackm_struc_cxk,
         NULL,                      bli_zpackm_struc_cxk,  } },
+// 0011 row/col panels: 3m-interleaved (3mi)
+    { { NULL,                      bli_cpackm_struc_cxk,
+        NULL,                      bli_zpackm_struc_cxk,  } },
 };
 
 static void_fp GENARRAY2_ALL(packm_struc_cxk_md,packm_struc_cxk_md);
@@ -160,6 +160,19 @@ bool bli_packm_init
 	// and 4m implementations.
 	inc_t is_p = 1;
 
+	// The 3m method stores the real, imaginary, and real+imaginary parts of
+	// each micropanel as three consecutive real micropanels. In this case,
+	// the imaginary stride is the distance (in units of real elements)
+	// between those real micropanels, and the panel stride (in units of
+	// complex elements) grows to span all three of them. NOTE: The 3mi
+	// packm kernels recompute this imaginary stride from ldp and the padded
+	// panel length, so the two computations must agree.
+	if ( bli_is_3mi_packed( schema ) )
+	{
+		is_p = ps_p;
+		ps_p = ( 3 * is_p ) / 2;
+	}
+
 	// Store the strides and panel dimension in P.
 	bli_obj_set_strides( rs_p, cs_p, p );
 	bli_obj_set_imag_stride( is_p, p );
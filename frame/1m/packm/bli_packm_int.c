@@ -63,6 +63,8 @@ void bli_packm_int
 	// and number of workgroups (n_way). Thus, we pass along the parent
 	// thrinfo_t node which has these two communicators as the sub-node and
 	// sub-prenode, respectively.
+	const double t_trace = bli_trace_pack_begin();
+
 	f
 	(
 	  a,
@@ -72,6 +74,8 @@ void bli_packm_int
 	  thread_par
 	);
 
+	bli_trace_pack_end( t_trace );
+
 	// Barrier so that packing is done before computation.
 	bli_thrinfo_barrier( thread );
 }
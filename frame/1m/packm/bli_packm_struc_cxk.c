@@ -79,6 +79,16 @@ void PASTEMAC(ch,varname) \
 		cxc_ker_id = bli_is_col_packed( schema ) ? BLIS_PACKM_NRXNR_DIAG_1ER_KER \
 		                                         : BLIS_PACKM_MRXMR_DIAG_1ER_KER; \
 	} \
+	else if ( bli_is_3mi_packed( schema ) ) \
+	{ \
+		/* The 3m method is only implemented for gemm, and so we only
+		   need to support packing general (dense) matrices. */ \
+		if ( !bli_is_general( strucc ) ) \
+			bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED ); \
+\
+		cxk_ker_id = bli_is_col_packed( schema ) ? BLIS_PACKM_NRXK_3MI_KER \
+		                                         : BLIS_PACKM_MRXK_3MI_KER; \
+	} \
 \
 	PASTECH(cxk_kername,_ker_ft) f_cxk = bli_cntx_get_ukr_dt( dt, cxk_ker_id, cntx ); \
 	PASTECH(cxc_kername,_ker_ft) f_cxc = bli_cntx_get_ukr_dt( dt, cxc_ker_id, cntx ); \
@@ -0,0 +1,292 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Perform checks common to all banded and packed operations. Note that the
+// dimensions of a describe the band or packed storage, not the logical
+// matrix, and so they are checked separately by each operation.
+static void bli_xbp_check
+     (
+       const obj_t* alpha,
+       const obj_t* a,
+       const obj_t* x
+     )
+{
+	err_t e_val;
+
+	// Check object datatypes.
+
+	e_val = bli_check_noninteger_object( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_floating_object( a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_floating_object( x );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_object_datatypes( a, x );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions.
+
+	e_val = bli_check_scalar_object( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_vector_object( x );
+	bli_check_error_code( e_val );
+
+	// Check object buffers (for non-NULLness).
+
+	e_val = bli_check_object_buffer( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( x );
+	bli_check_error_code( e_val );
+}
+
+static void bli_xbp_vec_check
+     (
+       const obj_t* x,
+       const obj_t* y
+     )
+{
+	err_t e_val;
+
+	e_val = bli_check_floating_object( y );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_object_datatypes( x, y );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_vector_object( y );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_equal_vector_lengths( x, y );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( y );
+	bli_check_error_code( e_val );
+}
+
+static void bli_xbp_beta_check
+     (
+       const obj_t* beta
+     )
+{
+	err_t e_val;
+
+	e_val = bli_check_noninteger_object( beta );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_scalar_object( beta );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( beta );
+	bli_check_error_code( e_val );
+}
+
+// Check that a packed triangle conforms to a vector of length m.
+static void bli_xbp_packed_check
+     (
+       const obj_t* a,
+       const obj_t* x
+     )
+{
+	err_t e_val;
+	dim_t m = bli_obj_vector_dim( x );
+
+	e_val = bli_check_vector_object( a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_vector_dim_equals( a, ( m * ( m + 1 ) ) / 2 );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_upper_or_lower_object( a );
+	bli_check_error_code( e_val );
+}
+
+// Check that the band storage of a square matrix with k off-diagonals
+// conforms to a vector of length m.
+static void bli_xbp_band_check
+     (
+             dim_t  k,
+       const obj_t* a,
+       const obj_t* x
+     )
+{
+	err_t e_val;
+
+	e_val = bli_check_matrix_object( a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_length_equals( a, k + 1 );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_width_equals( a, bli_obj_vector_dim( x ) );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_upper_or_lower_object( a );
+	bli_check_error_code( e_val );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_gbmv_check
+     (
+             dim_t  kl,
+             dim_t  ku,
+       const obj_t* alpha,
+       const obj_t* a,
+       const obj_t* x,
+       const obj_t* beta,
+       const obj_t* y
+     )
+{
+	err_t e_val;
+
+	bli_xbp_check( alpha, a, x );
+	bli_xbp_beta_check( beta );
+
+	e_val = bli_check_floating_object( y );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_object_datatypes( a, y );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_vector_object( y );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( y );
+	bli_check_error_code( e_val );
+
+	// The band storage holds kl + ku + 1 diagonals of the n columns of A,
+	// which must conform to x (or y, if A is transposed).
+
+	e_val = bli_check_matrix_object( a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_length_equals( a, kl + ku + 1 );
+	bli_check_error_code( e_val );
+
+	if ( bli_obj_has_notrans( a ) )
+		e_val = bli_check_vector_dim_equals( x, bli_obj_width( a ) );
+	else
+		e_val = bli_check_vector_dim_equals( y, bli_obj_width( a ) );
+	bli_check_error_code( e_val );
+}
+
+void bli_hbmv_check
+     (
+             dim_t  k,
+       const obj_t* alpha,
+       const obj_t* a,
+       const obj_t* x,
+       const obj_t* beta,
+       const obj_t* y
+     )
+{
+	bli_xbp_check( alpha, a, x );
+	bli_xbp_beta_check( beta );
+	bli_xbp_vec_check( x, y );
+	bli_xbp_band_check( k, a, x );
+}
+
+void bli_hpmv_check
+     (
+       const obj_t* alpha,
+       const obj_t* a,
+       const obj_t* x,
+       const obj_t* beta,
+       const obj_t* y
+     )
+{
+	bli_xbp_check( alpha, a, x );
+	bli_xbp_beta_check( beta );
+	bli_xbp_vec_check( x, y );
+	bli_xbp_packed_check( a, x );
+}
+
+void bli_hpr_check
+     (
+       const obj_t* alpha,
+       const obj_t* x,
+       const obj_t* a
+     )
+{
+	bli_xbp_check( alpha, a, x );
+	bli_xbp_packed_check( a, x );
+}
+
+void bli_hpr2_check
+     (
+       const obj_t* alpha,
+       const obj_t* x,
+       const obj_t* y,
+       const obj_t* a
+     )
+{
+	bli_xbp_check( alpha, a, x );
+	bli_xbp_vec_check( x, y );
+	bli_xbp_packed_check( a, x );
+}
+
+void bli_tbmv_check
+     (
+             dim_t  k,
+       const obj_t* alpha,
+       const obj_t* a,
+       const obj_t* x
+     )
+{
+	bli_xbp_check( alpha, a, x );
+	bli_xbp_band_check( k, a, x );
+}
+
+void bli_tpmv_check
+     (
+       const obj_t* alpha,
+       const obj_t* a,
+       const obj_t* x
+     )
+{
+	bli_xbp_check( alpha, a, x );
+	bli_xbp_packed_check( a, x );
+}
+
@@ -4,8 +4,7 @@
    An object-based framework for developing high-performance BLAS-like
    libraries.
 
-   Copyright (C) 2014, The University of Texas at Austin
-   Copyright (C) 2018, Advanced Micro Devices, Inc.
+   Copyright (C) 2022, The University of Texas at Austin
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -33,57 +32,69 @@
 
 */
 
-// Level-3 internal function type.
-typedef void (*l3aoint_ft)
+
+//
+// Prototype object-based check functions for banded and packed level-2
+// operations.
+//
+
+void bli_gbmv_check
+     (
+             dim_t  kl,
+             dim_t  ku,
+       const obj_t* alpha,
+       const obj_t* a,
+       const obj_t* x,
+       const obj_t* beta,
+       const obj_t* y
+     );
+
+void bli_hbmv_check
      (
-       obj_t*     alpha,
-       obj_t*     a,
-       obj_t*     b,
-       obj_t*     d,
-       obj_t*     beta,
-       obj_t*     c,
-       cntx_t*    cntx,
-       rntm_t*    rntm,
-       thrinfo_t* thread
+             dim_t  k,
+       const obj_t* alpha,
+       const obj_t* a,
+       const obj_t* x,
+       const obj_t* beta,
+       const obj_t* y
      );
 
-// Level-3 thread decorator function type.
-typedef void (*l3ao_decor_ft)
+void bli_hpmv_check
      (
-       l3aoint_ft func,
-       opid_t   family,
-       obj_t*   alpha,
-       obj_t*   a,
-       obj_t*   b,
-       obj_t*   d,
-       obj_t*   beta,
-       obj_t*   c,
-       cntx_t*  cntx,
-       rntm_t*  rntm
+       const obj_t* alpha,
+       const obj_t* a,
+       const obj_t* x,
+       const obj_t* beta,
+       const obj_t* y
      );
 
-// Level-3 thread decorator prototype.
-void bao_l3_thread_decorator
+void bli_hpr_check
      (
-       l3aoint_ft func,
-       opid_t   family,
-       obj_t*   alpha,
-       obj_t*   a,
-       obj_t*   b,
-       obj_t*   d,
-       obj_t*   beta,
-       obj_t*   c,
-       cntx_t*  cntx,
-       rntm_t*  rntm
+       const obj_t* alpha,
+       const obj_t* x,
+       const obj_t* a
      );
 
-void bao_l3_thread_decorator_check
+void bli_hpr2_check
      (
-       rntm_t* rntm
+       const obj_t* alpha,
+       const obj_t* x,
+       const obj_t* y,
+       const obj_t* a
      );
 
-// Include definitions specific to the method of multithreading.
-#include "bao_l3_decor_single.h"
-#include "bao_l3_decor_openmp.h"
-#include "bao_l3_decor_pthreads.h"
+void bli_tbmv_check
+     (
+             dim_t  k,
+       const obj_t* alpha,
+       const obj_t* a,
+       const obj_t* x
+     );
+
+void bli_tpmv_check
+     (
+       const obj_t* alpha,
+       const obj_t* a,
+       const obj_t* x
+     );
 
@@ -0,0 +1,157 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Prototype object-based interfaces for banded and packed level-2
+// operations. Banded matrices are passed as the (k+1) x m (or, for gbmv,
+// (kl+ku+1) x n) matrix that holds the band storage, and packed matrices
+// as vectors of length m*(m+1)/2. In both cases, the uplo, conj/trans, and
+// diag properties of a describe the logical matrix.
+//
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,EX_SUF) \
+     ( \
+             dim_t  kl, \
+             dim_t  ku, \
+       const obj_t* alpha, \
+       const obj_t* a, \
+       const obj_t* x, \
+       const obj_t* beta, \
+       const obj_t* y  \
+       BLIS_OAPI_EX_PARAMS  \
+     );
+
+GENPROT( gbmv )
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,EX_SUF) \
+     ( \
+             dim_t  k, \
+       const obj_t* alpha, \
+       const obj_t* a, \
+       const obj_t* x, \
+       const obj_t* beta, \
+       const obj_t* y  \
+       BLIS_OAPI_EX_PARAMS  \
+     );
+
+GENPROT( hbmv )
+GENPROT( sbmv )
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,EX_SUF) \
+     ( \
+       const obj_t* alpha, \
+       const obj_t* a, \
+       const obj_t* x, \
+       const obj_t* beta, \
+       const obj_t* y  \
+       BLIS_OAPI_EX_PARAMS  \
+     );
+
+GENPROT( hpmv )
+GENPROT( spmv )
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,EX_SUF) \
+     ( \
+       const obj_t* alpha, \
+       const obj_t* x, \
+       const obj_t* a  \
+       BLIS_OAPI_EX_PARAMS  \
+     );
+
+GENPROT( hpr )
+GENPROT( spr )
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,EX_SUF) \
+     ( \
+       const obj_t* alpha, \
+       const obj_t* x, \
+       const obj_t* y, \
+       const obj_t* a  \
+       BLIS_OAPI_EX_PARAMS  \
+     );
+
+GENPROT( hpr2 )
+GENPROT( spr2 )
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,EX_SUF) \
+     ( \
+             dim_t  k, \
+       const obj_t* alpha, \
+       const obj_t* a, \
+       const obj_t* x  \
+       BLIS_OAPI_EX_PARAMS  \
+     );
+
+GENPROT( tbmv )
+GENPROT( tbsv )
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,EX_SUF) \
+     ( \
+       const obj_t* alpha, \
+       const obj_t* a, \
+       const obj_t* x  \
+       BLIS_OAPI_EX_PARAMS  \
+     );
+
+GENPROT( tpmv )
+GENPROT( tpsv )
+
@@ -0,0 +1,545 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+// Guard the function definitions so that they are only compiled when
+// #included from files that define the typed API macros.
+#ifdef BLIS_ENABLE_TAPI
+
+//
+// Define BLAS-like interfaces with typed operands for banded and packed
+// matrices.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, varname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+             trans_t transa, \
+             conj_t  conjx, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   kl, \
+             dim_t   ku, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  x, inc_t incx, \
+       const ctype*  beta, \
+             ctype*  y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	dim_t m_y, n_x; \
+\
+	/* Determine the dimensions of y and x. */ \
+	bli_set_dims_with_trans( transa, m, n, &m_y, &n_x ); \
+\
+	/* If y has zero elements, return early. */ \
+	if ( bli_zero_dim1( m_y ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If x has zero elements, or if alpha is zero, scale y by beta and
+	   return early. */ \
+	if ( bli_zero_dim1( n_x ) || PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC2(ch,scalv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m_y, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	l2bp_params_t params; \
+\
+	/* Advance a so that element (i,j) of A resides at a + i*rs + j*cs
+	   (with cs = cs_a - rs_a), and then induce the transpose, if needed,
+	   by swapping the dimensions, the band widths, and the strides. */ \
+	params.var   = PASTEMAC(ch,varname); \
+	params.conja = bli_extract_conj( transa ); \
+	params.conjx = conjx; \
+	params.a     = ( ctype* )a + ku * rs_a; \
+\
+	if ( bli_does_notrans( transa ) ) \
+	{ \
+		params.m    = m;    params.n    = n; \
+		params.kl   = kl;   params.ku   = ku; \
+		params.rs_a = rs_a; params.cs_a = cs_a - rs_a; \
+	} \
+	else \
+	{ \
+		params.m    = n;           params.n    = m; \
+		params.kl   = ku;          params.ku   = kl; \
+		params.rs_a = cs_a - rs_a; params.cs_a = rs_a; \
+	} \
+\
+	params.n_iter   = m_y; \
+	params.weighted = FALSE; \
+	params.split_cols = ( bli_abs( params.rs_a ) <= bli_abs( params.cs_a ) ); \
+	params.alpha    = alpha; \
+	params.beta     = beta; \
+	params.x        = ( ctype* )x; \
+	params.incx     = incx; \
+	params.y        = y; \
+	params.incy     = incy; \
+	params.cntx     = cntx; \
+\
+	bli_l2bp_launch( n_x * ( kl + ku + 1 ), &params, rntm ); \
+}
+
+INSERT_GENTFUNC_BASIC( gbmv, gbmv_bp_var )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, conjherm, varname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+             uplo_t uploa, \
+             conj_t conja, \
+             conj_t conjx, \
+             dim_t  m, \
+             dim_t  k, \
+       const ctype* alpha, \
+       const ctype* a, inc_t rs_a, inc_t cs_a, \
+       const ctype* x, inc_t incx, \
+       const ctype* beta, \
+             ctype* y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If x has zero elements, or if alpha is zero, scale y by beta and
+	   return early. */ \
+	if ( bli_zero_dim1( m ) || PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC2(ch,scalv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	l2bp_params_t params; \
+\
+	bli_l2bp_init_band( uploa, m, k, rs_a, cs_a, &params.s ); \
+\
+	params.var      = PASTEMAC(ch,varname); \
+	params.n_iter   = m; \
+	params.weighted = FALSE; \
+	params.split_cols = TRUE; \
+	params.conja    = conja; \
+	params.conjh    = conjherm; \
+	params.conjx    = conjx; \
+	params.alpha    = alpha; \
+	params.beta     = beta; \
+	params.a        = ( ctype* )a + bli_l2bp_band_offset( uploa, k, rs_a ); \
+	params.x        = ( ctype* )x; \
+	params.incx     = incx; \
+	params.y        = y; \
+	params.incy     = incy; \
+	params.cntx     = cntx; \
+\
+	bli_l2bp_launch( m * ( 2 * k + 1 ), &params, rntm ); \
+}
+
+INSERT_GENTFUNC_BASIC( hbmv, BLIS_CONJUGATE,    hemv_bp_var )
+INSERT_GENTFUNC_BASIC( sbmv, BLIS_NO_CONJUGATE, hemv_bp_var )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, conjherm, varname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+             uplo_t uploa, \
+             conj_t conja, \
+             conj_t conjx, \
+             dim_t  m, \
+       const ctype* alpha, \
+       const ctype* a, \
+       const ctype* x, inc_t incx, \
+       const ctype* beta, \
+             ctype* y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If x has zero elements, or if alpha is zero, scale y by beta and
+	   return early. */ \
+	if ( bli_zero_dim1( m ) || PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC2(ch,scalv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  beta, \
+		  y, incy, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	l2bp_params_t params; \
+\
+	bli_l2bp_init_packed( uploa, m, &params.s ); \
+\
+	params.var      = PASTEMAC(ch,varname); \
+	params.n_iter   = m; \
+	params.weighted = FALSE; \
+	params.split_cols = TRUE; \
+	params.conja    = conja; \
+	params.conjh    = conjherm; \
+	params.conjx    = conjx; \
+	params.alpha    = alpha; \
+	params.beta     = beta; \
+	params.a        = ( ctype* )a; \
+	params.x        = ( ctype* )x; \
+	params.incx     = incx; \
+	params.y        = y; \
+	params.incy     = incy; \
+	params.cntx     = cntx; \
+\
+	bli_l2bp_launch( m * m, &params, rntm ); \
+}
+
+INSERT_GENTFUNC_BASIC( hpmv, BLIS_CONJUGATE,    hemv_bp_var )
+INSERT_GENTFUNC_BASIC( spmv, BLIS_NO_CONJUGATE, hemv_bp_var )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, conjherm, varname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+             uplo_t   uploa, \
+             conj_t   conjx, \
+             dim_t    m, \
+       const ctype_r* alpha, \
+       const ctype*   x, inc_t incx, \
+             ctype*   a  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	ctype alpha_local; \
+\
+	/* If x has zero elements, or if alpha is zero, return early. */ \
+	if ( bli_zero_dim1( m ) || PASTEMAC(chr,eq0)( *alpha ) ) return; \
+\
+	/* Make a local copy of alpha, cast into the complex domain. This
+	   allows us to use the same underlying variant to implement both
+	   hpr and spr. */ \
+	PASTEMAC2(chr,ch,copys)( *alpha, alpha_local ); \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	l2bp_params_t params; \
+\
+	bli_l2bp_init_packed( uploa, m, &params.s ); \
+\
+	params.var      = PASTEMAC(ch,varname); \
+	params.n_iter   = m; \
+	params.weighted = TRUE; \
+	params.split_cols = FALSE; \
+	params.conjh    = conjherm; \
+	params.conjx    = conjx; \
+	params.alpha    = &alpha_local; \
+	params.a        = a; \
+	params.x        = ( ctype* )x; \
+	params.incx     = incx; \
+	params.cntx     = cntx; \
+\
+	bli_l2bp_launch( ( m * ( m + 1 ) ) / 2, &params, rntm ); \
+}
+
+INSERT_GENTFUNCR_BASIC( hpr, BLIS_CONJUGATE, her_bp_var )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, conjherm, varname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+             uplo_t uploa, \
+             conj_t conjx, \
+             dim_t  m, \
+       const ctype* alpha, \
+       const ctype* x, inc_t incx, \
+             ctype* a  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* If x has zero elements, or if alpha is zero, return early. */ \
+	if ( bli_zero_dim1( m ) || PASTEMAC(ch,eq0)( *alpha ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	l2bp_params_t params; \
+\
+	bli_l2bp_init_packed( uploa, m, &params.s ); \
+\
+	params.var      = PASTEMAC(ch,varname); \
+	params.n_iter   = m; \
+	params.weighted = TRUE; \
+	params.split_cols = FALSE; \
+	params.conjh    = conjherm; \
+	params.conjx    = conjx; \
+	params.alpha    = alpha; \
+	params.a        = a; \
+	params.x        = ( ctype* )x; \
+	params.incx     = incx; \
+	params.cntx     = cntx; \
+\
+	bli_l2bp_launch( ( m * ( m + 1 ) ) / 2, &params, rntm ); \
+}
+
+INSERT_GENTFUNC_BASIC( spr, BLIS_NO_CONJUGATE, her_bp_var )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, conjherm, varname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+             uplo_t uploa, \
+             conj_t conjx, \
+             conj_t conjy, \
+             dim_t  m, \
+       const ctype* alpha, \
+       const ctype* x, inc_t incx, \
+       const ctype* y, inc_t incy, \
+             ctype* a  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* If x has zero elements, or if alpha is zero, return early. */ \
+	if ( bli_zero_dim1( m ) || PASTEMAC(ch,eq0)( *alpha ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	l2bp_params_t params; \
+\
+	bli_l2bp_init_packed( uploa, m, &params.s ); \
+\
+	params.var      = PASTEMAC(ch,varname); \
+	params.n_iter   = m; \
+	params.weighted = TRUE; \
+	params.split_cols = FALSE; \
+	params.conjh    = conjherm; \
+	params.conjx    = conjx; \
+	params.conjy    = conjy; \
+	params.alpha    = alpha; \
+	params.a        = a; \
+	params.x        = ( ctype* )x; \
+	params.incx     = incx; \
+	params.y        = ( ctype* )y; \
+	params.incy     = incy; \
+	params.cntx     = cntx; \
+\
+	bli_l2bp_launch( m * ( m + 1 ), &params, rntm ); \
+}
+
+INSERT_GENTFUNC_BASIC( hpr2, BLIS_CONJUGATE,    her2_bp_var )
+INSERT_GENTFUNC_BASIC( spr2, BLIS_NO_CONJUGATE, her2_bp_var )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, varname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+             uplo_t  uploa, \
+             trans_t transa, \
+             diag_t  diaga, \
+             dim_t   m, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+             ctype*  x, inc_t incx  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* If x has zero elements, return early. */ \
+	if ( bli_zero_dim1( m ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If alpha is zero, set x to zero and return early. */ \
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC2(ch,setv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  alpha, \
+		  x, incx, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	l2bp_t s; \
+\
+	bli_l2bp_init_band( uploa, m, k, rs_a, cs_a, &s ); \
+\
+	/* Each element of x depends on those computed before it, so the
+	   triangular operations are not parallelized. */ \
+	PASTEMAC(ch,varname) \
+	( \
+	  transa, \
+	  diaga, \
+	  alpha, \
+	  &s, \
+	  a + bli_l2bp_band_offset( uploa, k, rs_a ), \
+	  x, incx, \
+	  cntx  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( tbmv, trmv_bp_var )
+INSERT_GENTFUNC_BASIC( tbsv, trsv_bp_var )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, varname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+             uplo_t  uploa, \
+             trans_t transa, \
+             diag_t  diaga, \
+             dim_t   m, \
+       const ctype*  alpha, \
+       const ctype*  a, \
+             ctype*  x, inc_t incx  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* If x has zero elements, return early. */ \
+	if ( bli_zero_dim1( m ) ) return; \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* If alpha is zero, set x to zero and return early. */ \
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC2(ch,setv,BLIS_TAPI_EX_SUF) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  m, \
+		  alpha, \
+		  x, incx, \
+		  cntx, \
+		  NULL  \
+		); \
+		return; \
+	} \
+\
+	l2bp_t s; \
+\
+	bli_l2bp_init_packed( uploa, m, &s ); \
+\
+	PASTEMAC(ch,varname) \
+	( \
+	  transa, \
+	  diaga, \
+	  alpha, \
+	  &s, \
+	  a, \
+	  x, incx, \
+	  cntx  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( tpmv, trmv_bp_var )
+INSERT_GENTFUNC_BASIC( tpsv, trsv_bp_var )
+
+
+#endif
+
@@ -0,0 +1,751 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// -- Thread launch ------------------------------------------------------------
+//
+
+static void bli_l2bp_thread_range
+     (
+       const l2bp_params_t* p,
+             dim_t          nt,
+             dim_t          tid,
+             dim_t*         start,
+             dim_t*         end
+     )
+{
+	const dim_t n = p->n_iter;
+
+	if ( !p->weighted )
+	{
+		*start = ( n * tid       ) / nt;
+		*end   = ( n * ( tid + 1 ) ) / nt;
+		return;
+	}
+
+	// Columns of a packed triangle. Column j of an upper-stored matrix
+	// holds j+1 elements and column j of a lower-stored matrix holds m-j,
+	// so equalize the area of the trapezoid given to each thread.
+	const double f0 = ( double )tid         / ( double )nt;
+	const double f1 = ( double )( tid + 1 ) / ( double )nt;
+
+	if ( bli_is_upper( p->s.uplo ) )
+	{
+		*start = ( dim_t )( n * sqrt( f0 ) );
+		*end   = ( dim_t )( n * sqrt( f1 ) );
+	}
+	else
+	{
+		*start = ( dim_t )( n * ( 1.0 - sqrt( 1.0 - f0 ) ) );
+		*end   = ( dim_t )( n * ( 1.0 - sqrt( 1.0 - f1 ) ) );
+	}
+
+	if ( tid == 0      ) *start = 0;
+	if ( tid == nt - 1 ) *end   = n;
+}
+
+static void bli_l2bp_thread_entry
+     (
+             thrcomm_t* gl_comm,
+             dim_t      tid,
+       const void*      params
+     )
+{
+	const l2bp_params_t* p  = params;
+	const dim_t          nt = bli_thrcomm_num_threads( gl_comm );
+
+	dim_t start, end;
+
+	bli_l2bp_thread_range( p, nt, tid, &start, &end );
+
+	if ( start < end ) p->var( p, start, end );
+}
+
+void bli_l2bp_launch
+     (
+             dim_t          work,
+             l2bp_params_t* params,
+       const rntm_t*        rntm
+     )
+{
+	rntm_t  rntm_l;
+	timpl_t ti = BLIS_SINGLE;
+	dim_t   nt = 1;
+
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); }
+	else                { rntm_l = *rntm;                       }
+
+#ifdef BLIS_ENABLE_MULTITHREADING
+	ti = bli_rntm_thread_impl( &rntm_l );
+	nt = bli_rntm_num_threads( &rntm_l );
+
+	// Only use as many threads as there is enough work to keep busy.
+	nt = bli_min( nt, work / BLIS_L2BP_MT_MIN_WORK );
+	nt = bli_min( nt, params->n_iter );
+
+	// If the result must be independent of the number of threads, execute
+	// any variant whose partition would split the column updates serially.
+	if ( params->split_cols && bli_rntm_repro( &rntm_l ) ) nt = 1;
+
+	if ( ti == BLIS_SINGLE ) nt = 1;
+#endif
+
+	if ( nt <= 1 )
+	{
+		params->var( params, 0, params->n_iter );
+		return;
+	}
+
+	bli_thread_launch( ti, nt, bli_l2bp_thread_entry, params );
+}
+
+//
+// -- gbmv ---------------------------------------------------------------------
+//
+
+// Compute rows [start,end) of y := beta * y + alpha * conja(A) * conjx(x),
+// where A is an m x n band matrix with kl subdiagonals and ku superdiagonals
+// whose element (i,j) is stored at a + i*rs_a + j*cs_a (i.e., the transpose
+// and the band offset have already been folded into a, rs_a and cs_a by the
+// caller). Depending on which of the two strides is smaller, each row of y
+// is computed with a single dotxv, or y is updated one column at a time
+// with axpyv.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       const l2bp_params_t* p, \
+             dim_t          start, \
+             dim_t          end  \
+     ) \
+{ \
+	const num_t   dt    = PASTEMAC(ch,type); \
+\
+	const conj_t  conja = p->conja; \
+	const conj_t  conjx = p->conjx; \
+	const dim_t   m     = p->m; \
+	const dim_t   n     = p->n; \
+	const dim_t   kl    = p->kl; \
+	const dim_t   ku    = p->ku; \
+	const ctype*  alpha = p->alpha; \
+	const ctype*  beta  = p->beta; \
+	const ctype*  a     = p->a; \
+	const inc_t   rs_a  = p->rs_a; \
+	const inc_t   cs_a  = p->cs_a; \
+	const ctype*  x     = p->x; \
+	const inc_t   incx  = p->incx; \
+	      ctype*  y     = p->y; \
+	const inc_t   incy  = p->incy; \
+	const cntx_t* cntx  = p->cntx; \
+\
+	( void )m; \
+\
+	if ( bli_abs( cs_a ) < bli_abs( rs_a ) ) \
+	{ \
+		dotxv_ker_ft kfp_dv = bli_cntx_get_ukr_dt( dt, BLIS_DOTXV_KER, cntx ); \
+\
+		for ( dim_t i = start; i < end; ++i ) \
+		{ \
+			const dim_t j0  = bli_max( 0, i - kl ); \
+			const dim_t j1  = bli_min( n, i + ku + 1 ); \
+			      ctype* psi = y + i*incy; \
+\
+			if ( j1 <= j0 ) \
+			{ \
+				if ( PASTEMAC(ch,eq0)( *beta ) ) { PASTEMAC(ch,set0s)( *psi ); } \
+				else                              { PASTEMAC(ch,scals)( *beta, *psi ); } \
+				continue; \
+			} \
+\
+			/* psi = beta * psi + alpha * conja(a(i,j0:j1-1)) * conjx(x(j0:j1-1)); */ \
+			kfp_dv \
+			( \
+			  conja, \
+			  conjx, \
+			  j1 - j0, \
+			  alpha, \
+			  a + i*rs_a + j0*cs_a, cs_a, \
+			  x + j0*incx, incx, \
+			  beta, \
+			  psi, \
+			  cntx  \
+			); \
+		} \
+	} \
+	else \
+	{ \
+		scalv_ker_ft kfp_sv = bli_cntx_get_ukr_dt( dt, BLIS_SCALV_KER, cntx ); \
+		axpyv_ker_ft kfp_av = bli_cntx_get_ukr_dt( dt, BLIS_AXPYV_KER, cntx ); \
+\
+		/* y(start:end-1) = beta * y(start:end-1); */ \
+		kfp_sv \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  end - start, \
+		  beta, \
+		  y + start*incy, incy, \
+		  cntx  \
+		); \
+\
+		const dim_t j0 = bli_max( 0, start - kl ); \
+		const dim_t j1 = bli_min( n, end + ku ); \
+\
+		for ( dim_t j = j0; j < j1; ++j ) \
+		{ \
+			const dim_t i0 = bli_max( start, j - ku ); \
+			const dim_t i1 = bli_min( end, j + kl + 1 ); \
+			      ctype alpha_chi1; \
+\
+			if ( i1 <= i0 ) continue; \
+\
+			PASTEMAC(ch,copycjs)( conjx, x[ j*incx ], alpha_chi1 ); \
+			PASTEMAC(ch,scals)( *alpha, alpha_chi1 ); \
+\
+			/* y(i0:i1-1) += alpha * conjx(chi1) * conja(a(i0:i1-1,j)); */ \
+			kfp_av \
+			( \
+			  conja, \
+			  i1 - i0, \
+			  &alpha_chi1, \
+			  a + i0*rs_a + j*cs_a, rs_a, \
+			  y + i0*incy, incy, \
+			  cntx  \
+			); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( gbmv_bp_var )
+
+//
+// -- hemv/symv ----------------------------------------------------------------
+//
+
+// Compute rows [start,end) of y := beta * y + alpha * conja(A) * conjx(x),
+// where A is a Hermitian (conjh = BLIS_CONJUGATE) or symmetric matrix in
+// banded or packed storage. Every stored column j contributes an axpyv to
+// the rows of y owned by the current thread and, if the current thread owns
+// row j, a dotxv with the implicitly stored (conjugate-)transpose.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       const l2bp_params_t* p, \
+             dim_t          start, \
+             dim_t          end  \
+     ) \
+{ \
+	const num_t   dt    = PASTEMAC(ch,type); \
+\
+	const l2bp_t* s     = &p->s; \
+	const conj_t  conja = p->conja; \
+	const conj_t  conjh = p->conjh; \
+	const conj_t  conjx = p->conjx; \
+	const ctype*  alpha = p->alpha; \
+	const ctype*  beta  = p->beta; \
+	const ctype*  a     = p->a; \
+	const ctype*  x     = p->x; \
+	const inc_t   incx  = p->incx; \
+	      ctype*  y     = p->y; \
+	const inc_t   incy  = p->incy; \
+	const cntx_t* cntx  = p->cntx; \
+	const ctype*  one   = PASTEMAC(ch,1); \
+\
+	/* The implicitly stored half of A is conjh(conja(A)). */ \
+	const conj_t  conjat = bli_apply_conj( conjh, conja ); \
+\
+	scalv_ker_ft kfp_sv = bli_cntx_get_ukr_dt( dt, BLIS_SCALV_KER, cntx ); \
+	axpyv_ker_ft kfp_av = bli_cntx_get_ukr_dt( dt, BLIS_AXPYV_KER, cntx ); \
+	dotxv_ker_ft kfp_dv = bli_cntx_get_ukr_dt( dt, BLIS_DOTXV_KER, cntx ); \
+\
+	/* y(start:end-1) = beta * y(start:end-1); */ \
+	kfp_sv \
+	( \
+	  BLIS_NO_CONJUGATE, \
+	  end - start, \
+	  beta, \
+	  y + start*incy, incy, \
+	  cntx  \
+	); \
+\
+	dim_t j0, j1; \
+\
+	bli_l2bp_cols_for_rows( s, start, end, &j0, &j1 ); \
+\
+	for ( dim_t j = j0; j < j1; ++j ) \
+	{ \
+		dim_t i0, i1; \
+		inc_t off, inc; \
+		ctype alpha_chi1; \
+\
+		bli_l2bp_col( s, j, &i0, &i1, &off, &inc ); \
+\
+		const ctype* a1 = a + off; \
+\
+		PASTEMAC(ch,copycjs)( conjx, x[ j*incx ], alpha_chi1 ); \
+		PASTEMAC(ch,scals)( *alpha, alpha_chi1 ); \
+\
+		/* Restrict the column to the rows owned by this thread. */ \
+		const dim_t c0 = bli_max( i0, start ); \
+		const dim_t c1 = bli_min( i1, end ); \
+\
+		if ( c0 < c1 ) \
+		{ \
+			/* y(c0:c1-1) += alpha * conjx(chi1) * conja(a(c0:c1-1,j)); */ \
+			kfp_av \
+			( \
+			  conja, \
+			  c1 - c0, \
+			  &alpha_chi1, \
+			  a1 + ( c0 - i0 )*inc, inc, \
+			  y + c0*incy, incy, \
+			  cntx  \
+			); \
+		} \
+\
+		if ( start <= j && j < end ) \
+		{ \
+			ctype* psi1 = y + j*incy; \
+			ctype  alpha11; \
+\
+			/* psi1 += alpha * conjat(a(i0:i1-1,j))^T * conjx(x(i0:i1-1)); */ \
+			kfp_dv \
+			( \
+			  conjat, \
+			  conjx, \
+			  i1 - i0, \
+			  alpha, \
+			  a1, inc, \
+			  x + i0*incx, incx, \
+			  one, \
+			  psi1, \
+			  cntx  \
+			); \
+\
+			/* psi1 += alpha * conja(alpha11) * conjx(chi1), where the
+			   imaginary part of alpha11 is ignored for hemv. */ \
+			PASTEMAC(ch,copycjs)( conja, a[ bli_l2bp_diag( s, j ) ], alpha11 ); \
+			if ( bli_is_conj( conjh ) ) PASTEMAC(ch,seti0s)( alpha11 ); \
+			PASTEMAC(ch,axpys)( alpha11, alpha_chi1, *psi1 ); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( hemv_bp_var )
+
+//
+// -- her/syr ------------------------------------------------------------------
+//
+
+// Update columns [start,end) of A := A + alpha * conjx(x) * conjh(conjx(x))^T,
+// where A is a Hermitian or symmetric matrix in packed storage.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       const l2bp_params_t* p, \
+             dim_t          start, \
+             dim_t          end  \
+     ) \
+{ \
+	const num_t   dt    = PASTEMAC(ch,type); \
+\
+	const l2bp_t* s     = &p->s; \
+	const conj_t  conjh = p->conjh; \
+	const conj_t  conjx = p->conjx; \
+	const ctype*  x     = p->x; \
+	const inc_t   incx  = p->incx; \
+	      ctype*  a     = p->a; \
+	const cntx_t* cntx  = p->cntx; \
+\
+	ctype alpha_local; \
+\
+	/* her requires alpha to be real. */ \
+	PASTEMAC(ch,copys)( *( ctype* )p->alpha, alpha_local ); \
+	if ( bli_is_conj( conjh ) ) PASTEMAC(ch,seti0s)( alpha_local ); \
+\
+	const conj_t conj1 = bli_apply_conj( conjh, conjx ); \
+\
+	/* The conjugation parameters are unused by the real domain copycjs(). */ \
+	( void )conj1; \
+\
+	axpyv_ker_ft kfp_av = bli_cntx_get_ukr_dt( dt, BLIS_AXPYV_KER, cntx ); \
+\
+	for ( dim_t j = start; j < end; ++j ) \
+	{ \
+		dim_t  i0, i1; \
+		inc_t  off, inc; \
+		ctype  alpha_chi1; \
+		ctype  conjx_chi1; \
+		ctype* alpha11 = a + bli_l2bp_diag( s, j ); \
+\
+		bli_l2bp_col( s, j, &i0, &i1, &off, &inc ); \
+\
+		PASTEMAC(ch,copycjs)( conj1, x[ j*incx ], alpha_chi1 ); \
+		PASTEMAC(ch,scals)( alpha_local, alpha_chi1 ); \
+		PASTEMAC(ch,copycjs)( conjx, x[ j*incx ], conjx_chi1 ); \
+\
+		/* a(i0:i1-1,j) += alpha * conjh(conjx(chi1)) * conjx(x(i0:i1-1)); */ \
+		kfp_av \
+		( \
+		  conjx, \
+		  i1 - i0, \
+		  &alpha_chi1, \
+		  x + i0*incx, incx, \
+		  a + off, inc, \
+		  cntx  \
+		); \
+\
+		/* alpha11 += alpha * conjx(chi1) * conjh(conjx(chi1)); */ \
+		PASTEMAC(ch,axpys)( alpha_chi1, conjx_chi1, *alpha11 ); \
+		if ( bli_is_conj( conjh ) ) PASTEMAC(ch,seti0s)( *alpha11 ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( her_bp_var )
+
+//
+// -- her2/syr2 ----------------------------------------------------------------
+//
+
+// Update columns [start,end) of
+//
+//   A := A + alpha * conjx(x) * conjh(conjy(y))^T
+//          + conjh(alpha) * conjy(y) * conjh(conjx(x))^T,
+//
+// where A is a Hermitian or symmetric matrix in packed storage.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       const l2bp_params_t* p, \
+             dim_t          start, \
+             dim_t          end  \
+     ) \
+{ \
+	const num_t   dt    = PASTEMAC(ch,type); \
+\
+	const l2bp_t* s     = &p->s; \
+	const conj_t  conjh = p->conjh; \
+	const conj_t  conjx = p->conjx; \
+	const conj_t  conjy = p->conjy; \
+	const ctype*  alpha = p->alpha; \
+	const ctype*  x     = p->x; \
+	const inc_t   incx  = p->incx; \
+	const ctype*  y     = p->y; \
+	const inc_t   incy  = p->incy; \
+	      ctype*  a     = p->a; \
+	const cntx_t* cntx  = p->cntx; \
+\
+	ctype alpha0; \
+\
+	/* alpha0 = conjh(alpha); */ \
+	PASTEMAC(ch,copycjs)( conjh, *alpha, alpha0 ); \
+\
+	const conj_t conjx1 = bli_apply_conj( conjh, conjx ); \
+	const conj_t conjy1 = bli_apply_conj( conjh, conjy ); \
+\
+	/* The conjugation parameters are unused by the real domain copycjs(). */ \
+	( void )conjx1; \
+	( void )conjy1; \
+\
+	axpyv_ker_ft kfp_av = bli_cntx_get_ukr_dt( dt, BLIS_AXPYV_KER, cntx ); \
+\
+	for ( dim_t j = start; j < end; ++j ) \
+	{ \
+		dim_t  i0, i1; \
+		inc_t  off, inc; \
+		ctype  alpha_psi1; \
+		ctype  alpha0_chi1; \
+		ctype  conjx_chi1; \
+		ctype  conjy_psi1; \
+		ctype* alpha11 = a + bli_l2bp_diag( s, j ); \
+\
+		bli_l2bp_col( s, j, &i0, &i1, &off, &inc ); \
+\
+		PASTEMAC(ch,copycjs)( conjy1, y[ j*incy ], alpha_psi1 ); \
+		PASTEMAC(ch,scals)( *alpha, alpha_psi1 ); \
+		PASTEMAC(ch,copycjs)( conjx1, x[ j*incx ], alpha0_chi1 ); \
+		PASTEMAC(ch,scals)( alpha0, alpha0_chi1 ); \
+		PASTEMAC(ch,copycjs)( conjx, x[ j*incx ], conjx_chi1 ); \
+		PASTEMAC(ch,copycjs)( conjy, y[ j*incy ], conjy_psi1 ); \
+\
+		/* a(i0:i1-1,j) += alpha * conjh(conjy(psi1)) * conjx(x(i0:i1-1)); */ \
+		kfp_av \
+		( \
+		  conjx, \
+		  i1 - i0, \
+		  &alpha_psi1, \
+		  x + i0*incx, incx, \
+		  a + off, inc, \
+		  cntx  \
+		); \
+\
+		/* a(i0:i1-1,j) += conjh(alpha) * conjh(conjx(chi1)) * conjy(y(i0:i1-1)); */ \
+		kfp_av \
+		( \
+		  conjy, \
+		  i1 - i0, \
+		  &alpha0_chi1, \
+		  y + i0*incy, incy, \
+		  a + off, inc, \
+		  cntx  \
+		); \
+\
+		/* alpha11 += alpha * conjx(chi1) * conjh(conjy(psi1))
+		            + conjh(alpha) * conjy(psi1) * conjh(conjx(chi1)); */ \
+		PASTEMAC(ch,axpys)( alpha_psi1,  conjx_chi1, *alpha11 ); \
+		PASTEMAC(ch,axpys)( alpha0_chi1, conjy_psi1, *alpha11 ); \
+		if ( bli_is_conj( conjh ) ) PASTEMAC(ch,seti0s)( *alpha11 ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( her2_bp_var )
+
+//
+// -- trmv ---------------------------------------------------------------------
+//
+
+// Compute x := alpha * transa(A) * x, where A is a triangular matrix in
+// banded or packed storage. The no-transpose case sweeps the columns of A
+// with axpyv; the transpose case computes one element of x per column with
+// dotxv. In both cases, the order of the sweep is chosen so that each
+// element of x is consumed before it is overwritten.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             trans_t transa, \
+             diag_t  diaga, \
+       const ctype*  alpha, \
+       const l2bp_t* s, \
+       const ctype*  a, \
+             ctype*  x, inc_t incx, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const num_t  dt    = PASTEMAC(ch,type); \
+	const dim_t  m     = s->m; \
+	const conj_t conja = bli_extract_conj( transa ); \
+\
+	/* Sweep forward through the columns if the elements of x that column j
+	   reads (transpose) or updates (no transpose) have not yet been, or have
+	   already been, overwritten, respectively. */ \
+	const bool   fwd   = ( bli_does_trans( transa ) ? bli_is_lower( s->uplo ) \
+	                                                : bli_is_upper( s->uplo ) ); \
+\
+	axpyv_ker_ft kfp_av = bli_cntx_get_ukr_dt( dt, BLIS_AXPYV_KER, cntx ); \
+	dotxv_ker_ft kfp_dv = bli_cntx_get_ukr_dt( dt, BLIS_DOTXV_KER, cntx ); \
+\
+	for ( dim_t jj = 0; jj < m; ++jj ) \
+	{ \
+		const dim_t j = ( fwd ? jj : m - jj - 1 ); \
+\
+		dim_t  i0, i1; \
+		inc_t  off, inc; \
+		ctype  alpha11; \
+		ctype* chi1 = x + j*incx; \
+\
+		bli_l2bp_col( s, j, &i0, &i1, &off, &inc ); \
+\
+		/* alpha11 = alpha * conja(alpha11); */ \
+		if ( bli_is_nonunit_diag( diaga ) ) \
+		{ \
+			PASTEMAC(ch,copycjs)( conja, a[ bli_l2bp_diag( s, j ) ], alpha11 ); \
+			PASTEMAC(ch,scals)( *alpha, alpha11 ); \
+		} \
+		else \
+		{ \
+			PASTEMAC(ch,copys)( *alpha, alpha11 ); \
+		} \
+\
+		if ( bli_does_notrans( transa ) ) \
+		{ \
+			ctype alpha_chi1; \
+\
+			PASTEMAC(ch,scal2s)( *alpha, *chi1, alpha_chi1 ); \
+\
+			/* x(i0:i1-1) += alpha * chi1 * conja(a(i0:i1-1,j)); */ \
+			kfp_av \
+			( \
+			  conja, \
+			  i1 - i0, \
+			  &alpha_chi1, \
+			  a + off, inc, \
+			  x + i0*incx, incx, \
+			  cntx  \
+			); \
+\
+			/* chi1 = alpha11 * chi1; */ \
+			PASTEMAC(ch,scals)( alpha11, *chi1 ); \
+		} \
+		else \
+		{ \
+			/* chi1 = alpha11 * chi1 + alpha * conja(a(i0:i1-1,j))^T * x(i0:i1-1); */ \
+			kfp_dv \
+			( \
+			  conja, \
+			  BLIS_NO_CONJUGATE, \
+			  i1 - i0, \
+			  alpha, \
+			  a + off, inc, \
+			  x + i0*incx, incx, \
+			  &alpha11, \
+			  chi1, \
+			  cntx  \
+			); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( trmv_bp_var )
+
+//
+// -- trsv ---------------------------------------------------------------------
+//
+
+// Solve transa(A) * x = alpha * b, overwriting x (which holds b on entry),
+// where A is a triangular matrix in banded or packed storage. As with trmv,
+// the no-transpose case is column-oriented (axpyv) and the transpose case
+// is dot-based (dotxv).
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             trans_t transa, \
+             diag_t  diaga, \
+       const ctype*  alpha, \
+       const l2bp_t* s, \
+       const ctype*  a, \
+             ctype*  x, inc_t incx, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const num_t  dt    = PASTEMAC(ch,type); \
+	const dim_t  m     = s->m; \
+	const conj_t conja = bli_extract_conj( transa ); \
+	const ctype* one   = PASTEMAC(ch,1); \
+	const ctype* m_one = PASTEMAC(ch,m1); \
+\
+	/* Substitution proceeds away from the corner where the first unknown
+	   may be computed directly. */ \
+	const bool   fwd   = ( bli_does_trans( transa ) ? bli_is_upper( s->uplo ) \
+	                                                : bli_is_lower( s->uplo ) ); \
+\
+	scalv_ker_ft kfp_sv = bli_cntx_get_ukr_dt( dt, BLIS_SCALV_KER, cntx ); \
+	axpyv_ker_ft kfp_av = bli_cntx_get_ukr_dt( dt, BLIS_AXPYV_KER, cntx ); \
+	dotxv_ker_ft kfp_dv = bli_cntx_get_ukr_dt( dt, BLIS_DOTXV_KER, cntx ); \
+\
+	/* x = alpha * x; */ \
+	kfp_sv \
+	( \
+	  BLIS_NO_CONJUGATE, \
+	  m, \
+	  alpha, \
+	  x, incx, \
+	  cntx  \
+	); \
+\
+	for ( dim_t jj = 0; jj < m; ++jj ) \
+	{ \
+		const dim_t j = ( fwd ? jj : m - jj - 1 ); \
+\
+		dim_t  i0, i1; \
+		inc_t  off, inc; \
+		ctype  alpha11; \
+		ctype* chi1 = x + j*incx; \
+\
+		bli_l2bp_col( s, j, &i0, &i1, &off, &inc ); \
+\
+		if ( bli_does_trans( transa ) ) \
+		{ \
+			/* chi1 = chi1 - conja(a(i0:i1-1,j))^T * x(i0:i1-1); */ \
+			kfp_dv \
+			( \
+			  conja, \
+			  BLIS_NO_CONJUGATE, \
+			  i1 - i0, \
+			  m_one, \
+			  a + off, inc, \
+			  x + i0*incx, incx, \
+			  one, \
+			  chi1, \
+			  cntx  \
+			); \
+		} \
+\
+		/* chi1 = chi1 / conja(alpha11); */ \
+		if ( bli_is_nonunit_diag( diaga ) ) \
+		{ \
+			PASTEMAC(ch,copycjs)( conja, a[ bli_l2bp_diag( s, j ) ], alpha11 ); \
+			PASTEMAC(ch,invscals)( alpha11, *chi1 ); \
+		} \
+\
+		if ( bli_does_notrans( transa ) ) \
+		{ \
+			ctype minus_chi1; \
+\
+			PASTEMAC(ch,neg2s)( *chi1, minus_chi1 ); \
+\
+			/* x(i0:i1-1) -= chi1 * conja(a(i0:i1-1,j)); */ \
+			kfp_av \
+			( \
+			  conja, \
+			  i1 - i0, \
+			  &minus_chi1, \
+			  a + off, inc, \
+			  x + i0*incx, incx, \
+			  cntx  \
+			); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( trsv_bp_var )
+
@@ -0,0 +1,300 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_L2BP_VAR_H
+#define BLIS_L2BP_VAR_H
+
+// The minimum number of stored matrix elements that each thread must be
+// given before a banded or packed level-2 operation is parallelized. Below
+// this threshold, the operation is memory- or overhead-bound and extra
+// threads only get in each other's way.
+#ifndef BLIS_L2BP_MT_MIN_WORK
+#define BLIS_L2BP_MT_MIN_WORK 32768
+#endif
+
+//
+// -- Banded/packed storage descriptor -----------------------------------------
+//
+
+// A banded matrix stored in the usual (BLAS) band format is a general
+// strided matrix in disguise: element (i,j) lives at
+//
+//   a + (k+i-j)*rs_a + j*cs_a  =  a_e + i*rs_a + j*(cs_a-rs_a)
+//
+// where k is the number of superdiagonals (or zero for lower-stored
+// matrices). Thus, once a has been advanced to a_e, the stored elements of
+// row i and column j form vectors with strides (cs_a-rs_a) and rs_a,
+// respectively, and transposition is simply a swap of those two strides.
+// Packed matrices do not share this property, but each stored column is
+// still contiguous. The descriptor below captures both cases so that the
+// symmetric/Hermitian and triangular variants may be written once in terms
+// of column segments.
+
+typedef struct
+{
+	bool   packed;
+	uplo_t uplo;
+	dim_t  m;
+
+	// The following fields are only used for banded storage.
+	dim_t  k;
+	inc_t  rs;
+	inc_t  cs;
+} l2bp_t;
+
+BLIS_INLINE void bli_l2bp_init_band
+     (
+       uplo_t  uplo,
+       dim_t   m,
+       dim_t   k,
+       inc_t   rs_a,
+       inc_t   cs_a,
+       l2bp_t* s
+     )
+{
+	s->packed = FALSE;
+	s->uplo   = uplo;
+	s->m      = m;
+	s->k      = k;
+	s->rs     = rs_a;
+	s->cs     = cs_a - rs_a;
+}
+
+BLIS_INLINE void bli_l2bp_init_packed
+     (
+       uplo_t  uplo,
+       dim_t   m,
+       l2bp_t* s
+     )
+{
+	s->packed = TRUE;
+	s->uplo   = uplo;
+	s->m      = m;
+	s->k      = 0;
+	s->rs     = 1;
+	s->cs     = 0;
+}
+
+// Return the offset, in units of elements, from the address of the band
+// storage to the base address a_e described above.
+BLIS_INLINE inc_t bli_l2bp_band_offset( uplo_t uplo, dim_t k, inc_t rs_a )
+{
+	return ( bli_is_upper( uplo ) ? k * rs_a : 0 );
+}
+
+// Query the strictly off-diagonal part of stored column j: rows [i0,i1),
+// the offset of element (i0,j), and the stride between elements.
+BLIS_INLINE void bli_l2bp_col
+     (
+       const l2bp_t* s,
+             dim_t   j,
+             dim_t*  i0,
+             dim_t*  i1,
+             inc_t*  off,
+             inc_t*  inc
+     )
+{
+	if ( s->packed )
+	{
+		if ( bli_is_upper( s->uplo ) )
+		{
+			*i0  = 0;
+			*i1  = j;
+			*off = ( j * ( j + 1 ) ) / 2;
+		}
+		else
+		{
+			*i0  = j + 1;
+			*i1  = s->m;
+			*off = j * s->m - ( j * ( j - 1 ) ) / 2 + 1;
+		}
+		*inc = 1;
+	}
+	else
+	{
+		if ( bli_is_upper( s->uplo ) )
+		{
+			*i0 = bli_max( 0, j - s->k );
+			*i1 = j;
+		}
+		else
+		{
+			*i0 = j + 1;
+			*i1 = bli_min( s->m, j + s->k + 1 );
+		}
+		*off = *i0 * s->rs + j * s->cs;
+		*inc = s->rs;
+	}
+}
+
+// Return the offset of diagonal element (j,j).
+BLIS_INLINE inc_t bli_l2bp_diag( const l2bp_t* s, dim_t j )
+{
+	if ( s->packed )
+	{
+		if ( bli_is_upper( s->uplo ) ) return ( j * ( j + 1 ) ) / 2 + j;
+		else                           return j * s->m - ( j * ( j - 1 ) ) / 2;
+	}
+
+	return j * ( s->rs + s->cs );
+}
+
+// Return the range of columns [j0,j1) whose stored off-diagonal elements
+// or diagonal intersect rows [r0,r1).
+BLIS_INLINE void bli_l2bp_cols_for_rows
+     (
+       const l2bp_t* s,
+             dim_t   r0,
+             dim_t   r1,
+             dim_t*  j0,
+             dim_t*  j1
+     )
+{
+	if ( bli_is_upper( s->uplo ) )
+	{
+		*j0 = r0;
+		*j1 = ( s->packed ? s->m : bli_min( s->m, r1 + s->k ) );
+	}
+	else
+	{
+		*j0 = ( s->packed ? 0 : bli_max( 0, r0 - s->k ) );
+		*j1 = r1;
+	}
+}
+
+//
+// -- Thread parameters --------------------------------------------------------
+//
+
+// The multithreaded variants below partition either the rows of y (gbmv,
+// hemv/symv) or the columns of A (her/syr, her2/syr2) among threads. Each
+// thread updates only the elements it owns, so no synchronization beyond
+// the implicit join is needed.
+
+struct l2bp_params_s;
+
+typedef void (*l2bp_var_ft)
+     (
+       const struct l2bp_params_s* p,
+             dim_t                 start,
+             dim_t                 end
+     );
+
+typedef struct l2bp_params_s
+{
+	l2bp_var_ft   var;
+
+	// The extent partitioned among threads and, for column-partitioned
+	// variants applied to packed triangles, whether the work is skewed.
+	dim_t         n_iter;
+	bool          weighted;
+
+	// Whether the partition splits the column updates (axpyv) themselves,
+	// in which case the rounding of the result depends on the number of
+	// threads (since each kernel invocation may handle its edge differently).
+	bool          split_cols;
+
+	l2bp_t        s;
+
+	conj_t        conja;
+	conj_t        conjh;
+	conj_t        conjx;
+	conj_t        conjy;
+
+	// Dimensions and band widths (gbmv only).
+	dim_t         m;
+	dim_t         n;
+	dim_t         kl;
+	dim_t         ku;
+
+	const void*   alpha;
+	const void*   beta;
+	void*         a;
+	inc_t         rs_a;
+	inc_t         cs_a;
+	void*         x;
+	inc_t         incx;
+	void*         y;
+	inc_t         incy;
+
+	const cntx_t* cntx;
+} l2bp_params_t;
+
+void bli_l2bp_launch
+     (
+             dim_t          work,
+             l2bp_params_t* params,
+       const rntm_t*        rntm
+     );
+
+//
+// -- Variant prototypes -------------------------------------------------------
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       const l2bp_params_t* p, \
+             dim_t          start, \
+             dim_t          end  \
+     );
+
+INSERT_GENTPROT_BASIC( gbmv_bp_var )
+INSERT_GENTPROT_BASIC( hemv_bp_var )
+INSERT_GENTPROT_BASIC( her_bp_var )
+INSERT_GENTPROT_BASIC( her2_bp_var )
+
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+             trans_t transa, \
+             diag_t  diaga, \
+       const ctype*  alpha, \
+       const l2bp_t* s, \
+       const ctype*  a, \
+             ctype*  x, inc_t incx, \
+       const cntx_t* cntx  \
+     );
+
+INSERT_GENTPROT_BASIC( trmv_bp_var )
+INSERT_GENTPROT_BASIC( trsv_bp_var )
+
+#endif
+
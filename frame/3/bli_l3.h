@@ -92,3 +92,18 @@
 #include "bli_trmm3.h"
 #include "bli_trsm.h"
 #include "bli_gemmt.h"
+
+// Low-precision (half-precision storage) gemm.
+#include "bli_lpgemm.h"
+
+// Integer gemm (int32 accumulation).
+#include "bli_igemm.h"
+
+// Strided-batched gemm.
+#include "bli_gemmbatch.h"
+
+// Fixed-shape small gemm.
+#include "bli_gemmjit.h"
+
+// Task-parallel trsm and trmm.
+#include "bli_l3_dag.h"
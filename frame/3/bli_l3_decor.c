@@ -46,6 +46,7 @@ struct l3_decor_params_s
 	const cntx_t*  cntx;
 	      rntm_t*  rntm;
 	      array_t* array;
+	trace_call_t*  call;
 };
 typedef struct l3_decor_params_s l3_decor_params_t;
 
@@ -63,6 +64,9 @@ static void bli_l3_thread_decorator_entry( thrcomm_t* gl_comm, dim_t tid, const
 	const cntx_t*            cntx    = data->cntx;
 	      rntm_t*            rntm    = data->rntm;
 	      array_t*           array   = data->array;
+	      trace_call_t*      call    = data->call;
+
+	const double             t_trace = bli_trace_thread_begin( call );
 
 	bli_l3_thread_decorator_thread_check( gl_comm, rntm );
 
@@ -120,6 +124,8 @@ static void bli_l3_thread_decorator_entry( thrcomm_t* gl_comm, dim_t tid, const
 	// [1] https://github.com/flame/blis/pull/702
 	bli_thrinfo_barrier( thread );
 	bli_thrinfo_free( thread );
+
+	bli_trace_thread_end( call, t_trace );
 }
 
 void bli_l3_thread_decorator
@@ -182,6 +188,10 @@ void bli_l3_thread_decorator
 	        ( ti == BLIS_OPENMP ? "openmp" : "pthreads" ) ) );
 #endif
 
+	// Begin tracing the operation (if tracing is enabled).
+	trace_call_t call;
+	bli_trace_call_begin( &call );
+
 	// Check out an array_t from the small block allocator. This is done
 	// with an internal lock to ensure only one application thread accesses
 	// the sba at a time. bli_sba_checkout_array() will also automatically
@@ -199,6 +209,7 @@ void bli_l3_thread_decorator
 	params.cntx     = cntx;
 	params.rntm     = &rntm_l;
 	params.array    = array;
+	params.call     = &call;
 
 	// Launch the threads using the threading implementation specified by ti,
 	// and use bli_l3_thread_decorator_entry() as their entry points. The
@@ -209,6 +220,19 @@ void bli_l3_thread_decorator
 	// check-out, this is done using a lock embedded within the sba to ensure
 	// mutual exclusion.
 	bli_sba_checkin_array( array );
+
+	// Record the operation, including the ways of parallelism chosen for it.
+	bli_trace_call_end
+	(
+	  &call,
+	  bli_trace_l3_path( a, b, c, cntx ),
+	  family,
+	  bli_obj_dt( c ),
+	  bli_obj_length( c ),
+	  bli_obj_width( c ),
+	  bli_obj_width_after_trans( a ),
+	  &rntm_l
+	);
 }
 
 void bli_l3_thread_decorator_check
@@ -55,6 +55,15 @@ void PASTEMAC(gemm,BLIS_OAPI_EX_SUF)
 {
 	bli_init_once();
 
+	// If A and B are stored in a half-precision datatype, execute the
+	// low-precision implementation, which widens A and B to float during
+	// packing and handles all of its own special cases.
+	if ( bli_obj_is_half( a ) || bli_obj_is_half( b ) )
+	{
+		bli_lpgemm_front( alpha, a, b, beta, c, cntx, rntm );
+		return;
+	}
+
 	// If C has a zero dimension, return early.
 	if ( bli_obj_has_zero_dim( c ) ) return;
 
@@ -111,6 +120,15 @@ void PASTEMAC(gemm,BLIS_OAPI_EX_SUF)
 		// available but not enabled, or simply unavailable, BLIS_NAT will
 		// be returned here.)
 		im = bli_gemmind_find_avail( dt );
+
+		// The 3m method does not support mixing storage datatypes or the
+		// computation precision, so fall back to native execution if any
+		// such mixing is requested.
+		if ( im == BLIS_3M &&
+		     ( bli_obj_dt( a ) != dt ||
+		       bli_obj_dt( b ) != dt ||
+		       bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) )
+			im = BLIS_NAT;
 	}
 
 	// If necessary, obtain a valid context from the gks using the induced
@@ -68,6 +68,13 @@ void bli_l3_set_schemas
 			schema_b = BLIS_PACKED_COL_PANELS_1E;
 		}
 	}
+	else if ( bli_cntx_method( cntx ) == BLIS_3M )
+	{
+		// The 3m method packs the real, imaginary, and summed parts of each
+		// micropanel separately, regardless of the microkernel preference.
+		schema_a = BLIS_PACKED_ROW_PANELS_3MI;
+		schema_b = BLIS_PACKED_COL_PANELS_3MI;
+	}
 
 	// Embed the schemas into the objects for A and B. This is a sort of hack
 	// for communicating the desired pack schemas to bli_gemm_cntl_create()
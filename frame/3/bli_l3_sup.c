@@ -50,10 +50,33 @@ err_t bli_gemmsup
 	return BLIS_FAILURE;
 	#endif
 
+#ifdef BLIS_ENABLE_GEMM_MD
+	// Mixed-datatype computations are handled by typecasting A and/or B to
+	// the execution datatype (the domain of C combined with the computation
+	// precision) as they are packed. This covers any mixture of precisions
+	// along with the mixed-domain case where C is complex and only one of A
+	// and B is real. Return early for the remaining mixed-domain cases, which
+	// the conventional implementation handles by computing with only the real
+	// parts of the operands.
+	if ( bli_obj_is_real( c ) )
+	{
+		if ( bli_obj_is_complex( a ) ||
+		     bli_obj_is_complex( b ) ) return BLIS_FAILURE;
+	}
+	else // if ( bli_obj_is_complex( c ) )
+	{
+		if ( bli_obj_is_real( a ) &&
+		     bli_obj_is_real( b ) ) return BLIS_FAILURE;
+	}
+#else
 	// Return early if this is a mixed-datatype computation.
 	if ( bli_obj_dt( c ) != bli_obj_dt( a ) ||
 	     bli_obj_dt( c ) != bli_obj_dt( b ) ||
 	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return BLIS_FAILURE;
+#endif
+
+	// Determine the execution datatype, whose sup thresholds apply.
+	const num_t dt = bli_obj_domain( c ) | bli_obj_comp_prec( c );
 
 	// Obtain a valid (native) context from the gks if necessary.
 	// NOTE: This must be done before calling the _check() function, since
@@ -65,7 +88,6 @@ err_t bli_gemmsup
 	// of sup-handled problems.
 	if ( bli_cntx_dislikes_storage_of( c, BLIS_GEMM_VIR_UKR, cntx ) )
 	{
-		const num_t dt = bli_obj_dt( c );
 		const dim_t m  = bli_obj_length( c );
 		const dim_t n  = bli_obj_width( c );
 		const dim_t k  = bli_obj_width_after_trans( a );
@@ -77,7 +99,6 @@ err_t bli_gemmsup
 	}
 	else // ukr_prefers_storage_of( c, ... )
 	{
-		const num_t dt = bli_obj_dt( c );
 		const dim_t m  = bli_obj_length( c );
 		const dim_t n  = bli_obj_width( c );
 		const dim_t k  = bli_obj_width_after_trans( a );
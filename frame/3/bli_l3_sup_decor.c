@@ -46,6 +46,7 @@ struct l3_sup_decor_params_s
 	const cntx_t*     cntx;
 	      rntm_t*     rntm;
 	      array_t*    array;
+	trace_call_t*     call;
 };
 typedef struct l3_sup_decor_params_s l3_sup_decor_params_t;
 
@@ -63,9 +64,12 @@ static void bli_l3_sup_thread_decorator_entry( thrcomm_t* gl_comm, dim_t tid, co
 	const cntx_t*                cntx    = data->cntx;
 	      rntm_t*                rntm    = data->rntm;
 	      array_t*               array   = data->array;
+	      trace_call_t*          call    = data->call;
 
 	( void )family;
 
+	const double                 t_trace = bli_trace_thread_begin( call );
+
 	bli_l3_thread_decorator_thread_check( gl_comm, rntm );
 
 	// Create the root node of the thread's thrinfo_t structure.
@@ -91,6 +95,8 @@ static void bli_l3_sup_thread_decorator_entry( thrcomm_t* gl_comm, dim_t tid, co
 	// [1] https://github.com/flame/blis/pull/702
 	bli_thrinfo_barrier( thread );
 	bli_thrinfo_free( thread );
+
+	bli_trace_thread_end( call, t_trace );
 }
 
 err_t bli_l3_sup_thread_decorator
@@ -153,6 +159,10 @@ err_t bli_l3_sup_thread_decorator
 	        ( ti == BLIS_OPENMP ? "openmp" : "pthreads" ) ) );
 #endif
 
+	// Begin tracing the operation (if tracing is enabled).
+	trace_call_t call;
+	bli_trace_call_begin( &call );
+
 	// Check out an array_t from the small block allocator. This is done
 	// with an internal lock to ensure only one application thread accesses
 	// the sba at a time. bli_sba_checkout_array() will also automatically
@@ -170,11 +180,26 @@ err_t bli_l3_sup_thread_decorator
 	params.cntx   = cntx;
 	params.rntm   = &rntm_l;
 	params.array  = array;
+	params.call   = &call;
 
 	bli_thread_launch( ti, nt, bli_l3_sup_thread_decorator_entry, &params );
 
 	bli_sba_checkin_array( array );
 
+	// Record the operation, including the ways of parallelism chosen for it.
+	// (The low-precision gemm also executes via this decorator.)
+	bli_trace_call_end
+	(
+	  &call,
+	  bli_obj_is_half( a ) ? BLIS_TRACE_LP : BLIS_TRACE_SUP,
+	  family,
+	  bli_obj_dt( c ),
+	  bli_obj_length( c ),
+	  bli_obj_width( c ),
+	  bli_obj_width_after_trans( a ),
+	  &rntm_l
+	);
+
 	return BLIS_SUCCESS;
 }
 
@@ -34,6 +34,14 @@
 
 #include "blis.h"
 
+// In reproducible mode, the variants only partition the ic loop in units of
+// whole MC blocks, so the automatic thread factorization should weigh that
+// loop accordingly (and thus favor the jc loop when there are few blocks).
+static dim_t bli_l3_sup_ic_units( bool repro, dim_t units, dim_t bf, dim_t MC )
+{
+	return ( repro ? ( units * bf + MC - 1 ) / MC : units );
+}
+
 err_t bli_gemmsup_int
      (
        const obj_t*  alpha,
@@ -94,7 +102,9 @@ err_t bli_gemmsup_int
 	const dim_t  n           = bli_obj_width( c );
 	const dim_t  MR          = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
 	const dim_t  NR          = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t  MC          = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MC, cntx );
 	const bool   auto_factor = bli_rntm_auto_factor( rntm );
+	const bool   repro       = bli_rntm_repro( rntm );
 	const dim_t  n_threads   = bli_rntm_num_threads( rntm );
 	bool         use_bp      = TRUE;
 	dim_t        jc_new;
@@ -125,13 +135,17 @@ err_t bli_gemmsup_int
 			{
 				// In the block-panel algorithm, the m dimension is parallelized
 				// with ic_nt and the n dimension is parallelized with jc_nt.
-				bli_thread_partition_2x2( n_threads, mu, nu, &ic_new, &jc_new );
+				bli_thread_partition_2x2( n_threads,
+				                          bli_l3_sup_ic_units( repro, mu, MR, MC ),
+				                          nu, &ic_new, &jc_new );
 			}
 			else // if ( !use_bp )
 			{
 				// In the panel-block algorithm, the m dimension is parallelized
 				// with jc_nt and the n dimension is parallelized with ic_nt.
-				bli_thread_partition_2x2( n_threads, mu, nu, &jc_new, &ic_new );
+				bli_thread_partition_2x2( n_threads, mu,
+				                          bli_l3_sup_ic_units( repro, nu, NR, MC ),
+				                          &jc_new, &ic_new );
 			}
 
 			// Update the ways of parallelism for the jc and ic loops, and then
@@ -191,13 +205,17 @@ err_t bli_gemmsup_int
 			{
 				// In the block-panel algorithm, the m dimension is parallelized
 				// with ic_nt and the n dimension is parallelized with jc_nt.
-				bli_thread_partition_2x2( n_threads, mu, nu, &ic_new, &jc_new );
+				bli_thread_partition_2x2( n_threads,
+				                          bli_l3_sup_ic_units( repro, mu, MR, MC ),
+				                          nu, &ic_new, &jc_new );
 			}
 			else // if ( !use_bp )
 			{
 				// In the panel-block algorithm, the m dimension is parallelized
 				// with jc_nt and the n dimension is parallelized with ic_nt.
-				bli_thread_partition_2x2( n_threads, mu, nu, &jc_new, &ic_new );
+				bli_thread_partition_2x2( n_threads, mu,
+				                          bli_l3_sup_ic_units( repro, nu, NR, MC ),
+				                          &jc_new, &ic_new );
 			}
 
 			// Update the ways of parallelism for the jc and ic loops, and then
@@ -270,7 +288,9 @@ err_t bli_gemmtsup_int
 	const dim_t  n           = m;
 	const dim_t  MR          = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
 	const dim_t  NR          = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t  MC          = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MC, cntx );
 	const bool   auto_factor = bli_rntm_auto_factor( rntm );
+	const bool   repro       = bli_rntm_repro( rntm );
 	const dim_t  n_threads   = bli_rntm_num_threads( rntm );
 	bool         use_bp      = TRUE;
 	dim_t        jc_new;
@@ -301,13 +321,17 @@ err_t bli_gemmtsup_int
 			{
 				// In the block-panel algorithm, the m dimension is parallelized
 				// with ic_nt and the n dimension is parallelized with jc_nt.
-				bli_thread_partition_2x2( n_threads, mu, nu, &ic_new, &jc_new );
+				bli_thread_partition_2x2( n_threads,
+				                          bli_l3_sup_ic_units( repro, mu, MR, MC ),
+				                          nu, &ic_new, &jc_new );
 			}
 			else // if ( !use_bp )
 			{
 				// In the panel-block algorithm, the m dimension is parallelized
 				// with jc_nt and the n dimension is parallelized with ic_nt.
-				bli_thread_partition_2x2( n_threads, mu, nu, &jc_new, &ic_new );
+				bli_thread_partition_2x2( n_threads, mu,
+				                          bli_l3_sup_ic_units( repro, nu, NR, MC ),
+				                          &jc_new, &ic_new );
 			}
 
 			// Update the ways of parallelism for the jc and ic loops, and then
@@ -371,13 +395,17 @@ err_t bli_gemmtsup_int
 			{
 				// In the block-panel algorithm, the m dimension is parallelized
 				// with ic_nt and the n dimension is parallelized with jc_nt.
-				bli_thread_partition_2x2( n_threads, mu, nu, &ic_new, &jc_new );
+				bli_thread_partition_2x2( n_threads,
+				                          bli_l3_sup_ic_units( repro, mu, MR, MC ),
+				                          nu, &ic_new, &jc_new );
 			}
 			else // if ( !use_bp )
 			{
 				// In the panel-block algorithm, the m dimension is parallelized
 				// with jc_nt and the n dimension is parallelized with ic_nt.
-				bli_thread_partition_2x2( n_threads, mu, nu, &jc_new, &ic_new );
+				bli_thread_partition_2x2( n_threads, mu,
+				                          bli_l3_sup_ic_units( repro, nu, NR, MC ),
+				                          &jc_new, &ic_new );
 			}
 
 			// Update the ways of parallelism for the jc and ic loops, and then
@@ -315,9 +315,17 @@ typedef void (*packm_sup_var2_fp)
 static packm_sup_var1_fp GENARRAY(packm_sup_var1,packm_sup_var1);
 static packm_sup_var2_fp GENARRAY(packm_sup_var2,packm_sup_var2);
 
+static packm_sup_var1_fp GENARRAY2_ALL(packm_sup_var1_md,packm_sup_var1_md);
+static packm_sup_var2_fp GENARRAY2_ALL(packm_sup_var2_md,packm_sup_var2_md);
+
 //
 // Define BLAS-like interfaces to the variant chooser.
 //
+// NOTE: dt_a is the storage datatype of the source matrix while dt is the
+// datatype of the packed matrix (and of the computation). When the two
+// differ, the source matrix is typecast as it is packed, in which case the
+// caller must request packing via will_pack.
+//
 
 void bli_packm_sup
      (
@@ -325,6 +333,7 @@ void bli_packm_sup
              packbuf_t  pack_buf_type,
              stor3_t    stor_id,
              trans_t    transc,
+             num_t      dt_a,
              num_t      dt,
              dim_t      m_alloc,
              dim_t      k_alloc,
@@ -379,12 +388,17 @@ void bli_packm_sup
 	}
 	else // if ( will_pack == TRUE )
 	{
+		const double t_trace = bli_trace_pack_begin();
+
 		if ( schema == BLIS_PACKED_ROWS )
 		{
 			// printf( "blis_ packm_sup_a: packing A to rows.\n" );
 
 			// For plain packing by rows, use var2.
-			packm_sup_var2[ dt ]
+			packm_sup_var2_fp f = ( dt_a == dt ? packm_sup_var2[ dt ]
+			                                   : packm_sup_var2_md[ dt_a ][ dt ] );
+
+			f
 			(
 			  transc,
 			  schema,
@@ -402,7 +416,10 @@ void bli_packm_sup
 			// printf( "blis_ packm_sup_a: packing A to row panels.\n" );
 
 			// For packing to column-stored row panels, use var1.
-			packm_sup_var1[ dt ]
+			packm_sup_var1_fp f = ( dt_a == dt ? packm_sup_var1[ dt ]
+			                                   : packm_sup_var1_md[ dt_a ][ dt ] );
+
+			f
 			(
 			  transc,
 			  schema,
@@ -419,6 +436,8 @@ void bli_packm_sup
 			);
 		}
 
+		bli_trace_pack_end( t_trace );
+
 		// Barrier so that packing is done before computation.
 		bli_thrinfo_barrier( thread );
 	}
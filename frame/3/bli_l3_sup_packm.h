@@ -73,6 +73,7 @@ void bli_packm_sup
              packbuf_t  pack_buf_type,
              stor3_t    stor_id,
              trans_t    transc,
+             num_t      dt_a,
              num_t      dt,
              dim_t      m_alloc,
              dim_t      k_alloc,
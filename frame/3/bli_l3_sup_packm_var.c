@@ -445,3 +445,226 @@ PASTEMAC(ch,fprintm)( stdout, "packm_sup_var1: a packed", panel_dim_max, panel_l
 
 INSERT_GENTFUNCR_BASIC( packm, packm_sup_var2 )
 
+
+//
+// Define mixed-datatype variants that typecast the source matrix to the
+// datatype of the packed matrix. These variants mirror packm_sup_var1 and
+// packm_sup_var2 except that each micropanel (or row) is copy-cast rather
+// than passed to a packm kernel. Mixed-datatype kappa values are never
+// handled here; the callers always pack with kappa = 1.0 and pass alpha
+// along to the millikernel instead.
+//
+
+#undef  GENTFUNC2
+#define GENTFUNC2( ctype_c, ctype_p, chc, chp, varname ) \
+\
+void PASTEMAC2(chc,chp,varname) \
+     ( \
+       trans_t    transc, \
+       pack_t     schema, \
+       dim_t      m, \
+       dim_t      n, \
+       dim_t      m_max, \
+       dim_t      n_max, \
+       void*      kappa, \
+       void*      c, inc_t rs_c, inc_t cs_c, \
+       void*      p, inc_t rs_p, inc_t cs_p, \
+                     dim_t pd_p, inc_t ps_p, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	ctype_c* c_cast = c; \
+	ctype_p* p_cast = p; \
+	ctype_p* zero   = PASTEMAC(chp,0); \
+\
+	dim_t  iter_dim; \
+	dim_t  panel_len; \
+	dim_t  panel_len_max; \
+	dim_t  panel_dim_max; \
+	inc_t  vs_c; \
+	inc_t  ldc; \
+	inc_t  ldp; \
+\
+	( void )kappa; \
+\
+	/* Extract the conjugation bit from the transposition argument. */ \
+	conj_t conjc = bli_extract_conj( transc ); \
+\
+	/* If c needs a transposition, induce it so that we can more simply
+	   express the remaining parameters and code. */ \
+	if ( bli_does_trans( transc ) ) \
+	{ \
+		bli_swap_incs( &rs_c, &cs_c ); \
+		bli_toggle_trans( &transc ); \
+	} \
+\
+	if ( bli_is_col_packed( schema ) ) \
+	{ \
+		/* Prepare to pack to row-stored column panels. */ \
+		iter_dim      = n; \
+		panel_len     = m; \
+		panel_len_max = m_max; \
+		panel_dim_max = pd_p; \
+		vs_c          = cs_c; \
+		ldc           = rs_c; \
+		ldp           = rs_p; \
+	} \
+	else \
+	{ \
+		/* Prepare to pack to column-stored row panels. */ \
+		iter_dim      = m; \
+		panel_len     = n; \
+		panel_len_max = n_max; \
+		panel_dim_max = pd_p; \
+		vs_c          = rs_c; \
+		ldc           = cs_c; \
+		ldp           = cs_p; \
+	} \
+\
+	/* Compute the total number of iterations we'll need. */ \
+	const dim_t n_iter = iter_dim / panel_dim_max + ( iter_dim % panel_dim_max ? 1 : 0 ); \
+\
+	const dim_t nt  = bli_thrinfo_n_way( thread ); \
+	const dim_t tid = bli_thrinfo_work_id( thread ); \
+\
+	( void )nt; \
+	( void )tid; \
+\
+	dim_t it_start, it_end, it_inc; \
+\
+	bli_thread_range_slrr( thread, n_iter, 1, FALSE, &it_start, &it_end, &it_inc ); \
+\
+	for ( dim_t it = 0; it < n_iter; it += 1 ) \
+	{ \
+		if ( !bli_is_my_iter( it, it_start, it_end, tid, nt ) ) continue; \
+\
+		const dim_t ic          = it * panel_dim_max; \
+		const dim_t panel_dim_i = bli_min( panel_dim_max, iter_dim - ic ); \
+\
+		ctype_c* c_use = c_cast + ic*vs_c; \
+		ctype_p* p_use = p_cast + it*ps_p; \
+\
+		/* Copy-cast the micropanel, treating it as panel_dim x panel_len
+		   and column-stored (unit row stride). */ \
+		PASTEMAC2(chc,chp,castm) \
+		( \
+		  ( trans_t )conjc, \
+		  panel_dim_i, \
+		  panel_len, \
+		  c_use, vs_c, ldc, \
+		  p_use, 1,    ldp  \
+		); \
+\
+		/* Zero the unused rows and columns of the edge micropanel, if any. */ \
+		if ( panel_dim_i < panel_dim_max ) \
+			PASTEMAC2(chp,setm,BLIS_TAPI_EX_SUF) \
+			( \
+			  BLIS_NO_CONJUGATE, 0, BLIS_NONUNIT_DIAG, BLIS_DENSE, \
+			  panel_dim_max - panel_dim_i, panel_len_max, \
+			  zero, \
+			  p_use + panel_dim_i, 1, ldp, \
+			  cntx, NULL  \
+			); \
+\
+		if ( panel_len < panel_len_max ) \
+			PASTEMAC2(chp,setm,BLIS_TAPI_EX_SUF) \
+			( \
+			  BLIS_NO_CONJUGATE, 0, BLIS_NONUNIT_DIAG, BLIS_DENSE, \
+			  panel_dim_max, panel_len_max - panel_len, \
+			  zero, \
+			  p_use + panel_len*ldp, 1, ldp, \
+			  cntx, NULL  \
+			); \
+	} \
+}
+
+INSERT_GENTFUNC2_BASIC( packm_sup_var1_md )
+INSERT_GENTFUNC2_MIX_DP( packm_sup_var1_md )
+
+
+#undef  GENTFUNC2
+#define GENTFUNC2( ctype_c, ctype_p, chc, chp, varname ) \
+\
+void PASTEMAC2(chc,chp,varname) \
+     ( \
+       trans_t    transc, \
+       pack_t     schema, \
+       dim_t      m, \
+       dim_t      n, \
+       void*      kappa, \
+       void*      c, inc_t rs_c, inc_t cs_c, \
+       void*      p, inc_t rs_p, inc_t cs_p, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	ctype_c* c_cast = c; \
+	ctype_p* p_cast = p; \
+\
+	dim_t  iter_dim; \
+	dim_t  vector_len; \
+	inc_t  incc, ldc; \
+	inc_t  ldp; \
+\
+	( void )kappa; \
+	( void )cntx; \
+\
+	/* Extract the conjugation bit from the transposition argument. */ \
+	conj_t conjc = bli_extract_conj( transc ); \
+\
+	/* If c needs a transposition, induce it so that we can more simply
+	   express the remaining parameters and code. */ \
+	if ( bli_does_trans( transc ) ) \
+	{ \
+		bli_swap_incs( &rs_c, &cs_c ); \
+		bli_toggle_trans( &transc ); \
+	} \
+\
+	if ( bli_is_col_packed( schema ) ) \
+	{ \
+		/* Prepare to pack to a column-stored matrix. */ \
+		iter_dim   = n; \
+		vector_len = m; \
+		incc       = rs_c; \
+		ldc        = cs_c; \
+		ldp        = cs_p; \
+	} \
+	else \
+	{ \
+		/* Prepare to pack to a row-stored matrix. */ \
+		iter_dim   = m; \
+		vector_len = n; \
+		incc       = cs_c; \
+		ldc        = rs_c; \
+		ldp        = rs_p; \
+	} \
+\
+	const dim_t nt  = bli_thrinfo_n_way( thread ); \
+	const dim_t tid = bli_thrinfo_work_id( thread ); \
+\
+	( void )nt; \
+	( void )tid; \
+\
+	dim_t it_start, it_end, it_inc; \
+\
+	bli_thread_range_slrr( thread, iter_dim, 1, FALSE, &it_start, &it_end, &it_inc ); \
+\
+	for ( dim_t it = 0; it < iter_dim; it += 1 ) \
+	{ \
+		if ( bli_is_my_iter( it, it_start, it_end, tid, nt ) ) \
+		{ \
+			PASTEMAC2(chc,chp,castv) \
+			( \
+			  conjc, \
+			  vector_len, \
+			  c_cast + it*ldc, incc, \
+			  p_cast + it*ldp, 1     \
+			); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC2_BASIC( packm_sup_var2_md )
+INSERT_GENTFUNC2_MIX_DP( packm_sup_var2_md )
+
@@ -76,3 +76,44 @@ void PASTEMAC(ch,varname) \
 
 INSERT_GENTPROT_BASIC( packm_sup_var2 )
 
+#undef  GENTPROT2
+#define GENTPROT2( ctype_c, ctype_p, chc, chp, varname ) \
+\
+void PASTEMAC2(chc,chp,varname) \
+     ( \
+       trans_t    transc, \
+       pack_t     schema, \
+       dim_t      m, \
+       dim_t      n, \
+       dim_t      m_max, \
+       dim_t      n_max, \
+       void*      kappa, \
+       void*      c, inc_t rs_c, inc_t cs_c, \
+       void*      p, inc_t rs_p, inc_t cs_p, \
+                     dim_t pd_p, inc_t ps_p, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     );
+
+INSERT_GENTPROT2_BASIC( packm_sup_var1_md )
+INSERT_GENTPROT2_MIX_DP( packm_sup_var1_md )
+
+#undef  GENTPROT2
+#define GENTPROT2( ctype_c, ctype_p, chc, chp, varname ) \
+\
+void PASTEMAC2(chc,chp,varname) \
+     ( \
+       trans_t    transc, \
+       pack_t     schema, \
+       dim_t      m, \
+       dim_t      n, \
+       void*      kappa, \
+       void*      c, inc_t rs_c, inc_t cs_c, \
+       void*      p, inc_t rs_p, inc_t cs_p, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     );
+
+INSERT_GENTPROT2_BASIC( packm_sup_var2_md )
+INSERT_GENTPROT2_MIX_DP( packm_sup_var2_md )
+
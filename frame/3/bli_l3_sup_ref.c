@@ -105,8 +105,65 @@ err_t bli_gemmsup_ref
 	//bli_rntm_set_pack_b( 0, rntm );
 #endif
 
-	return
-	bli_l3_sup_thread_decorator
+	// The execution datatype combines the domain of C with the computation
+	// precision. The variants typecast A and B to this datatype as they are
+	// packed; if C is stored in a different precision, we compute into a
+	// workspace in the execution datatype (with the same storage format as
+	// C) and then typecast the result back to C, so that C is only rounded
+	// once.
+	const num_t dt_exec = bli_obj_domain( c ) | bli_obj_comp_prec( c );
+
+	// The variants read alpha and beta in the execution datatype, so make
+	// local copies typecast to that datatype if necessary.
+	obj_t alpha_local;
+	obj_t beta_local;
+
+	if ( !bli_obj_is_const( alpha ) && bli_obj_dt( alpha ) != dt_exec )
+	{
+		bli_obj_scalar_init_detached_copy_of( dt_exec, BLIS_NO_CONJUGATE,
+		                                      alpha, &alpha_local );
+		alpha = &alpha_local;
+	}
+
+	if ( !bli_obj_is_const( beta ) && bli_obj_dt( beta ) != dt_exec )
+	{
+		bli_obj_scalar_init_detached_copy_of( dt_exec, BLIS_NO_CONJUGATE,
+		                                      beta, &beta_local );
+		beta = &beta_local;
+	}
+
+	if ( bli_obj_dt( c ) == dt_exec )
+	{
+		return
+		bli_l3_sup_thread_decorator
+		(
+		  bli_gemmsup_int,
+		  BLIS_GEMM, // operation family id
+		  alpha,
+		  a,
+		  b,
+		  beta,
+		  c,
+		  cntx,
+		  rntm
+		);
+	}
+
+	const dim_t m = bli_obj_length( c );
+	const dim_t n = bli_obj_width( c );
+	obj_t       ct;
+
+	if ( bli_obj_is_row_stored( c ) )
+		bli_obj_create( dt_exec, m, n, n, 1, &ct );
+	else
+		bli_obj_create( dt_exec, m, n, 1, m, &ct );
+
+	// Only read C if beta is non-zero, so that C may contain NaN or Inf on
+	// entry when beta is zero.
+	if ( !bli_obj_equals( beta, &BLIS_ZERO ) )
+		bli_castm( c, &ct );
+
+	err_t r_val = bli_l3_sup_thread_decorator
 	(
 	  bli_gemmsup_int,
 	  BLIS_GEMM, // operation family id
@@ -114,10 +171,16 @@ err_t bli_gemmsup_ref
 	  a,
 	  b,
 	  beta,
-	  c,
+	  &ct,
 	  cntx,
 	  rntm
 	);
+
+	bli_castm( &ct, c );
+
+	bli_obj_free( &ct );
+
+	return r_val;
 }
 
 // -----------------------------------------------------------------------------
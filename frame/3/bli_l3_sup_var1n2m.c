@@ -59,6 +59,15 @@ void bli_gemmsup_ref_var1n
 	      bool   packa   = bli_rntm_pack_a( rntm );
 	      bool   packb   = bli_rntm_pack_b( rntm );
 
+	      num_t  dt_a    = bli_obj_dt( a );
+	      num_t  dt_b    = bli_obj_dt( b );
+
+	// If A or B is stored in a datatype other than that of C (which is also
+	// the execution datatype), it must be packed, since it is typecast as
+	// part of packing.
+	if ( dt_a != dt ) packa = TRUE;
+	if ( dt_b != dt ) packb = TRUE;
+
 	      conj_t conja   = bli_obj_conj_status( a );
 	      conj_t conjb   = bli_obj_conj_status( b );
 
@@ -121,6 +130,7 @@ void bli_gemmsup_ref_var1n
 	if ( bli_is_trans( trans ) )
 	{
 		      bool   packtmp = packa; packa = packb; packb = packtmp;
+		      num_t  dt_tmp  =  dt_a;  dt_a =  dt_b;  dt_b = dt_tmp;
 		      conj_t conjtmp = conja; conja = conjb; conjb = conjtmp;
 		      dim_t  len_tmp =     m;     m =     n;     n = len_tmp;
 		const void*  buf_tmp = buf_a; buf_a = buf_b; buf_b = buf_tmp;
@@ -202,15 +212,18 @@ void bli_gemmsup_ref_var1n
 	const dim_t MRM = bli_cntx_get_l3_sup_blksz_max_dt( dt, BLIS_MR, cntx );
 	const dim_t MRE = MRM - MR;
 
+	const dim_t dt_a_size = bli_dt_size( dt_a );
+	const dim_t dt_b_size = bli_dt_size( dt_b );
+
 	// Compute partitioning step values for each matrix of each loop.
 	const inc_t jcstep_c = rs_c * dt_size;
-	const inc_t jcstep_a = rs_a * dt_size;
+	const inc_t jcstep_a = rs_a * dt_a_size;
 
-	const inc_t pcstep_a = cs_a * dt_size;
-	const inc_t pcstep_b = rs_b * dt_size;
+	const inc_t pcstep_a = cs_a * dt_a_size;
+	const inc_t pcstep_b = rs_b * dt_b_size;
 
 	const inc_t icstep_c = cs_c * dt_size;
-	const inc_t icstep_b = cs_b * dt_size;
+	const inc_t icstep_b = cs_b * dt_b_size;
 
 	const inc_t jrstep_c = rs_c * MR * dt_size;
 
@@ -231,8 +244,21 @@ void bli_gemmsup_ref_var1n
 
 	auxinfo_t aux;
 
-	// Determine whether we are using more than one thread.
+	// Query the gemm epilogue (if any) attached to C. It is applied to each
+	// block of C updated by the millikernel during the last iteration of the
+	// pc loop, while the block is still in cache. Since this variant may have
+	// transposed the operation above, we pass along the trans parameter so
+	// that the block can be transposed back first.
+	const gemm_ker_params_t* params = bli_obj_ker_params( c );
+	const gemm_epi_t*        epi    = ( params ? params->epi : NULL );
+
+	// Determine whether we are using more than one thread, and whether the
+	// result must be independent of the number of threads. In the latter
+	// case, the IC loop is partitioned in units of whole MC blocks (so that
+	// each block, and thus each millikernel call, is identical to that of a
+	// single-threaded execution) and the extended edge case is never used.
 	const bool is_mt = ( bli_rntm_calc_num_threads( rntm ) > 1 );
+	const bool repro = bli_rntm_repro( rntm );
 
 	thrinfo_t* thread_jc = bli_thrinfo_sub_node( thread );
 	thrinfo_t* thread_pc = bli_thrinfo_sub_node( thread_jc );
@@ -297,6 +323,7 @@ void bli_gemmsup_ref_var1n
 			  BLIS_BUFFER_FOR_B_PANEL, // This algorithm packs matrix A to
 			  stor_id,                 // a "panel of B".
 			  BLIS_NO_TRANSPOSE,
+			  dt_a,
 			  dt,
 			  NC,     KC,       // This "panel of B" is (at most) NC x KC.
 			  nc_cur, kc_cur, MR,
@@ -312,15 +339,17 @@ void bli_gemmsup_ref_var1n
 			// matrix A.
 			const char* a_pc_use = a_use;
 
-			// We don't need to embed the panel stride of A within the auxinfo_t
-			// object because this variant iterates through A in the jr loop,
-			// which occurs here, within the macrokernel, not within the
-			// millikernel.
-			//bli_auxinfo_set_ps_a( ps_a_use, &aux );
+			// This variant iterates through A in the jr loop, which occurs here,
+			// within the macrokernel, but we still embed the panel stride of A
+			// within the auxinfo_t object so that a millikernel that is handed
+			// an extended edge case (more than one micropanel of A) can find
+			// the second micropanel.
+			bli_auxinfo_set_ps_a( ps_a_use, &aux );
 
 			// Compute the IC loop thread range for the current thread.
 			dim_t ic_start, ic_end;
-			bli_thread_range_sub( thread_ic, n, NR, FALSE, &ic_start, &ic_end );
+			bli_thread_range_sub( thread_ic, n, ( repro ? MC : NR ), FALSE,
+			                      &ic_start, &ic_end );
 			const dim_t n_local = ic_end - ic_start;
 
 			// Compute number of primary and leftover components of the IC loop.
@@ -353,6 +382,7 @@ void bli_gemmsup_ref_var1n
 				  BLIS_BUFFER_FOR_A_BLOCK, // This algorithm packs matrix B to
 				  stor_id,                 // a "block of A".
 				  BLIS_NO_TRANSPOSE,
+				  dt_b,
 				  dt,
 				  MC,     KC,       // This "block of A" is (at most) KC x MC.
 				  mc_cur, kc_cur, NR,
@@ -382,7 +412,7 @@ void bli_gemmsup_ref_var1n
 				// these cases.) Note that this prevents us from declaring jr_iter and
 				// jr_left as const. NOTE: We forgo this optimization when packing A
 				// since packing an extended edge case is not yet supported.
-				if ( !packa && !is_mt )
+				if ( !packa && !is_mt && !repro )
 				if ( MRE != 0 && 1 < jr_iter && jr_left != 0 && jr_left <= MRE )
 				{
 					jr_iter--; jr_left += MR;
@@ -423,6 +453,16 @@ void bli_gemmsup_ref_var1n
 						  &aux,
 						  ( cntx_t* )cntx
 						);
+
+						if ( epi && pp + kc_cur == pc_end )
+							bli_gemm_epi_apply
+							(
+							  dt, bli_is_trans( trans ),
+							  nr_cur, mc_cur,
+							  jj + j * MR, ii,
+							  c_jr, rs_c, cs_c,
+							  epi
+							);
 					}
 				}
 			}
@@ -477,6 +517,15 @@ void bli_gemmsup_ref_var2m
 	      bool   packa   = bli_rntm_pack_a( rntm );
 	      bool   packb   = bli_rntm_pack_b( rntm );
 
+	      num_t  dt_a    = bli_obj_dt( a );
+	      num_t  dt_b    = bli_obj_dt( b );
+
+	// If A or B is stored in a datatype other than that of C (which is also
+	// the execution datatype), it must be packed, since it is typecast as
+	// part of packing.
+	if ( dt_a != dt ) packa = TRUE;
+	if ( dt_b != dt ) packb = TRUE;
+
 	      conj_t conja   = bli_obj_conj_status( a );
 	      conj_t conjb   = bli_obj_conj_status( b );
 
@@ -539,6 +588,7 @@ void bli_gemmsup_ref_var2m
 	if ( bli_is_trans( trans ) )
 	{
 		      bool   packtmp = packa; packa = packb; packb = packtmp;
+		      num_t  dt_tmp  =  dt_a;  dt_a =  dt_b;  dt_b = dt_tmp;
 		      conj_t conjtmp = conja; conja = conjb; conjb = conjtmp;
 		      dim_t  len_tmp =     m;     m =     n;     n = len_tmp;
 		const void*  buf_tmp = buf_a; buf_a = buf_b; buf_b = buf_tmp;
@@ -604,15 +654,18 @@ void bli_gemmsup_ref_var2m
 	const dim_t NRM = bli_cntx_get_l3_sup_blksz_max_dt( dt, BLIS_NR, cntx );
 	const dim_t NRE = NRM - NR;
 
+	const dim_t dt_a_size = bli_dt_size( dt_a );
+	const dim_t dt_b_size = bli_dt_size( dt_b );
+
 	// Compute partitioning step values for each matrix of each loop.
 	const inc_t jcstep_c = cs_c * dt_size;
-	const inc_t jcstep_b = cs_b * dt_size;
+	const inc_t jcstep_b = cs_b * dt_b_size;
 
-	const inc_t pcstep_a = cs_a * dt_size;
-	const inc_t pcstep_b = rs_b * dt_size;
+	const inc_t pcstep_a = cs_a * dt_a_size;
+	const inc_t pcstep_b = rs_b * dt_b_size;
 
 	const inc_t icstep_c = rs_c * dt_size;
-	const inc_t icstep_a = rs_a * dt_size;
+	const inc_t icstep_a = rs_a * dt_a_size;
 
 	const inc_t jrstep_c = cs_c * NR * dt_size;
 
@@ -633,8 +686,21 @@ void bli_gemmsup_ref_var2m
 
 	auxinfo_t aux;
 
-	// Determine whether we are using more than one thread.
+	// Query the gemm epilogue (if any) attached to C. It is applied to each
+	// block of C updated by the millikernel during the last iteration of the
+	// pc loop, while the block is still in cache. Since this variant may have
+	// transposed the operation above, we pass along the trans parameter so
+	// that the block can be transposed back first.
+	const gemm_ker_params_t* params = bli_obj_ker_params( c );
+	const gemm_epi_t*        epi    = ( params ? params->epi : NULL );
+
+	// Determine whether we are using more than one thread, and whether the
+	// result must be independent of the number of threads. In the latter
+	// case, the IC loop is partitioned in units of whole MC blocks (so that
+	// each block, and thus each millikernel call, is identical to that of a
+	// single-threaded execution) and the extended edge case is never used.
 	const bool is_mt = ( bli_rntm_calc_num_threads( rntm ) > 1 );
+	const bool repro = bli_rntm_repro( rntm );
 
 	thrinfo_t* thread_jc = bli_thrinfo_sub_node( thread );
 	thrinfo_t* thread_pc = bli_thrinfo_sub_node( thread_jc );
@@ -697,6 +763,7 @@ void bli_gemmsup_ref_var2m
 			  BLIS_BUFFER_FOR_B_PANEL, // This algorithm packs matrix B to
 			  stor_id,                 // a "panel of B."
 			  BLIS_NO_TRANSPOSE,
+			  dt_b,
 			  dt,
 			  NC,     KC,       // This "panel of B" is (at most) KC x NC.
 			  nc_cur, kc_cur, NR,
@@ -712,15 +779,17 @@ void bli_gemmsup_ref_var2m
 			// matrix B.
 			char* b_pc_use = b_use;
 
-			// We don't need to embed the panel stride of B within the auxinfo_t
-			// object because this variant iterates through B in the jr loop,
-			// which occurs here, within the macrokernel, not within the
-			// millikernel.
-			//bli_auxinfo_set_ps_b( ps_b_use, &aux );
+			// This variant iterates through B in the jr loop, which occurs here,
+			// within the macrokernel, but we still embed the panel stride of B
+			// within the auxinfo_t object so that a millikernel that is handed
+			// an extended edge case (more than one micropanel of B) can find
+			// the second micropanel.
+			bli_auxinfo_set_ps_b( ps_b_use, &aux );
 
 			// Compute the IC loop thread range for the current thread.
 			dim_t ic_start, ic_end;
-			bli_thread_range_sub( thread_ic, m, MR, FALSE, &ic_start, &ic_end );
+			bli_thread_range_sub( thread_ic, m, ( repro ? MC : MR ), FALSE,
+			                      &ic_start, &ic_end );
 			const dim_t m_local = ic_end - ic_start;
 
 			// Compute number of primary and leftover components of the IC loop.
@@ -751,6 +820,7 @@ void bli_gemmsup_ref_var2m
 				  BLIS_BUFFER_FOR_A_BLOCK, // This algorithm packs matrix A to
 				  stor_id,                 // a "block of A."
 				  BLIS_NO_TRANSPOSE,
+				  dt_a,
 				  dt,
 				  MC,     KC,       // This "block of A" is (at most) MC x KC.
 				  mc_cur, kc_cur, MR,
@@ -780,7 +850,7 @@ void bli_gemmsup_ref_var2m
 				// these cases.) Note that this prevents us from declaring jr_iter and
 				// jr_left as const. NOTE: We forgo this optimization when packing B
 				// since packing an extended edge case is not yet supported.
-				if ( !packb && !is_mt )
+				if ( !packb && !is_mt && !repro )
 				if ( NRE != 0 && 1 < jr_iter && jr_left != 0 && jr_left <= NRE )
 				{
 					jr_iter--; jr_left += NR;
@@ -821,6 +891,16 @@ void bli_gemmsup_ref_var2m
 						  &aux,
 						  ( cntx_t* )cntx
 						);
+
+						if ( epi && pp + kc_cur == pc_end )
+							bli_gemm_epi_apply
+							(
+							  dt, bli_is_trans( trans ),
+							  mc_cur, nr_cur,
+							  ii, jj + j * NR,
+							  c_jr, rs_c, cs_c,
+							  epi
+							);
 					}
 				}
 			}
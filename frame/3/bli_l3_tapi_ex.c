@@ -59,6 +59,15 @@ void PASTEMAC2(ch,opname,BLIS_OAPI_EX_SUF) \
      ) \
 { \
 	bli_init_once(); \
+\
+	/* Compute tiny problems directly with the sup millikernels, bypassing
+	   the construction of objects. */ \
+	if ( PASTEMAC(ch,gemm_tiny) \
+	     ( \
+	       transa, transb, m, n, k, \
+	       alpha, a, rs_a, cs_a, b, rs_b, cs_b, \
+	       beta, c, rs_c, cs_c, cntx, rntm \
+	     ) == BLIS_SUCCESS ) return; \
 \
 	const num_t dt = PASTEMAC(ch,type); \
 \
@@ -0,0 +1,482 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// After transposing the operation (if necessary) so that the triangular
+// matrix A is on the left, the tiles of A are referred to by logical indices
+// (i,k) that run in the direction of the computation: forwards if A is lower
+// triangular and backwards if A is upper triangular, so that in both cases
+// only the tiles with k <= i are referenced. Each column tile j of B then
+// gives rise to a graph of the following tasks, one for each (i,k) with
+// k <= i:
+//
+// trsm:  (i,i)  B_i := inv( A_ii ) * B_i (scaling B_0 by alpha)
+//        (i,k)  B_i := B_i - A_ik * B_k  (scaling B_i by alpha if k = 0)
+//
+//        Each B_i is updated by the tasks (i,0), ..., (i,i-1), (i,i) in
+//        that order, and (i,k) also waits for the solve (k,k).
+//
+// trmm:  (i,i)  B_i := alpha * A_ii * B_i
+//        (i,k)  B_i := B_i + alpha * A_ik * B_k
+//
+//        Each B_i is updated by the tasks (i,i), (i,i-1), ..., (i,0) in
+//        that order, and (k,k) also waits for each (i,k), since they read
+//        B_k before it is overwritten.
+//
+// The successors of each task are listed (and released) from the least to
+// the most urgent, and each thread executes the task it released last, so
+// that the tasks along the critical path (the next diagonal solve, and the
+// updates it waits for) are overlapped with the remaining updates of the
+// trailing matrix.
+//
+
+typedef struct
+{
+	dim_t  i;
+	dim_t  k;
+	dim_t  j;
+	gint_t deps;     // unfinished predecessors
+	dim_t  succ_off; // the successors are succ[ succ_off, succ_off + n_succ )
+	dim_t  n_succ;
+} l3dag_task_t;
+
+// A deque of ready tasks. The owning thread pushes and pops tasks at the
+// bottom, while other threads steal tasks from the top.
+typedef struct
+{
+	bli_pthread_mutex_t lock;
+	dim_t*              buf;
+	dim_t               size;
+	dim_t               top;
+	dim_t               bottom;
+} l3dag_deque_t;
+
+typedef struct
+{
+	opid_t         family;
+	const obj_t*   alpha;
+	obj_t          a;
+	obj_t          b;
+	const cntx_t*  cntx;
+	rntm_t         rntm;      // the (single-threaded) runtime of each task
+	bool           is_upper;
+	dim_t          p;         // the number of tiles of A along each dimension
+	dim_t          q;         // the number of column tiles of B
+	l3dag_task_t*  tasks;
+	dim_t*         succ;
+	l3dag_deque_t* deques;
+	dim_t          nt;
+	gint_t         n_left;    // tasks not yet completed
+	trace_call_t*  call;
+} l3dag_t;
+
+// -----------------------------------------------------------------------------
+
+BLIS_INLINE dim_t bli_l3dag_id( const l3dag_t* dag, dim_t i, dim_t k, dim_t j )
+{
+	return j * ( ( dag->p * ( dag->p + 1 ) ) / 2 ) + ( i * ( i + 1 ) ) / 2 + k;
+}
+
+// Find the successors of task (i,k,j), from the least to the most urgent,
+// storing their ids in succ (if it is not NULL), and return their number.
+static dim_t bli_l3dag_succ( const l3dag_t* dag, dim_t i, dim_t k, dim_t j, dim_t* succ )
+{
+	dim_t ids[ 2 ];
+	dim_t n_succ = 0;
+
+	if ( dag->family == BLIS_TRSM )
+	{
+		if ( i == k )
+		{
+			// Release the updates with the solved B_k, the next block row
+			// (the next solve) last.
+			if ( succ != NULL )
+				for ( dim_t ii = dag->p - 1; ii > k; --ii )
+					succ[ n_succ++ ] = bli_l3dag_id( dag, ii, k, j );
+			else
+				n_succ = dag->p - 1 - k;
+
+			return n_succ;
+		}
+
+		ids[ n_succ++ ] = bli_l3dag_id( dag, i, k + 1, j );
+	}
+	else // if ( dag->family == BLIS_TRMM )
+	{
+		if ( i == k )
+		{
+			if ( 0 < i ) ids[ n_succ++ ] = bli_l3dag_id( dag, i, i - 1, j );
+		}
+		else
+		{
+			if ( 0 < k ) ids[ n_succ++ ] = bli_l3dag_id( dag, i, k - 1, j );
+			ids[ n_succ++ ] = bli_l3dag_id( dag, k, k, j );
+		}
+	}
+
+	if ( succ != NULL )
+		for ( dim_t s = 0; s < n_succ; ++s ) succ[ s ] = ids[ s ];
+
+	return n_succ;
+}
+
+// Acquire the tile of A with logical indices (i,k), or the (logical) block
+// row i of column tile j of B (if k < 0).
+static void bli_l3dag_acquire( const l3dag_t* dag, dim_t i, dim_t k, dim_t j, obj_t* sub )
+{
+	const dim_t b  = BLIS_L3_DAG_BLKSZ;
+	const dim_t ti = ( dag->is_upper ? dag->p - 1 - i : i );
+
+	if ( k < 0 )
+	{
+		bli_acquire_mpart( ti * b, j * b, b, b, &dag->b, sub );
+		return;
+	}
+
+	const dim_t tk = ( dag->is_upper ? dag->p - 1 - k : k );
+
+	bli_acquire_mpart( ti * b, tk * b, b, b, &dag->a, sub );
+
+	// The off-diagonal tiles lie entirely within the stored triangle.
+	if ( i != k )
+	{
+		bli_obj_set_struc( BLIS_GENERAL, sub );
+		bli_obj_set_uplo( BLIS_DENSE, sub );
+	}
+}
+
+static void bli_l3dag_exec( const l3dag_t* dag, const l3dag_task_t* task )
+{
+	const dim_t i = task->i;
+	const dim_t k = task->k;
+	const dim_t j = task->j;
+
+	obj_t a_ik, b_i, b_k;
+
+	bli_l3dag_acquire( dag, i, k,  j, &a_ik );
+	bli_l3dag_acquire( dag, i, -1, j, &b_i );
+
+	if ( dag->family == BLIS_TRSM )
+	{
+		if ( i == k )
+		{
+			bli_trsm_ex( BLIS_LEFT, ( i == 0 ? dag->alpha : &BLIS_ONE ),
+			             &a_ik, &b_i, dag->cntx, &dag->rntm );
+		}
+		else
+		{
+			bli_l3dag_acquire( dag, k, -1, j, &b_k );
+
+			bli_gemm_ex( &BLIS_MINUS_ONE, &a_ik, &b_k,
+			             ( k == 0 ? dag->alpha : &BLIS_ONE ), &b_i,
+			             dag->cntx, &dag->rntm );
+		}
+	}
+	else // if ( dag->family == BLIS_TRMM )
+	{
+		if ( i == k )
+		{
+			bli_trmm_ex( BLIS_LEFT, dag->alpha, &a_ik, &b_i,
+			             dag->cntx, &dag->rntm );
+		}
+		else
+		{
+			bli_l3dag_acquire( dag, k, -1, j, &b_k );
+
+			bli_gemm_ex( dag->alpha, &a_ik, &b_k, &BLIS_ONE, &b_i,
+			             dag->cntx, &dag->rntm );
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_l3dag_push( l3dag_deque_t* dq, dim_t id )
+{
+	bli_pthread_mutex_lock( &dq->lock );
+
+	if ( dq->bottom == dq->size )
+	{
+		// Reclaim the space of the stolen tasks, and grow the deque if it is
+		// still more than half full.
+		const dim_t n_live = dq->bottom - dq->top;
+		      dim_t size   = dq->size;
+
+		if ( size < 2 * n_live ) size *= 2;
+
+		err_t  r_val;
+		dim_t* buf = bli_malloc_intl( size * sizeof( dim_t ), &r_val );
+
+		memcpy( buf, dq->buf + dq->top, n_live * sizeof( dim_t ) );
+		bli_free_intl( dq->buf );
+
+		dq->buf  = buf;
+		dq->size = size;
+		__atomic_store_n( &dq->top,    0,      __ATOMIC_RELAXED );
+		__atomic_store_n( &dq->bottom, n_live, __ATOMIC_RELAXED );
+	}
+
+	dq->buf[ dq->bottom ] = id;
+	__atomic_store_n( &dq->bottom, dq->bottom + 1, __ATOMIC_RELAXED );
+
+	bli_pthread_mutex_unlock( &dq->lock );
+}
+
+static bool bli_l3dag_pop( l3dag_deque_t* dq, bool steal, dim_t* id )
+{
+	// Avoid taking the lock of an empty deque.
+	if ( __atomic_load_n( &dq->bottom, __ATOMIC_RELAXED ) ==
+	     __atomic_load_n( &dq->top,    __ATOMIC_RELAXED ) ) return FALSE;
+
+	bool found = FALSE;
+
+	bli_pthread_mutex_lock( &dq->lock );
+
+	if ( dq->top < dq->bottom )
+	{
+		if ( steal )
+		{
+			*id = dq->buf[ dq->top ];
+			__atomic_store_n( &dq->top, dq->top + 1, __ATOMIC_RELAXED );
+		}
+		else
+		{
+			*id = dq->buf[ dq->bottom - 1 ];
+			__atomic_store_n( &dq->bottom, dq->bottom - 1, __ATOMIC_RELAXED );
+		}
+
+		found = TRUE;
+	}
+
+	bli_pthread_mutex_unlock( &dq->lock );
+
+	return found;
+}
+
+static void bli_l3dag_thread_entry( thrcomm_t* gl_comm, dim_t tid, const void* data_void )
+{
+	( void )gl_comm;
+
+	l3dag_t* dag = ( l3dag_t* )data_void;
+
+	const double t_trace = bli_trace_thread_begin( dag->call );
+
+	while ( 0 < __atomic_load_n( &dag->n_left, __ATOMIC_ACQUIRE ) )
+	{
+		dim_t id;
+
+		// Execute the most recently released task of this thread, or else
+		// steal the oldest task of another thread.
+		bool found = bli_l3dag_pop( &dag->deques[ tid ], FALSE, &id );
+
+		for ( dim_t t = 1; !found && t < dag->nt; ++t )
+			found = bli_l3dag_pop( &dag->deques[ ( tid + t ) % dag->nt ], TRUE, &id );
+
+		if ( !found ) continue;
+
+		const l3dag_task_t* task = &dag->tasks[ id ];
+
+		bli_l3dag_exec( dag, task );
+
+		for ( dim_t s = 0; s < task->n_succ; ++s )
+		{
+			const dim_t id_s = dag->succ[ task->succ_off + s ];
+
+			if ( __atomic_sub_fetch( &dag->tasks[ id_s ].deps, 1, __ATOMIC_ACQ_REL ) == 0 )
+				bli_l3dag_push( &dag->deques[ tid ], id_s );
+		}
+
+		__atomic_sub_fetch( &dag->n_left, 1, __ATOMIC_RELEASE );
+	}
+
+	bli_trace_thread_end( dag->call, t_trace );
+}
+
+// -----------------------------------------------------------------------------
+
+err_t bli_l3_dag
+     (
+             opid_t  family,
+             side_t  side,
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	const dim_t bs = BLIS_L3_DAG_BLKSZ;
+	const dim_t m  = ( bli_is_left( side ) ? bli_obj_length( b ) : bli_obj_width( b ) );
+	const dim_t n  = ( bli_is_left( side ) ? bli_obj_width( b ) : bli_obj_length( b ) );
+
+	if ( m < 2 * bs || n == 0 ) return BLIS_FAILURE;
+	if ( bli_obj_diag_offset( a ) != 0 ) return BLIS_FAILURE;
+
+	// Determine the number of threads requested.
+	rntm_t rntm_l = *rntm;
+	bli_rntm_set_ways_for_op( BLIS_GEMM, BLIS_LEFT, m, n, m, &rntm_l );
+
+	const timpl_t ti = bli_rntm_thread_impl( &rntm_l );
+	const dim_t   nt = bli_rntm_calc_num_threads( &rntm_l );
+
+	if ( nt < 2 || ti == BLIS_SINGLE ) return BLIS_FAILURE;
+
+	// The DAG schedule accumulates the updates to each block in a different
+	// order than the single-threaded algorithm, so it is not used when the
+	// result must be independent of the number of threads.
+	if ( bli_rntm_repro( rntm ) ) return BLIS_FAILURE;
+	if ( bli_env_get_var( "BLIS_L3_DAG", 1 ) == 0 ) return BLIS_FAILURE;
+
+	l3dag_t dag;
+
+	dag.family = family;
+	dag.alpha  = alpha;
+	dag.cntx   = cntx;
+	dag.p      = ( m + bs - 1 ) / bs;
+	dag.q      = ( n + bs - 1 ) / bs;
+	dag.nt     = nt;
+
+	// Each task is executed by one thread, and is never split further.
+	rntm_t rntm_task = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_l3_sup( bli_rntm_l3_sup( rntm ), &rntm_task );
+	dag.rntm = rntm_task;
+
+	// Induce any transposition of A, and transpose the operation if A is on
+	// the right, as bli_trsm_front() does.
+	bli_obj_alias_to( a, &dag.a );
+	bli_obj_alias_to( b, &dag.b );
+
+	if ( bli_obj_has_trans( &dag.a ) )
+	{
+		bli_obj_induce_trans( &dag.a );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &dag.a );
+	}
+
+	if ( bli_is_right( side ) )
+	{
+		bli_obj_induce_trans( &dag.a );
+		bli_obj_induce_trans( &dag.b );
+	}
+
+	dag.is_upper = bli_obj_is_upper( &dag.a );
+
+	// Build the graph.
+	const dim_t n_tasks = dag.q * ( ( dag.p * ( dag.p + 1 ) ) / 2 );
+	      dim_t n_edges = 0;
+	      err_t r_val;
+
+	dag.tasks = bli_malloc_intl( n_tasks * sizeof( l3dag_task_t ), &r_val );
+
+	for ( dim_t j = 0; j < dag.q; ++j )
+	for ( dim_t i = 0; i < dag.p; ++i )
+	for ( dim_t k = 0; k <= i;    ++k )
+	{
+		l3dag_task_t* task = &dag.tasks[ bli_l3dag_id( &dag, i, k, j ) ];
+
+		task->i        = i;
+		task->k        = k;
+		task->j        = j;
+		task->deps     = 0;
+		task->succ_off = n_edges;
+		task->n_succ   = bli_l3dag_succ( &dag, i, k, j, NULL );
+
+		n_edges += task->n_succ;
+	}
+
+	dag.succ = bli_malloc_intl( bli_max( n_edges, 1 ) * sizeof( dim_t ), &r_val );
+
+	for ( dim_t t = 0; t < n_tasks; ++t )
+	{
+		const l3dag_task_t* task = &dag.tasks[ t ];
+		dim_t*              succ = &dag.succ[ task->succ_off ];
+
+		bli_l3dag_succ( &dag, task->i, task->k, task->j, succ );
+
+		for ( dim_t s = 0; s < task->n_succ; ++s )
+			dag.tasks[ succ[ s ] ].deps += 1;
+	}
+
+	// Distribute the initially ready tasks among the threads' deques.
+	dag.deques = bli_malloc_intl( nt * sizeof( l3dag_deque_t ), &r_val );
+
+	for ( dim_t t = 0; t < nt; ++t )
+	{
+		l3dag_deque_t* dq = &dag.deques[ t ];
+
+		bli_pthread_mutex_init( &dq->lock, NULL );
+
+		dq->size   = 2 * dag.q + 16;
+		dq->buf    = bli_malloc_intl( dq->size * sizeof( dim_t ), &r_val );
+		dq->top    = 0;
+		dq->bottom = 0;
+	}
+
+	for ( dim_t t = 0, r = 0; t < n_tasks; ++t )
+	{
+		if ( dag.tasks[ t ].deps == 0 )
+			bli_l3dag_push( &dag.deques[ r++ % nt ], t );
+	}
+
+	dag.n_left = n_tasks;
+
+	// Begin tracing the operation (if tracing is enabled).
+	trace_call_t call;
+	bli_trace_call_begin( &call );
+	dag.call = &call;
+
+	bli_thread_launch( ti, nt, bli_l3dag_thread_entry, &dag );
+
+	// The work is partitioned by tasks rather than loops.
+	bli_rntm_set_ways_only( 1, 1, 1, 1, 1, &rntm_l );
+	bli_rntm_set_num_threads_only( nt, &rntm_l );
+
+	bli_trace_call_end( &call, BLIS_TRACE_DAG, family, bli_obj_dt( b ),
+	                    m, n, m, &rntm_l );
+
+	for ( dim_t t = 0; t < nt; ++t )
+	{
+		bli_pthread_mutex_destroy( &dag.deques[ t ].lock );
+		bli_free_intl( dag.deques[ t ].buf );
+	}
+
+	bli_free_intl( dag.deques );
+	bli_free_intl( dag.succ );
+	bli_free_intl( dag.tasks );
+
+	return BLIS_SUCCESS;
+}
+
@@ -4,7 +4,7 @@
    An object-based framework for developing high-performance BLAS-like
    libraries.
 
-   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2022, The University of Texas at Austin
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -32,58 +32,37 @@
 
 */
 
-#include "blis.h"
 
-void bli_gemm_ex
+//
+// Task-parallel (algorithms-by-blocks) trsm and trmm. The triangular matrix
+// is partitioned into BLIS_L3_DAG_BLKSZ x BLIS_L3_DAG_BLKSZ tiles and the
+// general matrix into tiles of the same size, and the computation is
+// expressed as a directed acyclic graph of tasks, each of which is a
+// single-threaded trsm/trmm with a diagonal tile or a gemm with an
+// off-diagonal tile. The tasks are scheduled on a work-stealing runtime.
+// This avoids the limited parallelism of the conventional left-side trsm
+// and trmm, in which the dependencies along the m dimension leave only the
+// JC and JR loops to be threaded.
+//
+
+#ifndef BLIS_L3_DAG_BLKSZ
+#define BLIS_L3_DAG_BLKSZ 256
+#endif
+
+// Execute trsm (family == BLIS_TRSM) or trmm (family == BLIS_TRMM) as a
+// graph of tasks and return BLIS_SUCCESS, or return BLIS_FAILURE without
+// touching any operand if the problem should instead be computed by the
+// conventional implementation: if only one thread was requested, if the
+// triangular matrix consists of fewer than two tiles, or if the graph was
+// disabled by setting the environment variable BLIS_L3_DAG to 0.
+err_t bli_l3_dag
      (
+             opid_t  family,
+             side_t  side,
        const obj_t*  alpha,
        const obj_t*  a,
        const obj_t*  b,
-       const obj_t*  beta,
-       const obj_t*  c,
        const cntx_t* cntx,
-             rntm_t* rntm
-     )
-{
-	bli_init_once();
-
-	// A switch to easily toggle whether we use the addon implementation
-	// of bao_gemmd() as the implementation for bli_gemm(). (This allows for
-	// easy testing of bao_gemmd() via the testsuite.)
-	if ( 1 )
-	{
-		const dim_t k  = bli_obj_width_after_trans( a );
-		const num_t dt = bli_obj_dt( c );
-		obj_t       d;
-
-		bli_obj_create( dt, k, 1, 1, k, &d );
-		bli_setv( &BLIS_ONE, &d );
-		//bli_randv( &d );
-
-		bao_gemmd_ex( alpha, a, &d, b, beta, c, cntx, rntm );
-
-		bli_obj_free( &d );
-		return;
-	}
-
-	// Initialize a local runtime with global settings if necessary. Note
-	// that in the case that a runtime is passed in, we make a local copy.
-	rntm_t rntm_l;
-	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
-	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
-
-	// Obtain a valid (native) context from the gks if necessary.
-	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
-
-	// Check the operands.
-	if ( bli_error_checking_is_enabled() )
-		bli_gemm_check( alpha, a, b, beta, c, cntx );
-
-	// Invoke the operation's front end.
-	bli_gemm_front
-	(
-	  ( obj_t* )alpha, ( obj_t* )a, ( obj_t* )b, ( obj_t* )beta, ( obj_t* )c,
-	  ( cntx_t* )cntx, ( rntm_t* )rntm, NULL
-	);
-}
+       const rntm_t* rntm
+     );
 
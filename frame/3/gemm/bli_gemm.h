@@ -35,10 +35,13 @@
 #include "bli_gemm_cntl.h"
 #include "bli_gemm_front.h"
 
+#include "bli_gemm_epi.h"
 #include "bli_gemm_var.h"
 
 #include "bli_gemm_ind_opt.h"
 
+#include "bli_gemm_tiny.h"
+
 // Mixed datatype support.
 #ifdef BLIS_ENABLE_GEMM_MD
 #include "bli_gemm_md.h"
@@ -60,6 +60,25 @@ void bli_gemm_blk_var3
 	// Query dimension in partitioning direction.
 	dim_t k_trans = bli_obj_width_after_trans( &ap );
 
+	// If C carries a gemm epilogue, it may only be applied once the entire
+	// k dimension has been accumulated. Thus, we hide it from the macrokernel
+	// during all but the last rank-k update. (The parameters of C are only
+	// interpreted this way when C does not carry a custom macrokernel.)
+	gemm_ker_params_t* params = NULL;
+	gemm_ker_params_t  params_noepi;
+
+	if ( bli_cntl_family( cntl ) == BLIS_GEMM && bli_obj_ker_fn( &cs ) == NULL )
+	{
+		params = bli_obj_ker_params( &cs );
+
+		if ( params != NULL && params->epi != NULL )
+		{
+			params_noepi     = *params;
+			params_noepi.epi = NULL;
+		}
+		else params = NULL;
+	}
+
 	// Partition along the k dimension.
 	dim_t b_alg;
 	for ( dim_t i = 0; i < k_trans; i += b_alg )
@@ -75,6 +94,10 @@ void bli_gemm_blk_var3
 		bli_acquire_mpart_mdim( direct, BLIS_SUBPART1,
 		                        i, b_alg, &bp, &b1 );
 
+		if ( params != NULL )
+			bli_obj_set_ker_params( i + b_alg < k_trans ? &params_noepi
+			                                            : params, &cs );
+
 		// Perform gemm subproblem.
 		bli_l3_int
 		(
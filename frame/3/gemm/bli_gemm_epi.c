@@ -0,0 +1,207 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// Define the epilogue kernels. The m x n submatrix is traversed so that the
+// inner loop runs along its contiguous dimension, and each transformation is
+// applied to an entire row (or column) at a time so that the inner loops
+// remain simple enough for the compiler to vectorize.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, tanhfn, erffn ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             dim_t       m, \
+             dim_t       n, \
+             dim_t       off_m, \
+             dim_t       off_n, \
+             void*       c, inc_t rs_c, inc_t cs_c, \
+       const gemm_epi_t* epi  \
+     ) \
+{ \
+	ctype* restrict c_cast = c; \
+\
+	const ctype* restrict bias     = epi->bias; \
+	const inc_t           inc_bias = epi->inc_bias; \
+	const ctype           scale    = epi->scale; \
+	const ctype           clip_min = epi->clip_min; \
+	const ctype           clip_max = epi->clip_max; \
+\
+	const ctype           half     = 0.5; \
+	const ctype           gelu_c0  = 0.7978845608028654; /* sqrt(2/pi) */ \
+	const ctype           gelu_c1  = 0.044715; \
+	const ctype           rsqrt2   = 0.7071067811865476; /* 1/sqrt(2) */ \
+\
+	/* Identify whether the bias varies along the inner (contiguous) loop
+	   or the outer loop. */ \
+	bool  bias_inner = ( epi->bias_type == BLIS_EPI_BIAS_COLS ); \
+	bool  bias_outer = ( epi->bias_type == BLIS_EPI_BIAS_ROWS ); \
+	dim_t off_i      = off_m; \
+	dim_t off_j      = off_n; \
+\
+	/* Iterate over rows in the outer loop if C is row-stored, or columns
+	   otherwise. (We express the traversal in terms of a row-stored
+	   matrix.) */ \
+	if ( bli_abs( cs_c ) > bli_abs( rs_c ) ) \
+	{ \
+		bli_swap_dims( &m, &n ); \
+		bli_swap_incs( &rs_c, &cs_c ); \
+		bli_swap_dims( &off_i, &off_j ); \
+		bool t = bias_inner; bias_inner = bias_outer; bias_outer = t; \
+	} \
+\
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		ctype* restrict ci = c_cast + i*rs_c; \
+\
+		if ( bias_outer ) \
+		{ \
+			const ctype beta_i = bias[ ( off_i + i )*inc_bias ]; \
+			for ( dim_t j = 0; j < n; ++j ) ci[ j*cs_c ] += beta_i; \
+		} \
+		else if ( bias_inner ) \
+		{ \
+			const ctype* restrict bj = bias + off_j*inc_bias; \
+			for ( dim_t j = 0; j < n; ++j ) ci[ j*cs_c ] += bj[ j*inc_bias ]; \
+		} \
+\
+		switch ( epi->act ) \
+		{ \
+			case BLIS_EPI_RELU: \
+				for ( dim_t j = 0; j < n; ++j ) \
+				{ \
+					const ctype x = ci[ j*cs_c ]; \
+					ci[ j*cs_c ] = ( x > 0 ? x : 0 ); \
+				} \
+				break; \
+			case BLIS_EPI_GELU_TANH: \
+				for ( dim_t j = 0; j < n; ++j ) \
+				{ \
+					const ctype x = ci[ j*cs_c ]; \
+					ci[ j*cs_c ] = half * x * ( 1 + tanhfn( gelu_c0 * \
+					                            ( x + gelu_c1 * x * x * x ) ) ); \
+				} \
+				break; \
+			case BLIS_EPI_GELU_ERF: \
+				for ( dim_t j = 0; j < n; ++j ) \
+				{ \
+					const ctype x = ci[ j*cs_c ]; \
+					ci[ j*cs_c ] = half * x * ( 1 + erffn( rsqrt2 * x ) ); \
+				} \
+				break; \
+			default: \
+				break; \
+		} \
+\
+		if ( scale != 1 ) \
+			for ( dim_t j = 0; j < n; ++j ) ci[ j*cs_c ] *= scale; \
+\
+		if ( epi->clip ) \
+			for ( dim_t j = 0; j < n; ++j ) \
+			{ \
+				const ctype x = ci[ j*cs_c ]; \
+				ci[ j*cs_c ] = ( x < clip_min ? clip_min : \
+				               ( x > clip_max ? clip_max : x ) ); \
+			} \
+	} \
+}
+
+GENTFUNC( float,  s, gemm_epi_apply, tanhf, erff )
+GENTFUNC( double, d, gemm_epi_apply, tanh,  erf  )
+
+// -----------------------------------------------------------------------------
+
+void bli_gemm_epi_apply
+     (
+             num_t       dt,
+             bool        trans,
+             dim_t       m,
+             dim_t       n,
+             dim_t       off_m,
+             dim_t       off_n,
+             void*       c, inc_t rs_c, inc_t cs_c,
+       const gemm_epi_t* epi
+     )
+{
+	gemm_epi_ft f = ( dt == BLIS_FLOAT ? bli_sgemm_epi_apply
+	                                   : bli_dgemm_epi_apply );
+
+	if ( trans ) f( n, m, off_n, off_m, c, cs_c, rs_c, epi );
+	else         f( m, n, off_m, off_n, c, rs_c, cs_c, epi );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_gemm_epi_check
+     (
+       const obj_t*      a,
+       const obj_t*      b,
+       const obj_t*      c,
+       const gemm_epi_t* epi
+     )
+{
+	err_t e_val;
+
+	// Epilogues are only supported for real, non-mixed datatypes.
+
+	e_val = bli_check_real_object( c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_object_datatypes( c, a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_object_datatypes( c, b );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_precisions( bli_obj_dt( c ),
+	                                         BLIS_REAL | bli_obj_comp_prec( c ) );
+	bli_check_error_code( e_val );
+
+	// Check the epilogue itself.
+
+	e_val = bli_check_null_pointer( epi );
+	bli_check_error_code( e_val );
+
+	if ( epi->bias_type != BLIS_EPI_NO_BIAS )
+	{
+		e_val = bli_check_null_pointer( epi->bias );
+		bli_check_error_code( e_val );
+	}
+}
+
@@ -0,0 +1,231 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// gemm epilogues.
+//
+// An epilogue describes an elementwise transformation that is applied to
+// each element of C once the gemm update is complete:
+//
+//   C := clip( scale * act( beta * C + alpha * A * B + bias ) )
+//
+// The epilogue is applied by the macrokernel (or the sup variants) to each
+// microtile (or millikernel block) of C immediately after it is written,
+// while it is still resident in cache, which avoids a separate pass over C.
+// Epilogues are supported only for real datatypes.
+//
+
+typedef enum
+{
+	BLIS_EPI_NO_BIAS = 0,
+	BLIS_EPI_BIAS_ROWS,   // One bias element per row of C (length m).
+	BLIS_EPI_BIAS_COLS    // One bias element per column of C (length n).
+} epi_bias_t;
+
+typedef enum
+{
+	BLIS_EPI_NO_ACT = 0,
+	BLIS_EPI_RELU,        // max( x, 0 )
+	BLIS_EPI_GELU_TANH,   // 0.5 x ( 1 + tanh( sqrt(2/pi) ( x + 0.044715 x^3 ) ) )
+	BLIS_EPI_GELU_ERF     // 0.5 x ( 1 + erf( x / sqrt(2) ) )
+} epi_act_t;
+
+typedef struct
+{
+	// The bias vector, whose elements are stored in the datatype of C.
+	epi_bias_t  bias_type;
+	const void* bias;
+	inc_t       inc_bias;
+
+	// The elementwise activation function.
+	epi_act_t   act;
+
+	// The output scaling factor and (optional) clipping range.
+	double      scale;
+	bool        clip;
+	double      clip_min;
+	double      clip_max;
+} gemm_epi_t;
+
+// Initialize an epilogue that leaves C unchanged.
+BLIS_INLINE void bli_gemm_epi_init( gemm_epi_t* epi )
+{
+	epi->bias_type = BLIS_EPI_NO_BIAS;
+	epi->bias      = NULL;
+	epi->inc_bias  = 1;
+	epi->act       = BLIS_EPI_NO_ACT;
+	epi->scale     = 1.0;
+	epi->clip      = FALSE;
+	epi->clip_min  = 0.0;
+	epi->clip_max  = 0.0;
+}
+
+// Return a transposed copy of an epilogue, which is needed whenever the
+// entire operation is transposed (e.g. to satisfy the storage preference of
+// the microkernel).
+BLIS_INLINE gemm_epi_t bli_gemm_epi_trans( const gemm_epi_t* epi )
+{
+	gemm_epi_t r = *epi;
+
+	if      ( epi->bias_type == BLIS_EPI_BIAS_ROWS ) r.bias_type = BLIS_EPI_BIAS_COLS;
+	else if ( epi->bias_type == BLIS_EPI_BIAS_COLS ) r.bias_type = BLIS_EPI_BIAS_ROWS;
+
+	return r;
+}
+
+//
+// Prototype the epilogue kernels. These apply the epilogue to an m x n
+// submatrix of C whose top-left element is located at (off_m, off_n)
+// relative to the matrix to which the epilogue refers; the offsets are
+// used to index the bias vector.
+//
+
+typedef void (*gemm_epi_ft)
+     (
+             dim_t       m,
+             dim_t       n,
+             dim_t       off_m,
+             dim_t       off_n,
+             void*       c, inc_t rs_c, inc_t cs_c,
+       const gemm_epi_t* epi
+     );
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             dim_t       m, \
+             dim_t       n, \
+             dim_t       off_m, \
+             dim_t       off_n, \
+             void*       c, inc_t rs_c, inc_t cs_c, \
+       const gemm_epi_t* epi  \
+     );
+
+GENTPROT( float,  s, gemm_epi_apply )
+GENTPROT( double, d, gemm_epi_apply )
+
+// Apply an epilogue to a (possibly transposed) view. This is used by code
+// that may have transposed the operation internally, in which case the
+// block is transposed back before the epilogue is applied.
+void bli_gemm_epi_apply
+     (
+             num_t       dt,
+             bool        trans,
+             dim_t       m,
+             dim_t       n,
+             dim_t       off_m,
+             dim_t       off_n,
+             void*       c, inc_t rs_c, inc_t cs_c,
+       const gemm_epi_t* epi
+     );
+
+void bli_gemm_epi_check
+     (
+       const obj_t*      a,
+       const obj_t*      b,
+       const obj_t*      c,
+       const gemm_epi_t* epi
+     );
+
+//
+// Prototype object-based interfaces (basic and expert).
+//
+
+BLIS_EXPORT_BLIS void bli_gemm_epi
+     (
+       const obj_t*      alpha,
+       const obj_t*      a,
+       const obj_t*      b,
+       const obj_t*      beta,
+       const obj_t*      c,
+       const gemm_epi_t* epi
+     );
+
+BLIS_EXPORT_BLIS void bli_gemm_epi_ex
+     (
+       const obj_t*      alpha,
+       const obj_t*      a,
+       const obj_t*      b,
+       const obj_t*      beta,
+       const obj_t*      c,
+       const gemm_epi_t* epi,
+       const cntx_t*     cntx,
+       const rntm_t*     rntm
+     );
+
+//
+// Prototype BLAS-like interfaces with typed operands (basic and expert).
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname) \
+     ( \
+             trans_t     transa, \
+             trans_t     transb, \
+             dim_t       m, \
+             dim_t       n, \
+             dim_t       k, \
+       const ctype*      alpha, \
+       const ctype*      a, inc_t rs_a, inc_t cs_a, \
+       const ctype*      b, inc_t rs_b, inc_t cs_b, \
+       const ctype*      beta, \
+             ctype*      c, inc_t rs_c, inc_t cs_c, \
+       const gemm_epi_t* epi  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC2(ch,opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             trans_t     transa, \
+             trans_t     transb, \
+             dim_t       m, \
+             dim_t       n, \
+             dim_t       k, \
+       const ctype*      alpha, \
+       const ctype*      a, inc_t rs_a, inc_t cs_a, \
+       const ctype*      b, inc_t rs_b, inc_t cs_b, \
+       const ctype*      beta, \
+             ctype*      c, inc_t rs_c, inc_t cs_c, \
+       const gemm_epi_t* epi, \
+       const cntx_t*     cntx, \
+       const rntm_t*     rntm  \
+     );
+
+GENTPROT( float,  s, gemm_epi )
+GENTPROT( double, d, gemm_epi )
+
@@ -0,0 +1,131 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+void bli_gemm_epi
+     (
+       const obj_t*      alpha,
+       const obj_t*      a,
+       const obj_t*      b,
+       const obj_t*      beta,
+       const obj_t*      c,
+       const gemm_epi_t* epi
+     )
+{
+	bli_gemm_epi_ex( alpha, a, b, beta, c, epi, NULL, NULL );
+}
+
+void bli_gemm_epi_ex
+     (
+       const obj_t*      alpha,
+       const obj_t*      a,
+       const obj_t*      b,
+       const obj_t*      beta,
+       const obj_t*      c,
+       const gemm_epi_t* epi,
+       const cntx_t*     cntx,
+       const rntm_t*     rntm
+     )
+{
+	bli_init_once();
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_gemm_epi_check( a, b, c, epi );
+
+	// If C has a zero dimension, return early.
+	if ( bli_obj_has_zero_dim( c ) ) return;
+
+	const num_t dt = bli_obj_dt( c );
+
+	// If alpha is zero, or if A or B has a zero dimension, scale C by beta
+	// and then apply the epilogue in a separate pass, since the gemm
+	// implementation will not visit C in these cases.
+	if ( bli_obj_equals( alpha, &BLIS_ZERO ) ||
+	     bli_obj_has_zero_dim( a ) ||
+	     bli_obj_has_zero_dim( b ) )
+	{
+		bli_scalm( beta, c );
+
+		bli_gemm_epi_apply
+		(
+		  dt, FALSE,
+		  bli_obj_length( c ), bli_obj_width( c ),
+		  0, 0,
+		  bli_obj_buffer_at_off( c ),
+		  bli_obj_row_stride( c ), bli_obj_col_stride( c ),
+		  epi
+		);
+		return;
+	}
+
+#ifdef BLIS_ENABLE_SANDBOX
+	// A sandbox provides its own gemm implementation, which knows nothing
+	// of epilogues, so apply the epilogue in a separate pass.
+	bli_gemm_ex( alpha, a, b, beta, c, cntx, rntm );
+
+	bli_gemm_epi_apply
+	(
+	  dt, FALSE,
+	  bli_obj_length( c ), bli_obj_width( c ),
+	  0, 0,
+	  bli_obj_buffer_at_off( c ),
+	  bli_obj_row_stride( c ), bli_obj_col_stride( c ),
+	  epi
+	);
+#else
+	obj_t c_local;
+
+	// Attach the epilogue to C via the kernel parameters, preserving any
+	// user-specified microkernel that was already attached. If the gemm
+	// implementation transposes the operation (e.g. to satisfy the storage
+	// preference of the microkernel), it transposes the epilogue as well.
+	const gemm_ker_params_t* params_c = bli_obj_ker_params( c );
+	gemm_ker_params_t        params;
+
+	params.ukr = ( params_c ? params_c->ukr : NULL );
+	params.epi = epi;
+
+	bli_obj_alias_to( c, &c_local );
+	bli_obj_set_ker_params( &params, &c_local );
+
+	bli_gemm_ex( alpha, a, b, beta, &c_local, cntx, rntm );
+#endif
+}
+
@@ -52,17 +52,43 @@ void bli_gemm_front
 	obj_t   b_local;
 	obj_t   c_local;
 
-#if 0
+	gemm_ker_params_t params_t;
+	gemm_epi_t        epi_t;
+
 #ifdef BLIS_ENABLE_SMALL_MATRIX
-	// Only handle small problems separately for homogeneous datatypes.
+	// Only handle small problems separately for homogeneous datatypes, and
+	// only when a single thread was requested, since the small matrix code
+	// is not parallelized. (In reproducible mode, the number of threads is
+	// ignored so that the same code path is taken regardless.) The small
+	// matrix code also knows nothing of the kernel parameters (a user
+	// microkernel or an epilogue) that may be attached to C, nor of the
+	// packing parameters (such as the diagonal scaling of the gemmd addon)
+	// that may be attached to A or B.
+	const bool is_st = ( bli_rntm_thread_impl( rntm ) == BLIS_SINGLE ||
+	                     ( bli_rntm_num_threads( rntm ) <= 1 &&
+	                       bli_rntm_calc_num_threads( rntm ) <= 1 ) );
+
 	if ( bli_obj_dt( a ) == bli_obj_dt( b ) &&
 	     bli_obj_dt( a ) == bli_obj_dt( c ) &&
-	     bli_obj_comp_prec( c ) == bli_obj_prec( c ) )
+	     bli_obj_comp_prec( c ) == bli_obj_prec( c ) &&
+	     bli_obj_ker_params( c ) == NULL &&
+	     bli_obj_pack_params( a ) == NULL &&
+	     bli_obj_pack_params( b ) == NULL &&
+	     ( is_st || bli_rntm_repro( rntm ) ) )
 	{
-		err_t status = bli_gemm_small( alpha, a, b, beta, c, cntx, cntl );
-		if ( status == BLIS_SUCCESS ) return;
+		trace_call_t call;
+		bli_trace_call_begin( &call );
+
+		err_t status = bli_gemm_small( alpha, a, b, beta, c, cntx, NULL );
+		if ( status == BLIS_SUCCESS )
+		{
+			bli_trace_call_end( &call, BLIS_TRACE_SMALL, BLIS_GEMM,
+			                    bli_obj_dt( c ), bli_obj_length( c ),
+			                    bli_obj_width( c ), bli_obj_width_after_trans( a ),
+			                    rntm );
+			return;
+		}
 	}
-#endif
 #endif
 
 	// Alias A, B, and C in case we need to apply transformations.
@@ -89,6 +115,19 @@ void bli_gemm_front
 		bli_obj_induce_trans( &a_local );
 		bli_obj_induce_trans( &b_local );
 		bli_obj_induce_trans( &c_local );
+
+		// If C carries a gemm epilogue, it must be transposed along with
+		// the operation.
+		const gemm_ker_params_t* params = bli_obj_ker_params( &c_local );
+
+		if ( params != NULL && params->epi != NULL )
+		{
+			epi_t        = bli_gemm_epi_trans( params->epi );
+			params_t     = *params;
+			params_t.epi = &epi_t;
+
+			bli_obj_set_ker_params( &params_t, &c_local );
+		}
 	}
 
 	// Set the pack schemas within the objects.
@@ -44,7 +44,7 @@ void bli_gemm_front
      );
 
 #ifdef BLIS_ENABLE_SMALL_MATRIX
-err_t bli_gemm_small
+BLIS_EXPORT_BLIS err_t bli_gemm_small
      (
        const obj_t*  alpha,
        const obj_t*  a,
@@ -189,6 +189,17 @@ void bli_gemm_ker_var2
 	gemm_ukr_ft user_ukr = params ? params->ukr : NULL;
 	if ( user_ukr ) gemm_ukr = user_ukr;
 
+	// Likewise, query the epilogue (if any) to apply to each microtile of C
+	// once it has been updated. The offsets of C locate the current panel
+	// within the matrix to which the epilogue refers.
+	const gemm_epi_t* epi     = params ? params->epi : NULL;
+	gemm_epi_ft       epi_fn  = NULL;
+	const doff_t      off_m_c = bli_obj_row_off( c );
+	const doff_t      off_n_c = bli_obj_col_off( c );
+
+	if ( epi ) epi_fn = ( dt_c == BLIS_FLOAT ? bli_sgemm_epi_apply
+	                                         : bli_dgemm_epi_apply );
+
 	// Temporary C buffer for edge cases. Note that the strides of this
 	// temporary buffer are set so that they match the storage of the
 	// original C matrix. For example, if C is column-stored, ct will be
@@ -388,6 +399,16 @@ void bli_gemm_ker_var2
 				);
 			}
 
+			// Apply the epilogue while the microtile is still in cache.
+			if ( epi_fn )
+				epi_fn
+				(
+				  m_cur, n_cur,
+				  off_m_c + i * MR, off_n_c + j * NR,
+				  c11, rs_c, cs_c,
+				  epi
+				);
+
 			// Decrement the number of microtiles assigned to the thread; once
 			// it reaches zero, return immediately.
 			n_ut_for_me -= 1; if ( n_ut_for_me == 0 ) return;
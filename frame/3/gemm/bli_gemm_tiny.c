@@ -0,0 +1,179 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// The runtime reported to the tracing subsystem for tiny problems.
+static const rntm_t tiny_rntm = BLIS_RNTM_INITIALIZER;
+
+// Return whether a matrix has unit stride in one dimension and a valid
+// leading dimension in the other. Anything else is left to the object API,
+// which also reports any errors.
+BLIS_INLINE bool bli_gemm_tiny_is_rc( dim_t m, dim_t n, inc_t rs, inc_t cs )
+{
+	return ( rs == 1 && m <= cs ) || ( cs == 1 && n <= rs );
+}
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+err_t PASTEMAC(ch,opname) \
+     ( \
+             trans_t transa, \
+             trans_t transb, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   k, \
+       const ctype*  alpha, \
+       const ctype*  a, inc_t rs_a, inc_t cs_a, \
+       const ctype*  b, inc_t rs_b, inc_t cs_b, \
+       const ctype*  beta, \
+             ctype*  c, inc_t rs_c, inc_t cs_c, \
+       const cntx_t* cntx, \
+       const rntm_t* rntm  \
+     ) \
+{ \
+	/* The dispatch table is only derived for the contexts in the gks, so
+	   custom contexts always use the object API. */ \
+	if ( cntx != NULL ) return BLIS_FAILURE; \
+\
+	const num_t      dt       = PASTEMAC(ch,type); \
+	const cntx_t*    cntx_nat = bli_gks_query_cntx(); \
+	const l3_tiny_t* tiny     = bli_cntx_get_l3_tiny_dt( dt, cntx_nat ); \
+\
+	/* Tiny problems are always computed by the calling thread, unless the
+	   caller explicitly requested more threads or disabled sup handling.
+	   In reproducible mode, the request for more threads is ignored so that
+	   the same code path is taken regardless of the number of threads. */ \
+	if ( rntm != NULL ) \
+	{ \
+		if ( !bli_rntm_l3_sup( rntm ) ) return BLIS_FAILURE; \
+		if ( !bli_rntm_repro( rntm ) && \
+		     ( 1 < bli_rntm_num_threads( rntm ) || \
+		       1 < bli_rntm_calc_num_threads( rntm ) ) ) return BLIS_FAILURE; \
+	} \
+\
+	if ( m < 1 || tiny->max_dim < m || \
+	     n < 1 || tiny->max_dim < n || \
+	     k < 1 || tiny->max_dim < k ) return BLIS_FAILURE; \
+\
+	/* Leave NULL operands to the object API, which reports them as errors
+	   (when error checking is enabled). */ \
+	if ( alpha == NULL || beta == NULL || \
+	     a == NULL || b == NULL || c == NULL ) return BLIS_FAILURE; \
+\
+	/* Leave alpha = 0 to the object API, which does not read A or B. */ \
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) return BLIS_FAILURE; \
+\
+	/* Induce any transposition of A and B into their strides. */ \
+	if ( bli_does_trans( transa ) ) bli_swap_incs( &rs_a, &cs_a ); \
+	if ( bli_does_trans( transb ) ) bli_swap_incs( &rs_b, &cs_b ); \
+\
+	if ( !bli_gemm_tiny_is_rc( m, k, rs_a, cs_a ) || \
+	     !bli_gemm_tiny_is_rc( k, n, rs_b, cs_b ) || \
+	     !bli_gemm_tiny_is_rc( m, n, rs_c, cs_c ) ) return BLIS_FAILURE; \
+\
+	const stor3_t        stor_id = bli_stor3_from_strides( rs_c, cs_c, \
+	                                                       rs_a, cs_a, \
+	                                                       rs_b, cs_b ); \
+	const gemmsup_ker_ft ker     = ( gemmsup_ker_ft )tiny->ker[ stor_id ]; \
+\
+	if ( ker == NULL ) return BLIS_FAILURE; \
+\
+	conj_t conja = bli_extract_conj( transa ); \
+	conj_t conjb = bli_extract_conj( transb ); \
+\
+	/* Transpose the operation (C^T = B^T * A^T) if the table says so. */ \
+	if ( tiny->trans[ stor_id ] ) \
+	{ \
+		      conj_t conjtmp = conja; conja = conjb; conjb = conjtmp; \
+		      dim_t  len_tmp =     m;     m =     n;     n = len_tmp; \
+		const ctype* buf_tmp =     a;     a =     b;     b = buf_tmp; \
+		      inc_t  str_tmp =  rs_a;  rs_a =  cs_b;  cs_b = str_tmp; \
+		             str_tmp =  cs_a;  cs_a =  rs_b;  rs_b = str_tmp; \
+		             str_tmp =  rs_c;  rs_c =  cs_c;  cs_c = str_tmp; \
+	} \
+\
+	trace_call_t call; \
+	bli_trace_call_begin( &call ); \
+\
+	/* The millikernel iterates over the m dimension, stepping through A
+	   MR rows at a time. */ \
+	auxinfo_t aux; \
+	bli_auxinfo_set_ps_a( tiny->mr * rs_a, &aux ); \
+	bli_auxinfo_set_ps_b( tiny->nr * cs_b, &aux ); \
+\
+	/* Loop over the n dimension NR columns at a time, allowing the last
+	   iteration to contain up to nr_max columns, as bli_gemmsup_ref_var2m()
+	   does when it does not pack B. */ \
+	const dim_t NR      = tiny->nr; \
+	const dim_t NRE     = tiny->nr_max - NR; \
+	      dim_t jr_iter = ( n + NR - 1 ) / NR; \
+	      dim_t jr_left =   n % NR; \
+\
+	if ( NRE != 0 && 1 < jr_iter && jr_left != 0 && jr_left <= NRE ) \
+	{ \
+		jr_iter--; jr_left += NR; \
+	} \
+\
+	for ( dim_t j = 0; j < jr_iter; ++j ) \
+	{ \
+		const dim_t nr_cur = ( bli_is_not_edge_f( j, jr_iter, jr_left ) ? NR : jr_left ); \
+\
+		ker \
+		( \
+		  conja, \
+		  conjb, \
+		  m, \
+		  nr_cur, \
+		  k, \
+		  alpha, \
+		  a,                 rs_a, cs_a, \
+		  b + j * NR * cs_b, rs_b, cs_b, \
+		  beta, \
+		  c + j * NR * cs_c, rs_c, cs_c, \
+		  &aux, \
+		  cntx_nat \
+		); \
+	} \
+\
+	bli_trace_call_end( &call, BLIS_TRACE_TINY, BLIS_GEMM, dt, \
+	                    m, n, k, &tiny_rntm ); \
+\
+	return BLIS_SUCCESS; \
+}
+
+INSERT_GENTFUNC_BASIC( gemm_tiny )
+
@@ -41,6 +41,10 @@
 typedef struct
 {
 	gemm_ukr_ft ukr;
+
+	// The epilogue (if any) to apply to each microtile of C once the update
+	// is complete.
+	const gemm_epi_t* epi;
 } gemm_ker_params_t;
 
 
@@ -0,0 +1,78 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+void bli_gemmbatch_check
+     (
+       const obj_t*  alpha,
+       const obj_t*  a, inc_t stride_a,
+       const obj_t*  b, inc_t stride_b,
+       const obj_t*  beta,
+       const obj_t*  c, inc_t stride_c,
+             dim_t   batch_count,
+       const cntx_t* cntx
+     )
+{
+	err_t e_val;
+
+	( void )stride_a;
+	( void )stride_b;
+
+	// Check the first problem of the batch as we would any gemm.
+
+	bli_gemm_check( alpha, a, b, beta, c, cntx );
+
+	// Check object datatypes. Mixing datatypes is not supported.
+
+	e_val = bli_check_floating_object( c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_object_datatypes( c, a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_object_datatypes( c, b );
+	bli_check_error_code( e_val );
+
+	// Check the batch parameters. Since the problems of the batch are
+	// computed concurrently, no two of them may update the same C.
+
+	if ( batch_count < 0 )
+		bli_check_error_code( BLIS_NEGATIVE_DIMENSION );
+
+	if ( batch_count > 1 && stride_c == 0 )
+		bli_check_error_code( BLIS_INVALID_DIM_STRIDE_COMBINATION );
+}
+
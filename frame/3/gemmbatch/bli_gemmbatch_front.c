@@ -0,0 +1,172 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// Threads for the strided-batched gemm are spawned here directly (rather
+// than through the sup thread decorator) since the operands of the batch
+// are described by a gemmbatch_params_t.
+//
+
+struct gemmbatch_decor_params_s
+{
+	const gemmbatch_params_t* params;
+	const cntx_t*             cntx;
+	      rntm_t*             rntm;
+	      array_t*            array;
+	      trace_call_t*       call;
+};
+typedef struct gemmbatch_decor_params_s gemmbatch_decor_params_t;
+
+static void bli_gemmbatch_thread_entry( thrcomm_t* gl_comm, dim_t tid, const void* data_void )
+{
+	const gemmbatch_decor_params_t* data = data_void;
+
+	const double t_trace = bli_trace_thread_begin( data->call );
+
+	bli_l3_thread_decorator_thread_check( gl_comm, data->rntm );
+
+	// Create the root node of the thread's thrinfo_t structure. The sup
+	// thrinfo_t tree has exactly the shape needed by the block-panel variant
+	// (including the packm prenodes).
+	pool_t*    pool   = bli_apool_array_elem( tid, data->array );
+	thrinfo_t* thread = bli_l3_sup_thrinfo_create( tid, gl_comm, pool, data->rntm );
+
+	bli_gemmbatch_bp_var1( data->params, data->cntx, thread );
+
+	// Free the current thread's thrinfo_t structure (after a barrier, so that
+	// no thread releases packing memory still in use by its peers).
+	bli_thrinfo_barrier( thread );
+	bli_thrinfo_free( thread );
+
+	bli_trace_thread_end( data->call, t_trace );
+}
+
+void bli_gemmbatch_front
+     (
+       const gemmbatch_params_t* params,
+       const cntx_t*             cntx,
+       const rntm_t*             rntm
+     )
+{
+	bli_init_once();
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	const dim_t batch = params->batch;
+	const dim_t m     = params->m;
+	const dim_t n     = params->n;
+	const dim_t k     = params->k;
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); }
+	else                { rntm_l = *rntm;                       }
+
+	// A and B are always packed. Setting these fields also prevents
+	// bli_l3_sup_thrinfo_create() from assuming a sup-style (unpacked)
+	// execution.
+	bli_rntm_set_pack_a( TRUE, &rntm_l );
+	bli_rntm_set_pack_b( TRUE, &rntm_l );
+
+	// Parse and interpret the contents of the rntm_t object to determine
+	// the total number of threads.
+	bli_rntm_set_ways_for_op( BLIS_GEMM, BLIS_LEFT, m, n, k, &rntm_l );
+
+	// Query the threading implementation and the number of threads requested.
+	timpl_t ti = bli_rntm_thread_impl( &rntm_l );
+	dim_t   nt = bli_rntm_calc_num_threads( &rntm_l );
+
+	// Assign as many threads as possible to distinct problems of the batch
+	// via the JC loop (choosing the largest factor of nt that does not
+	// exceed the batch size), and partition the remaining threads between
+	// the IC and JR loops within each problem.
+	dim_t jc_way = bli_min( nt, batch );
+	while ( nt % jc_way != 0 ) --jc_way;
+
+	dim_t ic_way, jr_way;
+	bli_thread_partition_2x2( nt / jc_way, m, n, &ic_way, &jr_way );
+
+	bli_rntm_set_ways_only( jc_way, 1, ic_way, jr_way, 1, &rntm_l );
+	bli_rntm_set_num_threads_only( nt, &rntm_l );
+
+	if ( bli_error_checking_is_enabled() )
+		bli_l3_thread_decorator_check( &rntm_l );
+
+#ifdef BLIS_ENABLE_NT1_VIA_SINGLE
+	if ( nt == 1 )
+	{
+		// An optimization. If the caller requests only one thread, force
+		// the sequential implementation.
+		ti = BLIS_SINGLE;
+		bli_rntm_set_thread_impl( BLIS_SINGLE, &rntm_l );
+	}
+#endif
+
+	if ( 1 < nt && ti == BLIS_SINGLE )
+	{
+		// Favor the requested (sequential) threading implementation over the
+		// number of threads, and reset all parallelism parameters to 1.
+		nt = 1;
+		bli_rntm_set_ways_only( 1, 1, 1, 1, 1, &rntm_l );
+		bli_rntm_set_num_threads_only( 1, &rntm_l );
+	}
+
+	// Begin tracing the operation (if tracing is enabled).
+	trace_call_t call;
+	bli_trace_call_begin( &call );
+
+	// Check out an array_t from the small block allocator for the threads'
+	// thrinfo_t trees.
+	array_t* array = bli_sba_checkout_array( nt );
+
+	gemmbatch_decor_params_t decor_params;
+	decor_params.params = params;
+	decor_params.cntx   = cntx;
+	decor_params.rntm   = &rntm_l;
+	decor_params.array  = array;
+	decor_params.call   = &call;
+
+	bli_thread_launch( ti, nt, bli_gemmbatch_thread_entry, &decor_params );
+
+	bli_sba_checkin_array( array );
+
+	bli_trace_call_end( &call, BLIS_TRACE_BATCH, BLIS_GEMM, params->dt,
+	                    params->m, params->n, params->k, &rntm_l );
+}
+
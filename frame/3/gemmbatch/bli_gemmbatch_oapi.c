@@ -0,0 +1,194 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// Define object-based interfaces (basic and expert). The objects describe
+// the first problem of the batch, and the l-th problem is given by the
+// objects whose buffers lie l*stride_a, l*stride_b, and l*stride_c elements
+// beyond those of the first.
+//
+
+void bli_gemm_batch_strided
+     (
+       const obj_t*  alpha,
+       const obj_t*  a, inc_t stride_a,
+       const obj_t*  b, inc_t stride_b,
+       const obj_t*  beta,
+       const obj_t*  c, inc_t stride_c,
+             dim_t   batch_count
+     )
+{
+	bli_gemm_batch_strided_ex
+	(
+	  alpha,
+	  a, stride_a,
+	  b, stride_b,
+	  beta,
+	  c, stride_c,
+	  batch_count,
+	  NULL,
+	  NULL
+	);
+}
+
+void bli_gemm_batch_strided_ex
+     (
+       const obj_t*  alpha,
+       const obj_t*  a, inc_t stride_a,
+       const obj_t*  b, inc_t stride_b,
+       const obj_t*  beta,
+       const obj_t*  c, inc_t stride_c,
+             dim_t   batch_count,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_gemmbatch_check( alpha, a, stride_a, b, stride_b, beta, c, stride_c,
+		                     batch_count, cntx );
+
+	// If the batch is empty or C has a zero dimension, return early.
+	if ( batch_count == 0 || bli_obj_has_zero_dim( c ) ) return;
+
+	const num_t dt = bli_obj_dt( c );
+	const inc_t es = ( inc_t )bli_obj_elem_size( c );
+
+	// Create local copies of the scalars, typecast to the datatype of C.
+	obj_t alpha_local;
+	obj_t beta_local;
+
+	bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE,
+	                                      alpha, &alpha_local );
+	bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE,
+	                                      beta, &beta_local );
+
+	// If alpha is zero, or if A or B has a zero dimension, scale each C by
+	// beta and return early.
+	if ( bli_obj_equals( &alpha_local, &BLIS_ZERO ) ||
+	     bli_obj_has_zero_dim( a ) ||
+	     bli_obj_has_zero_dim( b ) )
+	{
+		obj_t c_l;
+		bli_obj_alias_to( c, &c_l );
+
+		for ( dim_t l = 0; l < batch_count; ++l )
+		{
+			bli_obj_set_buffer( ( char* )bli_obj_buffer( c ) + l * stride_c * es, &c_l );
+			bli_scalm_ex( &beta_local, &c_l, cntx, rntm );
+		}
+		return;
+	}
+
+	obj_t a_local;
+	obj_t b_local;
+	obj_t c_local;
+
+	inc_t st_a = stride_a;
+	inc_t st_b = stride_b;
+
+	// Alias A, B, and C in case we need to apply transformations.
+	bli_obj_alias_to( a, &a_local );
+	bli_obj_alias_to( b, &b_local );
+	bli_obj_alias_to( c, &c_local );
+
+	// Induce transpositions of A and B if they have their transposition
+	// properties set. Then clear the transposition bits in the objects.
+	// (Any conjugation remains and is applied during packing.)
+	if ( bli_obj_has_trans( &a_local ) )
+	{
+		bli_obj_induce_trans( &a_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &a_local );
+	}
+
+	if ( bli_obj_has_trans( &b_local ) )
+	{
+		bli_obj_induce_trans( &b_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &b_local );
+	}
+
+	// An optimization: If C is stored by rows and the microkernel prefers
+	// contiguous columns, or if C is stored by columns and the microkernel
+	// prefers contiguous rows, transpose the entire operation to allow the
+	// microkernel to access elements of C in its preferred manner. Note that
+	// a shared B thus becomes a shared A, which is handled equally well.
+	if ( bli_cntx_dislikes_storage_of( &c_local, BLIS_GEMM_UKR, cntx ) )
+	{
+		bli_obj_swap( &a_local, &b_local );
+		bli_swap_incs( &st_a, &st_b );
+
+		bli_obj_induce_trans( &a_local );
+		bli_obj_induce_trans( &b_local );
+		bli_obj_induce_trans( &c_local );
+	}
+
+	gemmbatch_params_t params;
+
+	params.dt    = dt;
+	params.batch = batch_count;
+	params.m     = bli_obj_length( &c_local );
+	params.n     = bli_obj_width( &c_local );
+	params.k     = bli_obj_width( &a_local );
+	params.conja = bli_obj_conj_status( &a_local );
+	params.conjb = bli_obj_conj_status( &b_local );
+
+	params.alpha = bli_obj_buffer_for_1x1( dt, &alpha_local );
+	params.beta  = bli_obj_buffer_for_1x1( dt, &beta_local );
+
+	params.a     = bli_obj_buffer_at_off( &a_local );
+	params.rs_a  = bli_obj_row_stride( &a_local );
+	params.cs_a  = bli_obj_col_stride( &a_local );
+	params.st_a  = st_a;
+
+	params.b     = bli_obj_buffer_at_off( &b_local );
+	params.rs_b  = bli_obj_row_stride( &b_local );
+	params.cs_b  = bli_obj_col_stride( &b_local );
+	params.st_b  = st_b;
+
+	params.c     = bli_obj_buffer_at_off( &c_local );
+	params.rs_c  = bli_obj_row_stride( &c_local );
+	params.cs_c  = bli_obj_col_stride( &c_local );
+	params.st_c  = stride_c;
+
+	bli_gemmbatch_front( &params, cntx, rntm );
+}
+
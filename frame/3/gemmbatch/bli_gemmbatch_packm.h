@@ -0,0 +1,104 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+void bli_gemmbatch_packm
+     (
+             packbuf_t  pack_buf_type,
+             num_t      dt,
+             ukr_t      ker_id,
+             conj_t     conja,
+             dim_t      mn_alloc,
+             dim_t      k_alloc,
+             dim_t      mn,
+             dim_t      k,
+             dim_t      mnr,
+             dim_t      packmnr,
+       const void*      a, inc_t inca, inc_t lda,
+             char**     p, inc_t* ps_p,
+       const cntx_t*    cntx,
+             thrinfo_t* thread
+     );
+
+void bli_gemmbatch_packm_full
+     (
+             num_t      dt,
+             ukr_t      ker_id,
+             conj_t     conja,
+             dim_t      mn,
+             dim_t      k,
+             dim_t      mnr,
+             dim_t      packmnr,
+             dim_t      kc,
+       const void*      a, inc_t inca, inc_t lda,
+             char*      p,
+       const cntx_t*    cntx,
+             thrinfo_t* thread
+     );
+
+// Return the size, in bytes, of the buffer needed by bli_gemmbatch_packm_full()
+// to pack an mn x k matrix.
+
+BLIS_INLINE siz_t bli_gemmbatch_packm_full_size
+     (
+       siz_t es,
+       dim_t mn,
+       dim_t k,
+       dim_t mnr,
+       dim_t packmnr
+     )
+{
+	return es * packmnr * ( ( mn + mnr - 1 ) / mnr ) * k;
+}
+
+// Return the address of the i-th micropanel of the KC block starting at
+// index pp of the k dimension, within a matrix packed by
+// bli_gemmbatch_packm_full(). Each KC block is stored as a contiguous
+// sequence of all n_iter micropanels, each with a panel stride of
+// packmnr * kc_cur elements.
+
+BLIS_INLINE char* bli_gemmbatch_packm_full_panel
+     (
+       char* p,
+       siz_t es,
+       dim_t pp,
+       dim_t kc_cur,
+       dim_t i,
+       dim_t n_iter,
+       dim_t packmnr
+     )
+{
+	return p + es * packmnr * ( pp * n_iter + i * kc_cur );
+}
+
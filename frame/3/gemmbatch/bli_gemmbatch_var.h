@@ -0,0 +1,69 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Parameters for the strided-batched gemm block-panel algorithm. The
+// operands of the first problem in the batch are given in raw form, with
+// any transposition already induced into the strides. The l-th problem
+// uses the operands found st_a, st_b, and st_c elements beyond those of
+// the first, and a zero stride for A or B marks that operand as shared.
+//
+
+typedef struct
+{
+	      num_t  dt;
+
+	      dim_t  batch;
+	      dim_t  m;
+	      dim_t  n;
+	      dim_t  k;
+
+	      conj_t conja;
+	      conj_t conjb;
+
+	const void*  alpha;
+	const void*  a; inc_t rs_a; inc_t cs_a; inc_t st_a;
+	const void*  b; inc_t rs_b; inc_t cs_b; inc_t st_b;
+	const void*  beta;
+	      void*  c; inc_t rs_c; inc_t cs_c; inc_t st_c;
+} gemmbatch_params_t;
+
+void bli_gemmbatch_bp_var1
+     (
+       const gemmbatch_params_t* params,
+       const cntx_t*             cntx,
+             thrinfo_t*          thread
+     );
+
@@ -0,0 +1,408 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// The strided-batched gemm block-panel algorithm. The problems of the batch
+// are partitioned among the thread groups of the JC loop, and each group
+// then computes its problems one after another with the conventional
+// five-loop algorithm (less the partitioning of the JC loop), in which the
+// IC and JR loops may be further parallelized. The packing buffers cached
+// in each group's thrinfo_t nodes are thus reused for all of the group's
+// problems.
+//
+// An operand whose batch stride is zero is shared by all problems of the
+// batch. Such an operand is packed in its entirety, once, by all threads
+// before any problem is computed, and the packed micropanels are then
+// referenced directly by every problem.
+//
+
+void bli_gemmbatch_bp_var1
+     (
+       const gemmbatch_params_t* params,
+       const cntx_t*             cntx,
+             thrinfo_t*          thread
+     )
+{
+	const num_t dt     = params->dt;
+	const inc_t es     = ( inc_t )bli_dt_size( dt );
+
+	const dim_t batch  = params->batch;
+	const dim_t m      = params->m;
+	const dim_t n      = params->n;
+	const dim_t k      = params->k;
+
+	const conj_t conja = params->conja;
+	const conj_t conjb = params->conjb;
+
+	const char* restrict a_00 = params->a;
+	const inc_t          rs_a = params->rs_a;
+	const inc_t          cs_a = params->cs_a;
+	const inc_t          st_a = params->st_a;
+
+	const char* restrict b_00 = params->b;
+	const inc_t          rs_b = params->rs_b;
+	const inc_t          cs_b = params->cs_b;
+	const inc_t          st_b = params->st_b;
+
+	char*       restrict c_00 = params->c;
+	const inc_t          rs_c = params->rs_c;
+	const inc_t          cs_c = params->cs_c;
+	const inc_t          st_c = params->st_c;
+
+	const bool  shared_a = ( st_a == 0 );
+	const bool  shared_b = ( st_b == 0 );
+
+	// Make local copies of the scalars to prevent any unnecessary sharing of
+	// cache lines between the cores' caches.
+	dcomplex alpha_local;
+	dcomplex beta_local;
+
+	memcpy( &alpha_local, params->alpha, es );
+	memcpy( &beta_local,  params->beta,  es );
+
+	const void* one = bli_obj_buffer_for_const( dt, &BLIS_ONE );
+
+	// Query the context for various blocksizes.
+	const dim_t NR     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t MR     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t NC     = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx );
+	const dim_t MC     = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx );
+	const dim_t KC     = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx );
+	const dim_t PACKNR = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx );
+	const dim_t PACKMR = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx );
+
+	// Query the context for the microkernel.
+	gemm_ukr_ft gemm_ukr = bli_cntx_get_ukr_dt( dt, BLIS_GEMM_UKR, cntx );
+
+	// Compute partitioning step values for each matrix of each loop.
+	const inc_t jcstep_c = cs_c * es;
+	const inc_t jcstep_b = cs_b * es;
+
+	const inc_t pcstep_a = cs_a * es;
+	const inc_t pcstep_b = rs_b * es;
+
+	const inc_t icstep_c = rs_c * es;
+	const inc_t icstep_a = rs_a * es;
+
+	const inc_t jrstep_c = cs_c * NR * es;
+	const inc_t irstep_c = rs_c * MR * es;
+
+	// Save the pack schemas, imaginary strides, and microkernel address to
+	// the auxinfo_t object.
+	auxinfo_t aux;
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux );
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux );
+	bli_auxinfo_set_is_a( 1, &aux );
+	bli_auxinfo_set_is_b( 1, &aux );
+	bli_auxinfo_set_ukr( ( void_fp )gemm_ukr, &aux );
+	bli_auxinfo_set_params( NULL, &aux );
+
+	thrinfo_t* restrict thread_jc = bli_thrinfo_sub_node( thread );
+	thrinfo_t* restrict thread_pc = bli_thrinfo_sub_node( thread_jc );
+	thrinfo_t* restrict thread_pb = bli_thrinfo_sub_node( thread_pc );
+	thrinfo_t* restrict thread_ic = bli_thrinfo_sub_node( thread_pb );
+	thrinfo_t* restrict thread_pa = bli_thrinfo_sub_node( thread_ic );
+	thrinfo_t* restrict thread_jr = bli_thrinfo_sub_node( thread_pa );
+	thrinfo_t* restrict thread_ir = bli_thrinfo_sub_node( thread_jr );
+
+	const dim_t m_iter = ( m + MR - 1 ) / MR;
+	const dim_t n_iter = ( n + NR - 1 ) / NR;
+
+	char* a_full = NULL;
+	char* b_full = NULL;
+
+	// Pack the shared operands (if any) into a single buffer that is
+	// acquired by the chief thread and cached in the root thrinfo_t node,
+	// from which it is released when the thrinfo_t tree is freed. The
+	// packed copy of B begins at a page boundary so that its micropanels
+	// retain the alignment expected by the microkernel.
+	if ( shared_a || shared_b )
+	{
+		const siz_t size_a = ( shared_a ? bli_gemmbatch_packm_full_size( es, m, k, MR, PACKMR ) : 0 );
+		const siz_t size_b = ( shared_b ? bli_gemmbatch_packm_full_size( es, n, k, NR, PACKNR ) : 0 );
+		const siz_t off_b  = ( ( size_a + BLIS_PAGE_SIZE - 1 ) / BLIS_PAGE_SIZE ) * BLIS_PAGE_SIZE;
+
+		mem_t* mem = bli_thrinfo_mem( thread );
+
+		if ( bli_thrinfo_am_chief( thread ) )
+		{
+			bli_pba_acquire_m
+			(
+			  bli_thrinfo_pba( thread ),
+			  off_b + size_b,
+			  BLIS_BUFFER_FOR_GEN_USE,
+			  mem
+			);
+		}
+
+		mem_t* mem_p  = bli_thrinfo_broadcast( thread, mem );
+		char*  p_full = bli_mem_buffer( mem_p );
+
+		if ( shared_a )
+		{
+			a_full = p_full;
+
+			bli_gemmbatch_packm_full
+			(
+			  dt, BLIS_PACKM_MRXK_KER, conja,
+			  m, k, MR, PACKMR, KC,
+			  a_00, rs_a, cs_a,
+			  a_full,
+			  cntx,
+			  thread
+			);
+		}
+
+		if ( shared_b )
+		{
+			b_full = p_full + off_b;
+
+			bli_gemmbatch_packm_full
+			(
+			  dt, BLIS_PACKM_NRXK_KER, conjb,
+			  n, k, NR, PACKNR, KC,
+			  b_00, cs_b, rs_b,
+			  b_full,
+			  cntx,
+			  thread
+			);
+		}
+
+		// Wait until the shared operands are fully packed.
+		bli_thrinfo_barrier( thread );
+	}
+
+	// Compute the range of problems of the batch assigned to the current
+	// thread group.
+	dim_t bt_start, bt_end;
+	bli_thread_range_sub( thread_jc, batch, 1, FALSE, &bt_start, &bt_end );
+
+	// Compute the IC loop thread range for the current thread. This is the
+	// same for all problems of the batch.
+	dim_t ic_start, ic_end;
+	bli_thread_range_sub( thread_ic, m, MR, FALSE, &ic_start, &ic_end );
+
+	// Loop over the problems of the batch.
+	for ( dim_t l = bt_start; l < bt_end; ++l )
+	{
+		const char* restrict a_l = a_00 + l * st_a * es;
+		const char* restrict b_l = b_00 + l * st_b * es;
+		      char* restrict c_l = c_00 + l * st_c * es;
+
+		// Loop over the n dimension (NC columns at a time).
+		for ( dim_t jj = 0; jj < n; jj += NC )
+		{
+			const dim_t nc_cur = bli_min( NC, n - jj );
+
+			const char* restrict b_jc = b_l + jj * jcstep_b;
+			      char* restrict c_jc = c_l + jj * jcstep_c;
+
+			// Loop over the k dimension (KC rows/columns at a time).
+			for ( dim_t pp = 0; pp < k; pp += KC )
+			{
+				const dim_t kc_cur = bli_min( KC, k - pp );
+
+				const char* restrict a_pc = a_l  + pp * pcstep_a;
+				const char* restrict b_pc = b_jc + pp * pcstep_b;
+
+				// Only apply beta to the first iteration of the pc loop.
+				const void* restrict beta_use = ( pp == 0 ? &beta_local : one );
+
+				char* b_use;
+				inc_t ps_b_use;
+
+				if ( shared_b )
+				{
+					// Locate the current KC x NC row panel of B within the
+					// shared packed copy.
+					b_use    = bli_gemmbatch_packm_full_panel
+					           ( b_full, es, pp, kc_cur, jj / NR, n_iter, PACKNR );
+					ps_b_use = es * PACKNR * kc_cur;
+				}
+				else
+				{
+					// Pack the current KC x NC row panel of B into
+					// row-stored column micropanels.
+					bli_gemmbatch_packm
+					(
+					  BLIS_BUFFER_FOR_B_PANEL,
+					  dt, BLIS_PACKM_NRXK_KER, conjb,
+					  NC, KC,
+					  nc_cur, kc_cur,
+					  NR, PACKNR,
+					  b_pc, cs_b, rs_b,
+					  &b_use, &ps_b_use,
+					  cntx,
+					  thread_pb
+					);
+				}
+
+				char* restrict b_pc_use = b_use;
+
+				// Loop over the m dimension (MC rows at a time).
+				for ( dim_t ii = ic_start; ii < ic_end; ii += MC )
+				{
+					const dim_t mc_cur = bli_min( MC, ic_end - ii );
+
+					const char* restrict a_ic = a_pc + ii * icstep_a;
+					      char* restrict c_ic = c_jc + ii * icstep_c;
+
+					char* a_use;
+					inc_t ps_a_use;
+
+					if ( shared_a )
+					{
+						// Locate the current MC x KC block of A within the
+						// shared packed copy.
+						a_use    = bli_gemmbatch_packm_full_panel
+						           ( a_full, es, pp, kc_cur, ii / MR, m_iter, PACKMR );
+						ps_a_use = es * PACKMR * kc_cur;
+					}
+					else
+					{
+						// Pack the current MC x KC block of A into
+						// column-stored row micropanels.
+						bli_gemmbatch_packm
+						(
+						  BLIS_BUFFER_FOR_A_BLOCK,
+						  dt, BLIS_PACKM_MRXK_KER, conja,
+						  MC, KC,
+						  mc_cur, kc_cur,
+						  MR, PACKMR,
+						  a_ic, rs_a, cs_a,
+						  &a_use, &ps_a_use,
+						  cntx,
+						  thread_pa
+						);
+					}
+
+					char* restrict a_ic_use = a_use;
+
+					// Query the number of threads and thread ids for the JR
+					// loop.
+					const dim_t jr_nt  = bli_thrinfo_n_way( thread_jr );
+					const dim_t jr_tid = bli_thrinfo_work_id( thread_jr );
+
+					// Compute number of primary and leftover components of
+					// the JR loop.
+					const dim_t jr_iter = ( nc_cur + NR - 1 ) / NR;
+					const dim_t jr_left =   nc_cur % NR;
+
+					// Compute the JR loop thread range for the current thread.
+					dim_t jr_start, jr_end;
+					bli_thread_range_sub( thread_jr, jr_iter, 1, FALSE, &jr_start, &jr_end );
+
+					// Loop over the n dimension (NR columns at a time).
+					for ( dim_t j = jr_start; j < jr_end; j += 1 )
+					{
+						const dim_t nr_cur
+						= ( bli_is_not_edge_f( j, jr_iter, jr_left ) ? NR : jr_left );
+
+						char* restrict b_jr = b_pc_use + j * ps_b_use;
+						char* restrict c_jr = c_ic     + j * jrstep_c;
+
+						// Assume for now that our next panel of B to be the
+						// current panel of B.
+						char* restrict b2 = b_jr;
+
+						// Query the number of threads and thread ids for the
+						// IR loop.
+						const dim_t ir_nt  = bli_thrinfo_n_way( thread_ir );
+						const dim_t ir_tid = bli_thrinfo_work_id( thread_ir );
+
+						// Compute number of primary and leftover components
+						// of the IR loop.
+						const dim_t ir_iter = ( mc_cur + MR - 1 ) / MR;
+						const dim_t ir_left =   mc_cur % MR;
+
+						// Compute the IR loop thread range for the current
+						// thread.
+						dim_t ir_start, ir_end;
+						bli_thread_range_sub( thread_ir, ir_iter, 1, FALSE, &ir_start, &ir_end );
+
+						// Loop over the m dimension (MR rows at a time).
+						for ( dim_t i = ir_start; i < ir_end; i += 1 )
+						{
+							const dim_t mr_cur
+							= ( bli_is_not_edge_f( i, ir_iter, ir_left ) ? MR : ir_left );
+
+							char* restrict a_ir = a_ic_use + i * ps_a_use;
+							char* restrict c_ir = c_jr     + i * irstep_c;
+
+							// Compute the addresses of the next micropanels of
+							// A and B.
+							char* restrict a2 = bli_gemm_get_next_a_upanel( a_ir, ps_a_use, 1 );
+							if ( bli_is_last_iter_slrr( i, ir_end, ir_tid, ir_nt ) )
+							{
+								a2 = a_ic_use;
+								b2 = bli_gemm_get_next_b_upanel( b_jr, ps_b_use, 1 );
+								if ( bli_is_last_iter_slrr( j, jr_end, jr_tid, jr_nt ) )
+									b2 = b_pc_use;
+							}
+
+							// Save the addresses of next micropanels of A and
+							// B to the auxinfo_t object.
+							bli_auxinfo_set_next_a( a2, &aux );
+							bli_auxinfo_set_next_b( b2, &aux );
+
+							// Invoke the microkernel.
+							gemm_ukr
+							(
+							  mr_cur,
+							  nr_cur,
+							  kc_cur,
+							  &alpha_local,
+							  a_ir,
+							  b_jr,
+							  beta_use,
+							  c_ir, rs_c, cs_c,
+							  &aux,
+							  cntx
+							);
+						}
+					}
+				}
+
+				// This barrier is needed to prevent threads from starting to
+				// pack the next row panel of B before the current row panel
+				// is fully computed upon.
+				if ( !shared_b ) bli_thrinfo_barrier( thread_pb );
+			}
+		}
+	}
+}
+
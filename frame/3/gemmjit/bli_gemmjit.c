@@ -0,0 +1,320 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+// MAP_ANONYMOUS is not exposed by the POSIX version that bli_system.h
+// requests, so the system's extensions must be requested before any system
+// header is included.
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+#ifndef _DARWIN_C_SOURCE
+#define _DARWIN_C_SOURCE
+#endif
+
+#include "blis.h"
+
+// Generated code is only executed on x86-64 systems that can map anonymous
+// memory with execute permission.
+#if defined(__x86_64__) && ( defined(__linux__) || defined(__APPLE__) )
+  #define BLIS_GEMMJIT_X86_64
+  #include <sys/mman.h>
+#endif
+
+static gemmjit_t*          gemmjit_table[ BLIS_GEMMJIT_NUM_BUCKETS ];
+static bli_pthread_mutex_t gemmjit_mutex = BLIS_PTHREAD_MUTEX_INITIALIZER;
+static bool                gemmjit_enabled = FALSE;
+
+// -----------------------------------------------------------------------------
+
+void bli_gemmjit_init( void )
+{
+	gemmjit_enabled = FALSE;
+
+#ifdef BLIS_GEMMJIT_X86_64
+	uint32_t family, model, features;
+
+	bli_cpuid_query( &family, &model, &features );
+
+	const uint32_t expected = FEATURE_AVX  |
+	                          FEATURE_FMA3 |
+	                          FEATURE_AVX2;
+
+	// Code generation may be disabled by setting BLIS_GEMM_JIT to zero, in
+	// which case every handle uses the expert typed API.
+	if ( bli_cpuid_has_features( features, expected ) &&
+	     bli_env_get_var( "BLIS_GEMM_JIT", 1 ) != 0 )
+		gemmjit_enabled = TRUE;
+#endif
+}
+
+void bli_gemmjit_finalize( void )
+{
+	bli_pthread_mutex_lock( &gemmjit_mutex );
+
+	for ( dim_t i = 0; i < BLIS_GEMMJIT_NUM_BUCKETS; ++i )
+	{
+		gemmjit_t* h = gemmjit_table[ i ];
+
+		while ( h != NULL )
+		{
+			gemmjit_t* next = h->next;
+
+#ifdef BLIS_GEMMJIT_X86_64
+			if ( h->code != NULL ) munmap( h->code, h->code_size );
+#endif
+			bli_free_intl( h );
+
+			h = next;
+		}
+
+		gemmjit_table[ i ] = NULL;
+	}
+
+	bli_pthread_mutex_unlock( &gemmjit_mutex );
+}
+
+// -----------------------------------------------------------------------------
+
+static gemmjit_sc_t bli_gemmjit_sc( num_t dt, const void* x )
+{
+	bool is0 = FALSE, is1 = FALSE;
+
+	switch ( dt )
+	{
+		case BLIS_FLOAT:    is0 = bli_seq0( *( const float*    )x );
+		                    is1 = bli_seq1( *( const float*    )x ); break;
+		case BLIS_DOUBLE:   is0 = bli_deq0( *( const double*   )x );
+		                    is1 = bli_deq1( *( const double*   )x ); break;
+		case BLIS_SCOMPLEX: is0 = bli_ceq0( *( const scomplex* )x );
+		                    is1 = bli_ceq1( *( const scomplex* )x ); break;
+		case BLIS_DCOMPLEX: is0 = bli_zeq0( *( const dcomplex* )x );
+		                    is1 = bli_zeq1( *( const dcomplex* )x ); break;
+		default: break;
+	}
+
+	return is0 ? BLIS_GEMMJIT_ZERO : is1 ? BLIS_GEMMJIT_ONE : BLIS_GEMMJIT_GEN;
+}
+
+static bool bli_gemmjit_eq( const gemmjit_t* h, const gemmjit_t* key )
+{
+	return h->dt       == key->dt       &&
+	       h->transa   == key->transa   && h->transb == key->transb &&
+	       h->m        == key->m        && h->n      == key->n      &&
+	       h->k        == key->k        &&
+	       h->rs_a     == key->rs_a     && h->cs_a   == key->cs_a   &&
+	       h->rs_b     == key->rs_b     && h->cs_b   == key->cs_b   &&
+	       h->rs_c     == key->rs_c     && h->cs_c   == key->cs_c   &&
+	       h->alpha_sc == key->alpha_sc && h->beta_sc == key->beta_sc;
+}
+
+static dim_t bli_gemmjit_bucket( const gemmjit_t* key )
+{
+	const uint64_t fields[] =
+	{
+	  key->dt, key->transa, key->transb,
+	  key->m, key->n, key->k,
+	  key->rs_a, key->cs_a, key->rs_b, key->cs_b, key->rs_c, key->cs_c,
+	  key->alpha_sc, key->beta_sc
+	};
+
+	// FNV-1a over the fields of the key.
+	uint64_t hash = 14695981039346656037ULL;
+
+	for ( size_t i = 0; i < sizeof( fields ) / sizeof( fields[0] ); ++i )
+	{
+		hash ^= fields[ i ];
+		hash *= 1099511628211ULL;
+	}
+
+	return ( dim_t )( ( hash ^ ( hash >> 32 ) ) % BLIS_GEMMJIT_NUM_BUCKETS );
+}
+
+// Describe the problem of a handle to the code generator, returning FALSE if
+// neither C nor C^T can be computed with vector loads along its columns.
+static bool bli_gemmjit_shape( const gemmjit_t* h, gemmjit_shape_t* shape )
+{
+	if ( !bli_is_real( h->dt ) ) return FALSE;
+	if ( h->m == 0 || h->n == 0 ) return FALSE;
+	if ( BLIS_GEMMJIT_MAX_DIM < h->m ||
+	     BLIS_GEMMJIT_MAX_DIM < h->n ||
+	     BLIS_GEMMJIT_MAX_DIM < h->k ) return FALSE;
+
+	// Induce any transposition of A and B into their strides.
+	inc_t rs_a = h->rs_a, cs_a = h->cs_a;
+	inc_t rs_b = h->rs_b, cs_b = h->cs_b;
+
+	if ( bli_does_trans( h->transa ) ) bli_swap_incs( &rs_a, &cs_a );
+	if ( bli_does_trans( h->transb ) ) bli_swap_incs( &rs_b, &cs_b );
+
+	shape->dt       = h->dt;
+	shape->k_g      = h->k;
+	shape->alpha_sc = h->alpha_sc;
+	shape->beta_sc  = h->beta_sc;
+
+	if ( rs_a == 1 && h->rs_c == 1 )
+	{
+		// Compute C += A * B, loading columns of A.
+		shape->m_g    = h->m;
+		shape->n_g    = h->n;
+		shape->v_is_a = TRUE;
+		shape->ld_v   = cs_a;
+		shape->s_k    = rs_b;
+		shape->s_n    = cs_b;
+		shape->ld_c   = h->cs_c;
+	}
+	else if ( cs_b == 1 && h->cs_c == 1 )
+	{
+		// Compute C^T += B^T * A^T, loading rows of B.
+		shape->m_g    = h->n;
+		shape->n_g    = h->m;
+		shape->v_is_a = FALSE;
+		shape->ld_v   = rs_b;
+		shape->s_k    = cs_a;
+		shape->s_n    = rs_a;
+		shape->ld_c   = h->rs_c;
+	}
+	else return FALSE;
+
+	return TRUE;
+}
+
+// Generate and map the kernel for a handle, leaving h->ker NULL on failure.
+static void bli_gemmjit_generate( gemmjit_t* h )
+{
+#ifdef BLIS_GEMMJIT_X86_64
+	gemmjit_shape_t shape;
+
+	if ( !gemmjit_enabled || !bli_gemmjit_shape( h, &shape ) ) return;
+
+	siz_t size;
+	void* buf = bli_gemmjit_emit_x86( &shape, &size );
+
+	if ( buf == NULL ) return;
+
+	// Copy the code into its own mapping, which is made executable only
+	// once it is no longer writable.
+	const siz_t page      = 4096;
+	const siz_t code_size = ( ( size + page - 1 ) / page ) * page;
+
+	void* code = mmap( NULL, code_size, PROT_READ | PROT_WRITE,
+	                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+
+	if ( code != MAP_FAILED )
+	{
+		memcpy( code, buf, size );
+
+		if ( mprotect( code, code_size, PROT_READ | PROT_EXEC ) == 0 )
+		{
+			// ISO C does not allow an object pointer to be converted to a
+			// function pointer, so we convert through a union.
+			union { void* p; gemmjit_ker_ft f; } u = { .p = code };
+
+			h->ker       = u.f;
+			h->code      = code;
+			h->code_size = code_size;
+		}
+		else munmap( code, code_size );
+	}
+
+	bli_free_intl( buf );
+#else
+	( void )h;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+const gemmjit_t* bli_gemmjit_query
+     (
+             num_t   dt,
+             trans_t transa,
+             trans_t transb,
+             dim_t   m,
+             dim_t   n,
+             dim_t   k,
+       const void*   alpha,
+             inc_t   rs_a, inc_t cs_a,
+             inc_t   rs_b, inc_t cs_b,
+       const void*   beta,
+             inc_t   rs_c, inc_t cs_c
+     )
+{
+	gemmjit_t key =
+	{
+	  .ker      = NULL,
+	  .dt       = dt,
+	  .transa   = transa,
+	  .transb   = transb,
+	  .m        = m,
+	  .n        = n,
+	  .k        = k,
+	  .rs_a     = rs_a, .cs_a = cs_a,
+	  .rs_b     = rs_b, .cs_b = cs_b,
+	  .rs_c     = rs_c, .cs_c = cs_c,
+	  .alpha_sc = bli_gemmjit_sc( dt, alpha ),
+	  .beta_sc  = bli_gemmjit_sc( dt, beta ),
+	  .code     = NULL,
+	  .code_size = 0,
+	  .next     = NULL
+	};
+
+	const dim_t i = bli_gemmjit_bucket( &key );
+
+	bli_pthread_mutex_lock( &gemmjit_mutex );
+
+	gemmjit_t* h = gemmjit_table[ i ];
+
+	while ( h != NULL && !bli_gemmjit_eq( h, &key ) ) h = h->next;
+
+	if ( h == NULL )
+	{
+		// This is the first query for the shape, so generate its kernel and
+		// insert it into the table.
+		err_t r_val;
+
+		h  = bli_malloc_intl( sizeof( gemmjit_t ), &r_val );
+		*h = key;
+
+		bli_gemmjit_generate( h );
+
+		h->next            = gemmjit_table[ i ];
+		gemmjit_table[ i ] = h;
+	}
+
+	bli_pthread_mutex_unlock( &gemmjit_mutex );
+
+	return h;
+}
+
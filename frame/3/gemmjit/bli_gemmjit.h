@@ -0,0 +1,160 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Fixed-shape small gemm: C := beta * C + alpha * transa(A) * transb(B) for
+// one problem shape that the application intends to compute many times. The
+// application queries a handle for the shape (the dimensions, the operand
+// strides, and whether alpha and beta are zero, one, or some other value)
+// once, and then passes the handle, along with the operands, to each call.
+//
+// For real datatypes, on x86-64 processors that support AVX2 and FMA3, the
+// first query for a shape generates fully unrolled machine code specialized
+// for that shape, which all later queries for the same shape share via a
+// hash table. Problems that cannot be handled this way (complex datatypes,
+// dimensions larger than BLIS_GEMMJIT_MAX_DIM, operands without unit stride
+// in the required dimension, or processors without AVX2) are given a handle
+// that simply calls the expert typed API with the stored shape, so that a
+// handle may be queried for any problem. Handles remain valid until the
+// library is finalized.
+//
+
+// The largest m, n, or k for which code is generated.
+#ifndef BLIS_GEMMJIT_MAX_DIM
+#define BLIS_GEMMJIT_MAX_DIM 32
+#endif
+
+// The number of buckets in the hash table of generated kernels.
+#define BLIS_GEMMJIT_NUM_BUCKETS 64
+
+// Classes of the alpha and beta scalars that are fixed by a handle.
+typedef enum
+{
+	BLIS_GEMMJIT_ZERO = 0,
+	BLIS_GEMMJIT_ONE,
+	BLIS_GEMMJIT_GEN
+} gemmjit_sc_t;
+
+// A generated kernel. The operands are always passed in the order of the
+// original problem; the kernel knows whether it computes C or C^T.
+typedef void (*gemmjit_ker_ft)
+     (
+       const void* a,
+       const void* b,
+             void* c,
+       const void* alpha,
+       const void* beta
+     );
+
+struct gemmjit_s
+{
+	// The generated kernel, or NULL if the problem is computed by the
+	// expert typed API.
+	gemmjit_ker_ft   ker;
+
+	num_t            dt;
+	trans_t          transa;
+	trans_t          transb;
+	dim_t            m;
+	dim_t            n;
+	dim_t            k;
+	inc_t            rs_a; inc_t cs_a;
+	inc_t            rs_b; inc_t cs_b;
+	inc_t            rs_c; inc_t cs_c;
+	gemmjit_sc_t     alpha_sc;
+	gemmjit_sc_t     beta_sc;
+
+	// The executable mapping that holds the kernel.
+	void*            code;
+	siz_t            code_size;
+
+	struct gemmjit_s* next;
+};
+typedef struct gemmjit_s gemmjit_t;
+
+// The shape of the (possibly transposed) problem as seen by the code
+// generator. Elements of V are loaded as vectors along the m_g dimension
+// (which has unit stride in both V and C) while elements of S are
+// broadcast. All offsets are in units of elements.
+typedef struct
+{
+	num_t dt;
+	dim_t m_g;
+	dim_t n_g;
+	dim_t k_g;
+
+	bool  v_is_a;         // V is A (and S is B); otherwise V is B^T.
+	inc_t ld_v;           // the stride of V along k_g
+	inc_t s_k;            // the stride of S along k_g
+	inc_t s_n;            // the stride of S along n_g
+	inc_t ld_c;           // the stride of C along n_g
+
+	gemmjit_sc_t alpha_sc;
+	gemmjit_sc_t beta_sc;
+} gemmjit_shape_t;
+
+//
+// Prototype internal functions.
+//
+
+void bli_gemmjit_init( void );
+void bli_gemmjit_finalize( void );
+
+const gemmjit_t* bli_gemmjit_query
+     (
+             num_t   dt,
+             trans_t transa,
+             trans_t transb,
+             dim_t   m,
+             dim_t   n,
+             dim_t   k,
+       const void*   alpha,
+             inc_t   rs_a, inc_t cs_a,
+             inc_t   rs_b, inc_t cs_b,
+       const void*   beta,
+             inc_t   rs_c, inc_t cs_c
+     );
+
+// Generate machine code for a shape into a buffer allocated with
+// bli_malloc_intl(), returning NULL if the shape cannot be generated.
+void* bli_gemmjit_emit_x86
+     (
+       const gemmjit_shape_t* shape,
+             siz_t*           size
+     );
+
+// Prototype the typed APIs.
+#include "bli_gemmjit_tapi.h"
+
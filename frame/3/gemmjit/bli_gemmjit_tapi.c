@@ -0,0 +1,103 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+const gemmjit_t* PASTEMAC2(ch,opname,_query) \
+     ( \
+             trans_t transa, \
+             trans_t transb, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   k, \
+       const ctype*  alpha, \
+             inc_t   rs_a, inc_t cs_a, \
+             inc_t   rs_b, inc_t cs_b, \
+       const ctype*  beta, \
+             inc_t   rs_c, inc_t cs_c  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	return bli_gemmjit_query \
+	( \
+	  PASTEMAC(ch,type), \
+	  transa, transb, \
+	  m, n, k, \
+	  alpha, \
+	  rs_a, cs_a, \
+	  rs_b, cs_b, \
+	  beta, \
+	  rs_c, cs_c  \
+	); \
+} \
+\
+void PASTEMAC2(ch,opname,_exec) \
+     ( \
+       const gemmjit_t* handle, \
+       const ctype*     alpha, \
+       const ctype*     a, \
+       const ctype*     b, \
+       const ctype*     beta, \
+             ctype*     c  \
+     ) \
+{ \
+	/* Call the generated kernel if there is one. */ \
+	if ( handle->ker != NULL ) \
+	{ \
+		handle->ker( a, b, c, alpha, beta ); \
+		return; \
+	} \
+\
+	PASTEMAC2(ch,gemm,BLIS_TAPI_EX_SUF) \
+	( \
+	  handle->transa, \
+	  handle->transb, \
+	  handle->m, handle->n, handle->k, \
+	  alpha, \
+	  a, handle->rs_a, handle->cs_a, \
+	  b, handle->rs_b, handle->cs_b, \
+	  beta, \
+	  c, handle->rs_c, handle->cs_c, \
+	  NULL, \
+	  NULL  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC( gemm_jit )
+
@@ -4,7 +4,7 @@
    An object-based framework for developing high-performance BLAS-like
    libraries.
 
-   Copyright (C) 2021, The University of Texas at Austin
+   Copyright (C) 2022, The University of Texas at Austin
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -32,38 +32,40 @@
 
 */
 
+
 //
-// Prototype BLAS-like interfaces to the variants.
+// Prototype the fixed-shape small gemm typed APIs. The values of alpha and
+// beta given to bli_?gemm_jit_query() only determine their class (zero, one,
+// or general); the values given to bli_?gemm_jit_exec() must be of the same
+// class as those given when querying the handle.
 //
 
 #undef  GENTPROT
-#define GENTPROT( ctype, ch, varname ) \
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS const gemmjit_t* PASTEMAC2(ch,opname,_query) \
+     ( \
+             trans_t transa, \
+             trans_t transb, \
+             dim_t   m, \
+             dim_t   n, \
+             dim_t   k, \
+       const ctype*  alpha, \
+             inc_t   rs_a, inc_t cs_a, \
+             inc_t   rs_b, inc_t cs_b, \
+       const ctype*  beta, \
+             inc_t   rs_c, inc_t cs_c  \
+     ); \
 \
-void PASTECH2(bao_,ch,varname) \
+BLIS_EXPORT_BLIS void PASTEMAC2(ch,opname,_exec) \
      ( \
-       trans_t          transc, \
-       pack_t           schema, \
-       dim_t            m, \
-       dim_t            n, \
-       dim_t            m_max, \
-       dim_t            n_max, \
-       ctype*  restrict kappa, \
-       ctype*  restrict d, inc_t incd, \
-       ctype*  restrict c, inc_t rs_c, inc_t cs_c, \
-       ctype*  restrict p, inc_t rs_p, inc_t cs_p, \
-                           dim_t pd_p, inc_t ps_p, \
-       cntx_t* restrict cntx, \
-       thrinfo_t* restrict thread  \
+       const gemmjit_t* handle, \
+       const ctype*     alpha, \
+       const ctype*     a, \
+       const ctype*     b, \
+       const ctype*     beta, \
+             ctype*     c  \
      );
 
-//INSERT_GENTPROT_BASIC0( packm_var1 )
-GENTPROT( float,    s, packm_var1 )
-GENTPROT( double,   d, packm_var1 )
-GENTPROT( scomplex, c, packm_var1 )
-GENTPROT( dcomplex, z, packm_var1 )
+INSERT_GENTPROT_BASIC( gemm_jit )
 
-//INSERT_GENTPROT_BASIC0( packm_var2 )
-GENTPROT( float,    s, packm_var2 )
-GENTPROT( double,   d, packm_var2 )
-GENTPROT( scomplex, c, packm_var2 )
-GENTPROT( dcomplex, z, packm_var2 )
@@ -0,0 +1,387 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// An x86-64 code generator for fixed-shape small gemm. The generated code
+// follows the System V calling convention, receiving the arguments of
+// gemmjit_ker_ft in rdi (a), rsi (b), rdx (c), rcx (alpha), and r8 (beta),
+// and using only ymm registers and rax, all of which are caller-saved.
+//
+// The m_g x n_g output is computed in register tiles of mv vectors (of four
+// doubles or eight floats) by nb columns. The loop over k_g within each tile
+// is fully unrolled: at each step, mv vectors of V are loaded, and each of nb
+// elements of S is broadcast and multiplied into the mv accumulators of its
+// column. The last vector along m_g may be partial, in which case it is
+// loaded and stored with a mask, so that no element outside of the operands
+// is ever accessed. Register use within a tile:
+//
+//   ymm0  .. ymm(mv*nb-1)  accumulators (mv*nb <= 14-mv)
+//   ymm(14-mv) .. ymm13    vectors of V (and, later, of C)
+//   ymm14                  broadcast element of S (and, later, alpha/beta)
+//   ymm15                  mask for the partial vector
+//
+
+enum
+{
+	JIT_RAX = 0,
+	JIT_RCX = 1,
+	JIT_RDX = 2,
+	JIT_RSI = 6,
+	JIT_RDI = 7,
+	JIT_R8  = 8
+};
+
+enum
+{
+	JIT_MAP_0F   = 1,
+	JIT_MAP_0F38 = 2
+};
+
+#define JIT_YMM_BCAST 14
+#define JIT_YMM_MASK  15
+
+// Masks for partial vectors. A mask for r lanes begins r elements before the
+// first zero.
+static const int64_t jit_mask_d[ 8 ]  = { -1, -1, -1, -1,
+                                           0,  0,  0,  0 };
+static const int32_t jit_mask_s[ 16 ] = { -1, -1, -1, -1, -1, -1, -1, -1,
+                                           0,  0,  0,  0,  0,  0,  0,  0 };
+
+typedef struct
+{
+	uint8_t* buf;
+	siz_t    len;
+	siz_t    cap;
+	bool     ok;
+} jitbuf_t;
+
+static void jit_put8( jitbuf_t* b, uint8_t x )
+{
+	if ( b->len == b->cap )
+	{
+		err_t    r_val;
+		uint8_t* buf = bli_malloc_intl( 2 * b->cap, &r_val );
+
+		memcpy( buf, b->buf, b->len );
+		bli_free_intl( b->buf );
+
+		b->buf  = buf;
+		b->cap *= 2;
+	}
+
+	b->buf[ b->len++ ] = x;
+}
+
+static void jit_put32( jitbuf_t* b, uint32_t x )
+{
+	for ( int i = 0; i < 4; ++i ) jit_put8( b, ( uint8_t )( x >> ( 8 * i ) ) );
+}
+
+// Emit a three-byte VEX prefix. The three-byte form is always used, since
+// it can encode an extended base register.
+static void jit_vex3( jitbuf_t* b, int map, int pp, int w, int reg, int vvvv, int rm )
+{
+	jit_put8( b, 0xC4 );
+	jit_put8( b, ( uint8_t )( ( ( ~reg >> 3 & 1 ) << 7 ) | ( 1 << 6 ) |
+	                          ( ( ~rm  >> 3 & 1 ) << 5 ) | map ) );
+	jit_put8( b, ( uint8_t )( ( w << 7 ) | ( ( ~vvvv & 0xF ) << 3 ) |
+	                          ( 1 << 2 ) | pp ) );
+}
+
+// op ymm(reg), ymm(vvvv), [base + disp]
+static void jit_op_mem( jitbuf_t* b, int map, int pp, int w, uint8_t op,
+                        int reg, int vvvv, int base, int64_t disp )
+{
+	if ( disp < INT32_MIN || INT32_MAX < disp ) { b->ok = FALSE; disp = 0; }
+
+	jit_vex3( b, map, pp, w, reg, vvvv, base );
+	jit_put8( b, op );
+	jit_put8( b, ( uint8_t )( 0x80 | ( ( reg & 7 ) << 3 ) | ( base & 7 ) ) );
+	jit_put32( b, ( uint32_t )( int32_t )disp );
+}
+
+// op ymm(reg), ymm(vvvv), ymm(rm)
+static void jit_op_reg( jitbuf_t* b, int map, int pp, int w, uint8_t op,
+                        int reg, int vvvv, int rm )
+{
+	jit_vex3( b, map, pp, w, reg, vvvv, rm );
+	jit_put8( b, op );
+	jit_put8( b, ( uint8_t )( 0xC0 | ( ( reg & 7 ) << 3 ) | ( rm & 7 ) ) );
+}
+
+// -----------------------------------------------------------------------------
+
+// The state of the generator for one shape.
+typedef struct
+{
+	const gemmjit_shape_t* s;
+
+	jitbuf_t b;
+
+	bool  is_d;
+	dim_t vl;      // elements per vector
+	dim_t es;      // bytes per element
+	int   pp;      // the packed-single/double prefix of 0F-map instructions
+
+	int   reg_v;
+	int   reg_s;
+
+	dim_t mv_tot;  // vectors along m_g
+	dim_t m_rem;   // elements in the partial vector (zero if none)
+} jitgen_t;
+
+static void jit_load_v( jitgen_t* g, int ymm, int base, int64_t off, bool partial )
+{
+	if ( partial )
+		jit_op_mem( &g->b, JIT_MAP_0F38, 1, 0, g->is_d ? 0x2D : 0x2C,
+		            ymm, JIT_YMM_MASK, base, off * g->es );
+	else
+		jit_op_mem( &g->b, JIT_MAP_0F, g->pp, 0, 0x10,
+		            ymm, 0, base, off * g->es );
+}
+
+static void jit_store_v( jitgen_t* g, int ymm, int base, int64_t off, bool partial )
+{
+	if ( partial )
+		jit_op_mem( &g->b, JIT_MAP_0F38, 1, 0, g->is_d ? 0x2F : 0x2E,
+		            ymm, JIT_YMM_MASK, base, off * g->es );
+	else
+		jit_op_mem( &g->b, JIT_MAP_0F, g->pp, 0, 0x11,
+		            ymm, 0, base, off * g->es );
+}
+
+static void jit_bcast( jitgen_t* g, int ymm, int base, int64_t off )
+{
+	jit_op_mem( &g->b, JIT_MAP_0F38, 1, 0, g->is_d ? 0x19 : 0x18,
+	            ymm, 0, base, off * g->es );
+}
+
+// ymm(dst) += ymm(x) * ymm(y)
+static void jit_fma( jitgen_t* g, int dst, int x, int y )
+{
+	jit_op_reg( &g->b, JIT_MAP_0F38, 1, g->is_d ? 1 : 0, 0xB8, dst, x, y );
+}
+
+// ymm(dst) = ymm(x) op ymm(y), for op = vmulp?, vaddp?, vxorp?.
+static void jit_arith( jitgen_t* g, uint8_t op, int dst, int x, int y )
+{
+	jit_op_reg( &g->b, JIT_MAP_0F, g->pp, 0, op, dst, x, y );
+}
+
+#define JIT_OP_ADD 0x58
+#define JIT_OP_MUL 0x59
+#define JIT_OP_XOR 0x57
+
+// Emit the code for the tile of C beginning at vector i0v and column j0.
+static void jit_tile( jitgen_t* g, dim_t i0v, dim_t mv, dim_t j0, dim_t nb )
+{
+	const gemmjit_shape_t* s = g->s;
+
+	const int ymm_v0 = ( int )( 14 - mv );
+
+	// Each tile is computed independently, so the product vanishes (without
+	// reading A or B) when alpha is zero, as it would in the BLAS.
+	const dim_t k_g = ( s->alpha_sc == BLIS_GEMMJIT_ZERO ? 0 : s->k_g );
+
+	#define ACC( v, j ) ( ( int )( (v)*nb + (j) ) )
+	#define PARTIAL( v ) ( g->m_rem != 0 && i0v + (v) == g->mv_tot - 1 )
+
+	if ( k_g == 0 )
+	{
+		for ( dim_t v = 0; v < mv; ++v )
+		for ( dim_t j = 0; j < nb; ++j )
+			jit_arith( g, JIT_OP_XOR, ACC( v, j ), ACC( v, j ), ACC( v, j ) );
+	}
+
+	for ( dim_t p = 0; p < k_g; ++p )
+	{
+		for ( dim_t v = 0; v < mv; ++v )
+			jit_load_v( g, ymm_v0 + ( int )v, g->reg_v,
+			            ( i0v + v ) * g->vl + p * s->ld_v, PARTIAL( v ) );
+
+		for ( dim_t j = 0; j < nb; ++j )
+		{
+			jit_bcast( g, JIT_YMM_BCAST, g->reg_s, p * s->s_k + ( j0 + j ) * s->s_n );
+
+			for ( dim_t v = 0; v < mv; ++v )
+			{
+				if ( p == 0 ) jit_arith( g, JIT_OP_MUL, ACC( v, j ), ymm_v0 + ( int )v, JIT_YMM_BCAST );
+				else          jit_fma( g, ACC( v, j ), ymm_v0 + ( int )v, JIT_YMM_BCAST );
+			}
+		}
+	}
+
+	// Scale by alpha.
+	if ( k_g != 0 && s->alpha_sc == BLIS_GEMMJIT_GEN )
+	{
+		jit_bcast( g, JIT_YMM_BCAST, JIT_RCX, 0 );
+
+		for ( dim_t v = 0; v < mv; ++v )
+		for ( dim_t j = 0; j < nb; ++j )
+			jit_arith( g, JIT_OP_MUL, ACC( v, j ), ACC( v, j ), JIT_YMM_BCAST );
+	}
+
+	// Accumulate into (or, if beta is zero, overwrite) C.
+	if ( s->beta_sc == BLIS_GEMMJIT_GEN )
+		jit_bcast( g, JIT_YMM_BCAST, JIT_R8, 0 );
+
+	for ( dim_t j = 0; j < nb; ++j )
+	for ( dim_t v = 0; v < mv; ++v )
+	{
+		const int64_t off = ( i0v + v ) * g->vl + ( j0 + j ) * s->ld_c;
+
+		if ( s->beta_sc != BLIS_GEMMJIT_ZERO )
+		{
+			jit_load_v( g, ymm_v0, JIT_RDX, off, PARTIAL( v ) );
+
+			if ( s->beta_sc == BLIS_GEMMJIT_ONE )
+				jit_arith( g, JIT_OP_ADD, ACC( v, j ), ACC( v, j ), ymm_v0 );
+			else
+				jit_fma( g, ACC( v, j ), ymm_v0, JIT_YMM_BCAST );
+		}
+
+		jit_store_v( g, ACC( v, j ), JIT_RDX, off, PARTIAL( v ) );
+	}
+
+	#undef ACC
+	#undef PARTIAL
+}
+
+// The largest number of columns in a tile of mv vectors.
+static dim_t jit_nb_max( dim_t mv )
+{
+	return ( 14 - mv ) / mv;
+}
+
+// Choose the number of vectors per tile that minimizes the number of loads
+// and broadcasts per unrolled k iteration.
+static dim_t jit_choose_mv( dim_t mv_tot, dim_t n_g )
+{
+	dim_t mv_best   = 1;
+	dim_t cost_best = -1;
+
+	for ( dim_t mvb = 1; mvb <= 4; ++mvb )
+	{
+		dim_t cost = 0;
+
+		for ( dim_t i0v = 0; i0v < mv_tot; i0v += mvb )
+		{
+			const dim_t mv  = bli_min( mvb, mv_tot - i0v );
+			const dim_t ncb = ( n_g + jit_nb_max( mv ) - 1 ) / jit_nb_max( mv );
+
+			cost += ncb * mv + n_g;
+		}
+
+		if ( cost_best < 0 || cost <= cost_best )
+		{
+			mv_best   = mvb;
+			cost_best = cost;
+		}
+	}
+
+	return mv_best;
+}
+
+void* bli_gemmjit_emit_x86
+     (
+       const gemmjit_shape_t* s,
+             siz_t*           size
+     )
+{
+	if ( s->dt != BLIS_FLOAT && s->dt != BLIS_DOUBLE ) return NULL;
+
+	err_t    r_val;
+	jitgen_t g;
+
+	g.s      = s;
+	g.is_d   = ( s->dt == BLIS_DOUBLE );
+	g.vl     = g.is_d ? 4 : 8;
+	g.es     = g.is_d ? 8 : 4;
+	g.pp     = g.is_d ? 1 : 0;
+	g.reg_v  = s->v_is_a ? JIT_RDI : JIT_RSI;
+	g.reg_s  = s->v_is_a ? JIT_RSI : JIT_RDI;
+	g.mv_tot = ( s->m_g + g.vl - 1 ) / g.vl;
+	g.m_rem  = s->m_g % g.vl;
+
+	g.b.cap  = 4096;
+	g.b.len  = 0;
+	g.b.ok   = TRUE;
+	g.b.buf  = bli_malloc_intl( g.b.cap, &r_val );
+
+	// Load the mask for the partial vector: mov rax, imm64; vmovup? ymm15, [rax].
+	if ( g.m_rem != 0 )
+	{
+		const void* mask = g.is_d ? ( const void* )&jit_mask_d[ g.vl - g.m_rem ]
+		                          : ( const void* )&jit_mask_s[ g.vl - g.m_rem ];
+		const uint64_t addr = ( uint64_t )( uintptr_t )mask;
+
+		jit_put8( &g.b, 0x48 );
+		jit_put8( &g.b, 0xB8 + JIT_RAX );
+		jit_put32( &g.b, ( uint32_t )addr );
+		jit_put32( &g.b, ( uint32_t )( addr >> 32 ) );
+
+		jit_op_mem( &g.b, JIT_MAP_0F, g.pp, 0, 0x10, JIT_YMM_MASK, 0, JIT_RAX, 0 );
+	}
+
+	const dim_t mvb = jit_choose_mv( g.mv_tot, s->n_g );
+
+	for ( dim_t i0v = 0; i0v < g.mv_tot; i0v += mvb )
+	{
+		const dim_t mv     = bli_min( mvb, g.mv_tot - i0v );
+		const dim_t nb_max = jit_nb_max( mv );
+
+		for ( dim_t j0 = 0; j0 < s->n_g; j0 += nb_max )
+			jit_tile( &g, i0v, mv, j0, bli_min( nb_max, s->n_g - j0 ) );
+	}
+
+	// vzeroupper; ret
+	jit_put8( &g.b, 0xC5 );
+	jit_put8( &g.b, 0xF8 );
+	jit_put8( &g.b, 0x77 );
+	jit_put8( &g.b, 0xC3 );
+
+	if ( !g.b.ok )
+	{
+		bli_free_intl( g.b.buf );
+		return NULL;
+	}
+
+	*size = g.b.len;
+
+	return g.b.buf;
+}
+
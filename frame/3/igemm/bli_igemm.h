@@ -0,0 +1,87 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Integer gemm: u8 x s8 and s16 x s16 products accumulated in int32, with
+// an optional epilogue that requantizes the int32 result to int8.
+//
+
+// Requantization parameters. Each int32 result c(i,j) is mapped to
+//
+//   q(i,j) = clamp( round( ( c(i,j) + bias[j] ) * scale[j*inc_scale] )
+//                   + zero_point, clip_min, clip_max )
+//
+// where rounding is to the nearest integer (ties to even). Setting
+// inc_scale to zero applies scale[0] to all columns (per-tensor scaling);
+// otherwise scale is indexed by column of C (per-channel scaling). The bias
+// is optional and, if present, is also indexed by column of C. clip_min and
+// clip_max must lie within the int8 range; narrowing them allows a fused
+// ReLU (e.g. clip_min = zero_point).
+
+typedef struct rqnt_s
+{
+	const float*   scale;
+	      inc_t    inc_scale;
+	const int32_t* bias;
+	      int32_t  zero_point;
+	      int32_t  clip_min;
+	      int32_t  clip_max;
+} rqnt_t;
+
+BLIS_INLINE void bli_rqnt_init
+     (
+       const float*   scale,
+             inc_t    inc_scale,
+       const int32_t* bias,
+             int32_t  zero_point,
+             rqnt_t*  rq
+     )
+{
+	rq->scale      = scale;
+	rq->inc_scale  = inc_scale;
+	rq->bias       = bias;
+	rq->zero_point = zero_point;
+	rq->clip_min   = INT8_MIN;
+	rq->clip_max   = INT8_MAX;
+}
+
+#include "bli_igemm_check.h"
+#include "bli_igemm_var.h"
+#include "bli_igemm_front.h"
+#include "bli_igemm_packm.h"
+
+// Prototype the typed APIs.
+#include "bli_igemm_tapi.h"
+
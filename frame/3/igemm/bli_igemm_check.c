@@ -0,0 +1,88 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+void bli_igemm_check
+     (
+             trans_t transa,
+             trans_t transb,
+             dim_t   m,
+             dim_t   n,
+             dim_t   k,
+             inc_t   rs_a,
+             inc_t   cs_a,
+             inc_t   rs_b,
+             inc_t   cs_b,
+             inc_t   rs_c,
+             inc_t   cs_c,
+       const rqnt_t* rq
+     )
+{
+	err_t e_val;
+	dim_t m_a, n_a;
+	dim_t m_b, n_b;
+
+	// Check the transposition parameters.
+
+	e_val = bli_check_valid_trans( transa );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_valid_trans( transb );
+	bli_check_error_code( e_val );
+
+	// Check the matrix dimensions and strides.
+
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a );
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b );
+
+	e_val = bli_check_matrix_strides( m_a, n_a, rs_a, cs_a, 1 );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_strides( m_b, n_b, rs_b, cs_b, 1 );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_strides( m, n, rs_c, cs_c, 1 );
+	bli_check_error_code( e_val );
+
+	// Check the requantization parameters, if given.
+
+	if ( rq != NULL )
+	{
+		e_val = bli_check_null_pointer( rq->scale );
+		bli_check_error_code( e_val );
+	}
+}
+
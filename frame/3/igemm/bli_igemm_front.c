@@ -0,0 +1,269 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// The integer gemm implementation computes C := beta * C + alpha * A * B
+// where A and B are stored as u8 and s8 (or both as s16) and C is stored as
+// int32, or alternatively Q := requant( A * B ) where Q is stored as int8.
+// The integer datatypes have no num_t (and thus no obj_t) encoding, so the
+// operands are described by an igemm_params_t, and threads are spawned here
+// directly rather than through the sup thread decorator.
+//
+
+struct igemm_decor_params_s
+{
+	const igemm_params_t* params;
+	const cntx_t*         cntx;
+	      rntm_t*         rntm;
+	      array_t*        array;
+	      trace_call_t*   call;
+};
+typedef struct igemm_decor_params_s igemm_decor_params_t;
+
+static void bli_igemm_thread_entry( thrcomm_t* gl_comm, dim_t tid, const void* data_void )
+{
+	const igemm_decor_params_t* data = data_void;
+
+	const double t_trace = bli_trace_thread_begin( data->call );
+
+	bli_l3_thread_decorator_thread_check( gl_comm, data->rntm );
+
+	// Create the root node of the thread's thrinfo_t structure. The sup
+	// thrinfo_t tree has exactly the shape needed by the block-panel variant
+	// (including the packm prenodes).
+	pool_t*    pool   = bli_apool_array_elem( tid, data->array );
+	thrinfo_t* thread = bli_l3_sup_thrinfo_create( tid, gl_comm, pool, data->rntm );
+
+	bli_igemm_bp_var1( data->params, data->cntx, thread );
+
+	// Free the current thread's thrinfo_t structure (after a barrier, so that
+	// no thread releases packing memory still in use by its peers).
+	bli_thrinfo_barrier( thread );
+	bli_thrinfo_free( thread );
+
+	bli_trace_thread_end( data->call, t_trace );
+}
+
+// Scale an int32 matrix by beta, overwriting it if beta is zero. All
+// arithmetic wraps on overflow, consistent with the microkernels.
+static void bli_igemm_scalm
+     (
+       int32_t  beta,
+       dim_t    m,
+       dim_t    n,
+       int32_t* c, inc_t rs_c, inc_t cs_c
+     )
+{
+	if ( beta == 1 ) return;
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		int32_t* cij = c + i*rs_c + j*cs_c;
+
+		if ( beta == 0 ) *cij = 0;
+		else             *cij = ( int32_t )( ( uint32_t )beta * ( uint32_t )*cij );
+	}
+}
+
+// Return whether all elements of the k x n matrix B (of int8 elements) lie
+// in [-64, 64], in which case no pair sum of u8 x s8 products can exceed the
+// int16 range.
+static bool bli_igemm_s8_is_madd_safe
+     (
+             dim_t   k,
+             dim_t   n,
+       const int8_t* b, inc_t rs_b, inc_t cs_b
+     )
+{
+	// Traverse B along its unit (or smaller) stride.
+	if ( bli_abs( rs_b ) > bli_abs( cs_b ) )
+	{
+		bli_swap_dims( &k, &n );
+		bli_swap_incs( &rs_b, &cs_b );
+	}
+
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		const int8_t* restrict bj = b + j*cs_b;
+		int8_t                 lo = 0, hi = 0;
+
+		for ( dim_t i = 0; i < k; ++i )
+		{
+			lo = bli_min( lo, bj[ i*rs_b ] );
+			hi = bli_max( hi, bj[ i*rs_b ] );
+		}
+
+		if ( lo < -64 || hi > 64 ) return FALSE;
+	}
+
+	return TRUE;
+}
+
+void bli_igemm_front
+     (
+             igemm_params_t* params,
+       const cntx_t*         cntx,
+       const rntm_t*         rntm
+     )
+{
+	bli_init_once();
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	const dim_t m = params->m;
+	const dim_t n = params->n;
+	const dim_t k = params->k;
+
+	// If the output has a zero dimension, return early.
+	if ( m == 0 || n == 0 ) return;
+
+	// If the k dimension is zero (or, without requantization, alpha is zero),
+	// the product A * B vanishes, so only the output needs to be updated.
+	if ( params->rq == NULL )
+	{
+		if ( k == 0 || params->alpha == 0 )
+		{
+			bli_igemm_scalm( params->beta, m, n, params->c, params->rs_c, params->cs_c );
+			return;
+		}
+	}
+	else if ( k == 0 )
+	{
+		const int32_t zero = 0;
+
+		bli_igemm_rq_apply( m, n, 0, &zero, 0, 0, params->rq,
+		                    params->q, params->rs_q, params->cs_q );
+		return;
+	}
+
+	// The u8 x s8 microkernels sum adjacent pairs of products with 16-bit
+	// saturation (as vpmaddubsw does), which cannot occur if the elements of
+	// B lie in [-64, 64]. Otherwise, A and B are widened to int16 as they
+	// are packed and the s16 x s16 microkernel is used instead, so that the
+	// result is always exact (up to int32 wraparound).
+	if ( params->ukr_id == BLIS_GEMM_U8S8S32_UKR &&
+	     !bli_igemm_s8_is_madd_safe( k, n, params->b, params->rs_b, params->cs_b ) )
+	{
+		params->ukr_id = BLIS_GEMM_S16S16S32_UKR;
+		params->es_p   = sizeof( int16_t );
+	}
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); }
+	else                { rntm_l = *rntm;                       }
+
+	// A and B must always be packed into the k-grouped format. Setting these
+	// fields also prevents bli_l3_sup_thrinfo_create() from assuming a
+	// sup-style (unpacked) execution.
+	bli_rntm_set_pack_a( TRUE, &rntm_l );
+	bli_rntm_set_pack_b( TRUE, &rntm_l );
+
+	// Parse and interpret the contents of the rntm_t object to properly
+	// set the ways of parallelism for each loop.
+	bli_rntm_set_ways_for_op( BLIS_GEMM, BLIS_LEFT, m, n, k, &rntm_l );
+
+	// If requantizing and the k dimension spans more than one KC block, the
+	// partial int32 sums must persist between blocks, so we allocate a
+	// (row-stored) int32 workspace for them.
+	int32_t* w = NULL;
+
+	if ( params->rq != NULL && k > bli_igemm_kc( params->es_p, cntx ) )
+	{
+		err_t r_val;
+
+		w = bli_malloc_intl( m * n * sizeof( int32_t ), &r_val );
+
+		params->c    = w;
+		params->rs_c = n;
+		params->cs_c = 1;
+	}
+
+	// Query the threading implementation and the number of threads requested.
+	timpl_t ti = bli_rntm_thread_impl( &rntm_l );
+	dim_t   nt = bli_rntm_num_threads( &rntm_l );
+
+	if ( bli_error_checking_is_enabled() )
+		bli_l3_thread_decorator_check( &rntm_l );
+
+#ifdef BLIS_ENABLE_NT1_VIA_SINGLE
+	if ( nt == 1 )
+	{
+		// An optimization. If the caller requests only one thread, force
+		// the sequential implementation.
+		ti = BLIS_SINGLE;
+		bli_rntm_set_thread_impl( BLIS_SINGLE, &rntm_l );
+	}
+#endif
+
+	if ( 1 < nt && ti == BLIS_SINGLE )
+	{
+		// Favor the requested (sequential) threading implementation over the
+		// number of threads, and reset all parallelism parameters to 1.
+		nt = 1;
+		bli_rntm_set_ways_only( 1, 1, 1, 1, 1, &rntm_l );
+		bli_rntm_set_num_threads_only( 1, &rntm_l );
+	}
+
+	// Begin tracing the operation (if tracing is enabled).
+	trace_call_t call;
+	bli_trace_call_begin( &call );
+
+	// Check out an array_t from the small block allocator for the threads'
+	// thrinfo_t trees.
+	array_t* array = bli_sba_checkout_array( nt );
+
+	igemm_decor_params_t decor_params;
+	decor_params.params = params;
+	decor_params.cntx   = cntx;
+	decor_params.rntm   = &rntm_l;
+	decor_params.array  = array;
+	decor_params.call   = &call;
+
+	bli_thread_launch( ti, nt, bli_igemm_thread_entry, &decor_params );
+
+	bli_sba_checkin_array( array );
+
+	bli_trace_call_end( &call, BLIS_TRACE_INT, BLIS_GEMM, BLIS_INT,
+	                    params->m, params->n, params->k, &rntm_l );
+
+	if ( w != NULL ) bli_free_intl( w );
+}
+
@@ -0,0 +1,230 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// Pack an mn x k micropanel of integer elements (whose elements are
+// separated by inca along the mn dimension and by lda along the k
+// dimension) into the k-grouped format expected by the integer gemm
+// microkernels: each group of kg consecutive k values belonging to one of
+// the mnr rows (or columns) is stored contiguously, and the groups of all
+// mnr rows are stored next to each other before proceeding to the next
+// group. The micropanel is zero-padded to mnr rows and to a multiple of kg
+// in the k dimension.
+//
+// Signed and unsigned 8-bit elements are packed identically, so only the
+// element size matters here, except when 8-bit elements are widened to
+// 16 bits (in which case they are zero- or sign-extended according to
+// ctype_a).
+//
+
+#undef  GENTFUNCI
+#define GENTFUNCI( ctype_a, ctype_p, nbits, suf ) \
+\
+static void PASTEMAC(igemm_packm_panel_,suf) \
+     ( \
+             dim_t    mn, \
+             dim_t    mnr, \
+             dim_t    k, \
+       const ctype_a* restrict a, inc_t inca, inc_t lda, \
+             ctype_p* restrict p  \
+     ) \
+{ \
+	const dim_t kg     = 32 / nbits; \
+	const dim_t k_iter = ( k + kg - 1 ) / kg; \
+	const inc_t ps_g   = mnr * kg; \
+\
+	if ( lda == 1 ) \
+	{ \
+		/* Each row of the source is contiguous in k, so copy one group (a
+		   32-bit word) at a time. */ \
+		const dim_t k_full = k / kg; \
+		const dim_t k_left = k % kg; \
+\
+		for ( dim_t i = 0; i < mn; ++i ) \
+		{ \
+			const ctype_a* restrict ai = a + i*inca; \
+			      ctype_p* restrict pi = p + i*kg; \
+\
+			for ( dim_t g = 0; g < k_full; ++g ) \
+				for ( dim_t l = 0; l < kg; ++l ) \
+					pi[ g*ps_g + l ] = ai[ g*kg + l ]; \
+\
+			if ( k_left != 0 ) \
+				for ( dim_t l = 0; l < kg; ++l ) \
+					pi[ k_full*ps_g + l ] = ( l < k_left ? ai[ k_full*kg + l ] : 0 ); \
+		} \
+	} \
+	else \
+	{ \
+		/* Otherwise, traverse the source one k index at a time, which is
+		   contiguous along mn when inca is unit. */ \
+		for ( dim_t g = 0; g < k_iter; ++g ) \
+		{ \
+			for ( dim_t l = 0; l < kg; ++l ) \
+			{ \
+				const dim_t              kk = g*kg + l; \
+				const ctype_a* restrict  al = a + kk*lda; \
+				      ctype_p* restrict  pl = p + g*ps_g + l; \
+\
+				if ( kk < k ) for ( dim_t i = 0; i < mn; ++i ) pl[ i*kg ] = al[ i*inca ]; \
+				else          for ( dim_t i = 0; i < mn; ++i ) pl[ i*kg ] = 0; \
+			} \
+		} \
+	} \
+\
+	/* Zero the rows (columns) of the micropanel beyond mn. */ \
+	if ( mn < mnr ) \
+		for ( dim_t g = 0; g < k_iter; ++g ) \
+			memset( p + g*ps_g + mn*kg, 0, ( mnr - mn ) * kg * sizeof( ctype_p ) ); \
+}
+
+GENTFUNCI( uint8_t, uint8_t,  8, 8 )
+GENTFUNCI( int16_t, int16_t, 16, 16 )
+GENTFUNCI( uint8_t, int16_t, 16, u8_16 )
+GENTFUNCI( int8_t,  int16_t, 16, s8_16 )
+
+//
+// Pack an mn x k integer matrix into consecutive k-grouped micropanels of
+// width mnr, partitioning the micropanels among the threads of the packm
+// thrinfo_t node. The packing buffer is acquired from the pba by the chief
+// thread and cached in the thrinfo_t node, where it persists across calls.
+// The panel stride ps_p is returned in bytes. The elements of the source
+// occupy es bytes and those of the micropanels es_p bytes; if es_p exceeds
+// es, 8-bit elements are widened to 16 bits, treating them as signed if
+// is_signed is TRUE and as unsigned otherwise.
+//
+
+void bli_igemm_packm
+     (
+             packbuf_t  pack_buf_type,
+             siz_t      es,
+             siz_t      es_p,
+             bool       is_signed,
+             dim_t      mn_alloc,
+             dim_t      k_alloc,
+             dim_t      mn,
+             dim_t      k,
+             dim_t      mnr,
+       const void*      a, inc_t inca, inc_t lda,
+             char**     p, inc_t* ps_p,
+             thrinfo_t* thread
+     )
+{
+	// Barrier to make sure all threads are caught up and ready to begin the
+	// packm stage.
+	bli_thrinfo_barrier( thread );
+
+	const double t_trace = bli_trace_pack_begin();
+
+	// Each group of kg elements occupies four bytes.
+	const dim_t kg = 4 / es_p;
+
+	// Compute the size of the memory block needed. We size the block for
+	// the largest problem the caller expects to pack (mn_alloc x k_alloc)
+	// so that it need not be re-acquired for edge cases.
+	const dim_t n_iter_alloc = ( mn_alloc + mnr - 1 ) / mnr;
+	const dim_t k_iter_alloc = ( k_alloc + kg - 1 ) / kg;
+	const siz_t size_needed  = 4 * n_iter_alloc * mnr * k_iter_alloc;
+
+	mem_t* mem = bli_thrinfo_mem( thread );
+
+	// Acquire a block from the pba if the cached block is absent or too small.
+	if ( bli_mem_is_unalloc( mem ) || bli_mem_size( mem ) < size_needed )
+	{
+		if ( bli_thrinfo_am_chief( thread ) )
+		{
+			// The acquisition must go directly to the chief thread's mem_t
+			// (rather than to a temporary) since there is no barrier until
+			// after packing is finished.
+			if ( bli_mem_is_alloc( mem ) )
+				bli_pba_release( bli_thrinfo_pba( thread ), mem );
+
+			bli_pba_acquire_m
+			(
+			  bli_thrinfo_pba( thread ),
+			  size_needed,
+			  pack_buf_type,
+			  mem
+			);
+		}
+
+		// Broadcast the address of the chief thread's mem_t to all threads,
+		// and copy its contents into the other threads' mem_t.
+		mem_t* mem_p = bli_thrinfo_broadcast( thread, mem );
+
+		if ( !bli_thrinfo_am_chief( thread ) ) *mem = *mem_p;
+	}
+
+	char* restrict p_begin = bli_mem_buffer( mem );
+	const inc_t    ps      = 4 * mnr * ( ( k + kg - 1 ) / kg );
+
+	*p    = p_begin;
+	*ps_p = ps;
+
+	// Compute the total number of micropanels and partition them among the
+	// threads in the packm thrinfo_t node.
+	thrinfo_t*  thread_p = bli_thrinfo_sub_prenode( thread );
+	const dim_t n_iter   = ( mn + mnr - 1 ) / mnr;
+	const dim_t nt       = bli_thrinfo_n_way( thread_p );
+	const dim_t tid      = bli_thrinfo_work_id( thread_p );
+
+	dim_t it_start, it_end, it_inc;
+	bli_thread_range_slrr( thread_p, n_iter, 1, FALSE, &it_start, &it_end, &it_inc );
+
+	const char* restrict a_cast = a;
+
+	for ( dim_t it = 0; it < n_iter; ++it )
+	{
+		if ( bli_is_my_iter( it, it_start, it_end, tid, nt ) )
+		{
+			const dim_t mn_cur = bli_min( mnr, mn - it*mnr );
+			const void* a_use  = a_cast + it*mnr*inca*( inc_t )es;
+			      void* p_use  = p_begin + it*ps;
+
+			if      ( es == es_p && es == 1 ) bli_igemm_packm_panel_8    ( mn_cur, mnr, k, a_use, inca, lda, p_use );
+			else if ( es == es_p )            bli_igemm_packm_panel_16   ( mn_cur, mnr, k, a_use, inca, lda, p_use );
+			else if ( is_signed )             bli_igemm_packm_panel_s8_16( mn_cur, mnr, k, a_use, inca, lda, p_use );
+			else                              bli_igemm_packm_panel_u8_16( mn_cur, mnr, k, a_use, inca, lda, p_use );
+		}
+	}
+
+	bli_trace_pack_end( t_trace );
+
+	// Barrier so that packing is done before computation.
+	bli_thrinfo_barrier( thread );
+}
+
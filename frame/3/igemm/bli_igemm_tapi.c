@@ -0,0 +1,213 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// Define BLAS-like interfaces with typed operands (basic and expert).
+//
+
+#undef  GENTFUNCI
+#define GENTFUNCI( ctype_a, ctype_b, ukrid, opname ) \
+\
+void PASTEMAC0(opname) \
+     ( \
+             trans_t  transa, \
+             trans_t  transb, \
+             dim_t    m, \
+             dim_t    n, \
+             dim_t    k, \
+       const int32_t* alpha, \
+       const ctype_a* a, inc_t rs_a, inc_t cs_a, \
+       const ctype_b* b, inc_t rs_b, inc_t cs_b, \
+       const int32_t* beta, \
+             int32_t* c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	/* Invoke the expert interface and request default cntx_t and rntm_t
+	   objects. */ \
+	PASTEMAC(opname,BLIS_TAPI_EX_SUF) \
+	( \
+	  transa, \
+	  transb, \
+	  m, n, k, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  b, rs_b, cs_b, \
+	  beta, \
+	  c, rs_c, cs_c, \
+	  NULL, \
+	  NULL  \
+	); \
+} \
+\
+void PASTEMAC(opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             trans_t  transa, \
+             trans_t  transb, \
+             dim_t    m, \
+             dim_t    n, \
+             dim_t    k, \
+       const int32_t* alpha, \
+       const ctype_a* a, inc_t rs_a, inc_t cs_a, \
+       const ctype_b* b, inc_t rs_b, inc_t cs_b, \
+       const int32_t* beta, \
+             int32_t* c, inc_t rs_c, inc_t cs_c, \
+       const cntx_t*  cntx, \
+       const rntm_t*  rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	/* Check parameters. */ \
+	if ( bli_error_checking_is_enabled() ) \
+		bli_igemm_check( transa, transb, m, n, k, rs_a, cs_a, rs_b, cs_b, \
+		                 rs_c, cs_c, NULL ); \
+\
+	/* Induce the transpositions of A and B (conjugation is meaningless for
+	   integer operands). */ \
+	if ( bli_does_trans( transa ) ) bli_swap_incs( &rs_a, &cs_a ); \
+	if ( bli_does_trans( transb ) ) bli_swap_incs( &rs_b, &cs_b ); \
+\
+	igemm_params_t params; \
+\
+	params.ukr_id = ukrid; \
+	params.es     = sizeof( ctype_a ); \
+	params.es_p   = sizeof( ctype_a ); \
+	params.m      = m; \
+	params.n      = n; \
+	params.k      = k; \
+	params.a      = a; params.rs_a = rs_a; params.cs_a = cs_a; \
+	params.b      = b; params.rs_b = rs_b; params.cs_b = cs_b; \
+	params.alpha  = *alpha; \
+	params.beta   = *beta; \
+	params.c      = c; params.rs_c = rs_c; params.cs_c = cs_c; \
+	params.rq     = NULL; \
+	params.q      = NULL; params.rs_q = 0; params.cs_q = 0; \
+\
+	bli_igemm_front( &params, cntx, rntm ); \
+}
+
+GENTFUNCI( uint8_t, int8_t,  BLIS_GEMM_U8S8S32_UKR,   u8s8gemm )
+#ifndef BLIS_ENABLE_SANDBOX
+GENTFUNCI( int16_t, int16_t, BLIS_GEMM_S16S16S32_UKR, i16gemm )
+#endif
+
+
+#undef  GENTFUNCI
+#define GENTFUNCI( ctype_a, ctype_b, ukrid, opname ) \
+\
+void PASTEMAC0(opname) \
+     ( \
+             trans_t  transa, \
+             trans_t  transb, \
+             dim_t    m, \
+             dim_t    n, \
+             dim_t    k, \
+       const ctype_a* a, inc_t rs_a, inc_t cs_a, \
+       const ctype_b* b, inc_t rs_b, inc_t cs_b, \
+       const rqnt_t*  rq, \
+             int8_t*  c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	/* Invoke the expert interface and request default cntx_t and rntm_t
+	   objects. */ \
+	PASTEMAC(opname,BLIS_TAPI_EX_SUF) \
+	( \
+	  transa, \
+	  transb, \
+	  m, n, k, \
+	  a, rs_a, cs_a, \
+	  b, rs_b, cs_b, \
+	  rq, \
+	  c, rs_c, cs_c, \
+	  NULL, \
+	  NULL  \
+	); \
+} \
+\
+void PASTEMAC(opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             trans_t  transa, \
+             trans_t  transb, \
+             dim_t    m, \
+             dim_t    n, \
+             dim_t    k, \
+       const ctype_a* a, inc_t rs_a, inc_t cs_a, \
+       const ctype_b* b, inc_t rs_b, inc_t cs_b, \
+       const rqnt_t*  rq, \
+             int8_t*  c, inc_t rs_c, inc_t cs_c, \
+       const cntx_t*  cntx, \
+       const rntm_t*  rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	/* Check parameters. */ \
+	if ( bli_error_checking_is_enabled() ) \
+	{ \
+		bli_check_error_code( bli_check_null_pointer( rq ) ); \
+		bli_igemm_check( transa, transb, m, n, k, rs_a, cs_a, rs_b, cs_b, \
+		                 rs_c, cs_c, rq ); \
+	} \
+\
+	/* Induce the transpositions of A and B (conjugation is meaningless for
+	   integer operands). */ \
+	if ( bli_does_trans( transa ) ) bli_swap_incs( &rs_a, &cs_a ); \
+	if ( bli_does_trans( transb ) ) bli_swap_incs( &rs_b, &cs_b ); \
+\
+	/* The int32 product is computed without scaling, into either a local
+	   microtile or a workspace allocated by bli_igemm_front(). */ \
+	igemm_params_t params; \
+\
+	params.ukr_id = ukrid; \
+	params.es     = sizeof( ctype_a ); \
+	params.es_p   = sizeof( ctype_a ); \
+	params.m      = m; \
+	params.n      = n; \
+	params.k      = k; \
+	params.a      = a; params.rs_a = rs_a; params.cs_a = cs_a; \
+	params.b      = b; params.rs_b = rs_b; params.cs_b = cs_b; \
+	params.alpha  = 1; \
+	params.beta   = 0; \
+	params.c      = NULL; params.rs_c = 0; params.cs_c = 0; \
+	params.rq     = rq; \
+	params.q      = c; params.rs_q = rs_c; params.cs_q = cs_c; \
+\
+	bli_igemm_front( &params, cntx, rntm ); \
+}
+
+GENTFUNCI( uint8_t, int8_t,  BLIS_GEMM_U8S8S32_UKR,   u8s8gemm_rq )
+
@@ -0,0 +1,123 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Prototype BLAS-like interfaces with typed operands (basic and expert).
+//
+// The operation name encodes the storage datatypes of A and B:
+//
+//   u8s8: A is uint8_t and B is int8_t
+//   i16:  A and B are int16_t
+//
+// Products are accumulated in int32, so C, alpha, and beta are int32_t.
+// The _rq variants instead requantize the int32 product A * B into an int8
+// matrix C according to the given rqnt_t (see bli_igemm.h).
+//
+
+#undef  GENTPROTI
+#define GENTPROTI( ctype_a, ctype_b, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC0(opname) \
+     ( \
+             trans_t  transa, \
+             trans_t  transb, \
+             dim_t    m, \
+             dim_t    n, \
+             dim_t    k, \
+       const int32_t* alpha, \
+       const ctype_a* a, inc_t rs_a, inc_t cs_a, \
+       const ctype_b* b, inc_t rs_b, inc_t cs_b, \
+       const int32_t* beta, \
+             int32_t* c, inc_t rs_c, inc_t cs_c  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             trans_t  transa, \
+             trans_t  transb, \
+             dim_t    m, \
+             dim_t    n, \
+             dim_t    k, \
+       const int32_t* alpha, \
+       const ctype_a* a, inc_t rs_a, inc_t cs_a, \
+       const ctype_b* b, inc_t rs_b, inc_t cs_b, \
+       const int32_t* beta, \
+             int32_t* c, inc_t rs_c, inc_t cs_c, \
+       const cntx_t*  cntx, \
+       const rntm_t*  rntm  \
+     );
+
+GENTPROTI( uint8_t, int8_t,  u8s8gemm )
+
+// NOTE: The POWER10 sandbox provides its own bli_i16gemm(), so we forgo
+// prototyping (and defining) it when a sandbox is enabled.
+#ifndef BLIS_ENABLE_SANDBOX
+GENTPROTI( int16_t, int16_t, i16gemm )
+#endif
+
+
+#undef  GENTPROTI
+#define GENTPROTI( ctype_a, ctype_b, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC0(opname) \
+     ( \
+             trans_t  transa, \
+             trans_t  transb, \
+             dim_t    m, \
+             dim_t    n, \
+             dim_t    k, \
+       const ctype_a* a, inc_t rs_a, inc_t cs_a, \
+       const ctype_b* b, inc_t rs_b, inc_t cs_b, \
+       const rqnt_t*  rq, \
+             int8_t*  c, inc_t rs_c, inc_t cs_c  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             trans_t  transa, \
+             trans_t  transb, \
+             dim_t    m, \
+             dim_t    n, \
+             dim_t    k, \
+       const ctype_a* a, inc_t rs_a, inc_t cs_a, \
+       const ctype_b* b, inc_t rs_b, inc_t cs_b, \
+       const rqnt_t*  rq, \
+             int8_t*  c, inc_t rs_c, inc_t cs_c, \
+       const cntx_t*  cntx, \
+       const rntm_t*  rntm  \
+     );
+
+GENTPROTI( uint8_t, int8_t,  u8s8gemm_rq )
+
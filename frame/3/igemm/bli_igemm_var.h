@@ -0,0 +1,96 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Parameters for the integer gemm block-panel algorithm. The operands are
+// passed in raw form since the integer datatypes have no num_t encoding.
+// Exactly one of the following output configurations is used:
+//  - c != NULL, rq == NULL: C := beta * C + alpha * A * B (int32 C).
+//  - rq != NULL: Q := requant( A * B ) (int8 Q), where the int32 product is
+//    accumulated into a local microtile or, if the k dimension spans more
+//    than one cache block, into the int32 workspace given by c.
+// The elements of A and B occupy es bytes and the elements of the packed
+// micropanels es_p bytes. These differ only when u8 and s8 operands are
+// widened to int16 for use with the s16 x s16 microkernel.
+//
+
+typedef struct
+{
+	      ukr_t    ukr_id;
+	      siz_t    es;
+	      siz_t    es_p;
+
+	      dim_t    m;
+	      dim_t    n;
+	      dim_t    k;
+
+	const void*    a; inc_t rs_a; inc_t cs_a;
+	const void*    b; inc_t rs_b; inc_t cs_b;
+
+	      int32_t  alpha;
+	      int32_t  beta;
+	      int32_t* c; inc_t rs_c; inc_t cs_c;
+
+	const rqnt_t*  rq;
+	      int8_t*  q; inc_t rs_q; inc_t cs_q;
+} igemm_params_t;
+
+// The KC cache blocksize for integer operands of es bytes. We scale the
+// float KC so that packed blocks occupy the same number of bytes as in the
+// float gemm (and so that KC remains a multiple of the k grouping).
+
+BLIS_INLINE dim_t bli_igemm_kc( siz_t es, const cntx_t* cntx )
+{
+	return bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_KC, cntx )
+	       * ( dim_t )( sizeof( float ) / es );
+}
+
+void bli_igemm_bp_var1
+     (
+       const igemm_params_t* params,
+       const cntx_t*         cntx,
+             thrinfo_t*      thread
+     );
+
+void bli_igemm_rq_apply
+     (
+             dim_t    m,
+             dim_t    n,
+             dim_t    j_off,
+       const int32_t* c, inc_t rs_c, inc_t cs_c,
+       const rqnt_t*  rq,
+             int8_t*  q, inc_t rs_q, inc_t cs_q
+     );
+
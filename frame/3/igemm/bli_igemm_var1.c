@@ -0,0 +1,378 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// The integer gemm block-panel algorithm. This variant mirrors the
+// conventional five-loop gemm algorithm, except that A and B are packed into
+// k-grouped micropanels (see bli_igemm_packm()) and the products are
+// accumulated in int32 by the integer gemm microkernel identified in the
+// parameters. The register blocksizes and the MC and NC cache blocksizes are
+// those of float, while KC is scaled by the packed element size (see
+// bli_igemm_kc()). B is signed (s8 or s16), and A is unsigned only when it
+// holds 8-bit elements, which only matters if they are widened when packed.
+//
+// When requantization is requested, it is applied to each microtile as soon
+// as the microkernel has computed its final (int32) value, while the
+// microtile is still in cache.
+//
+
+void bli_igemm_bp_var1
+     (
+       const igemm_params_t* params,
+       const cntx_t*         cntx,
+             thrinfo_t*      thread
+     )
+{
+	const dim_t m      = params->m;
+	const dim_t n      = params->n;
+	const dim_t k      = params->k;
+	const siz_t es     = params->es;
+	const siz_t es_p   = params->es_p;
+
+	const char* restrict a_00 = params->a;
+	const inc_t          rs_a = params->rs_a;
+	const inc_t          cs_a = params->cs_a;
+
+	const char* restrict b_00 = params->b;
+	const inc_t          rs_b = params->rs_b;
+	const inc_t          cs_b = params->cs_b;
+
+	int32_t*    restrict c_00 = params->c;
+	const inc_t          rs_c = params->rs_c;
+	const inc_t          cs_c = params->cs_c;
+
+	const rqnt_t*        rq   = params->rq;
+	int8_t*     restrict q_00 = params->q;
+	const inc_t          rs_q = params->rs_q;
+	const inc_t          cs_q = params->cs_q;
+
+	// Make local copies of the scalars to prevent any unnecessary sharing of
+	// cache lines between the cores' caches.
+	const int32_t alpha_local = params->alpha;
+	const int32_t beta_local  = params->beta;
+	const int32_t one_local   = 1;
+	const int32_t zero_local  = 0;
+
+	// Query the context for various blocksizes.
+	const dim_t NR     = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_NR, cntx );
+	const dim_t MR     = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_MR, cntx );
+	const dim_t NC     = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_NC, cntx );
+	const dim_t MC     = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_MC, cntx );
+	const dim_t KC     = bli_igemm_kc( es_p, cntx );
+
+	// Query the context for the integer microkernel.
+	gemm_ukr_ft gemm_ukr = bli_cntx_get_ukr_dt( BLIS_FLOAT, params->ukr_id, cntx );
+
+	// When requantizing without an int32 workspace (ie: when k spans only
+	// one KC block), each microtile is computed into this local buffer.
+	int32_t     ct[ BLIS_STACK_BUF_MAX_SIZE
+	                / sizeof( int32_t ) ]
+	                __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+
+	// Compute partitioning step values for each matrix of each loop.
+	const inc_t jcstep_b = cs_b * es;
+	const inc_t pcstep_a = cs_a * es;
+	const inc_t pcstep_b = rs_b * es;
+	const inc_t icstep_a = rs_a * es;
+
+	// Save the pack schemas, imaginary strides, and microkernel address to
+	// the auxinfo_t object.
+	auxinfo_t aux;
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux );
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux );
+	bli_auxinfo_set_is_a( 1, &aux );
+	bli_auxinfo_set_is_b( 1, &aux );
+	bli_auxinfo_set_ukr( ( void_fp )gemm_ukr, &aux );
+	bli_auxinfo_set_params( NULL, &aux );
+
+	thrinfo_t* restrict thread_jc = bli_thrinfo_sub_node( thread );
+	thrinfo_t* restrict thread_pc = bli_thrinfo_sub_node( thread_jc );
+	thrinfo_t* restrict thread_pb = bli_thrinfo_sub_node( thread_pc );
+	thrinfo_t* restrict thread_ic = bli_thrinfo_sub_node( thread_pb );
+	thrinfo_t* restrict thread_pa = bli_thrinfo_sub_node( thread_ic );
+	thrinfo_t* restrict thread_jr = bli_thrinfo_sub_node( thread_pa );
+	thrinfo_t* restrict thread_ir = bli_thrinfo_sub_node( thread_jr );
+
+	// Compute the JC loop thread range for the current thread.
+	dim_t jc_start, jc_end;
+	bli_thread_range_sub( thread_jc, n, NR, FALSE, &jc_start, &jc_end );
+
+	// Loop over the n dimension (NC columns at a time).
+	for ( dim_t jj = jc_start; jj < jc_end; jj += NC )
+	{
+		const dim_t nc_cur = bli_min( NC, jc_end - jj );
+
+		const char* restrict b_jc = b_00 + jj * jcstep_b;
+
+		// Loop over the k dimension (KC rows/columns at a time).
+		for ( dim_t pp = 0; pp < k; pp += KC )
+		{
+			const dim_t kc_cur  = bli_min( KC, k - pp );
+			const bool  is_last = ( pp + kc_cur == k );
+
+			const char* restrict a_pc = a_00 + pp * pcstep_a;
+			const char* restrict b_pc = b_jc + pp * pcstep_b;
+
+			// Only apply beta to the first iteration of the pc loop.
+			const int32_t* restrict beta_use = ( pp == 0 ? &beta_local : &one_local );
+
+			char* b_use;
+			inc_t ps_b_use;
+
+			// Pack the current KC x NC row panel of B into k-grouped
+			// column micropanels.
+			bli_igemm_packm
+			(
+			  BLIS_BUFFER_FOR_B_PANEL,
+			  es, es_p, TRUE,
+			  NC, KC,
+			  nc_cur, kc_cur,
+			  NR,
+			  b_pc, cs_b, rs_b,
+			  &b_use, &ps_b_use,
+			  thread_pb
+			);
+
+			char* restrict b_pc_use = b_use;
+
+			// Compute the IC loop thread range for the current thread.
+			dim_t ic_start, ic_end;
+			bli_thread_range_sub( thread_ic, m, MR, FALSE, &ic_start, &ic_end );
+
+			// Loop over the m dimension (MC rows at a time).
+			for ( dim_t ii = ic_start; ii < ic_end; ii += MC )
+			{
+				const dim_t mc_cur = bli_min( MC, ic_end - ii );
+
+				const char* restrict a_ic = a_pc + ii * icstep_a;
+
+				char* a_use;
+				inc_t ps_a_use;
+
+				// Pack the current MC x KC block of A into k-grouped row
+				// micropanels.
+				bli_igemm_packm
+				(
+				  BLIS_BUFFER_FOR_A_BLOCK,
+				  es, es_p, FALSE,
+				  MC, KC,
+				  mc_cur, kc_cur,
+				  MR,
+				  a_ic, rs_a, cs_a,
+				  &a_use, &ps_a_use,
+				  thread_pa
+				);
+
+				char* restrict a_ic_use = a_use;
+
+				// Query the number of threads and thread ids for the JR loop.
+				const dim_t jr_nt  = bli_thrinfo_n_way( thread_jr );
+				const dim_t jr_tid = bli_thrinfo_work_id( thread_jr );
+
+				// Compute number of primary and leftover components of the
+				// JR loop.
+				const dim_t jr_iter = ( nc_cur + NR - 1 ) / NR;
+				const dim_t jr_left =   nc_cur % NR;
+
+				// Compute the JR loop thread range for the current thread.
+				dim_t jr_start, jr_end;
+				bli_thread_range_sub( thread_jr, jr_iter, 1, FALSE, &jr_start, &jr_end );
+
+				// Loop over the n dimension (NR columns at a time).
+				for ( dim_t j = jr_start; j < jr_end; j += 1 )
+				{
+					const dim_t nr_cur
+					= ( bli_is_not_edge_f( j, jr_iter, jr_left ) ? NR : jr_left );
+
+					// The (absolute) index of the first column of the
+					// microtile.
+					const dim_t jt = jj + j * NR;
+
+					char* restrict b_jr = b_pc_use + j * ps_b_use;
+
+					// Assume for now that our next panel of B to be the
+					// current panel of B.
+					char* restrict b2 = b_jr;
+
+					// Query the number of threads and thread ids for the IR
+					// loop.
+					const dim_t ir_nt  = bli_thrinfo_n_way( thread_ir );
+					const dim_t ir_tid = bli_thrinfo_work_id( thread_ir );
+
+					// Compute number of primary and leftover components of
+					// the IR loop.
+					const dim_t ir_iter = ( mc_cur + MR - 1 ) / MR;
+					const dim_t ir_left =   mc_cur % MR;
+
+					// Compute the IR loop thread range for the current thread.
+					dim_t ir_start, ir_end;
+					bli_thread_range_sub( thread_ir, ir_iter, 1, FALSE, &ir_start, &ir_end );
+
+					// Loop over the m dimension (MR rows at a time).
+					for ( dim_t i = ir_start; i < ir_end; i += 1 )
+					{
+						const dim_t mr_cur
+						= ( bli_is_not_edge_f( i, ir_iter, ir_left ) ? MR : ir_left );
+
+						// The (absolute) index of the first row of the
+						// microtile.
+						const dim_t it = ii + i * MR;
+
+						char* restrict a_ir = a_ic_use + i * ps_a_use;
+
+						// Compute the addresses of the next micropanels of A
+						// and B.
+						char* restrict a2 = a_ir + ps_a_use;
+						if ( bli_is_last_iter_slrr( i, ir_end, ir_tid, ir_nt ) )
+						{
+							a2 = a_ic_use;
+							b2 = b_jr + ps_b_use;
+							if ( bli_is_last_iter_slrr( j, jr_end, jr_tid, jr_nt ) )
+								b2 = b_pc_use;
+						}
+
+						// Save the addresses of next micropanels of A and B to
+						// the auxinfo_t object.
+						bli_auxinfo_set_next_a( a2, &aux );
+						bli_auxinfo_set_next_b( b2, &aux );
+
+						// Choose the int32 microtile to update: the
+						// corresponding microtile of C (or of the
+						// workspace), if present, or the local buffer.
+						int32_t*       c_ir;
+						inc_t          rs_ct, cs_ct;
+						const int32_t* beta_ir;
+
+						if ( c_00 != NULL )
+						{
+							c_ir    = c_00 + it * rs_c + jt * cs_c;
+							rs_ct   = rs_c;
+							cs_ct   = cs_c;
+							beta_ir = beta_use;
+						}
+						else
+						{
+							c_ir    = ct;
+							rs_ct   = NR;
+							cs_ct   = 1;
+							beta_ir = &zero_local;
+						}
+
+						// Invoke the integer gemm microkernel.
+						gemm_ukr
+						(
+						  mr_cur,
+						  nr_cur,
+						  kc_cur,
+						  &alpha_local,
+						  a_ir,
+						  b_jr,
+						  beta_ir,
+						  c_ir, rs_ct, cs_ct,
+						  &aux,
+						  cntx
+						);
+
+						// Requantize the finished microtile, if requested.
+						if ( rq != NULL && is_last )
+						{
+							bli_igemm_rq_apply
+							(
+							  mr_cur,
+							  nr_cur,
+							  jt,
+							  c_ir, rs_ct, cs_ct,
+							  rq,
+							  q_00 + it * rs_q + jt * cs_q, rs_q, cs_q
+							);
+						}
+					}
+				}
+			}
+
+			// This barrier is needed to prevent threads from starting to pack
+			// the next row panel of B before the current row panel is fully
+			// computed upon.
+			bli_thrinfo_barrier( thread_pb );
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+//
+// Requantize an m x n int32 matrix C into an int8 matrix Q, where j_off is
+// the column index (within the full output matrix) of the first column of C,
+// which is used to index the per-channel scale and bias.
+//
+
+void bli_igemm_rq_apply
+     (
+             dim_t    m,
+             dim_t    n,
+             dim_t    j_off,
+       const int32_t* c, inc_t rs_c, inc_t cs_c,
+       const rqnt_t*  rq,
+             int8_t*  q, inc_t rs_q, inc_t cs_q
+     )
+{
+	const float lo = ( float )bli_max( rq->clip_min, INT8_MIN );
+	const float hi = ( float )bli_min( rq->clip_max, INT8_MAX );
+	const float zp = ( float )rq->zero_point;
+
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		const float   scale = rq->scale[ ( j_off + j ) * rq->inc_scale ];
+		const int32_t bias  = ( rq->bias != NULL ? rq->bias[ j_off + j ] : 0 );
+
+		const int32_t* restrict cj = c + j*cs_c;
+		      int8_t*  restrict qj = q + j*cs_q;
+
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			// Round (ties to even) and shift by the zero point in float so
+			// that the clamp also guards against values beyond the int32
+			// range. The bias is added in 64 bits to avoid overflow.
+			float v = nearbyintf( ( float )( ( int64_t )cj[ i*rs_c ] + bias ) * scale ) + zp;
+
+			v = bli_min( bli_max( v, lo ), hi );
+
+			qj[ i*rs_q ] = ( int8_t )v;
+		}
+	}
+}
+
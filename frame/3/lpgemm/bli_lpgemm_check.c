@@ -4,7 +4,7 @@
    An object-based framework for developing high-performance BLAS-like
    libraries.
 
-   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2022, The University of Texas at Austin
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -34,40 +34,59 @@
 
 #include "blis.h"
 
-void bao_gemmd_check
+void bli_lpgemm_check
      (
-       obj_t*  alpha,
-       obj_t*  a,
-       obj_t*  d,
-       obj_t*  b,
-       obj_t*  beta,
-       obj_t*  c,
-       cntx_t* cntx
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx
      )
 {
 	err_t e_val;
 
-	// Check object datatypes.
+	( void )cntx;
 
-	e_val = bli_check_noninteger_object( alpha );
+	// Check object datatypes. A and B must share a half-precision storage
+	// datatype, while C may be stored in float or in the datatype of A and B.
+	// The scalars are interpreted in float, so they may be any non-integer,
+	// non-half datatype (including constants).
+
+	e_val = bli_check_half_object( a );
 	bli_check_error_code( e_val );
 
-	e_val = bli_check_noninteger_object( beta );
+	e_val = bli_check_half_object( b );
 	bli_check_error_code( e_val );
 
-	e_val = bli_check_floating_object( a );
+	e_val = bli_check_consistent_object_datatypes( a, b );
 	bli_check_error_code( e_val );
 
-	e_val = bli_check_floating_object( d );
+	e_val = bli_check_nonconstant_object( c );
 	bli_check_error_code( e_val );
 
-	e_val = bli_check_floating_object( b );
+	if ( !bli_obj_is_float( c ) )
+	{
+		e_val = bli_check_consistent_object_datatypes( a, c );
+		bli_check_error_code( e_val );
+	}
+
+	e_val = bli_check_noninteger_object( alpha );
 	bli_check_error_code( e_val );
 
-	e_val = bli_check_floating_object( c );
+	e_val = bli_check_noninteger_object( beta );
 	bli_check_error_code( e_val );
 
-	// Check scalar/vector/matrix type.
+	if ( bli_obj_is_half( alpha ) || bli_obj_is_half( beta ) )
+		bli_check_error_code( BLIS_INVALID_DATATYPE );
+
+	e_val = bli_check_real_valued_object( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_real_valued_object( beta );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions.
 
 	e_val = bli_check_scalar_object( alpha );
 	bli_check_error_code( e_val );
@@ -78,54 +97,41 @@ void bao_gemmd_check
 	e_val = bli_check_matrix_object( a );
 	bli_check_error_code( e_val );
 
-	e_val = bli_check_vector_object( d );
-	bli_check_error_code( e_val );
-
 	e_val = bli_check_matrix_object( b );
 	bli_check_error_code( e_val );
 
 	e_val = bli_check_matrix_object( c );
 	bli_check_error_code( e_val );
 
-	// Check object buffers (for non-NULLness).
-
-	e_val = bli_check_object_buffer( alpha );
-	bli_check_error_code( e_val );
-
-	e_val = bli_check_object_buffer( a );
+	e_val = bli_check_level3_dims( a, b, c );
 	bli_check_error_code( e_val );
 
-	e_val = bli_check_object_buffer( d );
-	bli_check_error_code( e_val );
+	// Check object structure.
 
-	e_val = bli_check_object_buffer( b );
+	e_val = bli_check_general_object( a );
 	bli_check_error_code( e_val );
 
-	e_val = bli_check_object_buffer( beta );
+	e_val = bli_check_general_object( b );
 	bli_check_error_code( e_val );
 
-	e_val = bli_check_object_buffer( c );
+	e_val = bli_check_general_object( c );
 	bli_check_error_code( e_val );
 
-	// Check object dimensions.
+	// Check object buffers (for non-NULLness).
 
-	e_val = bli_check_level3_dims( a, b, c );
+	e_val = bli_check_object_buffer( alpha );
 	bli_check_error_code( e_val );
 
-	e_val = bli_check_vector_dim_equals( d, bli_obj_width_after_trans( a ) );
+	e_val = bli_check_object_buffer( beta );
 	bli_check_error_code( e_val );
 
-	// Check for consistent datatypes.
-	// NOTE: We only perform these tests when mixed datatype support is
-	// disabled.
-
-	e_val = bli_check_consistent_object_datatypes( c, a );
+	e_val = bli_check_object_buffer( a );
 	bli_check_error_code( e_val );
 
-	e_val = bli_check_consistent_object_datatypes( c, d );
+	e_val = bli_check_object_buffer( b );
 	bli_check_error_code( e_val );
 
-	e_val = bli_check_consistent_object_datatypes( c, b );
+	e_val = bli_check_object_buffer( c );
 	bli_check_error_code( e_val );
 }
 
@@ -0,0 +1,324 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// The low-precision gemm implementation computes C := beta * C + alpha * A * B
+// where A and B are stored in a half-precision datatype (bfloat16 or float16).
+// All arithmetic takes place in float: A and B are widened to float as they
+// are packed, after which the conventional float gemm microkernel is used.
+// C may be stored in float or in the half-precision datatype of A and B; in
+// the latter case, the product is accumulated into a float workspace that is
+// narrowed into C once the computation is complete, so that C is rounded
+// only once regardless of the size of the k dimension.
+//
+
+static void bli_lpgemm_castm
+     (
+       const obj_t* a,
+       const obj_t* b
+     );
+
+static void bli_lpgemm_front_s
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     );
+
+void bli_lpgemm_front
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_lpgemm_check( alpha, a, b, beta, c, cntx );
+
+	// If C has a zero dimension, return early.
+	if ( bli_obj_has_zero_dim( c ) ) return;
+
+	// Create local copies of the scalars, typecast to float.
+	obj_t alpha_local;
+	obj_t beta_local;
+
+	bli_obj_scalar_init_detached_copy_of( BLIS_FLOAT, BLIS_NO_CONJUGATE,
+	                                      alpha, &alpha_local );
+	bli_obj_scalar_init_detached_copy_of( BLIS_FLOAT, BLIS_NO_CONJUGATE,
+	                                      beta, &beta_local );
+
+	if ( bli_obj_is_float( c ) )
+	{
+		bli_lpgemm_front_s( &alpha_local, a, b, &beta_local, c, cntx, rntm );
+		return;
+	}
+
+	// If C is stored in half precision, compute into a float workspace with
+	// the same storage format as C.
+	const dim_t m = bli_obj_length( c );
+	const dim_t n = bli_obj_width( c );
+	obj_t       c_s;
+
+	if ( bli_obj_is_row_stored( c ) )
+		bli_obj_create( BLIS_FLOAT, m, n, n, 1, &c_s );
+	else
+		bli_obj_create( BLIS_FLOAT, m, n, 1, m, &c_s );
+
+	// Only read C if beta is non-zero, so that C may contain NaN or Inf on
+	// entry when beta is zero (in keeping with the BLAS convention).
+	if ( !bli_obj_equals( &beta_local, &BLIS_ZERO ) )
+		bli_lpgemm_castm( c, &c_s );
+
+	bli_lpgemm_front_s( &alpha_local, a, b, &beta_local, &c_s, cntx, rntm );
+
+	// Narrow the result into C.
+	bli_lpgemm_castm( &c_s, c );
+
+	bli_obj_free( &c_s );
+}
+
+static void bli_lpgemm_front_s
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+       const rntm_t* rntm
+     )
+{
+	obj_t a_local;
+	obj_t b_local;
+	obj_t c_local;
+
+	// If alpha is zero, or if A or B has a zero dimension, scale C by beta
+	// and return early.
+	if ( bli_obj_equals( alpha, &BLIS_ZERO ) ||
+	     bli_obj_has_zero_dim( a ) ||
+	     bli_obj_has_zero_dim( b ) )
+	{
+		bli_scalm( beta, c );
+		return;
+	}
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); }
+	else                { rntm_l = *rntm;                       }
+
+	// A and B must always be packed since packing is where they are widened
+	// to float. Setting these fields also prevents bli_l3_sup_thrinfo_create()
+	// from assuming a sup-style (unpacked) execution.
+	bli_rntm_set_pack_a( TRUE, &rntm_l );
+	bli_rntm_set_pack_b( TRUE, &rntm_l );
+
+	// Alias A, B, and C in case we need to apply transformations.
+	bli_obj_alias_to( a, &a_local );
+	bli_obj_alias_to( b, &b_local );
+	bli_obj_alias_to( c, &c_local );
+
+	// Induce transpositions of A and B if they have their transposition
+	// properties set. Then clear the transposition bits in the objects.
+	if ( bli_obj_has_trans( &a_local ) )
+	{
+		bli_obj_induce_trans( &a_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &a_local );
+	}
+
+	if ( bli_obj_has_trans( &b_local ) )
+	{
+		bli_obj_induce_trans( &b_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &b_local );
+	}
+
+	// An optimization: If C is stored by rows and the float microkernel
+	// prefers contiguous columns, or if C is stored by columns and the
+	// microkernel prefers contiguous rows, transpose the entire operation to
+	// allow the microkernel to access elements of C in its preferred manner.
+	if ( bli_cntx_dislikes_storage_of( &c_local, BLIS_GEMM_VIR_UKR, cntx ) )
+	{
+		bli_obj_swap( &a_local, &b_local );
+
+		bli_obj_induce_trans( &a_local );
+		bli_obj_induce_trans( &b_local );
+		bli_obj_induce_trans( &c_local );
+	}
+
+	// Parse and interpret the contents of the rntm_t object to properly
+	// set the ways of parallelism for each loop.
+	bli_rntm_set_ways_for_op
+	(
+	  BLIS_GEMM,
+	  BLIS_LEFT, // ignored for gemm/hemm/symm
+	  bli_obj_length( &c_local ),
+	  bli_obj_width( &c_local ),
+	  bli_obj_width( &a_local ),
+	  &rntm_l
+	);
+
+	// Spawn threads (if applicable), where bli_lpgemm_int() is the thread
+	// entry point function for each thread. The sup thread decorator builds
+	// the full jc/pc/ic/jr/ir thrinfo_t tree needed by the block-panel
+	// variant.
+	bli_l3_sup_thread_decorator
+	(
+	  bli_lpgemm_int,
+	  BLIS_GEMM, // operation family id
+	  alpha,
+	  &a_local,
+	  &b_local,
+	  beta,
+	  &c_local,
+	  cntx,
+	  &rntm_l
+	);
+}
+
+err_t bli_lpgemm_int
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+       const rntm_t*    rntm,
+             thrinfo_t* thread
+     )
+{
+	( void )rntm;
+
+	bli_lpgemm_bp_var1
+	(
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  cntx,
+	  thread
+	);
+
+	return BLIS_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+
+// Copy a matrix between float and a half-precision datatype, converting each
+// element along the way. Exactly one of the two operands is stored in float.
+
+#undef  GENTFUNCH
+#define GENTFUNCH( ctype_h, ch, tofloat, fromfloat ) \
+\
+static void PASTEMAC(ch,lpgemm_castm) \
+     ( \
+       bool  to_half, \
+       dim_t m, \
+       dim_t n, \
+       void* h, inc_t rs_h, inc_t cs_h, \
+       void* s, inc_t rs_s, inc_t cs_s  \
+     ) \
+{ \
+	ctype_h* restrict h_cast = h; \
+	float*   restrict s_cast = s; \
+\
+	/* Traverse the matrices along their (shared) contiguous dimension, if
+	   possible. */ \
+	if ( bli_abs( rs_h ) < bli_abs( cs_h ) ) \
+	{ \
+		bli_swap_dims( &m, &n ); \
+		bli_swap_incs( &rs_h, &cs_h ); \
+		bli_swap_incs( &rs_s, &cs_s ); \
+	} \
+\
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		ctype_h* restrict hi = h_cast + i*rs_h; \
+		float*   restrict si = s_cast + i*rs_s; \
+\
+		if ( to_half ) \
+			for ( dim_t j = 0; j < n; ++j ) hi[ j*cs_h ] = fromfloat( si[ j*cs_s ] ); \
+		else \
+			for ( dim_t j = 0; j < n; ++j ) si[ j*cs_s ] = tofloat( hi[ j*cs_h ] ); \
+	} \
+}
+
+GENTFUNCH( bfloat16, b, bli_bf16_to_float, bli_float_to_bf16 )
+GENTFUNCH( float16,  h, bli_f16_to_float,  bli_float_to_f16 )
+
+static void bli_lpgemm_castm
+     (
+       const obj_t* a,
+       const obj_t* b
+     )
+{
+	const bool   to_half = bli_obj_is_float( a );
+	const obj_t* h       = ( to_half ? b : a );
+	const obj_t* s       = ( to_half ? a : b );
+
+	const dim_t  m       = bli_obj_length( h );
+	const dim_t  n       = bli_obj_width( h );
+
+	void*        buf_h   = bli_obj_buffer_at_off( h );
+	const inc_t  rs_h    = bli_obj_row_stride( h );
+	const inc_t  cs_h    = bli_obj_col_stride( h );
+
+	void*        buf_s   = bli_obj_buffer_at_off( s );
+	const inc_t  rs_s    = bli_obj_row_stride( s );
+	const inc_t  cs_s    = bli_obj_col_stride( s );
+
+	if ( bli_obj_is_bfloat16( h ) )
+		bli_blpgemm_castm( to_half, m, n, buf_h, rs_h, cs_h, buf_s, rs_s, cs_s );
+	else
+		bli_hlpgemm_castm( to_half, m, n, buf_h, rs_h, cs_h, buf_s, rs_s, cs_s );
+}
+
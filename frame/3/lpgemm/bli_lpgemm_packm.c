@@ -0,0 +1,162 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Pack an mn x k half-precision matrix (whose elements are separated by
+// inca along the mn dimension and by lda along the k dimension) into
+// contiguous float micropanels of width mnr, each stored with a leading
+// dimension of packmnr. The element widening is performed by the packm
+// kernel identified by ker_id, which is queried for BLIS_FLOAT since the
+// packed micropanels are always stored in float.
+//
+// The packing buffer is acquired from the pba by the chief thread and
+// cached in the thrinfo_t node, where it persists across calls.
+//
+
+void bli_lpgemm_packm
+     (
+             packbuf_t  pack_buf_type,
+             ukr_t      ker_id,
+             dim_t      mn_alloc,
+             dim_t      k_alloc,
+             dim_t      mn,
+             dim_t      k,
+             dim_t      mnr,
+             dim_t      packmnr,
+       const void*      a, inc_t inca, inc_t lda,
+             float**    p, inc_t* ps_p,
+       const cntx_t*    cntx,
+             thrinfo_t* thread
+     )
+{
+	// Barrier to make sure all threads are caught up and ready to begin the
+	// packm stage.
+	bli_thrinfo_barrier( thread );
+
+	const double t_trace = bli_trace_pack_begin();
+
+	// Compute the size of the memory block needed. We size the block for
+	// the largest problem the caller expects to pack (mn_alloc x k_alloc)
+	// so that it need not be re-acquired for edge cases.
+	const dim_t n_iter_alloc = ( mn_alloc + mnr - 1 ) / mnr;
+	const siz_t size_needed  = sizeof( float ) * n_iter_alloc * packmnr * k_alloc;
+
+	mem_t* mem = bli_thrinfo_mem( thread );
+
+	// Acquire a block from the pba if the cached block is absent or too small.
+	if ( bli_mem_is_unalloc( mem ) || bli_mem_size( mem ) < size_needed )
+	{
+		if ( bli_thrinfo_am_chief( thread ) )
+		{
+			// The acquisition must go directly to the chief thread's mem_t
+			// (rather than to a temporary) since there is no barrier until
+			// after packing is finished.
+			if ( bli_mem_is_alloc( mem ) )
+				bli_pba_release( bli_thrinfo_pba( thread ), mem );
+
+			bli_pba_acquire_m
+			(
+			  bli_thrinfo_pba( thread ),
+			  size_needed,
+			  pack_buf_type,
+			  mem
+			);
+		}
+
+		// Broadcast the address of the chief thread's mem_t to all threads,
+		// and copy its contents into the other threads' mem_t.
+		mem_t* mem_p = bli_thrinfo_broadcast( thread, mem );
+
+		if ( !bli_thrinfo_am_chief( thread ) ) *mem = *mem_p;
+	}
+
+	float* restrict p_begin = bli_mem_buffer( mem );
+	const inc_t     ps      = packmnr * k;
+
+	*p    = p_begin;
+	*ps_p = ps;
+
+	// Query the packm kernel that widens each micropanel.
+	packm_cxk_ker_ft f = bli_cntx_get_ukr_dt( BLIS_FLOAT, ker_id, cntx );
+
+	const float* restrict one = bli_s1;
+
+	// Compute the total number of micropanels and partition them among the
+	// threads in the packm thrinfo_t node.
+	thrinfo_t*  thread_p = bli_thrinfo_sub_prenode( thread );
+	const dim_t n_iter   = ( mn + mnr - 1 ) / mnr;
+	const dim_t nt       = bli_thrinfo_n_way( thread_p );
+	const dim_t tid      = bli_thrinfo_work_id( thread_p );
+
+	( void )nt;
+	( void )tid;
+
+	dim_t it_start, it_end, it_inc;
+	bli_thread_range_slrr( thread_p, n_iter, 1, FALSE, &it_start, &it_end, &it_inc );
+
+	const char* restrict a_cast = a;
+
+	for ( dim_t it = 0; it < n_iter; ++it )
+	{
+		if ( bli_is_my_iter( it, it_start, it_end, tid, nt ) )
+		{
+			const dim_t mn_cur = bli_min( mnr, mn - it*mnr );
+
+			// Both half-precision storage datatypes are two bytes wide.
+			const void* a_use = a_cast + it*mnr*inca*( inc_t )sizeof( bfloat16 );
+			      float* p_use = p_begin + it*ps;
+
+			f
+			(
+			  BLIS_NO_CONJUGATE,
+			  BLIS_PACKED_ROW_PANELS,
+			  mn_cur,
+			  k,
+			  k,
+			  one,
+			  a_use, inca, lda,
+			  p_use,       packmnr,
+			  cntx
+			);
+		}
+	}
+
+	bli_trace_pack_end( t_trace );
+
+	// Barrier so that packing is done before computation.
+	bli_thrinfo_barrier( thread );
+}
+
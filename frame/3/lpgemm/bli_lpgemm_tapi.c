@@ -0,0 +1,135 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Define BLAS-like interfaces with typed operands (basic and expert).
+//
+
+#undef  GENTFUNCH
+#define GENTFUNCH( ctype_ab, ctype_c, chc, chab, opname ) \
+\
+void PASTEMAC2(chc,chab,opname) \
+     ( \
+             trans_t   transa, \
+             trans_t   transb, \
+             dim_t     m, \
+             dim_t     n, \
+             dim_t     k, \
+       const float*    alpha, \
+       const ctype_ab* a, inc_t rs_a, inc_t cs_a, \
+       const ctype_ab* b, inc_t rs_b, inc_t cs_b, \
+       const float*    beta, \
+             ctype_c*  c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	/* Invoke the expert interface and request default cntx_t and rntm_t
+	   objects. */ \
+	PASTEMAC3(chc,chab,opname,BLIS_TAPI_EX_SUF) \
+	( \
+	  transa, \
+	  transb, \
+	  m, n, k, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  b, rs_b, cs_b, \
+	  beta, \
+	  c, rs_c, cs_c, \
+	  NULL, \
+	  NULL  \
+	); \
+} \
+\
+void PASTEMAC3(chc,chab,opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             trans_t   transa, \
+             trans_t   transb, \
+             dim_t     m, \
+             dim_t     n, \
+             dim_t     k, \
+       const float*    alpha, \
+       const ctype_ab* a, inc_t rs_a, inc_t cs_a, \
+       const ctype_ab* b, inc_t rs_b, inc_t cs_b, \
+       const float*    beta, \
+             ctype_c*  c, inc_t rs_c, inc_t cs_c, \
+       const cntx_t*   cntx, \
+       const rntm_t*   rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	const num_t dt_ab = PASTEMAC(chab,type); \
+	const num_t dt_c  = PASTEMAC(chc,type); \
+\
+	obj_t       alphao, ao, bo, betao, co; \
+\
+	dim_t       m_a, n_a; \
+	dim_t       m_b, n_b; \
+\
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a ); \
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b ); \
+\
+	/* NOTE: We use the full object creation functions here (rather than
+	   bli_obj_init_finish()) since they query the element size of the
+	   half-precision datatypes. */ \
+	bli_obj_create_1x1_with_attached_buffer( BLIS_FLOAT, ( float* )alpha, &alphao ); \
+	bli_obj_create_1x1_with_attached_buffer( BLIS_FLOAT, ( float* )beta,  &betao  ); \
+\
+	bli_obj_create_with_attached_buffer( dt_ab, m_a, n_a, ( ctype_ab* )a, rs_a, cs_a, &ao ); \
+	bli_obj_create_with_attached_buffer( dt_ab, m_b, n_b, ( ctype_ab* )b, rs_b, cs_b, &bo ); \
+	bli_obj_create_with_attached_buffer( dt_c,  m,   n,                 c, rs_c, cs_c, &co ); \
+\
+	bli_obj_set_conjtrans( transa, &ao ); \
+	bli_obj_set_conjtrans( transb, &bo ); \
+\
+	bli_lpgemm_front \
+	( \
+	  &alphao, \
+	  &ao, \
+	  &bo, \
+	  &betao, \
+	  &co, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+#ifndef BLIS_ENABLE_SANDBOX
+GENTFUNCH( bfloat16, float,    s, b, gemm )
+GENTFUNCH( float16,  float,    s, h, gemm )
+#endif
+GENTFUNCH( bfloat16, bfloat16, b, b, gemm )
+GENTFUNCH( float16,  float16,  h, h, gemm )
+
@@ -0,0 +1,87 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// Prototype BLAS-like interfaces with typed operands (basic and expert).
+//
+// The first character of the operation name encodes the storage datatype of
+// C and the second encodes the storage datatype of A and B:
+//
+//   s: float, b: bfloat16, h: float16
+//
+// Computation always takes place in float, so alpha and beta are float.
+//
+
+#undef  GENTPROTH
+#define GENTPROTH( ctype_ab, ctype_c, chc, chab, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC2(chc,chab,opname) \
+     ( \
+             trans_t   transa, \
+             trans_t   transb, \
+             dim_t     m, \
+             dim_t     n, \
+             dim_t     k, \
+       const float*    alpha, \
+       const ctype_ab* a, inc_t rs_a, inc_t cs_a, \
+       const ctype_ab* b, inc_t rs_b, inc_t cs_b, \
+       const float*    beta, \
+             ctype_c*  c, inc_t rs_c, inc_t cs_c  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC3(chc,chab,opname,BLIS_TAPI_EX_SUF) \
+     ( \
+             trans_t   transa, \
+             trans_t   transb, \
+             dim_t     m, \
+             dim_t     n, \
+             dim_t     k, \
+       const float*    alpha, \
+       const ctype_ab* a, inc_t rs_a, inc_t cs_a, \
+       const ctype_ab* b, inc_t rs_b, inc_t cs_b, \
+       const float*    beta, \
+             ctype_c*  c, inc_t rs_c, inc_t cs_c, \
+       const cntx_t*   cntx, \
+       const rntm_t*   rntm  \
+     );
+
+// NOTE: The POWER10 sandbox provides its own bli_sbgemm() and bli_shgemm(),
+// so we forgo prototyping (and defining) them when a sandbox is enabled.
+#ifndef BLIS_ENABLE_SANDBOX
+GENTPROTH( bfloat16, float,    s, b, gemm )
+GENTPROTH( float16,  float,    s, h, gemm )
+#endif
+GENTPROTH( bfloat16, bfloat16, b, b, gemm )
+GENTPROTH( float16,  float16,  h, h, gemm )
+
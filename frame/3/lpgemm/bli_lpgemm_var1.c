@@ -0,0 +1,300 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// The low-precision gemm block-panel algorithm. This variant mirrors the
+// conventional five-loop gemm algorithm, except that A and B are read in a
+// half-precision storage datatype and widened to float during packing,
+// after which the float gemm microkernel (and the float cache and register
+// blocksizes) are used. C is always stored in float here; see
+// bli_lpgemm_front() for how half-precision output is handled.
+//
+
+void bli_lpgemm_bp_var1
+     (
+       const obj_t*     alpha,
+       const obj_t*     a,
+       const obj_t*     b,
+       const obj_t*     beta,
+       const obj_t*     c,
+       const cntx_t*    cntx,
+             thrinfo_t* thread
+     )
+{
+	const num_t dt     = BLIS_FLOAT;
+	const num_t dt_ab  = bli_obj_dt( a );
+
+	const dim_t m      = bli_obj_length( c );
+	const dim_t n      = bli_obj_width( c );
+	const dim_t k      = bli_obj_width( a );
+
+	// Both half-precision storage datatypes are two bytes wide, so we use
+	// byte-offset arithmetic on the A and B buffers.
+	const siz_t dt_ab_size = bli_dt_size( dt_ab );
+
+	const char* restrict a_00 = bli_obj_buffer_at_off( a );
+	const inc_t          rs_a = bli_obj_row_stride( a );
+	const inc_t          cs_a = bli_obj_col_stride( a );
+
+	const char* restrict b_00 = bli_obj_buffer_at_off( b );
+	const inc_t          rs_b = bli_obj_row_stride( b );
+	const inc_t          cs_b = bli_obj_col_stride( b );
+
+	float*      restrict c_00 = bli_obj_buffer_at_off( c );
+	const inc_t          rs_c = bli_obj_row_stride( c );
+	const inc_t          cs_c = bli_obj_col_stride( c );
+
+	// Make local copies of the scalars to prevent any unnecessary sharing of
+	// cache lines between the cores' caches.
+	const float alpha_local = *( float* )bli_obj_buffer_for_1x1( dt, alpha );
+	const float beta_local  = *( float* )bli_obj_buffer_for_1x1( dt, beta );
+	const float one_local   = 1.0F;
+
+	// Choose the packm kernels that widen the current storage datatype.
+	const ukr_t packa_id = ( bli_is_bfloat16( dt_ab ) ? BLIS_PACKM_MRXK_BF16_KER
+	                                                  : BLIS_PACKM_MRXK_F16_KER );
+	const ukr_t packb_id = ( bli_is_bfloat16( dt_ab ) ? BLIS_PACKM_NRXK_BF16_KER
+	                                                  : BLIS_PACKM_NRXK_F16_KER );
+
+	// Query the context for various blocksizes.
+	const dim_t NR     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t MR     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t NC     = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx );
+	const dim_t MC     = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx );
+	const dim_t KC     = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx );
+	const dim_t PACKNR = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx );
+	const dim_t PACKMR = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx );
+
+	// Query the context for the float microkernel.
+	gemm_ukr_ft gemm_ukr = bli_cntx_get_ukr_dt( dt, BLIS_GEMM_UKR, cntx );
+
+	// Compute partitioning step values for each matrix of each loop.
+	const inc_t jcstep_c = cs_c;
+	const inc_t jcstep_b = cs_b * dt_ab_size;
+
+	const inc_t pcstep_a = cs_a * dt_ab_size;
+	const inc_t pcstep_b = rs_b * dt_ab_size;
+
+	const inc_t icstep_c = rs_c;
+	const inc_t icstep_a = rs_a * dt_ab_size;
+
+	const inc_t jrstep_c = cs_c * NR;
+	const inc_t irstep_c = rs_c * MR;
+
+	// Save the pack schemas, imaginary strides, and microkernel address to
+	// the auxinfo_t object.
+	auxinfo_t aux;
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux );
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux );
+	bli_auxinfo_set_is_a( 1, &aux );
+	bli_auxinfo_set_is_b( 1, &aux );
+	bli_auxinfo_set_ukr( ( void_fp )gemm_ukr, &aux );
+	bli_auxinfo_set_params( NULL, &aux );
+
+	thrinfo_t* restrict thread_jc = bli_thrinfo_sub_node( thread );
+	thrinfo_t* restrict thread_pc = bli_thrinfo_sub_node( thread_jc );
+	thrinfo_t* restrict thread_pb = bli_thrinfo_sub_node( thread_pc );
+	thrinfo_t* restrict thread_ic = bli_thrinfo_sub_node( thread_pb );
+	thrinfo_t* restrict thread_pa = bli_thrinfo_sub_node( thread_ic );
+	thrinfo_t* restrict thread_jr = bli_thrinfo_sub_node( thread_pa );
+	thrinfo_t* restrict thread_ir = bli_thrinfo_sub_node( thread_jr );
+
+	// Compute the JC loop thread range for the current thread.
+	dim_t jc_start, jc_end;
+	bli_thread_range_sub( thread_jc, n, NR, FALSE, &jc_start, &jc_end );
+
+	// Loop over the n dimension (NC columns at a time).
+	for ( dim_t jj = jc_start; jj < jc_end; jj += NC )
+	{
+		const dim_t nc_cur = bli_min( NC, jc_end - jj );
+
+		const char*  restrict b_jc = b_00 + jj * jcstep_b;
+		      float* restrict c_jc = c_00 + jj * jcstep_c;
+
+		// Loop over the k dimension (KC rows/columns at a time).
+		for ( dim_t pp = 0; pp < k; pp += KC )
+		{
+			const dim_t kc_cur = bli_min( KC, k - pp );
+
+			const char* restrict a_pc = a_00 + pp * pcstep_a;
+			const char* restrict b_pc = b_jc + pp * pcstep_b;
+
+			// Only apply beta to the first iteration of the pc loop.
+			const float* restrict beta_use = ( pp == 0 ? &beta_local : &one_local );
+
+			float* b_use;
+			inc_t  ps_b_use;
+
+			// Pack (and widen) the current KC x NC row panel of B into
+			// row-stored column micropanels.
+			bli_lpgemm_packm
+			(
+			  BLIS_BUFFER_FOR_B_PANEL,
+			  packb_id,
+			  NC, KC,
+			  nc_cur, kc_cur,
+			  NR, PACKNR,
+			  b_pc, cs_b, rs_b,
+			  &b_use, &ps_b_use,
+			  cntx,
+			  thread_pb
+			);
+
+			float* restrict b_pc_use = b_use;
+
+			// Compute the IC loop thread range for the current thread.
+			dim_t ic_start, ic_end;
+			bli_thread_range_sub( thread_ic, m, MR, FALSE, &ic_start, &ic_end );
+
+			// Loop over the m dimension (MC rows at a time).
+			for ( dim_t ii = ic_start; ii < ic_end; ii += MC )
+			{
+				const dim_t mc_cur = bli_min( MC, ic_end - ii );
+
+				const char*  restrict a_ic = a_pc + ii * icstep_a;
+				      float* restrict c_ic = c_jc + ii * icstep_c;
+
+				float* a_use;
+				inc_t  ps_a_use;
+
+				// Pack (and widen) the current MC x KC block of A into
+				// column-stored row micropanels.
+				bli_lpgemm_packm
+				(
+				  BLIS_BUFFER_FOR_A_BLOCK,
+				  packa_id,
+				  MC, KC,
+				  mc_cur, kc_cur,
+				  MR, PACKMR,
+				  a_ic, rs_a, cs_a,
+				  &a_use, &ps_a_use,
+				  cntx,
+				  thread_pa
+				);
+
+				float* restrict a_ic_use = a_use;
+
+				// Query the number of threads and thread ids for the JR loop.
+				const dim_t jr_nt  = bli_thrinfo_n_way( thread_jr );
+				const dim_t jr_tid = bli_thrinfo_work_id( thread_jr );
+
+				// Compute number of primary and leftover components of the
+				// JR loop.
+				const dim_t jr_iter = ( nc_cur + NR - 1 ) / NR;
+				const dim_t jr_left =   nc_cur % NR;
+
+				// Compute the JR loop thread range for the current thread.
+				dim_t jr_start, jr_end;
+				bli_thread_range_sub( thread_jr, jr_iter, 1, FALSE, &jr_start, &jr_end );
+
+				// Loop over the n dimension (NR columns at a time).
+				for ( dim_t j = jr_start; j < jr_end; j += 1 )
+				{
+					const dim_t nr_cur
+					= ( bli_is_not_edge_f( j, jr_iter, jr_left ) ? NR : jr_left );
+
+					float* restrict b_jr = b_pc_use + j * ps_b_use;
+					float* restrict c_jr = c_ic     + j * jrstep_c;
+
+					// Assume for now that our next panel of B to be the
+					// current panel of B.
+					float* restrict b2 = b_jr;
+
+					// Query the number of threads and thread ids for the IR
+					// loop.
+					const dim_t ir_nt  = bli_thrinfo_n_way( thread_ir );
+					const dim_t ir_tid = bli_thrinfo_work_id( thread_ir );
+
+					// Compute number of primary and leftover components of
+					// the IR loop.
+					const dim_t ir_iter = ( mc_cur + MR - 1 ) / MR;
+					const dim_t ir_left =   mc_cur % MR;
+
+					// Compute the IR loop thread range for the current thread.
+					dim_t ir_start, ir_end;
+					bli_thread_range_sub( thread_ir, ir_iter, 1, FALSE, &ir_start, &ir_end );
+
+					// Loop over the m dimension (MR rows at a time).
+					for ( dim_t i = ir_start; i < ir_end; i += 1 )
+					{
+						const dim_t mr_cur
+						= ( bli_is_not_edge_f( i, ir_iter, ir_left ) ? MR : ir_left );
+
+						float* restrict a_ir = a_ic_use + i * ps_a_use;
+						float* restrict c_ir = c_jr     + i * irstep_c;
+
+						// Compute the addresses of the next micropanels of A
+						// and B.
+						float* restrict a2 = bli_gemm_get_next_a_upanel( a_ir, ps_a_use, 1 );
+						if ( bli_is_last_iter_slrr( i, ir_end, ir_tid, ir_nt ) )
+						{
+							a2 = a_ic_use;
+							b2 = bli_gemm_get_next_b_upanel( b_jr, ps_b_use, 1 );
+							if ( bli_is_last_iter_slrr( j, jr_end, jr_tid, jr_nt ) )
+								b2 = b_pc_use;
+						}
+
+						// Save the addresses of next micropanels of A and B to
+						// the auxinfo_t object.
+						bli_auxinfo_set_next_a( a2, &aux );
+						bli_auxinfo_set_next_b( b2, &aux );
+
+						// Invoke the float gemm microkernel.
+						gemm_ukr
+						(
+						  mr_cur,
+						  nr_cur,
+						  kc_cur,
+						  &alpha_local,
+						  a_ir,
+						  b_jr,
+						  beta_use,
+						  c_ir, rs_c, cs_c,
+						  &aux,
+						  cntx
+						);
+					}
+				}
+			}
+
+			// This barrier is needed to prevent threads from starting to pack
+			// the next row panel of B before the current row panel is fully
+			// computed upon.
+			bli_thrinfo_barrier( thread_pb );
+		}
+	}
+}
+
@@ -58,6 +58,11 @@ void bli_trmm_front
 		return;
 	}
 
+	// Large multithreaded problems are computed as a graph of tasks, each
+	// of which updates one tile of B with a single thread.
+	if ( bli_l3_dag( BLIS_TRMM, side, alpha, a, b, cntx, rntm ) == BLIS_SUCCESS )
+		return;
+
 	// Alias A and B so we can tweak the objects if necessary.
 	bli_obj_alias_to( a, &a_local );
 	bli_obj_alias_to( b, &b_local );
@@ -51,13 +51,6 @@ void bli_trsm_front
 	obj_t   b_local;
 	obj_t   c_local;
 
-#if 0
-#ifdef BLIS_ENABLE_SMALL_MATRIX_TRSM
-	gint_t status = bli_trsm_small( side, alpha, a, b, cntx, cntl );
-	if ( status == BLIS_SUCCESS ) return;
-#endif
-#endif
-
 	// If alpha is zero, scale by beta and return.
 	if ( bli_obj_equals( alpha, &BLIS_ZERO ) )
 	{
@@ -65,6 +58,36 @@ void bli_trsm_front
 		return;
 	}
 
+#ifdef BLIS_ENABLE_SMALL_MATRIX_TRSM
+	// As with gemm, small problems are only handled separately when a single
+	// thread was requested (or in reproducible mode), since the small matrix
+	// code is not parallelized.
+	const bool is_st = ( bli_rntm_thread_impl( rntm ) == BLIS_SINGLE ||
+	                     ( bli_rntm_num_threads( rntm ) <= 1 &&
+	                       bli_rntm_calc_num_threads( rntm ) <= 1 ) );
+
+	if ( is_st || bli_rntm_repro( rntm ) )
+	{
+		trace_call_t call;
+		bli_trace_call_begin( &call );
+
+		err_t status = bli_trsm_small( side, alpha, a, b, cntx, NULL );
+		if ( status == BLIS_SUCCESS )
+		{
+			bli_trace_call_end( &call, BLIS_TRACE_SMALL, BLIS_TRSM,
+			                    bli_obj_dt( b ), bli_obj_length( b ),
+			                    bli_obj_width( b ), bli_obj_length( a ),
+			                    rntm );
+			return;
+		}
+	}
+#endif
+
+	// Large multithreaded problems are computed as a graph of tasks, each
+	// of which updates one tile of B with a single thread.
+	if ( bli_l3_dag( BLIS_TRSM, side, alpha, a, b, cntx, rntm ) == BLIS_SUCCESS )
+		return;
+
 	// Alias A and B so we can tweak the objects if necessary.
 	bli_obj_alias_to( a, &a_local );
 	bli_obj_alias_to( b, &b_local );
@@ -43,15 +43,15 @@ void bli_trsm_front
              rntm_t* rntm
      );
 
-#ifdef BLIS_ENABLE_SMALL_MATRIX
-err_t bli_trsm_small
+#ifdef BLIS_ENABLE_SMALL_MATRIX_TRSM
+BLIS_EXPORT_BLIS err_t bli_trsm_small
      (
-       side_t  side,
-       obj_t*  alpha,
-       obj_t*  a,
-       obj_t*  b,
-       cntx_t* cntx,
-       cntl_t* cntl
+             side_t  side,
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const cntx_t* cntx,
+             cntl_t* cntl
      );
 #endif
 
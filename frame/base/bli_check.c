@@ -149,7 +149,9 @@ err_t bli_check_valid_datatype( num_t dt )
 	     dt != BLIS_SCOMPLEX &&
 	     dt != BLIS_DCOMPLEX &&
 	     dt != BLIS_INT &&
-	     dt != BLIS_CONSTANT )
+	     dt != BLIS_CONSTANT &&
+	     dt != BLIS_BFLOAT16 &&
+	     dt != BLIS_FLOAT16 )
 		e_val = BLIS_INVALID_DATATYPE;
 
 	return e_val;
@@ -275,6 +277,28 @@ err_t bli_check_integer_object( const obj_t* a )
 	return e_val;
 }
 
+err_t bli_check_half_datatype( num_t dt )
+{
+	err_t e_val = BLIS_SUCCESS;
+
+	if ( dt != BLIS_BFLOAT16 &&
+	     dt != BLIS_FLOAT16 )
+		e_val = BLIS_INVALID_DATATYPE;
+
+	return e_val;
+}
+
+err_t bli_check_half_object( const obj_t* a )
+{
+	err_t e_val;
+	num_t dt;
+
+	dt = bli_obj_dt( a );
+	e_val = bli_check_half_datatype( dt );
+
+	return e_val;
+}
+
 err_t bli_check_consistent_datatypes( num_t dt_a, num_t dt_b )
 {
 	err_t e_val = BLIS_SUCCESS;
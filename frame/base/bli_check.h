@@ -58,6 +58,8 @@ err_t bli_check_real_datatype( num_t dt );
 err_t bli_check_real_object( const obj_t* a );
 err_t bli_check_integer_datatype( num_t dt );
 err_t bli_check_integer_object( const obj_t* a );
+err_t bli_check_half_datatype( num_t dt );
+err_t bli_check_half_object( const obj_t* a );
 err_t bli_check_consistent_datatypes( num_t dt_a, num_t dt_b );
 err_t bli_check_consistent_object_datatypes( const obj_t* a, const obj_t* b );
 err_t bli_check_datatype_real_proj_of( num_t dt_c, num_t dt_r );
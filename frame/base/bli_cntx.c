@@ -386,6 +386,132 @@ void bli_cntx_set_l3_sup_handlers( cntx_t* cntx, ... )
 
 // -----------------------------------------------------------------------------
 
+void bli_cntx_update_l3_tiny( cntx_t* cntx )
+{
+	// This function derives the tiny gemm dispatch table from the sup
+	// kernels, kernel preferences, blocksizes, and thresholds in the context,
+	// and so must be called after any of these change. The table records,
+	// for each storage combination, the choice that bli_gemmsup_int() would
+	// make for a single-threaded problem that fits within one block: if the
+	// millikernel registered for the storage combination is not primary for
+	// the kernel's storage preference, the operation is transposed and the
+	// millikernel for the transposed storage combination is used instead.
+
+	memset( cntx->l3_tiny, 0, sizeof( cntx->l3_tiny ) );
+
+#ifdef BLIS_DISABLE_SUP_HANDLING
+	return;
+#endif
+
+	// Leave the table empty if the default sup handler has been replaced.
+	if ( bli_cntx_get_l3_sup_handler( BLIS_GEMM, cntx ) != bli_gemmsup_ref )
+		return;
+
+	for ( num_t dt = BLIS_DT_LO; dt <= BLIS_DT_HI; ++dt )
+	{
+		l3_tiny_t* tiny = &cntx->l3_tiny[ dt ];
+
+		// Problems must fit within a single block of each sup loop and meet
+		// the sup thresholds, whether or not they are transposed.
+		dim_t max_dim = BLIS_GEMM_TINY_MAX_DIM;
+
+		max_dim = bli_min( max_dim, bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MC, cntx ) );
+		max_dim = bli_min( max_dim, bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_NC, cntx ) );
+		max_dim = bli_min( max_dim, bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_KC, cntx ) );
+		max_dim = bli_min( max_dim, bli_cntx_get_blksz_def_dt( dt, BLIS_MT, cntx ) - 1 );
+		max_dim = bli_min( max_dim, bli_cntx_get_blksz_def_dt( dt, BLIS_NT, cntx ) - 1 );
+
+		tiny->mr      = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MR, cntx );
+		tiny->nr      = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_NR, cntx );
+		tiny->nr_max  = bli_cntx_get_l3_sup_blksz_max_dt( dt, BLIS_NR, cntx );
+		tiny->max_dim = bli_max( max_dim, 0 );
+
+		for ( stor3_t id = BLIS_RRR; id <= BLIS_CCC; ++id )
+		{
+			const bool row_pref = bli_cntx_ukr_prefers_rows_dt( dt, bli_stor3_ukr( id ), cntx );
+
+			// The sup variants do not yet support column-preferential
+			// millikernels.
+			if ( !row_pref ) continue;
+
+			const bool is_primary = ( id == BLIS_RRR || id == BLIS_RRC ||
+			                          id == BLIS_RCR || id == BLIS_CRR );
+
+			const stor3_t id_use = ( is_primary ? id : bli_stor3_trans( id ) );
+
+			tiny->ker[ id ]   = bli_cntx_get_l3_sup_ker_dt( dt, id_use, cntx );
+			tiny->trans[ id ] = !is_primary;
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+err_t bli_cntx_set_blksz_dt( num_t dt, bszid_t bs_id, dim_t bs, cntx_t* cntx )
+{
+	/* Example prototype:
+
+	   err_t bli_cntx_set_blksz_dt
+	   (
+	     num_t   dt,
+	     bszid_t bs_id,
+	     dim_t   bs,
+	     cntx_t* cntx
+	   );
+
+		NOTE: Unlike bli_cntx_set_blksz_def_dt(), this function validates
+		the new default blocksize against the blocksize multiple (e.g. MR
+		for MC) registered in the context, as well as against the optional
+		MC/NR and NC/MR constraints checked by bli_gks_register_cntx(). The
+		context is left untouched unless BLIS_SUCCESS is returned.
+	*/
+
+	const bszid_t mult_id = bli_cntx_get_bmult_id( bs_id, cntx );
+	const dim_t   def_old = bli_cntx_get_blksz_def_dt( dt, bs_id, cntx );
+	const dim_t   max_old = bli_cntx_get_blksz_max_dt( dt, bs_id, cntx );
+
+	if ( bs <= 0 ) return BLIS_NONPOSITIVE_BLKSZ;
+
+	// Cache blocksizes must remain whole multiples of the register blocksizes
+	// that they are paired with. (Thresholds are their own multiple.)
+	if ( mult_id != bs_id )
+	{
+		const dim_t mult = bli_cntx_get_blksz_def_dt( dt, mult_id, cntx );
+
+		if ( bs % mult != 0 )
+		{
+			if      ( bs_id == BLIS_MC || bs_id == BLIS_MC_SUP ) return BLIS_MC_DEF_NONMULTIPLE_OF_MR;
+			else if ( bs_id == BLIS_NC || bs_id == BLIS_NC_SUP ) return BLIS_NC_DEF_NONMULTIPLE_OF_NR;
+			else                                                 return BLIS_KC_DEF_NONMULTIPLE_OF_KR;
+		}
+	}
+
+#ifndef BLIS_RELAX_MCNR_NCMR_CONSTRAINTS
+	if ( bs_id == BLIS_MC &&
+	     bs % bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ) != 0 )
+		return BLIS_MC_DEF_NONMULTIPLE_OF_NR;
+	if ( bs_id == BLIS_NC &&
+	     bs % bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ) != 0 )
+		return BLIS_NC_DEF_NONMULTIPLE_OF_MR;
+#endif
+
+	// Preserve whatever slack the context originally allowed between the
+	// default and maximum blocksizes. Since both were multiples of the
+	// register blocksize, so is their difference.
+	const dim_t max_new = bs + bli_max( max_old - def_old, 0 );
+
+	bli_cntx_set_blksz_def_dt( dt, bs_id, bs,      cntx );
+	bli_cntx_set_blksz_max_dt( dt, bs_id, max_new, cntx );
+
+	// The tiny gemm dispatch table depends on the sup blocksizes and
+	// thresholds, so derive it again.
+	bli_cntx_update_l3_tiny( cntx );
+
+	return BLIS_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+
 void bli_cntx_print( const cntx_t* cntx )
 {
 	dim_t i;
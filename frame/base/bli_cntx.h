@@ -51,6 +51,8 @@ typedef struct cntx_s
 
 	void_fp   l3_sup_handlers[ BLIS_NUM_LEVEL3_OPS ];
 
+	l3_tiny_t l3_tiny[ BLIS_NUM_FP_TYPES ];
+
 	ind_t     method;
 
 } cntx_t;
@@ -190,6 +192,11 @@ BLIS_INLINE void_fp bli_cntx_get_l3_sup_handler( opid_t op, const cntx_t* cntx )
 	return cntx->l3_sup_handlers[ op ];
 }
 
+BLIS_INLINE const l3_tiny_t* bli_cntx_get_l3_tiny_dt( num_t dt, const cntx_t* cntx )
+{
+	return &cntx->l3_tiny[ dt ];
+}
+
 // -----------------------------------------------------------------------------
 
 BLIS_INLINE bool bli_cntx_ukr_prefers_rows_dt( num_t dt, ukr_t ukr_id, const cntx_t* cntx )
@@ -350,6 +357,8 @@ BLIS_EXPORT_BLIS void bli_cntx_set_blkszs( cntx_t* cntx, ... );
 
 BLIS_EXPORT_BLIS void bli_cntx_set_ind_blkszs( ind_t method, num_t dt, cntx_t* cntx, ... );
 
+BLIS_EXPORT_BLIS err_t bli_cntx_set_blksz_dt( num_t dt, bszid_t bs_id, dim_t bs, cntx_t* cntx );
+
 BLIS_EXPORT_BLIS void bli_cntx_set_ukrs( cntx_t* cntx, ... );
 BLIS_EXPORT_BLIS void bli_cntx_set_ukr_prefs( cntx_t* cntx, ... );
 
@@ -357,6 +366,8 @@ BLIS_EXPORT_BLIS void bli_cntx_print( const cntx_t* cntx );
 
 BLIS_EXPORT_BLIS void bli_cntx_set_l3_sup_handlers( cntx_t* cntx, ... );
 
+BLIS_EXPORT_BLIS void bli_cntx_update_l3_tiny( cntx_t* cntx );
+
 
 #endif
 
@@ -112,6 +112,9 @@ static const char *bli_error_string[-BLIS_ERROR_CODE_MAX] =
 	[-BLIS_NC_MAX_NONMULTIPLE_OF_NR]             = "Maximum NC is non-multiple of NR for one or more datatypes.",
 	[-BLIS_KC_DEF_NONMULTIPLE_OF_KR]             = "Default KC is non-multiple of KR for one or more datatypes.",
 	[-BLIS_KC_MAX_NONMULTIPLE_OF_KR]             = "Maximum KC is non-multiple of KR for one or more datatypes.",
+	[-BLIS_NONPOSITIVE_BLKSZ]                    = "Encountered blocksize value that is zero or negative.",
+	[-BLIS_MC_DEF_NONMULTIPLE_OF_NR]             = "Default MC is non-multiple of NR for one or more datatypes.",
+	[-BLIS_NC_DEF_NONMULTIPLE_OF_MR]             = "Default NC is non-multiple of MR for one or more datatypes.",
 };
 
 // -----------------------------------------------------------------------------
@@ -57,7 +57,7 @@ typedef void (*ind_cntx_init_ft)( ind_t method, cntx_t* cntx );
 // pointers will be set once and then reused to fulfill subsequent context
 // queries.
 static cntx_t* cached_cntx_nat = NULL;
-static cntx_t* cached_cntx_ind = NULL;
+static cntx_t* cached_cntx_ind[ BLIS_NUM_IND_METHODS ];
 
 // -----------------------------------------------------------------------------
 
@@ -259,7 +259,8 @@ void bli_gks_init( void )
 	// bli_init_once(); and (2) we can guarantee that the gks has been
 	// initialized given that bli_gks_init() is about to return.
 	cached_cntx_nat = ( cntx_t* )bli_gks_query_nat_cntx_noinit();
-	cached_cntx_ind = ( cntx_t* )bli_gks_query_ind_cntx_noinit( BLIS_1M );
+	for ( ind_t ind = 0; ind < BLIS_NUM_IND_METHODS; ++ind )
+		cached_cntx_ind[ ind ] = ( cntx_t* )bli_gks_query_ind_cntx_noinit( ind );
 #endif
 }
 
@@ -316,7 +317,8 @@ void bli_gks_finalize( void )
 #ifdef BLIS_ENABLE_GKS_CACHING
 	// Clear the cached pointers to the native and induced contexts.
 	cached_cntx_nat = NULL;
-	cached_cntx_ind = NULL;
+	for ( ind = 0; ind < BLIS_NUM_IND_METHODS; ++ind )
+		cached_cntx_ind[ ind ] = NULL;
 #endif
 }
 
@@ -481,6 +483,13 @@ void bli_gks_register_cntx
 	// allocated array corresponding to native execution.
 	f( gks_id_nat );
 
+	// Apply any blocksize overrides from a user-supplied tuning file or from
+	// the environment. This is done before the checks below, and before the
+	// induced contexts are derived from the native context, so that the
+	// overrides are subject to the same constraints as the hard-coded values
+	// and are inherited by the induced methods.
+	bli_tune_init_cntx( id, gks_id_nat );
+
 	// Verify that cache blocksizes are whole multiples of register blocksizes.
 	// Specifically, verify that:
 	//   - MC is a whole multiple of MR.
@@ -517,6 +526,10 @@ void bli_gks_register_cntx
 	// relative to the maximum stack buffer size defined at configure-time.
 	e_val = bli_check_sufficient_stack_buf_size( gks_id_nat );
 	bli_check_error_code( e_val );
+
+	// Derive the tiny gemm dispatch table from the final contents of the
+	// context.
+	bli_cntx_update_l3_tiny( gks_id_nat );
 }
 
 // -----------------------------------------------------------------------------
@@ -586,9 +599,9 @@ const cntx_t* bli_gks_query_ind_cntx
 	// address instead of the one for induced execution.
 	if ( ind == BLIS_NAT ) return cached_cntx_nat;
 
-	// Return a pointer to the context for the induced method that was deep-
-	// queried and cached at the end of bli_gks_init().
-	return cached_cntx_ind;
+	// Return a pointer to the context for the requested induced method that
+	// was deep-queried and cached at the end of bli_gks_init().
+	return cached_cntx_ind[ ind ];
 
 #else
 
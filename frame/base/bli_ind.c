@@ -36,6 +36,7 @@
 
 static const char* bli_ind_impl_str[BLIS_NUM_IND_METHODS] =
 {
+/* 3m   */ "3m",
 /* 1m   */ "1m",
 /* nat  */ "native",
 };
@@ -67,6 +67,7 @@ BLIS_EXPORT_BLIS gint_t bli_info_get_enable_cblas( void );
 BLIS_EXPORT_BLIS gint_t bli_info_get_blas_int_type_size( void );
 BLIS_EXPORT_BLIS gint_t bli_info_get_enable_pba_pools( void );
 BLIS_EXPORT_BLIS gint_t bli_info_get_enable_sba_pools( void );
+BLIS_EXPORT_BLIS gint_t bli_info_get_enable_trace( void );
 BLIS_EXPORT_BLIS gint_t bli_info_get_enable_threading( void );
 BLIS_EXPORT_BLIS gint_t bli_info_get_enable_openmp( void );
 BLIS_EXPORT_BLIS gint_t bli_info_get_enable_pthreads( void );
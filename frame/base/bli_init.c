@@ -85,6 +85,8 @@ int bli_init_apis( void )
 	bli_ind_init();
 	bli_thread_init();
 	bli_pack_init();
+	bli_trace_init();
+	bli_gemmjit_init();
 	bli_memsys_init();
 
 	return 0;
@@ -94,6 +96,8 @@ int bli_finalize_apis( void )
 {
 	// Finalize various sub-APIs.
 	bli_memsys_finalize();
+	bli_gemmjit_finalize();
+	bli_trace_finalize();
 	bli_pack_finalize();
 	bli_thread_finalize();
 	bli_ind_finalize();
@@ -515,14 +515,16 @@ void bli_adjust_strides
 	}
 }
 
-static siz_t dt_sizes[6] =
+static siz_t dt_sizes[8] =
 {
 	sizeof( float ),
 	sizeof( scomplex ),
 	sizeof( double ),
 	sizeof( dcomplex ),
 	sizeof( gint_t ),
-	sizeof( constdata_t )
+	sizeof( constdata_t ),
+	sizeof( bfloat16 ),
+	sizeof( float16 )
 };
 
 siz_t bli_dt_size
@@ -536,13 +538,16 @@ siz_t bli_dt_size
 	return dt_sizes[dt];
 }
 
-static char* dt_names[ BLIS_NUM_FP_TYPES+1 ] =
+static char* dt_names[8] =
 {
 	"float",
 	"scomplex",
 	"double",
 	"dcomplex",
-	"int"
+	"int",
+	"constant",
+	"bfloat16",
+	"float16"
 };
 
 const char* bli_dt_string
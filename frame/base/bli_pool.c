@@ -238,11 +238,16 @@ void bli_pool_checkout_block
        pool_t* pool
      )
 {
+	// Note whether new blocks must be allocated to satisfy the request.
+	bool grew = FALSE;
+
 	// If the requested block size is smaller than what the pool was
 	// initialized with, reinitialize the pool to contain blocks of the
 	// requested size.
 	if ( bli_pool_block_size( pool ) < req_size )
 	{
+		grew = TRUE;
+
 		const siz_t num_blocks_new     = bli_pool_num_blocks( pool );
 		const siz_t block_ptrs_len_new = bli_pool_block_ptrs_len( pool );
 		const siz_t align_size_new     = bli_pool_align_size( pool );
@@ -275,9 +280,12 @@ void bli_pool_checkout_block
 		fflush( stdout );
 		#endif
 
+		grew = TRUE;
 		bli_pool_grow( 1, pool );
 	}
 
+	bli_trace_pool_checkout( grew );
+
 	// At this point, at least one block is guaranteed to be available.
 
 	// Query the block_ptrs array.
@@ -52,6 +52,7 @@ typedef struct rntm_s
 	bool      pack_a;
 	bool      pack_b;
 	bool      l3_sup;
+	bool      repro;
 } rntm_t;
 */
 
@@ -118,6 +119,11 @@ BLIS_INLINE bool bli_rntm_l3_sup( const rntm_t* rntm )
 	return rntm->l3_sup;
 }
 
+BLIS_INLINE bool bli_rntm_repro( const rntm_t* rntm )
+{
+	return rntm->repro;
+}
+
 //
 // -- rntm_t modification (internal use only) ----------------------------------
 //
@@ -222,6 +228,21 @@ BLIS_INLINE void bli_rntm_disable_l3_sup( rntm_t* rntm )
 	bli_rntm_set_l3_sup( FALSE, rntm );
 }
 
+BLIS_INLINE void bli_rntm_set_repro( bool repro, rntm_t* rntm )
+{
+	// Set the bool indicating whether results must be independent of the
+	// number of threads (see docs/Multithreading.md).
+	rntm->repro = repro;
+}
+BLIS_INLINE void bli_rntm_enable_repro( rntm_t* rntm )
+{
+	bli_rntm_set_repro( TRUE, rntm );
+}
+BLIS_INLINE void bli_rntm_disable_repro( rntm_t* rntm )
+{
+	bli_rntm_set_repro( FALSE, rntm );
+}
+
 //
 // -- rntm_t modification (internal use only) ----------------------------------
 //
@@ -247,6 +268,10 @@ BLIS_INLINE void bli_rntm_clear_l3_sup( rntm_t* rntm )
 {
 	bli_rntm_set_l3_sup( TRUE, rntm );
 }
+BLIS_INLINE void bli_rntm_clear_repro( rntm_t* rntm )
+{
+	bli_rntm_set_repro( FALSE, rntm );
+}
 
 //
 // -- rntm_t initialization ----------------------------------------------------
@@ -265,6 +290,7 @@ BLIS_INLINE void bli_rntm_clear_l3_sup( rntm_t* rntm )
           .pack_a      = FALSE, \
           .pack_b      = FALSE, \
           .l3_sup      = TRUE, \
+          .repro       = FALSE, \
         }  \
 
 BLIS_INLINE void bli_rntm_init( rntm_t* rntm )
@@ -278,6 +304,7 @@ BLIS_INLINE void bli_rntm_init( rntm_t* rntm )
 	bli_rntm_clear_pack_a( rntm );
 	bli_rntm_clear_pack_b( rntm );
 	bli_rntm_clear_l3_sup( rntm );
+	bli_rntm_clear_repro( rntm );
 }
 
 //
@@ -0,0 +1,568 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+static const char* trace_path_names[ BLIS_NUM_TRACE_PATHS ] =
+{
+	"small", "sup", "nat", "1m", "md", "lp", "int", "batch", "tiny", "dag", "note"
+};
+
+const char* bli_trace_path_string( trace_path_t path )
+{
+	return trace_path_names[ path ];
+}
+
+#ifdef BLIS_ENABLE_TRACE
+
+static const char* trace_opid_names[ BLIS_NUM_LEVEL3_OPS ] =
+{
+	"gemm", "gemmt", "hemm", "herk", "her2k", "symm",
+	"syrk", "syr2k", "trmm3", "trmm", "trsm"
+};
+
+// -- Records and ring buffers -------------------------------------------------
+
+typedef struct
+{
+	// The index of the record (plus one) within its ring buffer. This field
+	// is written last, after the rest of the record, so that a reader can
+	// detect records that were overwritten while being read.
+	uint64_t     seq;
+
+	trace_path_t path;
+	opid_t       family;
+	num_t        dt;
+	dim_t        m;
+	dim_t        n;
+	dim_t        k;
+	dim_t        nt;
+	dim_t        ways[ 5 ];
+
+	double       t_start;
+	double       time;
+	double       pack_time;
+	double       thread_time;
+	uint64_t     checkouts;
+	uint64_t     grows;
+
+	const char*  note;
+
+} trace_rec_t;
+
+typedef struct trace_ring_s
+{
+	struct trace_ring_s* next;
+	dim_t                id;
+
+	// The number of records ever written to the ring, and the value of head
+	// when the trace was last reset. Only the owning thread writes head.
+	uint64_t             head;
+	uint64_t             base;
+
+	trace_rec_t          recs[ BLIS_TRACE_RING_LEN ];
+
+} trace_ring_t;
+
+// The list of all ring buffers, to which each application thread adds its
+// ring buffer (without locking) the first time it writes a record. Ring
+// buffers are never freed.
+static trace_ring_t* trace_rings   = NULL;
+static dim_t         trace_n_rings = 0;
+
+// Each application thread's ring buffer and, for each thread participating
+// in an operation, the state of that operation (to which the thread's packing
+// time and pool checkouts are added). Without thread-local storage, neither
+// can be kept, and so only the aggregate counters are maintained.
+#ifdef BLIS_ENABLE_TLS
+static BLIS_THREAD_LOCAL trace_ring_t* trace_ring = NULL;
+static BLIS_THREAD_LOCAL trace_call_t* trace_cur  = NULL;
+#endif
+
+// -- Aggregate counters -------------------------------------------------------
+
+static bool     trace_enabled = FALSE;
+static char     trace_file[ 256 ] = "";
+
+static uint64_t trace_calls[ BLIS_NUM_TRACE_PATHS ];
+static uint64_t trace_time_ns[ BLIS_NUM_TRACE_PATHS ];
+static uint64_t trace_pack_ns;
+static uint64_t trace_thread_ns;
+static uint64_t trace_checkouts;
+static uint64_t trace_grows;
+
+#define bli_trace_add( ptr, value ) \
+        __atomic_fetch_add( ptr, value, __ATOMIC_RELAXED )
+#define bli_trace_load( ptr ) \
+        __atomic_load_n( ptr, __ATOMIC_RELAXED )
+
+BLIS_INLINE uint64_t bli_trace_ns( double t )
+{
+	return ( t > 0.0 ? ( uint64_t )( t * 1.0e9 ) : 0 );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_trace_init( void )
+{
+	// Read BLIS_TRACE and, if it is set, use it to enable or disable tracing.
+	// (If it is unset, a prior call to bli_trace_enable() takes effect.)
+	const gint_t trace_env = bli_env_get_var( "BLIS_TRACE", -1 );
+
+	if      ( trace_env ==  0 ) bli_trace_disable();
+	else if ( trace_env != -1 ) bli_trace_enable();
+
+	const char* file_env = bli_env_get_str( "BLIS_TRACE_FILE" );
+
+	if ( file_env != NULL )
+	{
+		strncpy( trace_file, file_env, sizeof( trace_file ) - 1 );
+		trace_file[ sizeof( trace_file ) - 1 ] = '\0';
+	}
+}
+
+void bli_trace_finalize( void )
+{
+	// The trace persists across bli_finalize() so that it may be dumped at
+	// program exit.
+}
+
+void bli_trace_enable( void )
+{
+	__atomic_store_n( &trace_enabled, TRUE, __ATOMIC_RELAXED );
+}
+
+void bli_trace_disable( void )
+{
+	__atomic_store_n( &trace_enabled, FALSE, __ATOMIC_RELAXED );
+}
+
+bool bli_trace_is_enabled( void )
+{
+	return __atomic_load_n( &trace_enabled, __ATOMIC_RELAXED );
+}
+
+// -----------------------------------------------------------------------------
+
+static trace_ring_t* bli_trace_ring_get( void )
+{
+#ifdef BLIS_ENABLE_TLS
+	if ( trace_ring != NULL ) return trace_ring;
+
+	err_t         r_val;
+	trace_ring_t* ring = bli_malloc_intl( sizeof( trace_ring_t ), &r_val );
+
+	if ( ring == NULL ) return NULL;
+
+	memset( ring, 0, sizeof( trace_ring_t ) );
+
+	ring->id = bli_trace_add( &trace_n_rings, 1 );
+
+	// Push the ring buffer onto the front of the list.
+	ring->next = __atomic_load_n( &trace_rings, __ATOMIC_RELAXED );
+
+	while ( !__atomic_compare_exchange_n( &trace_rings, &ring->next, ring, FALSE,
+	                                      __ATOMIC_RELEASE, __ATOMIC_RELAXED ) )
+		;
+
+	trace_ring = ring;
+
+	return ring;
+#else
+	return NULL;
+#endif
+}
+
+static void bli_trace_record( trace_rec_t* rec )
+{
+	trace_ring_t* ring = bli_trace_ring_get();
+
+	if ( ring == NULL ) return;
+
+	const uint64_t head = ring->head;
+	trace_rec_t*   slot = &ring->recs[ head % BLIS_TRACE_RING_LEN ];
+
+	// Invalidate the slot before overwriting it, then publish the record by
+	// writing its sequence number followed by the new head.
+	__atomic_store_n( &slot->seq, 0, __ATOMIC_RELAXED );
+	__atomic_thread_fence( __ATOMIC_RELEASE );
+
+	rec->seq = 0;
+	*slot    = *rec;
+
+	__atomic_store_n( &slot->seq,  head + 1, __ATOMIC_RELEASE );
+	__atomic_store_n( &ring->head, head + 1, __ATOMIC_RELEASE );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_trace_call_begin( trace_call_t* call )
+{
+	call->active = bli_trace_is_enabled();
+
+	if ( !call->active ) return;
+
+	call->t_start   = bli_clock();
+	call->pack_ns   = 0;
+	call->thread_ns = 0;
+	call->checkouts = 0;
+	call->grows     = 0;
+}
+
+void bli_trace_call_end
+     (
+             trace_call_t* call,
+             trace_path_t  path,
+             opid_t        family,
+             num_t         dt,
+             dim_t         m,
+             dim_t         n,
+             dim_t         k,
+       const rntm_t*       rntm
+     )
+{
+	if ( !call->active ) return;
+
+	const double time = bli_clock() - call->t_start;
+
+	bli_trace_add( &trace_calls[ path ], 1 );
+	bli_trace_add( &trace_time_ns[ path ], bli_trace_ns( time ) );
+
+	trace_rec_t rec;
+
+	rec.path        = path;
+	rec.family      = family;
+	rec.dt          = dt;
+	rec.m           = m;
+	rec.n           = n;
+	rec.k           = k;
+	rec.nt          = bli_rntm_num_threads( rntm );
+	rec.ways[ 0 ]   = bli_rntm_jc_ways( rntm );
+	rec.ways[ 1 ]   = bli_rntm_pc_ways( rntm );
+	rec.ways[ 2 ]   = bli_rntm_ic_ways( rntm );
+	rec.ways[ 3 ]   = bli_rntm_jr_ways( rntm );
+	rec.ways[ 4 ]   = bli_rntm_ir_ways( rntm );
+	rec.t_start     = call->t_start;
+	rec.time        = time;
+	rec.pack_time   = call->pack_ns   * 1.0e-9;
+	rec.thread_time = call->thread_ns * 1.0e-9;
+	rec.checkouts   = call->checkouts;
+	rec.grows       = call->grows;
+	rec.note        = NULL;
+
+	bli_trace_record( &rec );
+}
+
+double bli_trace_thread_begin( trace_call_t* call )
+{
+	if ( !call->active ) return 0.0;
+
+#ifdef BLIS_ENABLE_TLS
+	trace_cur = call;
+#endif
+
+	return bli_clock();
+}
+
+void bli_trace_thread_end( trace_call_t* call, double t_start )
+{
+	if ( !call->active ) return;
+
+	const uint64_t ns = bli_trace_ns( bli_clock() - t_start );
+
+	bli_trace_add( &call->thread_ns, ns );
+	bli_trace_add( &trace_thread_ns, ns );
+
+#ifdef BLIS_ENABLE_TLS
+	trace_cur = NULL;
+#endif
+}
+
+double bli_trace_pack_begin( void )
+{
+	if ( !bli_trace_is_enabled() ) return -1.0;
+
+	return bli_clock();
+}
+
+void bli_trace_pack_end( double t_start )
+{
+	if ( t_start < 0.0 ) return;
+
+	const uint64_t ns = bli_trace_ns( bli_clock() - t_start );
+
+	bli_trace_add( &trace_pack_ns, ns );
+
+#ifdef BLIS_ENABLE_TLS
+	if ( trace_cur != NULL ) bli_trace_add( &trace_cur->pack_ns, ns );
+#endif
+}
+
+void bli_trace_pool_checkout( bool grew )
+{
+	if ( !bli_trace_is_enabled() ) return;
+
+	bli_trace_add( &trace_checkouts, 1 );
+	if ( grew ) bli_trace_add( &trace_grows, 1 );
+
+#ifdef BLIS_ENABLE_TLS
+	if ( trace_cur != NULL )
+	{
+		bli_trace_add( &trace_cur->checkouts, 1 );
+		if ( grew ) bli_trace_add( &trace_cur->grows, 1 );
+	}
+#endif
+}
+
+void bli_trace_note( const char* note )
+{
+	if ( !bli_trace_is_enabled() ) return;
+
+	trace_rec_t rec;
+
+	memset( &rec, 0, sizeof( trace_rec_t ) );
+
+	rec.path    = BLIS_TRACE_NOTE;
+	rec.family  = BLIS_NOID;
+	rec.t_start = bli_clock();
+	rec.note    = note;
+
+	bli_trace_record( &rec );
+}
+
+// -----------------------------------------------------------------------------
+
+// Return the index of the oldest record of a ring buffer that has not been
+// overwritten or discarded by a reset.
+static uint64_t bli_trace_ring_first( const trace_ring_t* ring, uint64_t head )
+{
+	const uint64_t base = bli_trace_load( &ring->base );
+	const uint64_t lo   = ( head > BLIS_TRACE_RING_LEN ? head - BLIS_TRACE_RING_LEN : 0 );
+
+	return bli_max( base, lo );
+}
+
+void bli_trace_reset( void )
+{
+	for ( dim_t p = 0; p < BLIS_NUM_TRACE_PATHS; ++p )
+	{
+		__atomic_store_n( &trace_calls[ p ],   0, __ATOMIC_RELAXED );
+		__atomic_store_n( &trace_time_ns[ p ], 0, __ATOMIC_RELAXED );
+	}
+
+	__atomic_store_n( &trace_pack_ns,   0, __ATOMIC_RELAXED );
+	__atomic_store_n( &trace_thread_ns, 0, __ATOMIC_RELAXED );
+	__atomic_store_n( &trace_checkouts, 0, __ATOMIC_RELAXED );
+	__atomic_store_n( &trace_grows,     0, __ATOMIC_RELAXED );
+
+	// Discard the records of each ring buffer by advancing its base (rather
+	// than its head, which only the owning thread may write).
+	trace_ring_t* ring = __atomic_load_n( &trace_rings, __ATOMIC_ACQUIRE );
+
+	for ( ; ring != NULL; ring = ring->next )
+		__atomic_store_n( &ring->base, __atomic_load_n( &ring->head, __ATOMIC_ACQUIRE ),
+		                  __ATOMIC_RELAXED );
+}
+
+void bli_trace_query_counters( trace_counters_t* counters )
+{
+	for ( dim_t p = 0; p < BLIS_NUM_TRACE_PATHS; ++p )
+	{
+		counters->calls[ p ] = bli_trace_load( &trace_calls[ p ] );
+		counters->time[ p ]  = bli_trace_load( &trace_time_ns[ p ] ) * 1.0e-9;
+	}
+
+	counters->pack_time   = bli_trace_load( &trace_pack_ns )   * 1.0e-9;
+	counters->thread_time = bli_trace_load( &trace_thread_ns ) * 1.0e-9;
+	counters->checkouts   = bli_trace_load( &trace_checkouts );
+	counters->grows       = bli_trace_load( &trace_grows );
+	counters->dropped     = 0;
+
+	// Count the records that were overwritten before they could be dumped.
+	trace_ring_t* ring = __atomic_load_n( &trace_rings, __ATOMIC_ACQUIRE );
+
+	for ( ; ring != NULL; ring = ring->next )
+	{
+		const uint64_t head = __atomic_load_n( &ring->head, __ATOMIC_ACQUIRE );
+		const uint64_t base = bli_trace_load( &ring->base );
+
+		if ( head > base + BLIS_TRACE_RING_LEN )
+			counters->dropped += head - base - BLIS_TRACE_RING_LEN;
+	}
+}
+
+static const char* bli_trace_dt_string( num_t dt )
+{
+	switch ( dt )
+	{
+		case BLIS_FLOAT:    return "s";
+		case BLIS_DOUBLE:   return "d";
+		case BLIS_SCOMPLEX: return "c";
+		case BLIS_DCOMPLEX: return "z";
+		case BLIS_INT:      return "i";
+		case BLIS_BFLOAT16: return "bf16";
+		case BLIS_FLOAT16:  return "f16";
+		default:            return "-";
+	}
+}
+
+void bli_trace_dump( FILE* file )
+{
+	trace_counters_t counters;
+
+	if ( file == NULL ) file = stdout;
+
+	bli_trace_query_counters( &counters );
+
+	fprintf( file, "# BLIS trace (tracing %s)\n",
+	         bli_trace_is_enabled() ? "enabled" : "disabled" );
+	fprintf( file, "#\n" );
+	fprintf( file, "# %-8s %12s %14s\n", "path", "calls", "time (s)" );
+
+	for ( dim_t p = 0; p < BLIS_TRACE_NOTE; ++p )
+		fprintf( file, "# %-8s %12llu %14.6e\n", trace_path_names[ p ],
+		         ( unsigned long long )counters.calls[ p ], counters.time[ p ] );
+
+	fprintf( file, "#\n" );
+	fprintf( file, "# thread time (s)    %14.6e\n", counters.thread_time );
+	fprintf( file, "#   packing (s)      %14.6e\n", counters.pack_time );
+	fprintf( file, "#   computing (s)    %14.6e\n",
+	         bli_fmax( counters.thread_time - counters.pack_time, 0.0 ) );
+	fprintf( file, "# pool checkouts     %14llu\n", ( unsigned long long )counters.checkouts );
+	fprintf( file, "#   pool grows       %14llu\n", ( unsigned long long )counters.grows );
+	fprintf( file, "# dropped records    %14llu\n", ( unsigned long long )counters.dropped );
+	fprintf( file, "#\n" );
+	fprintf( file, "# %4s %8s %6s %6s %4s %7s %7s %7s %3s %3s %3s %3s %3s %3s "
+	               "%12s %12s %12s %12s %6s %6s\n",
+	         "ring", "seq", "op", "path", "dt", "m", "n", "k",
+	         "nt", "jc", "pc", "ic", "jr", "ir",
+	         "t_start", "time", "pack", "compute", "chkout", "grows" );
+
+	trace_ring_t* ring = __atomic_load_n( &trace_rings, __ATOMIC_ACQUIRE );
+
+	for ( ; ring != NULL; ring = ring->next )
+	{
+		const uint64_t head = __atomic_load_n( &ring->head, __ATOMIC_ACQUIRE );
+
+		for ( uint64_t i = bli_trace_ring_first( ring, head ); i < head; ++i )
+		{
+			const trace_rec_t* slot = &ring->recs[ i % BLIS_TRACE_RING_LEN ];
+			trace_rec_t        rec;
+
+			// Copy the record, and skip it if it was overwritten (by the
+			// owning thread) in the meantime.
+			const uint64_t seq0 = __atomic_load_n( &slot->seq, __ATOMIC_ACQUIRE );
+			rec = *slot;
+			__atomic_thread_fence( __ATOMIC_ACQUIRE );
+			const uint64_t seq1 = __atomic_load_n( &slot->seq, __ATOMIC_RELAXED );
+
+			if ( seq0 != i + 1 || seq1 != i + 1 ) continue;
+
+			if ( rec.path == BLIS_TRACE_NOTE )
+			{
+				fprintf( file, "  %4ld %8llu %6s %6s   %s\n",
+				         ( long )ring->id, ( unsigned long long )i, "-",
+				         trace_path_names[ rec.path ], rec.note );
+				continue;
+			}
+
+			fprintf( file, "  %4ld %8llu %6s %6s %4s %7ld %7ld %7ld %3ld %3ld %3ld %3ld %3ld %3ld "
+			               "%12.6e %12.6e %12.6e %12.6e %6llu %6llu\n",
+			         ( long )ring->id, ( unsigned long long )i,
+			         trace_opid_names[ rec.family ], trace_path_names[ rec.path ],
+			         bli_trace_dt_string( rec.dt ),
+			         ( long )rec.m, ( long )rec.n, ( long )rec.k, ( long )rec.nt,
+			         ( long )rec.ways[ 0 ], ( long )rec.ways[ 1 ], ( long )rec.ways[ 2 ],
+			         ( long )rec.ways[ 3 ], ( long )rec.ways[ 4 ],
+			         rec.t_start, rec.time, rec.pack_time,
+			         bli_fmax( rec.thread_time - rec.pack_time, 0.0 ),
+			         ( unsigned long long )rec.checkouts,
+			         ( unsigned long long )rec.grows );
+		}
+	}
+
+	fflush( file );
+}
+
+// Dump the trace to the file named by BLIS_TRACE_FILE (if any) at program
+// exit.
+static void BLIS_ATTRIB_DTOR bli_trace_dump_at_exit( void )
+{
+	if ( trace_file[ 0 ] == '\0' ) return;
+
+	if      ( strcmp( trace_file, "stdout" ) == 0 ) bli_trace_dump( stdout );
+	else if ( strcmp( trace_file, "stderr" ) == 0 ) bli_trace_dump( stderr );
+	else
+	{
+		FILE* file = fopen( trace_file, "w" );
+
+		if ( file == NULL ) return;
+
+		bli_trace_dump( file );
+		fclose( file );
+	}
+}
+
+#else
+
+// -- Tracing disabled at configure-time ---------------------------------------
+
+void bli_trace_init( void )     { }
+void bli_trace_finalize( void ) { }
+
+void bli_trace_enable( void )   { }
+void bli_trace_disable( void )  { }
+
+bool bli_trace_is_enabled( void )
+{
+	return FALSE;
+}
+
+void bli_trace_reset( void )    { }
+
+void bli_trace_query_counters( trace_counters_t* counters )
+{
+	memset( counters, 0, sizeof( trace_counters_t ) );
+}
+
+void bli_trace_dump( FILE* file )
+{
+	if ( file == NULL ) file = stdout;
+
+	fprintf( file, "# BLIS trace unavailable (BLIS was configured without --enable-trace)\n" );
+}
+
+#endif
+
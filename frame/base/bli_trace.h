@@ -0,0 +1,229 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_TRACE_H
+#define BLIS_TRACE_H
+
+//
+// The tracing subsystem records, for each level-3 operation invoked by the
+// application, which implementation path the operation took, its dimensions,
+// the ways of parallelism assigned to each loop, its wall time, the time
+// spent by all threads packing and computing, and the number of memory pool
+// blocks it checked out. It is compiled in only when BLIS is configured with
+// --enable-trace, and then remains inactive unless enabled at runtime, either
+// via bli_trace_enable() or by setting the BLIS_TRACE environment variable
+// to a non-zero value.
+//
+// Each application thread writes its records into its own ring buffer (so
+// that no locking is needed when recording), keeping only the most recent
+// BLIS_TRACE_RING_LEN records. In addition, a set of aggregate counters is
+// maintained across all threads. Both may be printed via bli_trace_dump(),
+// and are printed automatically at program exit to the file named by the
+// BLIS_TRACE_FILE environment variable ("stdout" and "stderr" are also
+// recognized), if it is set.
+//
+
+// The number of records retained per application thread.
+#ifndef BLIS_TRACE_RING_LEN
+#define BLIS_TRACE_RING_LEN 1024
+#endif
+
+// The implementation path taken by a traced operation.
+typedef enum
+{
+	BLIS_TRACE_SMALL = 0, // small matrix code (bli_gemm_small())
+	BLIS_TRACE_SUP,       // small/unpacked (sup) code
+	BLIS_TRACE_NAT,       // conventional code, native execution
+	BLIS_TRACE_1M,        // conventional code, 1m induced method
+	BLIS_TRACE_MD,        // conventional code, mixed datatypes
+	BLIS_TRACE_LP,        // low-precision (bfloat16/float16) gemm
+	BLIS_TRACE_INT,       // integer gemm
+	BLIS_TRACE_BATCH,     // strided-batched gemm
+	BLIS_TRACE_TINY,      // tiny gemm (bli_?gemm_tiny())
+	BLIS_TRACE_DAG,       // task-parallel trsm/trmm (bli_l3_dag())
+	BLIS_TRACE_NOTE       // not an operation; a note left by the library
+} trace_path_t;
+
+#define BLIS_NUM_TRACE_PATHS 11
+
+// The per-operation state used while a traced operation is in progress. The
+// counters are updated by all threads participating in the operation.
+typedef struct
+{
+	bool     active;
+	double   t_start;
+
+	uint64_t pack_ns;
+	uint64_t thread_ns;
+	uint64_t checkouts;
+	uint64_t grows;
+
+} trace_call_t;
+
+// A snapshot of the aggregate counters. All times are in seconds.
+typedef struct
+{
+	uint64_t calls[ BLIS_NUM_TRACE_PATHS ];
+	double   time[ BLIS_NUM_TRACE_PATHS ];
+
+	double   pack_time;
+	double   thread_time;
+	uint64_t checkouts;
+	uint64_t grows;
+	uint64_t dropped;
+
+} trace_counters_t;
+
+// -- Public API ---------------------------------------------------------------
+
+BLIS_EXPORT_BLIS void        bli_trace_enable( void );
+BLIS_EXPORT_BLIS void        bli_trace_disable( void );
+BLIS_EXPORT_BLIS bool        bli_trace_is_enabled( void );
+
+BLIS_EXPORT_BLIS void        bli_trace_reset( void );
+BLIS_EXPORT_BLIS void        bli_trace_query_counters( trace_counters_t* counters );
+BLIS_EXPORT_BLIS void        bli_trace_dump( FILE* file );
+
+BLIS_EXPORT_BLIS const char* bli_trace_path_string( trace_path_t path );
+
+// -- Internal API -------------------------------------------------------------
+
+void bli_trace_init( void );
+void bli_trace_finalize( void );
+
+#ifdef BLIS_ENABLE_TRACE
+
+// Mark the beginning and end of an operation on the calling thread.
+void bli_trace_call_begin( trace_call_t* call );
+void bli_trace_call_end
+     (
+             trace_call_t* call,
+             trace_path_t  path,
+             opid_t        family,
+             num_t         dt,
+             dim_t         m,
+             dim_t         n,
+             dim_t         k,
+       const rntm_t*       rntm
+     );
+
+// Mark the beginning and end of the work of one thread participating in an
+// operation.
+double bli_trace_thread_begin( trace_call_t* call );
+void   bli_trace_thread_end( trace_call_t* call, double t_start );
+
+// Mark the beginning and end of a packing stage.
+double bli_trace_pack_begin( void );
+void   bli_trace_pack_end( double t_start );
+
+// Count the checkout of a memory pool block, which required the pool to
+// allocate new blocks if grew is TRUE.
+void   bli_trace_pool_checkout( bool grew );
+
+// Leave a note (a string literal) in the calling thread's ring buffer.
+void   bli_trace_note( const char* note );
+
+#else
+
+BLIS_INLINE void bli_trace_call_begin( trace_call_t* call )
+{
+	( void )call;
+}
+BLIS_INLINE void bli_trace_call_end
+     (
+             trace_call_t* call,
+             trace_path_t  path,
+             opid_t        family,
+             num_t         dt,
+             dim_t         m,
+             dim_t         n,
+             dim_t         k,
+       const rntm_t*       rntm
+     )
+{
+	( void )call; ( void )path; ( void )family; ( void )dt;
+	( void )m; ( void )n; ( void )k; ( void )rntm;
+}
+
+BLIS_INLINE double bli_trace_thread_begin( trace_call_t* call )
+{
+	( void )call; return 0.0;
+}
+BLIS_INLINE void bli_trace_thread_end( trace_call_t* call, double t_start )
+{
+	( void )call; ( void )t_start;
+}
+
+BLIS_INLINE double bli_trace_pack_begin( void )
+{
+	return 0.0;
+}
+BLIS_INLINE void bli_trace_pack_end( double t_start )
+{
+	( void )t_start;
+}
+
+BLIS_INLINE void bli_trace_pool_checkout( bool grew )
+{
+	( void )grew;
+}
+
+BLIS_INLINE void bli_trace_note( const char* note )
+{
+	( void )note;
+}
+
+#endif
+
+// Determine the path taken by an operation executed by the conventional
+// level-3 code.
+BLIS_INLINE trace_path_t bli_trace_l3_path
+     (
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  c,
+       const cntx_t* cntx
+     )
+{
+	if ( bli_obj_dt( a ) != bli_obj_dt( c ) ||
+	     bli_obj_dt( b ) != bli_obj_dt( c ) ||
+	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return BLIS_TRACE_MD;
+	if ( bli_cntx_method( cntx ) == BLIS_1M )           return BLIS_TRACE_1M;
+
+	return BLIS_TRACE_NAT;
+}
+
+#endif
+
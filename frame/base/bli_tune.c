@@ -0,0 +1,266 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// A tuning file is a plain text file, typically written by the autotuner in
+// test/tune, that overrides a subset of the blocksizes registered by a
+// sub-configuration's context initialization function. Each non-empty line
+// that does not begin with '#' is either
+//
+//   arch <name>
+//
+// which restricts the entries that follow to the sub-configuration whose
+// name (as returned by bli_arch_string()) is <name>, or
+//
+//   <blksz>_<dt> <value>
+//
+// where <blksz> is one of MC, KC, NC, MT, NT, KT, MC_SUP, KC_SUP, or NC_SUP
+// and <dt> is one of S, D, C, or Z. Entries that appear before any arch line
+// apply to the sub-configuration selected at runtime by bli_arch_query_id().
+// For example:
+//
+//   arch zen3
+//   MC_D 120
+//   KC_D 256
+//   MT_D 192
+//
+// In addition, any of the same blocksizes may be overridden for the active
+// sub-configuration through environment variables of the form
+//
+//   BLIS_<blksz>_<dt>=<value>
+//
+// e.g. BLIS_MC_D=120 or BLIS_KT_S=300. Environment variables are applied
+// after the tuning file and thus take precedence over it.
+//
+// Entries that name an unknown blocksize or that would violate the usual
+// blocksize constraints (e.g. MC being a multiple of MR) are reported and
+// skipped, leaving the value set by the context initialization function.
+
+typedef struct
+{
+	const char* name;
+	bszid_t     bs_id;
+} tune_blksz_t;
+
+static tune_blksz_t tune_blkszs[] =
+{
+	{ "MC",     BLIS_MC     },
+	{ "KC",     BLIS_KC     },
+	{ "NC",     BLIS_NC     },
+	{ "MT",     BLIS_MT     },
+	{ "NT",     BLIS_NT     },
+	{ "KT",     BLIS_KT     },
+	{ "MC_SUP", BLIS_MC_SUP },
+	{ "KC_SUP", BLIS_KC_SUP },
+	{ "NC_SUP", BLIS_NC_SUP },
+};
+
+static const dim_t n_tune_blkszs = sizeof( tune_blkszs ) / sizeof( tune_blksz_t );
+
+// -----------------------------------------------------------------------------
+
+static bool bli_tune_parse_key
+     (
+       const char* key,
+       bszid_t*    bs_id,
+       num_t*      dt
+     )
+{
+	const char* sep = strrchr( key, '_' );
+
+	if ( sep == NULL || sep[1] == '\0' || sep[2] != '\0' ) return FALSE;
+
+	switch ( sep[1] )
+	{
+		case 'S': case 's': *dt = BLIS_FLOAT;    break;
+		case 'D': case 'd': *dt = BLIS_DOUBLE;   break;
+		case 'C': case 'c': *dt = BLIS_SCOMPLEX; break;
+		case 'Z': case 'z': *dt = BLIS_DCOMPLEX; break;
+		default: return FALSE;
+	}
+
+	const size_t len = sep - key;
+
+	for ( dim_t i = 0; i < n_tune_blkszs; ++i )
+	{
+		if ( strlen( tune_blkszs[ i ].name ) == len &&
+		     strncmp( tune_blkszs[ i ].name, key, len ) == 0 )
+		{
+			*bs_id = tune_blkszs[ i ].bs_id;
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+static void bli_tune_report
+     (
+       const char* src,
+       const char* key,
+       long        val,
+       err_t       e_val
+     )
+{
+	char msg[ 1024 ];
+
+	snprintf( msg, sizeof( msg ), "%s: rejected %s = %ld (%s); skipping.",
+	          src, key, val, bli_error_string_for_code( e_val ) );
+	bli_print_msg( msg, __FILE__, __LINE__ );
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_tune_apply_env( cntx_t* cntx )
+{
+	const char  dt_chars[] = { 'S', 'D', 'C', 'Z' };
+	const num_t dts[]      = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+
+	for ( dim_t i = 0; i < n_tune_blkszs; ++i )
+	{
+		for ( dim_t j = 0; j < 4; ++j )
+		{
+			char env[ 32 ];
+
+			snprintf( env, sizeof( env ), "BLIS_%s_%c",
+			          tune_blkszs[ i ].name, dt_chars[ j ] );
+
+			const char* str = bli_env_get_str( env );
+
+			if ( str == NULL || *str == '\0' ) continue;
+
+			char* end;
+			long  val = strtol( str, &end, 10 );
+
+			if ( *end != '\0' )
+			{
+				char msg[ 128 ];
+
+				snprintf( msg, sizeof( msg ),
+				          "environment: non-numeric value for %s; skipping.", env );
+				bli_print_msg( msg, __FILE__, __LINE__ );
+				continue;
+			}
+
+			err_t e_val = bli_cntx_set_blksz_dt( dts[ j ], tune_blkszs[ i ].bs_id,
+			                                     ( dim_t )val, cntx );
+
+			if ( e_val != BLIS_SUCCESS )
+				bli_tune_report( "environment", env, val, e_val );
+		}
+	}
+}
+
+static void bli_tune_apply_file( arch_t id, cntx_t* cntx )
+{
+	const char* path = bli_env_get_str( "BLIS_TUNING_FILE" );
+
+	if ( path == NULL || *path == '\0' ) return;
+
+	FILE* fp = fopen( path, "r" );
+
+	if ( fp == NULL )
+	{
+		// Only complain once, when processing the active sub-configuration.
+		if ( id == bli_arch_query_id() )
+			bli_print_msg( "Unable to open BLIS_TUNING_FILE; ignoring.",
+			               __FILE__, __LINE__ );
+		return;
+	}
+
+	// Entries preceding the first arch line target the active configuration.
+	bool active = ( id == bli_arch_query_id() );
+	char line[ 256 ];
+	char msg[ 512 ];
+	dim_t lineno = 0;
+
+	while ( fgets( line, sizeof( line ), fp ) != NULL )
+	{
+		char key[ 64 ];
+		long val;
+
+		++lineno;
+
+		if ( sscanf( line, " %63s", key ) != 1 || key[0] == '#' ) continue;
+
+		if ( strcmp( key, "arch" ) == 0 )
+		{
+			char name[ 64 ];
+
+			active = ( sscanf( line, " %*s %63s", name ) == 1 &&
+			           strcmp( name, bli_arch_string( id ) ) == 0 );
+			continue;
+		}
+
+		if ( !active ) continue;
+
+		bszid_t bs_id;
+		num_t   dt;
+		err_t   e_val;
+
+		if ( !bli_tune_parse_key( key, &bs_id, &dt ) ||
+		     sscanf( line, " %*s %ld", &val ) != 1 )
+		{
+			snprintf( msg, sizeof( msg ),
+			          "%s:%d: unrecognized tuning entry '%s'; skipping.",
+			          path, ( int )lineno, key );
+			bli_print_msg( msg, __FILE__, __LINE__ );
+			continue;
+		}
+
+		e_val = bli_cntx_set_blksz_dt( dt, bs_id, ( dim_t )val, cntx );
+
+		if ( e_val != BLIS_SUCCESS )
+		{
+			snprintf( msg, sizeof( msg ), "%s:%d", path, ( int )lineno );
+			bli_tune_report( msg, key, val, e_val );
+		}
+	}
+
+	fclose( fp );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_tune_init_cntx( arch_t id, cntx_t* cntx )
+{
+	bli_tune_apply_file( id, cntx );
+
+	// Environment overrides only make sense for the active configuration.
+	if ( id == bli_arch_query_id() )
+		bli_tune_apply_env( cntx );
+}
+
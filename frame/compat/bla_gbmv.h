@@ -4,7 +4,7 @@
    An object-based framework for developing high-performance BLAS-like
    libraries.
 
-   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2022, The University of Texas at Austin
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -33,27 +33,31 @@
 */
 
 
+#if 1
+
+//
+// Prototype BLAS-to-BLIS interfaces.
+//
 #undef  GENTPROT
-#define GENTPROT( ctype, ch, varname ) \
+#define GENTPROT( ftype, ch, blasname ) \
 \
-void PASTECH2(bao_,ch,varname) \
+BLIS_EXPORT_BLAS void PASTEF77(ch,blasname) \
      ( \
-       conj_t  conja, \
-       pack_t  schema, \
-       dim_t   panel_dim, \
-       dim_t   panel_dim_max, \
-       dim_t   panel_len, \
-       dim_t   panel_len_max, \
-       ctype*  kappa, \
-       ctype*  d, inc_t incd, \
-       ctype*  a, inc_t inca, inc_t lda, \
-       ctype*  p,             inc_t ldp, \
-       cntx_t* cntx  \
+       const f77_char* transa, \
+       const f77_int*  m, \
+       const f77_int*  n, \
+       const f77_int*  kl, \
+       const f77_int*  ku, \
+       const ftype*    alpha, \
+       const ftype*    a, const f77_int* lda, \
+       const ftype*    x, const f77_int* incx, \
+       const ftype*    beta, \
+             ftype*    y, const f77_int* incy  \
      );
 
-//INSERT_GENTPROT_BASIC0( packm_cxk )
-GENTPROT( float,    s, packm_cxk )
-GENTPROT( double,   d, packm_cxk )
-GENTPROT( scomplex, c, packm_cxk )
-GENTPROT( dcomplex, z, packm_cxk )
+#ifdef BLIS_ENABLE_BLAS
+INSERT_GENTPROT_BLAS( gbmv )
+#endif
+
+#endif
 
@@ -218,6 +218,19 @@ void PASTEF77(ch,blasname) \
 		); \
 		return; \
 	} \
+\
+	/* Compute tiny problems directly with the sup millikernels, bypassing
+	   the construction of objects. */ \
+	if ( PASTEMAC(ch,gemm_tiny) \
+	     ( \
+	       blis_transa, blis_transb, m0, n0, k0, \
+	       alpha, a, rs_a, cs_a, b, rs_b, cs_b, \
+	       beta, c, rs_c, cs_c, NULL, NULL \
+	     ) == BLIS_SUCCESS ) \
+	{ \
+		bli_finalize_auto(); \
+		return; \
+	} \
 \
 	const num_t dt     = PASTEMAC(ch,type); \
 \
@@ -4,7 +4,7 @@
    An object-based framework for developing high-performance BLAS-like
    libraries.
 
-   Copyright (C) 2021, The University of Texas at Austin
+   Copyright (C) 2022, The University of Texas at Austin
 
    Redistribution and use in source and binary forms, with or without
    modification, are permitted provided that the following conditions are
@@ -32,25 +32,27 @@
 
 */
 
-// Definitions specific to situations when POSIX multithreading is enabled.
-#ifdef BLIS_ENABLE_PTHREADS
-
-// Thread entry point prototype.
-void* bao_l3_thread_entry( void* data_void );
-
-void bao_l3_thread_decorator_pthreads
-     (
-       l3aoint_ft func,
-       opid_t     family,
-       obj_t*     alpha,
-       obj_t*     a,
-       obj_t*     d,
-       obj_t*     b,
-       obj_t*     beta,
-       obj_t*     c,
-       cntx_t*    cntx,
-       rntm_t*    rntm
+
+#if 1
+
+//
+// Prototype BLAS-to-BLIS interfaces.
+//
+#undef  GENTPROTR2
+#define GENTPROTR2( ftype_x, ftype_r, chx, chr, blasname ) \
+\
+BLIS_EXPORT_BLAS void PASTEF772(chx,chr,blasname) \
+     ( \
+       const f77_int* n, \
+       ftype_x* x, const f77_int* incx, \
+       ftype_x* y, const f77_int* incy, \
+       const ftype_r* c, \
+       const ftype_r* s  \
      );
 
+#ifdef BLIS_ENABLE_BLAS
+INSERT_GENTPROTR2_BLAS( rot )
+#endif
+
 #endif
 
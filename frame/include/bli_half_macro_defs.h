@@ -0,0 +1,146 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_HALF_MACRO_DEFS_H
+#define BLIS_HALF_MACRO_DEFS_H
+
+
+// -- Half-precision conversion functions --
+
+// NOTE: These scalar conversions are the reference semantics for all of the
+// bfloat16/float16 code in BLIS (including vectorized kernels): widening is
+// exact, and narrowing rounds to nearest with ties to even. NaN inputs are
+// narrowed to quiet NaNs.
+
+BLIS_INLINE float bli_bf16_to_float( bfloat16 x )
+{
+	union { uint32_t u; float f; } r;
+
+	r.u = ( uint32_t )x.v << 16;
+
+	return r.f;
+}
+
+BLIS_INLINE bfloat16 bli_float_to_bf16( float x )
+{
+	union { uint32_t u; float f; } r;
+	bfloat16 y;
+
+	r.f = x;
+
+	if ( ( r.u & 0x7fffffff ) > 0x7f800000 )
+		y.v = ( uint16_t )( ( r.u >> 16 ) | 0x0040 );
+	else
+		y.v = ( uint16_t )( ( r.u + 0x7fff + ( ( r.u >> 16 ) & 1 ) ) >> 16 );
+
+	return y;
+}
+
+BLIS_INLINE float bli_f16_to_float( float16 x )
+{
+	union { uint32_t u; float f; } r;
+
+	const uint32_t sign = ( uint32_t )( x.v & 0x8000 ) << 16;
+	const uint32_t expn = ( x.v >> 10 ) & 0x1f;
+	      uint32_t mant = ( x.v & 0x3ff );
+
+	if ( expn == 0 )
+	{
+		if ( mant == 0 ) r.u = sign;
+		else
+		{
+			// Normalize the subnormal value.
+			uint32_t e = 113;
+			while ( ( mant & 0x400 ) == 0 ) { mant <<= 1; --e; }
+			r.u = sign | ( e << 23 ) | ( ( mant & 0x3ff ) << 13 );
+		}
+	}
+	else if ( expn == 31 ) r.u = sign | 0x7f800000 | ( mant << 13 );
+	else                   r.u = sign | ( ( expn + 112 ) << 23 ) | ( mant << 13 );
+
+	return r.f;
+}
+
+BLIS_INLINE float16 bli_float_to_f16( float x )
+{
+	union { uint32_t u; float f; } r;
+	float16 y;
+
+	r.f = x;
+
+	const uint32_t sign = ( r.u >> 16 ) & 0x8000;
+	      uint32_t u    = ( r.u & 0x7fffffff );
+
+	if ( u >= 0x7f800000 )
+	{
+		// Inf or NaN.
+		y.v = ( uint16_t )( sign | 0x7c00 |
+		                    ( u > 0x7f800000 ? 0x200 | ( ( u >> 13 ) & 0x3ff ) : 0 ) );
+	}
+	else if ( u >= 0x477ff000 )
+	{
+		// Values that round beyond 65504 overflow to Inf.
+		y.v = ( uint16_t )( sign | 0x7c00 );
+	}
+	else if ( u < 0x38800000 )
+	{
+		// Values that map to float16 subnormals (or zero).
+		if ( u <= 0x33000000 ) y.v = ( uint16_t )sign;
+		else
+		{
+			const uint32_t e     = u >> 23;
+			const uint32_t m     = ( u & 0x7fffff ) | 0x800000;
+			const uint32_t shift = 126 - e;
+			const uint32_t half  = 1u << ( shift - 1 );
+			const uint32_t rem   = m & ( ( 1u << shift ) - 1 );
+			      uint32_t h     = m >> shift;
+
+			if ( rem > half || ( rem == half && ( h & 1 ) ) ) ++h;
+
+			y.v = ( uint16_t )( sign | h );
+		}
+	}
+	else
+	{
+		u -= ( 112u << 23 );
+		u += 0xfff + ( ( u >> 13 ) & 1 );
+
+		y.v = ( uint16_t )( sign | ( u >> 13 ) );
+	}
+
+	return y;
+}
+
+
+#endif
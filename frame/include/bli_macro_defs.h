@@ -103,6 +103,7 @@
 #include "bli_obj_macro_defs.h"
 #include "bli_complex_macro_defs.h"
 #include "bli_scalar_macro_defs.h"
+#include "bli_half_macro_defs.h"
 #include "bli_error_macro_defs.h"
 #include "bli_blas_macro_defs.h"
 #include "bli_builtin_macro_defs.h"
@@ -136,6 +136,8 @@ BLIS_INLINE void bli_toggle_bool( bool* b )
 #define bli_dtype ( BLIS_DOUBLE   )
 #define bli_ctype ( BLIS_SCOMPLEX )
 #define bli_ztype ( BLIS_DCOMPLEX )
+#define bli_btype ( BLIS_BFLOAT16 )
+#define bli_htype ( BLIS_FLOAT16  )
 
 // return C type for char
 
@@ -143,6 +145,8 @@ BLIS_INLINE void bli_toggle_bool( bool* b )
 #define bli_dctype  double
 #define bli_cctype  scomplex
 #define bli_zctype  dcomplex
+#define bli_bctype  bfloat16
+#define bli_hctype  float16
 
 // return real proj of C type for char
 
@@ -171,6 +171,37 @@ typedef uint32_t objbits_t;  // object information bit field
 
 #endif // BLIS_ENABLE_C99_COMPLEX
 
+// -- Half-precision types --
+
+// Note: These types are storage-only; BLIS never computes in half precision.
+// Elements are widened to float when they are packed (or otherwise read) and
+// narrowed back only when a half-precision result is requested. The unions
+// match the definitions used by the POWER10 sandbox.
+
+// brain float16
+typedef union
+{
+	uint16_t v;
+	struct
+	{
+		uint16_t m:7;
+		uint16_t e:8;
+		uint16_t s:1;
+	} bits;
+} bfloat16;
+
+// ieee float16
+typedef union
+{
+	uint16_t v;
+	struct
+	{
+		uint16_t m:10;
+		uint16_t e:5;
+		uint16_t s:1;
+	} bits;
+} float16;
+
 // -- Atom type --
 
 // Note: atom types are used to hold "bufferless" scalar object values. Note
@@ -377,6 +408,8 @@ typedef void  (*free_ft)  ( void*  p    );
 #define   BLIS_BITVAL_DCOMPLEX_TYPE         ( BLIS_DOMAIN_BIT | BLIS_PRECISION_BIT )
 #define   BLIS_BITVAL_INT_TYPE                0x04
 #define   BLIS_BITVAL_CONST_TYPE              0x05
+#define   BLIS_BITVAL_BFLOAT16_TYPE           0x06
+#define   BLIS_BITVAL_FLOAT16_TYPE            0x07
 #define BLIS_BITVAL_NO_TRANS                  0x0
 #define BLIS_BITVAL_TRANS                     BLIS_TRANS_BIT
 #define BLIS_BITVAL_NO_CONJ                   0x0
@@ -392,6 +425,7 @@ typedef void  (*free_ft)  ( void*  p    );
 #define BLIS_BITVAL_NOT_PACKED                0x0
 #define   BLIS_BITVAL_1E                    ( 0x1  << BLIS_PACK_FORMAT_SHIFT )
 #define   BLIS_BITVAL_1R                    ( 0x2  << BLIS_PACK_FORMAT_SHIFT )
+#define   BLIS_BITVAL_3MI                   ( 0x3  << BLIS_PACK_FORMAT_SHIFT )
 #define   BLIS_BITVAL_PACKED_UNSPEC         ( BLIS_PACK_BIT                                                            )
 #define   BLIS_BITVAL_PACKED_ROWS           ( BLIS_PACK_BIT                                                            )
 #define   BLIS_BITVAL_PACKED_COLUMNS        ( BLIS_PACK_BIT                                         | BLIS_PACK_RC_BIT )
@@ -401,6 +435,8 @@ typedef void  (*free_ft)  ( void*  p    );
 #define   BLIS_BITVAL_PACKED_COL_PANELS_1E  ( BLIS_PACK_BIT | BLIS_BITVAL_1E  | BLIS_PACK_PANEL_BIT | BLIS_PACK_RC_BIT )
 #define   BLIS_BITVAL_PACKED_ROW_PANELS_1R  ( BLIS_PACK_BIT | BLIS_BITVAL_1R  | BLIS_PACK_PANEL_BIT                    )
 #define   BLIS_BITVAL_PACKED_COL_PANELS_1R  ( BLIS_PACK_BIT | BLIS_BITVAL_1R  | BLIS_PACK_PANEL_BIT | BLIS_PACK_RC_BIT )
+#define   BLIS_BITVAL_PACKED_ROW_PANELS_3MI ( BLIS_PACK_BIT | BLIS_BITVAL_3MI | BLIS_PACK_PANEL_BIT                    )
+#define   BLIS_BITVAL_PACKED_COL_PANELS_3MI ( BLIS_PACK_BIT | BLIS_BITVAL_3MI | BLIS_PACK_PANEL_BIT | BLIS_PACK_RC_BIT )
 #define BLIS_BITVAL_PACK_FWD_IF_UPPER         0x0
 #define BLIS_BITVAL_PACK_REV_IF_UPPER         BLIS_PACK_REV_IF_UPPER_BIT
 #define BLIS_BITVAL_PACK_FWD_IF_LOWER         0x0
@@ -480,6 +516,8 @@ typedef enum
 	BLIS_DCOMPLEX          = BLIS_BITVAL_DCOMPLEX_TYPE,
 	BLIS_INT               = BLIS_BITVAL_INT_TYPE,
 	BLIS_CONSTANT          = BLIS_BITVAL_CONST_TYPE,
+	BLIS_BFLOAT16          = BLIS_BITVAL_BFLOAT16_TYPE,
+	BLIS_FLOAT16           = BLIS_BITVAL_FLOAT16_TYPE,
 	BLIS_DT_LO             = BLIS_FLOAT,
 	BLIS_DT_HI             = BLIS_DCOMPLEX
 } num_t;
@@ -511,12 +549,14 @@ typedef enum
 	BLIS_PACKED_ROW_PANELS_1E  = BLIS_BITVAL_PACKED_ROW_PANELS_1E,
 	BLIS_PACKED_COL_PANELS_1E  = BLIS_BITVAL_PACKED_COL_PANELS_1E,
 	BLIS_PACKED_ROW_PANELS_1R  = BLIS_BITVAL_PACKED_ROW_PANELS_1R,
-	BLIS_PACKED_COL_PANELS_1R  = BLIS_BITVAL_PACKED_COL_PANELS_1R
+	BLIS_PACKED_COL_PANELS_1R  = BLIS_BITVAL_PACKED_COL_PANELS_1R,
+	BLIS_PACKED_ROW_PANELS_3MI = BLIS_BITVAL_PACKED_ROW_PANELS_3MI,
+	BLIS_PACKED_COL_PANELS_3MI = BLIS_BITVAL_PACKED_COL_PANELS_3MI
 } pack_t;
 
 // We combine row and column packing into one "type", and we start
 // with BLIS_PACKED_ROW_PANELS, _COLUMN_PANELS.
-#define BLIS_NUM_PACK_SCHEMA_TYPES 3
+#define BLIS_NUM_PACK_SCHEMA_TYPES 4
 
 
 // -- Pack order type --
@@ -609,7 +649,8 @@ typedef enum
 
 typedef enum
 {
-	BLIS_1M        = 0,
+	BLIS_3M        = 0,
+	BLIS_1M,
 	BLIS_NAT,
 	BLIS_IND_FIRST = 0,
 	BLIS_IND_LAST  = BLIS_NAT
@@ -619,6 +660,7 @@ typedef enum
 
 // These are used in bli_l3_*_oapi.c to construct the ind_t values from
 // the induced method substrings that go into function names.
+#define bli_3m   BLIS_3M
 #define bli_1m   BLIS_1M
 #define bli_nat  BLIS_NAT
 
@@ -645,6 +687,7 @@ typedef enum
 	// l1v kernels
 	BLIS_ADDV_KER,
 	BLIS_AMAXV_KER,
+	BLIS_ASUMV_KER,
 	BLIS_AXPBYV_KER,
 	BLIS_AXPYV_KER,
 	BLIS_COPYV_KER,
@@ -652,6 +695,9 @@ typedef enum
 	BLIS_DOTXV_KER,
 	BLIS_INVERTV_KER,
 	BLIS_INVSCALV_KER,
+	BLIS_NORMFV_KER,
+	BLIS_ROTMV_KER,
+	BLIS_ROTV_KER,
 	BLIS_SCALV_KER,
 	BLIS_SCAL2V_KER,
 	BLIS_SETV_KER,
@@ -671,6 +717,8 @@ typedef enum
 	BLIS_PACKM_NRXK_KER,
 	BLIS_PACKM_MRXK_1ER_KER,
 	BLIS_PACKM_NRXK_1ER_KER,
+	BLIS_PACKM_MRXK_3MI_KER,
+	BLIS_PACKM_NRXK_3MI_KER,
 	BLIS_PACKM_MRXMR_DIAG_KER,
 	BLIS_PACKM_NRXNR_DIAG_KER,
 	BLIS_PACKM_MRXMR_DIAG_1ER_KER,
@@ -680,6 +728,12 @@ typedef enum
 	BLIS_UNPACKM_MRXK_KER,
 	BLIS_UNPACKM_NRXK_KER,
 
+	// half-precision pack kernels (bfloat16/float16 widened to float)
+	BLIS_PACKM_MRXK_BF16_KER,
+	BLIS_PACKM_NRXK_BF16_KER,
+	BLIS_PACKM_MRXK_F16_KER,
+	BLIS_PACKM_NRXK_F16_KER,
+
 	// l3 native kernels
 	BLIS_GEMM_UKR,
 	BLIS_GEMMTRSM_L_UKR,
@@ -705,6 +759,12 @@ typedef enum
 	BLIS_GEMMSUP_CCC_UKR,
 	BLIS_GEMMSUP_XXX_UKR,
 
+	// integer gemm kernels (int32 accumulation). These operate on k-grouped
+	// packed micropanels and are registered in the BLIS_FLOAT slot since
+	// they share the float register blocksizes (MR x NR 32-bit elements).
+	BLIS_GEMM_U8S8S32_UKR,
+	BLIS_GEMM_S16S16S32_UKR,
+
 	// BLIS_NUM_UKRS must be last!
 	BLIS_NUM_UKRS
 } ukr_t;
@@ -1431,6 +1491,25 @@ BLIS_INLINE void bli_obj_init_subpart_from( const obj_t* a, obj_t* b )
 }
 
 
+// -- Tiny gemm dispatch type --
+
+// For one datatype, the sup millikernel that single-threaded sup execution
+// of gemm would call for each storage combination (or NULL if there is
+// none), whether the operation is transposed before calling it, and the
+// blocksizes needed to call it directly. See bli_gemm_tiny.c.
+
+typedef struct
+{
+	void_fp   ker[ BLIS_NUM_3OP_RC_COMBOS ];
+	bool      trans[ BLIS_NUM_3OP_RC_COMBOS ];
+
+	dim_t     mr;
+	dim_t     nr;
+	dim_t     nr_max;
+	dim_t     max_dim;
+} l3_tiny_t;
+
+
 // -- Context type --
 
 typedef struct cntx_s
@@ -1443,6 +1522,9 @@ typedef struct cntx_s
 
 	void_fp   l3_sup_handlers[ BLIS_NUM_LEVEL3_OPS ];
 
+	// Derived from the fields above; see bli_cntx_update_l3_tiny().
+	l3_tiny_t l3_tiny[ BLIS_NUM_FP_TYPES ];
+
 	ind_t     method;
 
 } cntx_t;
@@ -1465,6 +1547,7 @@ typedef struct rntm_s
 	bool      pack_a; // enable/disable packing of left-hand matrix A.
 	bool      pack_b; // enable/disable packing of right-hand matrix B.
 	bool      l3_sup; // enable/disable small matrix handling in level-3 ops.
+	bool      repro;  // enable/disable thread-count-independent results.
 } rntm_t;
 
 
@@ -1576,6 +1659,9 @@ typedef enum
 	BLIS_NC_MAX_NONMULTIPLE_OF_NR              = (-163),
 	BLIS_KC_DEF_NONMULTIPLE_OF_KR              = (-164),
 	BLIS_KC_MAX_NONMULTIPLE_OF_KR              = (-165),
+	BLIS_NONPOSITIVE_BLKSZ                     = (-166),
+	BLIS_MC_DEF_NONMULTIPLE_OF_NR              = (-167),
+	BLIS_NC_DEF_NONMULTIPLE_OF_MR              = (-168),
 
 	BLIS_ERROR_CODE_MAX                        = (-170)
 } err_t;
@@ -151,6 +151,8 @@ extern "C" {
 #include "bli_opid.h"
 #include "bli_cntl.h"
 #include "bli_env.h"
+#include "bli_tune.h"
+#include "bli_trace.h"
 #include "bli_pack.h"
 #include "bli_info.h"
 #include "bli_arch.h"
@@ -717,6 +717,14 @@ const char* bli_thread_get_thread_impl_str( timpl_t ti )
 	return bli_timpl_string[ti];
 }
 
+bool bli_thread_get_reproducible( void )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	return bli_rntm_repro( &global_rntm );
+}
+
 // ----------------------------------------------------------------------------
 
 void bli_thread_set_ways( dim_t jc, dim_t pc, dim_t ic, dim_t jr, dim_t ir )
@@ -785,6 +793,20 @@ void bli_thread_set_thread_impl( timpl_t ti )
 	bli_pthread_mutex_unlock( &global_rntm_mutex );
 }
 
+void bli_thread_set_reproducible( bool repro )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	// Acquire the mutex protecting global_rntm.
+	bli_pthread_mutex_lock( &global_rntm_mutex );
+
+	bli_rntm_set_repro( repro, &global_rntm );
+
+	// Release the mutex protecting global_rntm.
+	bli_pthread_mutex_unlock( &global_rntm_mutex );
+}
+
 // ----------------------------------------------------------------------------
 
 //#define PRINT_IMPL
@@ -872,10 +894,17 @@ void bli_thread_init_rntm_from_env
 
 	// ------------------------------------------------------------------------
 
+	// Try to read BLIS_REPRODUCIBLE. Any nonzero value requests results that
+	// are bitwise identical regardless of the number of threads.
+	bool repro = ( bli_env_get_var( "BLIS_REPRODUCIBLE", 0 ) != 0 );
+
+	// ------------------------------------------------------------------------
+
 	// Save the results back in the runtime object.
 	bli_rntm_set_thread_impl_only( ti, rntm );
 	bli_rntm_set_num_threads_only( nt, rntm );
 	bli_rntm_set_ways_only( jc, pc, ic, jr, ir, rntm );
+	bli_rntm_set_repro( repro, rntm );
 
 	// ------------------------------------------------------------------------
 
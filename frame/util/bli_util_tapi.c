@@ -41,7 +41,7 @@
 //
 
 #undef  GENTFUNCR
-#define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, kerid ) \
 \
 void PASTEMAC2(ch,opname,EX_SUF) \
      ( \
@@ -64,21 +64,22 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 	} \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
-	/*if ( cntx == NULL ) cntx = bli_gks_query_cntx();*/ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
 \
-	/* Invoke the helper variant, which loops over the appropriate kernel
-	   to implement the current operation. */ \
-	PASTEMAC2(ch,opname,_unb_var1) \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	PASTECH(opname,_ker_ft) f = bli_cntx_get_ukr_dt( dt, kerid, cntx ); \
+\
+	f \
 	( \
 	  n, \
-	  ( ctype* )x, incx, \
-	            asum, \
-	  ( cntx_t* )cntx, \
-	  ( rntm_t* )rntm  \
+	  x, incx, \
+	  asum, \
+	  cntx  \
 	); \
 }
 
-INSERT_GENTFUNCR_BASIC( asumv )
+INSERT_GENTFUNCR_BASIC( asumv, BLIS_ASUMV_KER )
 
 
 #undef  GENTFUNC
@@ -158,10 +159,51 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 }
 
 INSERT_GENTFUNCR_BASIC( norm1v )
-INSERT_GENTFUNCR_BASIC( normfv )
 INSERT_GENTFUNCR_BASIC( normiv )
 
 
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, kerid ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+             dim_t    n, \
+       const ctype*   x, inc_t incx, \
+             ctype_r* norm  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	/* If the vector length is zero, set the norm to zero and return
+	   early. */ \
+	if ( bli_zero_dim1( n ) ) \
+	{ \
+		PASTEMAC(chr,set0s)( *norm ); \
+		return; \
+	} \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	PASTECH(opname,_ker_ft) f = bli_cntx_get_ukr_dt( dt, kerid, cntx ); \
+\
+	f \
+	( \
+	  n, \
+	  x, incx, \
+	  norm, \
+	  cntx  \
+	); \
+}
+
+INSERT_GENTFUNCR_BASIC( normfv, BLIS_NORMFV_KER )
+
+
 #undef  GENTFUNCR
 #define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
 \
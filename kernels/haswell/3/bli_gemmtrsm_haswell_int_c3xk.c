@@ -0,0 +1,306 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// AVX2 complex gemmtrsm and trsm microkernels for the haswell register
+// blocksizes (3x8 for scomplex and 3x4 for dcomplex, the same shapes as the
+// complex gemm microkernels in bli_gemm_haswell_asm_d6x8.c). Each row of
+// the micro-tile is held in two ymm registers of interleaved (real, imag)
+// pairs.
+//
+// The gemm portion is computed by the assembly gemm microkernel, which
+// updates the packed micropanel of B in place. The triangular solve is then
+// performed entirely in registers: each row is updated by a complex scalar
+// times the rows solved before it and scaled by the (pre-inverted) diagonal
+// element, after which the tile is written to both the packed micropanel of
+// B and to C. Compared with the reference gemmtrsm microkernel, this avoids
+// the scalar solve and the copy through a temporary micro-tile.
+//
+// A11 is packed column-wise (with leading dimension MR) and B11 row-wise
+// (with leading dimension NR); the haswell configuration does not
+// duplicate the elements of B (BBN = 1).
+//
+
+// Swap the real and imaginary parts of each element of a vector.
+#define GTI_CSWAP( x )  GTI_PERMUTE( x, GTI_SWAP_IMM )
+
+// Multiply each element of a vector by the complex scalar (ar, ai).
+#define GTI_CMUL( x, ar, ai ) \
+  GTI_FMADDSUB( ar, x, GTI_MUL( ai, GTI_CSWAP( x ) ) )
+
+// Load row i of B11.
+#define GTI_LOAD_ROW( i ) \
+{ \
+	const GTI_FTYPE* bi = ( const GTI_FTYPE* )( b11 + (i)*GTI_NR ); \
+	r ## i ## 0 = GTI_LOADU( bi ); \
+	r ## i ## 1 = GTI_LOADU( bi + 2*GTI_VL ); \
+}
+
+// Row i := row i - alpha11(i,j) * row j.
+#define GTI_ELIM_ROW( i, j ) \
+{ \
+	const GTI_FTYPE* aij = ( const GTI_FTYPE* )( a11 + (i) + (j)*GTI_MR ); \
+	const GTI_VEC ar = GTI_BCAST( aij ); \
+	const GTI_VEC ai = GTI_BCAST( aij + 1 ); \
+	r ## i ## 0 = GTI_SUB( r ## i ## 0, GTI_CMUL( r ## j ## 0, ar, ai ) ); \
+	r ## i ## 1 = GTI_SUB( r ## i ## 1, GTI_CMUL( r ## j ## 1, ar, ai ) ); \
+}
+
+// Row i := row i / alpha11(i,i). When trsm pre-inversion is enabled, the
+// packing routine has already stored the inverse of the diagonal element.
+#ifdef BLIS_ENABLE_TRSM_PREINVERSION
+#define GTI_SCALE_ROW( i ) \
+{ \
+	const GTI_FTYPE* aii = ( const GTI_FTYPE* )( a11 + (i) + (i)*GTI_MR ); \
+	const GTI_VEC ar = GTI_BCAST( aii ); \
+	const GTI_VEC ai = GTI_BCAST( aii + 1 ); \
+	r ## i ## 0 = GTI_CMUL( r ## i ## 0, ar, ai ); \
+	r ## i ## 1 = GTI_CMUL( r ## i ## 1, ar, ai ); \
+}
+#else
+#define GTI_SCALE_ROW( i ) \
+{ \
+	GTI_CTYPE inv = a11[ (i) + (i)*GTI_MR ]; \
+	GTI_INVERTS( inv ); \
+	const GTI_VEC ar = GTI_BCAST( ( const GTI_FTYPE* )&inv ); \
+	const GTI_VEC ai = GTI_BCAST( ( const GTI_FTYPE* )&inv + 1 ); \
+	r ## i ## 0 = GTI_CMUL( r ## i ## 0, ar, ai ); \
+	r ## i ## 1 = GTI_CMUL( r ## i ## 1, ar, ai ); \
+}
+#endif
+
+#define GTI_SOLVE_l() \
+{ \
+	GTI_SCALE_ROW( 0 ); \
+	GTI_ELIM_ROW( 1, 0 ); \
+	GTI_SCALE_ROW( 1 ); \
+	GTI_ELIM_ROW( 2, 0 ); \
+	GTI_ELIM_ROW( 2, 1 ); \
+	GTI_SCALE_ROW( 2 ); \
+}
+
+#define GTI_SOLVE_u() \
+{ \
+	GTI_SCALE_ROW( 2 ); \
+	GTI_ELIM_ROW( 1, 2 ); \
+	GTI_SCALE_ROW( 1 ); \
+	GTI_ELIM_ROW( 0, 2 ); \
+	GTI_ELIM_ROW( 0, 1 ); \
+	GTI_SCALE_ROW( 0 ); \
+}
+
+// Store row i to the micropanel of B11 and, if C is stored with unit
+// column stride and the micro-tile is full, directly to C. Otherwise the
+// row is staged in ct so that it can be copied to C element-wise.
+#define GTI_STORE_ROW( i ) \
+{ \
+	GTI_FTYPE* bi = ( GTI_FTYPE* )( b11 + (i)*GTI_NR ); \
+	GTI_STOREU( bi,            r ## i ## 0 ); \
+	GTI_STOREU( bi + 2*GTI_VL, r ## i ## 1 ); \
+\
+	GTI_FTYPE* ci = ( use_ct ? ( GTI_FTYPE* )( ct + (i)*GTI_NR ) \
+	                         : ( GTI_FTYPE* )( c11 + (i)*rs_c ) ); \
+	GTI_STOREU( ci,            r ## i ## 0 ); \
+	GTI_STOREU( ci + 2*GTI_VL, r ## i ## 1 ); \
+}
+
+#define GTI_STORE( m, n ) \
+{ \
+	GTI_CTYPE ct[ GTI_MR * GTI_NR ]; \
+	const bool use_ct = !( (m) == GTI_MR && (n) == GTI_NR && cs_c == 1 ); \
+\
+	GTI_STORE_ROW( 0 ); \
+	GTI_STORE_ROW( 1 ); \
+	GTI_STORE_ROW( 2 ); \
+\
+	if ( use_ct ) \
+	{ \
+		for ( dim_t i = 0; i < (m); ++i ) \
+		for ( dim_t j = 0; j < (n); ++j ) \
+			c11[ i*rs_c + j*cs_c ] = ct[ i*GTI_NR + j ]; \
+	} \
+}
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, uplo, arch, suf ) \
+\
+void PASTEMAC4(ch,opname,uplo,arch,suf) \
+     ( \
+             dim_t      m, \
+             dim_t      n, \
+             dim_t      k, \
+       const void*      alpha0, \
+       const void*      a1x0, \
+       const void*      a110, \
+       const void*      bx10, \
+             void*      b110, \
+             void*      c110, inc_t rs_c, inc_t cs_c, \
+             auxinfo_t* data, \
+       const cntx_t*    cntx  \
+     ) \
+{ \
+	const ctype* restrict alpha = alpha0; \
+	const ctype* restrict a     = a1x0; \
+	const ctype* restrict a11   = a110; \
+	const ctype* restrict b     = bx10; \
+	      ctype* restrict b11   = b110; \
+	      ctype* restrict c11   = c110; \
+\
+	/* B11 := alpha * B11 - A1x * Bx1. The micropanels are always packed
+	   to full MR x NR size, so the gemm microkernel can update B11 in place
+	   regardless of m and n. */ \
+	GTI_GEMM_UKR \
+	( \
+	  GTI_MR, \
+	  GTI_NR, \
+	  k, \
+	  PASTEMAC(ch,m1), \
+	  a, \
+	  b, \
+	  alpha, \
+	  b11, GTI_NR, 1, \
+	  data, \
+	  cntx  \
+	); \
+\
+	GTI_VEC r00, r01, r10, r11, r20, r21; \
+\
+	GTI_LOAD_ROW( 0 ); \
+	GTI_LOAD_ROW( 1 ); \
+	GTI_LOAD_ROW( 2 ); \
+\
+	/* B11 := inv(A11) * B11; C11 := B11 */ \
+	PASTECH(GTI_SOLVE_,uplo)(); \
+\
+	GTI_STORE( m, n ); \
+}
+
+#undef  GENTFUNC2
+#define GENTFUNC2( ctype, ch, opname, uplo, arch, suf ) \
+\
+void PASTEMAC4(ch,opname,uplo,arch,suf) \
+     ( \
+       const void*      a110, \
+             void*      b110, \
+             void*      c110, inc_t rs_c, inc_t cs_c, \
+             auxinfo_t* data, \
+       const cntx_t*    cntx  \
+     ) \
+{ \
+	const ctype* restrict a11 = a110; \
+	      ctype* restrict b11 = b110; \
+	      ctype* restrict c11 = c110; \
+\
+	GTI_VEC r00, r01, r10, r11, r20, r21; \
+\
+	GTI_LOAD_ROW( 0 ); \
+	GTI_LOAD_ROW( 1 ); \
+	GTI_LOAD_ROW( 2 ); \
+\
+	PASTECH(GTI_SOLVE_,uplo)(); \
+\
+	GTI_STORE( GTI_MR, GTI_NR ); \
+}
+
+
+// -- scomplex (3x8) -----------------------------------------------------------
+
+#define GTI_CTYPE     scomplex
+#define GTI_FTYPE     float
+#define GTI_VEC       __m256
+#define GTI_MR        3
+#define GTI_NR        8
+#define GTI_VL        4
+#define GTI_SWAP_IMM  0xB1
+#define GTI_INVERTS   bli_cinverts
+#define GTI_GEMM_UKR  bli_cgemm_haswell_asm_3x8
+#define GTI_LOADU     _mm256_loadu_ps
+#define GTI_STOREU    _mm256_storeu_ps
+#define GTI_BCAST     _mm256_broadcast_ss
+#define GTI_PERMUTE   _mm256_permute_ps
+#define GTI_FMADDSUB  _mm256_fmaddsub_ps
+#define GTI_MUL       _mm256_mul_ps
+#define GTI_SUB       _mm256_sub_ps
+
+GENTFUNC(  scomplex, c, gemmtrsm_, l, _haswell_int, _3x8 )
+GENTFUNC(  scomplex, c, gemmtrsm_, u, _haswell_int, _3x8 )
+GENTFUNC2( scomplex, c, trsm_,     l, _haswell_int, _3x8 )
+GENTFUNC2( scomplex, c, trsm_,     u, _haswell_int, _3x8 )
+
+#undef GTI_CTYPE
+#undef GTI_FTYPE
+#undef GTI_VEC
+#undef GTI_MR
+#undef GTI_NR
+#undef GTI_VL
+#undef GTI_SWAP_IMM
+#undef GTI_INVERTS
+#undef GTI_GEMM_UKR
+#undef GTI_LOADU
+#undef GTI_STOREU
+#undef GTI_BCAST
+#undef GTI_PERMUTE
+#undef GTI_FMADDSUB
+#undef GTI_MUL
+#undef GTI_SUB
+
+
+// -- dcomplex (3x4) -----------------------------------------------------------
+
+#define GTI_CTYPE     dcomplex
+#define GTI_FTYPE     double
+#define GTI_VEC       __m256d
+#define GTI_MR        3
+#define GTI_NR        4
+#define GTI_VL        2
+#define GTI_SWAP_IMM  0x5
+#define GTI_INVERTS   bli_zinverts
+#define GTI_GEMM_UKR  bli_zgemm_haswell_asm_3x4
+#define GTI_LOADU     _mm256_loadu_pd
+#define GTI_STOREU    _mm256_storeu_pd
+#define GTI_BCAST     _mm256_broadcast_sd
+#define GTI_PERMUTE   _mm256_permute_pd
+#define GTI_FMADDSUB  _mm256_fmaddsub_pd
+#define GTI_MUL       _mm256_mul_pd
+#define GTI_SUB       _mm256_sub_pd
+
+GENTFUNC(  dcomplex, z, gemmtrsm_, l, _haswell_int, _3x4 )
+GENTFUNC(  dcomplex, z, gemmtrsm_, u, _haswell_int, _3x4 )
+GENTFUNC2( dcomplex, z, trsm_,     l, _haswell_int, _3x4 )
+GENTFUNC2( dcomplex, z, trsm_,     u, _haswell_int, _3x4 )
+
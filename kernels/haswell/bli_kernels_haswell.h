@@ -71,6 +71,22 @@ GEMMTRSM_UKR_PROT( double,   d, gemmtrsm_l_haswell_asm_6x8 )
 GEMMTRSM_UKR_PROT( float,    s, gemmtrsm_u_haswell_asm_6x16 )
 GEMMTRSM_UKR_PROT( double,   d, gemmtrsm_u_haswell_asm_6x8 )
 
+// gemmtrsm_l (intrinsics c3x8/z3x4)
+GEMMTRSM_UKR_PROT( scomplex, c, gemmtrsm_l_haswell_int_3x8 )
+GEMMTRSM_UKR_PROT( dcomplex, z, gemmtrsm_l_haswell_int_3x4 )
+
+// gemmtrsm_u (intrinsics c3x8/z3x4)
+GEMMTRSM_UKR_PROT( scomplex, c, gemmtrsm_u_haswell_int_3x8 )
+GEMMTRSM_UKR_PROT( dcomplex, z, gemmtrsm_u_haswell_int_3x4 )
+
+// trsm_l (intrinsics c3x8/z3x4)
+TRSM_UKR_PROT( scomplex, c, trsm_l_haswell_int_3x8 )
+TRSM_UKR_PROT( dcomplex, z, trsm_l_haswell_int_3x4 )
+
+// trsm_u (intrinsics c3x8/z3x4)
+TRSM_UKR_PROT( scomplex, c, trsm_u_haswell_int_3x8 )
+TRSM_UKR_PROT( dcomplex, z, trsm_u_haswell_int_3x4 )
+
 
 // gemm (asm d8x6)
 //GEMM_UKR_PROT( float,    s, gemm_haswell_asm_16x6 )
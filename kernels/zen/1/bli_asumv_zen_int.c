@@ -0,0 +1,217 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+/* Union data structure to access AVX registers
+   One 256-bit AVX register holds 8 SP elements. */
+typedef union
+{
+	__m256  v;
+	float   f[8] __attribute__((aligned(64)));
+} v8sf_t;
+
+/* Union data structure to access AVX registers
+   One 256-bit AVX register holds 4 DP elements. */
+typedef union
+{
+	__m256d v;
+	double  d[4] __attribute__((aligned(64)));
+} v4df_t;
+
+// -----------------------------------------------------------------------------
+
+static float bli_sasumv_sum_zen_int
+     (
+       dim_t        n,
+       const float* x,
+       inc_t        incx
+     )
+{
+	float asum = 0.0F;
+	dim_t i    = 0;
+
+	if ( incx == 1 )
+	{
+		const __m256 signv = _mm256_set1_ps( -0.0F );
+
+		v8sf_t accv[4];
+
+		accv[0].v = _mm256_setzero_ps();
+		accv[1].v = _mm256_setzero_ps();
+		accv[2].v = _mm256_setzero_ps();
+		accv[3].v = _mm256_setzero_ps();
+
+		for ( ; ( i + 31 ) < n; i += 32 )
+		{
+			accv[0].v = _mm256_add_ps( accv[0].v, _mm256_andnot_ps( signv, _mm256_loadu_ps( x + i +  0 ) ) );
+			accv[1].v = _mm256_add_ps( accv[1].v, _mm256_andnot_ps( signv, _mm256_loadu_ps( x + i +  8 ) ) );
+			accv[2].v = _mm256_add_ps( accv[2].v, _mm256_andnot_ps( signv, _mm256_loadu_ps( x + i + 16 ) ) );
+			accv[3].v = _mm256_add_ps( accv[3].v, _mm256_andnot_ps( signv, _mm256_loadu_ps( x + i + 24 ) ) );
+		}
+
+		for ( ; ( i + 7 ) < n; i += 8 )
+		{
+			accv[0].v = _mm256_add_ps( accv[0].v, _mm256_andnot_ps( signv, _mm256_loadu_ps( x + i ) ) );
+		}
+
+		accv[0].v = _mm256_add_ps( accv[0].v, accv[1].v );
+		accv[2].v = _mm256_add_ps( accv[2].v, accv[3].v );
+		accv[0].v = _mm256_add_ps( accv[0].v, accv[2].v );
+
+		asum = accv[0].f[0] + accv[0].f[1] + accv[0].f[2] + accv[0].f[3] +
+		       accv[0].f[4] + accv[0].f[5] + accv[0].f[6] + accv[0].f[7];
+	}
+
+	for ( ; i < n; ++i )
+	{
+		asum += bli_fabs( x[ i*incx ] );
+	}
+
+	return asum;
+}
+
+static double bli_dasumv_sum_zen_int
+     (
+       dim_t         n,
+       const double* x,
+       inc_t         incx
+     )
+{
+	double asum = 0.0;
+	dim_t  i    = 0;
+
+	if ( incx == 1 )
+	{
+		const __m256d signv = _mm256_set1_pd( -0.0 );
+
+		v4df_t accv[4];
+
+		accv[0].v = _mm256_setzero_pd();
+		accv[1].v = _mm256_setzero_pd();
+		accv[2].v = _mm256_setzero_pd();
+		accv[3].v = _mm256_setzero_pd();
+
+		for ( ; ( i + 15 ) < n; i += 16 )
+		{
+			accv[0].v = _mm256_add_pd( accv[0].v, _mm256_andnot_pd( signv, _mm256_loadu_pd( x + i +  0 ) ) );
+			accv[1].v = _mm256_add_pd( accv[1].v, _mm256_andnot_pd( signv, _mm256_loadu_pd( x + i +  4 ) ) );
+			accv[2].v = _mm256_add_pd( accv[2].v, _mm256_andnot_pd( signv, _mm256_loadu_pd( x + i +  8 ) ) );
+			accv[3].v = _mm256_add_pd( accv[3].v, _mm256_andnot_pd( signv, _mm256_loadu_pd( x + i + 12 ) ) );
+		}
+
+		for ( ; ( i + 3 ) < n; i += 4 )
+		{
+			accv[0].v = _mm256_add_pd( accv[0].v, _mm256_andnot_pd( signv, _mm256_loadu_pd( x + i ) ) );
+		}
+
+		accv[0].v = _mm256_add_pd( accv[0].v, accv[1].v );
+		accv[2].v = _mm256_add_pd( accv[2].v, accv[3].v );
+		accv[0].v = _mm256_add_pd( accv[0].v, accv[2].v );
+
+		asum = accv[0].d[0] + accv[0].d[1] + accv[0].d[2] + accv[0].d[3];
+	}
+
+	for ( ; i < n; ++i )
+	{
+		asum += bli_fabs( x[ i*incx ] );
+	}
+
+	return asum;
+}
+
+// -----------------------------------------------------------------------------
+
+// For complex vectors, asumv sums the absolute values of the real and
+// imaginary parts, so a contiguous complex vector may be treated as a real
+// vector of twice the length.
+
+void bli_sasumv_zen_int
+     (
+             dim_t   n,
+       const void*   x0, inc_t incx,
+             void*   asum0,
+       const cntx_t* cntx
+     )
+{
+	*( float* )asum0 = bli_sasumv_sum_zen_int( n, x0, incx );
+}
+
+void bli_casumv_zen_int
+     (
+             dim_t   n,
+       const void*   x0, inc_t incx,
+             void*   asum0,
+       const cntx_t* cntx
+     )
+{
+	const float* x = x0;
+
+	if ( incx == 1 )
+		*( float* )asum0 = bli_sasumv_sum_zen_int( 2*n, x, 1 );
+	else
+		*( float* )asum0 = bli_sasumv_sum_zen_int( n, x + 0, 2*incx ) +
+		                   bli_sasumv_sum_zen_int( n, x + 1, 2*incx );
+}
+
+void bli_dasumv_zen_int
+     (
+             dim_t   n,
+       const void*   x0, inc_t incx,
+             void*   asum0,
+       const cntx_t* cntx
+     )
+{
+	*( double* )asum0 = bli_dasumv_sum_zen_int( n, x0, incx );
+}
+
+void bli_zasumv_zen_int
+     (
+             dim_t   n,
+       const void*   x0, inc_t incx,
+             void*   asum0,
+       const cntx_t* cntx
+     )
+{
+	const double* x = x0;
+
+	if ( incx == 1 )
+		*( double* )asum0 = bli_dasumv_sum_zen_int( 2*n, x, 1 );
+	else
+		*( double* )asum0 = bli_dasumv_sum_zen_int( n, x + 0, 2*incx ) +
+		                    bli_dasumv_sum_zen_int( n, x + 1, 2*incx );
+}
+
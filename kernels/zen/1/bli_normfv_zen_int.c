@@ -0,0 +1,345 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+/* Union data structure to access AVX registers
+   One 256-bit AVX register holds 4 DP elements. */
+typedef union
+{
+	__m256d v;
+	double  d[4] __attribute__((aligned(64)));
+} v4df_t;
+
+// -----------------------------------------------------------------------------
+
+// The single-precision kernels square and accumulate each element in double
+// precision. Since the square of any finite float (including subnormals) is
+// a normal double, and a sum of up to 2^63 such squares cannot overflow, no
+// scaling is needed to protect against overflow or underflow.
+
+static double bli_snormfv_sumsq_zen_int
+     (
+       dim_t        n,
+       const float* x,
+       inc_t        incx
+     )
+{
+	double sumsq = 0.0;
+	dim_t  i     = 0;
+
+	if ( incx == 1 )
+	{
+		v4df_t accv[4];
+
+		accv[0].v = _mm256_setzero_pd();
+		accv[1].v = _mm256_setzero_pd();
+		accv[2].v = _mm256_setzero_pd();
+		accv[3].v = _mm256_setzero_pd();
+
+		for ( ; ( i + 15 ) < n; i += 16 )
+		{
+			__m256 x0v = _mm256_loadu_ps( x + i + 0 );
+			__m256 x1v = _mm256_loadu_ps( x + i + 8 );
+
+			__m256d x0l = _mm256_cvtps_pd( _mm256_castps256_ps128( x0v ) );
+			__m256d x0h = _mm256_cvtps_pd( _mm256_extractf128_ps( x0v, 1 ) );
+			__m256d x1l = _mm256_cvtps_pd( _mm256_castps256_ps128( x1v ) );
+			__m256d x1h = _mm256_cvtps_pd( _mm256_extractf128_ps( x1v, 1 ) );
+
+			accv[0].v = _mm256_fmadd_pd( x0l, x0l, accv[0].v );
+			accv[1].v = _mm256_fmadd_pd( x0h, x0h, accv[1].v );
+			accv[2].v = _mm256_fmadd_pd( x1l, x1l, accv[2].v );
+			accv[3].v = _mm256_fmadd_pd( x1h, x1h, accv[3].v );
+		}
+
+		accv[0].v = _mm256_add_pd( accv[0].v, accv[1].v );
+		accv[2].v = _mm256_add_pd( accv[2].v, accv[3].v );
+		accv[0].v = _mm256_add_pd( accv[0].v, accv[2].v );
+
+		sumsq = accv[0].d[0] + accv[0].d[1] + accv[0].d[2] + accv[0].d[3];
+	}
+
+	for ( ; i < n; ++i )
+	{
+		const double chi1 = x[ i*incx ];
+
+		sumsq += chi1 * chi1;
+	}
+
+	return sumsq;
+}
+
+void bli_snormfv_zen_int
+     (
+             dim_t   n,
+       const void*   x0, inc_t incx,
+             void*   norm0,
+       const cntx_t* cntx
+     )
+{
+	const float* x    = x0;
+	      float* norm = norm0;
+
+	*norm = ( float )sqrt( bli_snormfv_sumsq_zen_int( n, x, incx ) );
+}
+
+void bli_cnormfv_zen_int
+     (
+             dim_t   n,
+       const void*   x0, inc_t incx,
+             void*   norm0,
+       const cntx_t* cntx
+     )
+{
+	const float* x    = x0;
+	      float* norm = norm0;
+	      double sumsq;
+
+	// A contiguous complex vector may be treated as a real vector of twice
+	// the length. Otherwise, accumulate the real and imaginary parts as two
+	// separate strided real vectors.
+	if ( incx == 1 )
+		sumsq = bli_snormfv_sumsq_zen_int( 2*n, x, 1 );
+	else
+		sumsq = bli_snormfv_sumsq_zen_int( n, x + 0, 2*incx ) +
+		        bli_snormfv_sumsq_zen_int( n, x + 1, 2*incx );
+
+	*norm = ( float )sqrt( sumsq );
+}
+
+// -----------------------------------------------------------------------------
+
+// The double-precision kernels use Blue's algorithm, as in LAPACK 3.10's
+// dnrm2: elements are sorted into three accumulators according to their
+// magnitude, with the "small" and "big" accumulators scaled so that their
+// squares can neither underflow nor overflow. Since nearly all elements in
+// practice fall within the "medium" range, the vectorized loop first checks
+// each block for elements outside of that range and, only if it finds any,
+// recomputes the block with the (slower) three-way classification.
+
+#define TSML  0x1p-511   // Values below this are "small" ...
+#define TBIG  0x1p+486   // ... and values above this are "big".
+#define SSML  0x1p+537   // Scale factor applied to small values.
+#define SBIG  0x1p-538   // Scale factor applied to big values.
+
+static void bli_dnormfv_acc_zen_int
+     (
+       dim_t         n,
+       const double* x,
+       inc_t         incx,
+       double*       asml,
+       double*       amed,
+       double*       abig
+     )
+{
+	dim_t i = 0;
+
+	if ( incx == 1 )
+	{
+		const __m256d signv = _mm256_set1_pd( -0.0 );
+		const __m256d zerov = _mm256_setzero_pd();
+		const __m256d tsmlv = _mm256_set1_pd( TSML );
+		const __m256d tbigv = _mm256_set1_pd( TBIG );
+		const __m256d ssmlv = _mm256_set1_pd( SSML );
+		const __m256d sbigv = _mm256_set1_pd( SBIG );
+
+		v4df_t smlv, bigv, medv[4];
+
+		smlv.v    = _mm256_setzero_pd();
+		bigv.v    = _mm256_setzero_pd();
+		medv[0].v = _mm256_setzero_pd();
+		medv[1].v = _mm256_setzero_pd();
+		medv[2].v = _mm256_setzero_pd();
+		medv[3].v = _mm256_setzero_pd();
+
+		for ( ; ( i + 15 ) < n; i += 16 )
+		{
+			__m256d av[4];
+
+			av[0] = _mm256_andnot_pd( signv, _mm256_loadu_pd( x + i +  0 ) );
+			av[1] = _mm256_andnot_pd( signv, _mm256_loadu_pd( x + i +  4 ) );
+			av[2] = _mm256_andnot_pd( signv, _mm256_loadu_pd( x + i +  8 ) );
+			av[3] = _mm256_andnot_pd( signv, _mm256_loadu_pd( x + i + 12 ) );
+
+			// Flag any element that is big or that is small but nonzero.
+			// (NaN compares false and is left in the medium accumulator,
+			// through which it propagates to the result.)
+			__m256d oorv = _mm256_setzero_pd();
+
+			for ( dim_t j = 0; j < 4; ++j )
+			{
+				__m256d bigm = _mm256_cmp_pd( av[j], tbigv, _CMP_GT_OQ );
+				__m256d smlm = _mm256_and_pd( _mm256_cmp_pd( av[j], tsmlv, _CMP_LT_OQ ),
+				                              _mm256_cmp_pd( av[j], zerov, _CMP_GT_OQ ) );
+
+				oorv = _mm256_or_pd( oorv, _mm256_or_pd( bigm, smlm ) );
+			}
+
+			if ( _mm256_movemask_pd( oorv ) == 0 )
+			{
+				medv[0].v = _mm256_fmadd_pd( av[0], av[0], medv[0].v );
+				medv[1].v = _mm256_fmadd_pd( av[1], av[1], medv[1].v );
+				medv[2].v = _mm256_fmadd_pd( av[2], av[2], medv[2].v );
+				medv[3].v = _mm256_fmadd_pd( av[3], av[3], medv[3].v );
+			}
+			else
+			{
+				for ( dim_t j = 0; j < 4; ++j )
+				{
+					__m256d bigm = _mm256_cmp_pd( av[j], tbigv, _CMP_GT_OQ );
+					__m256d smlm = _mm256_cmp_pd( av[j], tsmlv, _CMP_LT_OQ );
+
+					__m256d bv = _mm256_and_pd( bigm, _mm256_mul_pd( av[j], sbigv ) );
+					__m256d sv = _mm256_and_pd( smlm, _mm256_mul_pd( av[j], ssmlv ) );
+					__m256d mv = _mm256_andnot_pd( _mm256_or_pd( bigm, smlm ), av[j] );
+
+					bigv.v    = _mm256_fmadd_pd( bv, bv, bigv.v );
+					smlv.v    = _mm256_fmadd_pd( sv, sv, smlv.v );
+					medv[j].v = _mm256_fmadd_pd( mv, mv, medv[j].v );
+				}
+			}
+		}
+
+		medv[0].v = _mm256_add_pd( medv[0].v, medv[1].v );
+		medv[2].v = _mm256_add_pd( medv[2].v, medv[3].v );
+		medv[0].v = _mm256_add_pd( medv[0].v, medv[2].v );
+
+		*asml += smlv.d[0] + smlv.d[1] + smlv.d[2] + smlv.d[3];
+		*amed += medv[0].d[0] + medv[0].d[1] + medv[0].d[2] + medv[0].d[3];
+		*abig += bigv.d[0] + bigv.d[1] + bigv.d[2] + bigv.d[3];
+	}
+
+	for ( ; i < n; ++i )
+	{
+		double a = bli_fabs( x[ i*incx ] );
+
+		if      ( a > TBIG ) { a *= SBIG; *abig += a * a; }
+		else if ( a < TSML ) { a *= SSML; *asml += a * a; }
+		else                 {            *amed += a * a; }
+	}
+}
+
+static double bli_dnormfv_combine_zen_int
+     (
+       double asml,
+       double amed,
+       double abig
+     )
+{
+	double scl;
+	double sumsq;
+
+	// Combine the accumulators as in LAPACK's dnrm2. If there are any big
+	// values, the small values cannot matter; if there are no big values,
+	// combine the small and medium values carefully.
+	if ( abig > 0.0 )
+	{
+		if ( amed > 0.0 || bli_isnan( amed ) )
+			abig += ( amed * SBIG ) * SBIG;
+
+		scl   = 1.0 / SBIG;
+		sumsq = abig;
+	}
+	else if ( asml > 0.0 )
+	{
+		if ( amed > 0.0 || bli_isnan( amed ) )
+		{
+			const double ymed = sqrt( amed );
+			const double ysml = sqrt( asml ) / SSML;
+			const double ymin = ( ysml > ymed ? ymed : ysml );
+			const double ymax = ( ysml > ymed ? ysml : ymed );
+
+			scl   = 1.0;
+			sumsq = ymax * ymax * ( 1.0 + ( ymin / ymax ) * ( ymin / ymax ) );
+		}
+		else
+		{
+			scl   = 1.0 / SSML;
+			sumsq = asml;
+		}
+	}
+	else
+	{
+		scl   = 1.0;
+		sumsq = amed;
+	}
+
+	return scl * sqrt( sumsq );
+}
+
+void bli_dnormfv_zen_int
+     (
+             dim_t   n,
+       const void*   x0, inc_t incx,
+             void*   norm0,
+       const cntx_t* cntx
+     )
+{
+	const double* x    = x0;
+	      double* norm = norm0;
+	      double  asml = 0.0, amed = 0.0, abig = 0.0;
+
+	bli_dnormfv_acc_zen_int( n, x, incx, &asml, &amed, &abig );
+
+	*norm = bli_dnormfv_combine_zen_int( asml, amed, abig );
+}
+
+void bli_znormfv_zen_int
+     (
+             dim_t   n,
+       const void*   x0, inc_t incx,
+             void*   norm0,
+       const cntx_t* cntx
+     )
+{
+	const double* x    = x0;
+	      double* norm = norm0;
+	      double  asml = 0.0, amed = 0.0, abig = 0.0;
+
+	if ( incx == 1 )
+	{
+		bli_dnormfv_acc_zen_int( 2*n, x, 1, &asml, &amed, &abig );
+	}
+	else
+	{
+		bli_dnormfv_acc_zen_int( n, x + 0, 2*incx, &asml, &amed, &abig );
+		bli_dnormfv_acc_zen_int( n, x + 1, 2*incx, &asml, &amed, &abig );
+	}
+
+	*norm = bli_dnormfv_combine_zen_int( asml, amed, abig );
+}
+
@@ -0,0 +1,329 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+// Apply the 2x2 real transformation
+//
+//   [ x y ] := [ x y ] * [ h11 h21 ]
+//                        [ h12 h22 ]
+//
+// to the vectors x and y. Plane rotations (rotv) and modified rotations
+// (rotmv) are both instances of this operation. Contiguous vectors are
+// processed four registers at a time with FMA; the strided case and any
+// leftover elements fall back to scalar code.
+
+static void bli_srot2v_zen_int
+     (
+       dim_t  n,
+       float* x, inc_t incx,
+       float* y, inc_t incy,
+       float  h11, float h12,
+       float  h21, float h22
+     )
+{
+	dim_t i = 0;
+
+	if ( incx == 1 && incy == 1 )
+	{
+		const __m256 h11v = _mm256_set1_ps( h11 );
+		const __m256 h12v = _mm256_set1_ps( h12 );
+		const __m256 h21v = _mm256_set1_ps( h21 );
+		const __m256 h22v = _mm256_set1_ps( h22 );
+
+		__m256 xv[4], yv[4], rv[4], tv[4];
+
+		for ( ; ( i + 31 ) < n; i += 32 )
+		{
+			xv[0] = _mm256_loadu_ps( x + i +  0 );
+			xv[1] = _mm256_loadu_ps( x + i +  8 );
+			xv[2] = _mm256_loadu_ps( x + i + 16 );
+			xv[3] = _mm256_loadu_ps( x + i + 24 );
+
+			yv[0] = _mm256_loadu_ps( y + i +  0 );
+			yv[1] = _mm256_loadu_ps( y + i +  8 );
+			yv[2] = _mm256_loadu_ps( y + i + 16 );
+			yv[3] = _mm256_loadu_ps( y + i + 24 );
+
+			rv[0] = _mm256_mul_ps( h11v, xv[0] );
+			rv[1] = _mm256_mul_ps( h11v, xv[1] );
+			rv[2] = _mm256_mul_ps( h11v, xv[2] );
+			rv[3] = _mm256_mul_ps( h11v, xv[3] );
+
+			tv[0] = _mm256_mul_ps( h21v, xv[0] );
+			tv[1] = _mm256_mul_ps( h21v, xv[1] );
+			tv[2] = _mm256_mul_ps( h21v, xv[2] );
+			tv[3] = _mm256_mul_ps( h21v, xv[3] );
+
+			rv[0] = _mm256_fmadd_ps( h12v, yv[0], rv[0] );
+			rv[1] = _mm256_fmadd_ps( h12v, yv[1], rv[1] );
+			rv[2] = _mm256_fmadd_ps( h12v, yv[2], rv[2] );
+			rv[3] = _mm256_fmadd_ps( h12v, yv[3], rv[3] );
+
+			tv[0] = _mm256_fmadd_ps( h22v, yv[0], tv[0] );
+			tv[1] = _mm256_fmadd_ps( h22v, yv[1], tv[1] );
+			tv[2] = _mm256_fmadd_ps( h22v, yv[2], tv[2] );
+			tv[3] = _mm256_fmadd_ps( h22v, yv[3], tv[3] );
+
+			_mm256_storeu_ps( x + i +  0, rv[0] );
+			_mm256_storeu_ps( x + i +  8, rv[1] );
+			_mm256_storeu_ps( x + i + 16, rv[2] );
+			_mm256_storeu_ps( x + i + 24, rv[3] );
+
+			_mm256_storeu_ps( y + i +  0, tv[0] );
+			_mm256_storeu_ps( y + i +  8, tv[1] );
+			_mm256_storeu_ps( y + i + 16, tv[2] );
+			_mm256_storeu_ps( y + i + 24, tv[3] );
+		}
+
+		for ( ; ( i + 7 ) < n; i += 8 )
+		{
+			xv[0] = _mm256_loadu_ps( x + i );
+			yv[0] = _mm256_loadu_ps( y + i );
+
+			rv[0] = _mm256_mul_ps( h11v, xv[0] );
+			tv[0] = _mm256_mul_ps( h21v, xv[0] );
+			rv[0] = _mm256_fmadd_ps( h12v, yv[0], rv[0] );
+			tv[0] = _mm256_fmadd_ps( h22v, yv[0], tv[0] );
+
+			_mm256_storeu_ps( x + i, rv[0] );
+			_mm256_storeu_ps( y + i, tv[0] );
+		}
+
+		// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+		// This avoids a performance penalty caused by false dependencies when
+		// transitioning from AVX to SSE instructions (which may occur later,
+		// especially if BLIS is compiled with -mfpmath=sse).
+		_mm256_zeroupper();
+	}
+
+	for ( ; i < n; ++i )
+	{
+		const float chi1 = x[ i*incx ];
+		const float psi1 = y[ i*incy ];
+
+		x[ i*incx ] = h11 * chi1 + h12 * psi1;
+		y[ i*incy ] = h21 * chi1 + h22 * psi1;
+	}
+}
+
+static void bli_drot2v_zen_int
+     (
+       dim_t   n,
+       double* x, inc_t incx,
+       double* y, inc_t incy,
+       double  h11, double h12,
+       double  h21, double h22
+     )
+{
+	dim_t i = 0;
+
+	if ( incx == 1 && incy == 1 )
+	{
+		const __m256d h11v = _mm256_set1_pd( h11 );
+		const __m256d h12v = _mm256_set1_pd( h12 );
+		const __m256d h21v = _mm256_set1_pd( h21 );
+		const __m256d h22v = _mm256_set1_pd( h22 );
+
+		__m256d xv[4], yv[4], rv[4], tv[4];
+
+		for ( ; ( i + 15 ) < n; i += 16 )
+		{
+			xv[0] = _mm256_loadu_pd( x + i +  0 );
+			xv[1] = _mm256_loadu_pd( x + i +  4 );
+			xv[2] = _mm256_loadu_pd( x + i +  8 );
+			xv[3] = _mm256_loadu_pd( x + i + 12 );
+
+			yv[0] = _mm256_loadu_pd( y + i +  0 );
+			yv[1] = _mm256_loadu_pd( y + i +  4 );
+			yv[2] = _mm256_loadu_pd( y + i +  8 );
+			yv[3] = _mm256_loadu_pd( y + i + 12 );
+
+			rv[0] = _mm256_mul_pd( h11v, xv[0] );
+			rv[1] = _mm256_mul_pd( h11v, xv[1] );
+			rv[2] = _mm256_mul_pd( h11v, xv[2] );
+			rv[3] = _mm256_mul_pd( h11v, xv[3] );
+
+			tv[0] = _mm256_mul_pd( h21v, xv[0] );
+			tv[1] = _mm256_mul_pd( h21v, xv[1] );
+			tv[2] = _mm256_mul_pd( h21v, xv[2] );
+			tv[3] = _mm256_mul_pd( h21v, xv[3] );
+
+			rv[0] = _mm256_fmadd_pd( h12v, yv[0], rv[0] );
+			rv[1] = _mm256_fmadd_pd( h12v, yv[1], rv[1] );
+			rv[2] = _mm256_fmadd_pd( h12v, yv[2], rv[2] );
+			rv[3] = _mm256_fmadd_pd( h12v, yv[3], rv[3] );
+
+			tv[0] = _mm256_fmadd_pd( h22v, yv[0], tv[0] );
+			tv[1] = _mm256_fmadd_pd( h22v, yv[1], tv[1] );
+			tv[2] = _mm256_fmadd_pd( h22v, yv[2], tv[2] );
+			tv[3] = _mm256_fmadd_pd( h22v, yv[3], tv[3] );
+
+			_mm256_storeu_pd( x + i +  0, rv[0] );
+			_mm256_storeu_pd( x + i +  4, rv[1] );
+			_mm256_storeu_pd( x + i +  8, rv[2] );
+			_mm256_storeu_pd( x + i + 12, rv[3] );
+
+			_mm256_storeu_pd( y + i +  0, tv[0] );
+			_mm256_storeu_pd( y + i +  4, tv[1] );
+			_mm256_storeu_pd( y + i +  8, tv[2] );
+			_mm256_storeu_pd( y + i + 12, tv[3] );
+		}
+
+		for ( ; ( i + 3 ) < n; i += 4 )
+		{
+			xv[0] = _mm256_loadu_pd( x + i );
+			yv[0] = _mm256_loadu_pd( y + i );
+
+			rv[0] = _mm256_mul_pd( h11v, xv[0] );
+			tv[0] = _mm256_mul_pd( h21v, xv[0] );
+			rv[0] = _mm256_fmadd_pd( h12v, yv[0], rv[0] );
+			tv[0] = _mm256_fmadd_pd( h22v, yv[0], tv[0] );
+
+			_mm256_storeu_pd( x + i, rv[0] );
+			_mm256_storeu_pd( y + i, tv[0] );
+		}
+
+		// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+		// This avoids a performance penalty caused by false dependencies when
+		// transitioning from AVX to SSE instructions (which may occur later,
+		// especially if BLIS is compiled with -mfpmath=sse).
+		_mm256_zeroupper();
+	}
+
+	for ( ; i < n; ++i )
+	{
+		const double chi1 = x[ i*incx ];
+		const double psi1 = y[ i*incy ];
+
+		x[ i*incx ] = h11 * chi1 + h12 * psi1;
+		y[ i*incy ] = h21 * chi1 + h22 * psi1;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+// Since c and s (and the elements of H for rotmv) are real, the complex
+// kernels apply the real transformation to the real and imaginary parts
+// independently. Contiguous complex vectors are thus treated as real vectors
+// of twice the length, and strided complex vectors as two real vectors with
+// twice the stride.
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, kername ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             dim_t   n, \
+             void*   x0, inc_t incx, \
+             void*   y0, inc_t incy, \
+       const void*   c0, \
+       const void*   s0, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	ctype_r* x = x0; \
+	ctype_r* y = y0; \
+	ctype_r  c = *( const ctype_r* )c0; \
+	ctype_r  s = *( const ctype_r* )s0; \
+	dim_t    m = sizeof( ctype ) / sizeof( ctype_r ); \
+\
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	if ( m == 1 || ( incx == 1 && incy == 1 ) ) \
+	{ \
+		PASTEMAC(chr,kername)( m*n, x, incx, y, incy, c, s, -s, c ); \
+	} \
+	else \
+	{ \
+		PASTEMAC(chr,kername)( n, x + 0, 2*incx, y + 0, 2*incy, c, s, -s, c ); \
+		PASTEMAC(chr,kername)( n, x + 1, 2*incx, y + 1, 2*incy, c, s, -s, c ); \
+	} \
+}
+
+GENTFUNCR( float,    float,  s, s, rotv_zen_int, rot2v_zen_int )
+GENTFUNCR( double,   double, d, d, rotv_zen_int, rot2v_zen_int )
+GENTFUNCR( scomplex, float,  c, s, rotv_zen_int, rot2v_zen_int )
+GENTFUNCR( dcomplex, double, z, d, rotv_zen_int, rot2v_zen_int )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, kername ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             dim_t   n, \
+             void*   x0, inc_t incx, \
+             void*   y0, inc_t incy, \
+       const void*   param0, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	ctype_r*       x     = x0; \
+	ctype_r*       y     = y0; \
+	const ctype_r* param = param0; \
+	const ctype_r  flag  = param[0]; \
+	ctype_r        h11, h21, h12, h22; \
+	dim_t          m     = sizeof( ctype ) / sizeof( ctype_r ); \
+\
+	if ( bli_zero_dim1( n ) || flag == -2.0 ) return; \
+\
+	/* Expand H from its compact representation (see the reference
+	   kernel for the meaning of the flag). */ \
+	if      ( flag <  0.0 ) { h11 = param[1]; h21 = param[2]; \
+	                          h12 = param[3]; h22 = param[4]; } \
+	else if ( flag == 0.0 ) { h11 = 1.0;      h21 = param[2]; \
+	                          h12 = param[3]; h22 = 1.0;      } \
+	else                    { h11 = param[1]; h21 = -1.0; \
+	                          h12 = 1.0;      h22 = param[4]; } \
+\
+	if ( m == 1 || ( incx == 1 && incy == 1 ) ) \
+	{ \
+		PASTEMAC(chr,kername)( m*n, x, incx, y, incy, h11, h12, h21, h22 ); \
+	} \
+	else \
+	{ \
+		PASTEMAC(chr,kername)( n, x + 0, 2*incx, y + 0, 2*incy, h11, h12, h21, h22 ); \
+		PASTEMAC(chr,kername)( n, x + 1, 2*incx, y + 1, 2*incy, h11, h12, h21, h22 ); \
+	} \
+}
+
+GENTFUNCR( float,    float,  s, s, rotmv_zen_int, rot2v_zen_int )
+GENTFUNCR( double,   double, d, d, rotmv_zen_int, rot2v_zen_int )
+GENTFUNCR( scomplex, float,  c, s, rotmv_zen_int, rot2v_zen_int )
+GENTFUNCR( dcomplex, double, z, d, rotmv_zen_int, rot2v_zen_int )
+
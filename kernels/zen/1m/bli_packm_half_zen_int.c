@@ -0,0 +1,185 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+// Widen eight (or four) half-precision values to float. bfloat16 is simply
+// the upper half of a float, so it is zero-extended to 32 bits and shifted
+// into place; float16 uses the F16C conversion instructions.
+
+#define BF16_CVT8( p ) \
+  _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_cvtepu16_epi32( \
+    _mm_loadu_si128( ( const __m128i* )( p ) ) ), 16 ) )
+#define BF16_CVT4( p ) \
+  _mm_castsi128_ps( _mm_slli_epi32( _mm_cvtepu16_epi32( \
+    _mm_loadl_epi64( ( const __m128i* )( p ) ) ), 16 ) )
+
+#define F16_CVT8( p ) \
+  _mm256_cvtph_ps( _mm_loadu_si128( ( const __m128i* )( p ) ) )
+#define F16_CVT4( p ) \
+  _mm_cvtph_ps( _mm_loadl_epi64( ( const __m128i* )( p ) ) )
+
+// Pack a cdim x n micropanel of half-precision values into a float
+// micropanel with leading dimension ldp, scaling by kappa. Three cases are
+// vectorized differently:
+//  - inca == 1: each column of the micropanel is contiguous in the source,
+//    so it is widened directly (8, then 4, then 1 element at a time).
+//  - lda == 1: each row of the micropanel is contiguous in the source, so
+//    eight consecutive columns are widened at once and then stored with a
+//    stride of ldp.
+//  - otherwise: elements are widened one at a time.
+// Finally, the micropanel is zero-padded out to cdim_max x n_max.
+
+#undef  GENTFUNCH
+#define GENTFUNCH( ctype_h, cvt, cvt8, cvt4, opname ) \
+\
+static void PASTEMAC(s,opname) \
+     ( \
+             dim_t   cdim, \
+             dim_t   cdim_max, \
+             dim_t   n, \
+             dim_t   n_max, \
+             float   kappa, \
+       const ctype_h* restrict a, inc_t inca, inc_t lda, \
+             float*   restrict p,             inc_t ldp  \
+     ) \
+{ \
+	const __m256 kv8 = _mm256_set1_ps( kappa ); \
+	const __m128 kv4 = _mm_set1_ps( kappa ); \
+\
+	if ( inca == 1 ) \
+	{ \
+		for ( dim_t k = 0; k < n; ++k ) \
+		{ \
+			const ctype_h* restrict ak = a + k*lda; \
+			      float*   restrict pk = p + k*ldp; \
+			      dim_t             i  = 0; \
+\
+			for ( ; i + 8 <= cdim; i += 8 ) \
+				_mm256_storeu_ps( pk + i, _mm256_mul_ps( kv8, cvt8( ak + i ) ) ); \
+			for ( ; i + 4 <= cdim; i += 4 ) \
+				_mm_storeu_ps( pk + i, _mm_mul_ps( kv4, cvt4( ak + i ) ) ); \
+			for ( ; i < cdim; ++i ) \
+				pk[ i ] = kappa * cvt( ak[ i ] ); \
+		} \
+	} \
+	else if ( lda == 1 ) \
+	{ \
+		float t[ 8 ] __attribute__((aligned(32))); \
+		dim_t k = 0; \
+\
+		for ( ; k + 8 <= n; k += 8 ) \
+		{ \
+			for ( dim_t i = 0; i < cdim; ++i ) \
+			{ \
+				_mm256_store_ps( t, _mm256_mul_ps( kv8, cvt8( a + i*inca + k ) ) ); \
+\
+				float* restrict pi = p + i + k*ldp; \
+\
+				pi[ 0*ldp ] = t[ 0 ]; pi[ 1*ldp ] = t[ 1 ]; \
+				pi[ 2*ldp ] = t[ 2 ]; pi[ 3*ldp ] = t[ 3 ]; \
+				pi[ 4*ldp ] = t[ 4 ]; pi[ 5*ldp ] = t[ 5 ]; \
+				pi[ 6*ldp ] = t[ 6 ]; pi[ 7*ldp ] = t[ 7 ]; \
+			} \
+		} \
+		for ( ; k < n; ++k ) \
+		{ \
+			for ( dim_t i = 0; i < cdim; ++i ) \
+				p[ i + k*ldp ] = kappa * cvt( a[ i*inca + k ] ); \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t k = 0; k < n; ++k ) \
+		{ \
+			for ( dim_t i = 0; i < cdim; ++i ) \
+				p[ i + k*ldp ] = kappa * cvt( a[ i*inca + k*lda ] ); \
+		} \
+	} \
+\
+	bli_sset0s_edge \
+	( \
+	  cdim, cdim_max, \
+	  n, n_max, \
+	  p, ldp  \
+	); \
+}
+
+GENTFUNCH( bfloat16, bli_bf16_to_float, BF16_CVT8, BF16_CVT4, packm_bf16_zen_int )
+GENTFUNCH( float16,  bli_f16_to_float,  F16_CVT8,  F16_CVT4,  packm_f16_zen_int )
+
+// -----------------------------------------------------------------------------
+
+// Define the kernel entry points. The mrxk and nrxk variants differ only in
+// the register blocksize used to determine the amount of zero-padding.
+
+#undef  GENTFUNCH
+#define GENTFUNCH( ctype_h, opname, kername, mnr ) \
+\
+void PASTEMAC(s,opname) \
+     ( \
+             conj_t  conja, \
+             pack_t  schema, \
+             dim_t   cdim, \
+             dim_t   n, \
+             dim_t   n_max, \
+       const void*   kappa, \
+       const void*   a, inc_t inca, inc_t lda, \
+             void*   p,             inc_t ldp, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	( void )conja; \
+	( void )schema; \
+\
+	PASTEMAC(s,kername) \
+	( \
+	  cdim, \
+	  bli_cntx_get_blksz_def_dt( BLIS_FLOAT, mnr, cntx ), \
+	  n, \
+	  n_max, \
+	  *( const float* )kappa, \
+	  a, inca, lda, \
+	  p,       ldp  \
+	); \
+}
+
+GENTFUNCH( bfloat16, packm_mrxk_bf16_zen_int, packm_bf16_zen_int, BLIS_MR )
+GENTFUNCH( bfloat16, packm_nrxk_bf16_zen_int, packm_bf16_zen_int, BLIS_NR )
+GENTFUNCH( float16,  packm_mrxk_f16_zen_int,  packm_f16_zen_int,  BLIS_MR )
+GENTFUNCH( float16,  packm_nrxk_f16_zen_int,  packm_f16_zen_int,  BLIS_NR )
+
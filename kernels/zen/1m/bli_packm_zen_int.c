@@ -0,0 +1,210 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+// Pack a cdim x n micropanel into a micropanel with mnr rows and leading
+// dimension ldp, scaling by kappa. The micropanel is processed four rows at
+// a time, with the rows at or beyond cdim masked off (and thus packed as
+// zeros):
+//  - inca == 1: each group of four rows is read with a masked load.
+//  - otherwise: each group of four rows is read with a masked gather, using
+//    indices that are multiples of inca. This covers general-stride sources
+//    as well as row-stored sources that the assembly kernels do not handle
+//    (edge micropanels and non-unit kappa).
+// mnr must be even and no greater than 16. Finally, the micropanel is zero-padded
+// out to n_max columns.
+
+BLIS_INLINE void bli_dpackm_zen_int
+     (
+             dim_t   mnr,
+             dim_t   cdim,
+             dim_t   n,
+             dim_t   n_max,
+             double  kappa,
+       const double* restrict a, inc_t inca, inc_t lda,
+             double* restrict p,             inc_t ldp
+     )
+{
+	const __m256d kv   = _mm256_set1_pd( kappa );
+	const __m256d zero = _mm256_setzero_pd();
+	const __m256i vidx = _mm256_set_epi64x( 3*inca, 2*inca, inca, 0 );
+
+	// Compute the lane masks for each group of four rows.
+	__m256i mask[ 4 ];
+	for ( dim_t g = 0; g < mnr / 4 + ( mnr % 4 != 0 ); ++g )
+	{
+		const int64_t r = cdim - 4*g;
+		mask[ g ] = _mm256_set_epi64x( -( 3 < r ), -( 2 < r ), -( 1 < r ), -( 0 < r ) );
+	}
+
+	for ( dim_t k = 0; k < n; ++k )
+	{
+		const double* restrict ak = a + k*lda;
+		      double* restrict pk = p + k*ldp;
+
+		for ( dim_t i = 0, g = 0; i < mnr; i += 4, ++g )
+		{
+			__m256d v;
+
+			if ( inca == 1 )
+				v = _mm256_maskload_pd( ak + i, mask[ g ] );
+			else
+				v = _mm256_mask_i64gather_pd( zero, ak + i*inca, vidx,
+				                              _mm256_castsi256_pd( mask[ g ] ), 8 );
+
+			v = _mm256_mul_pd( kv, v );
+
+			if ( i + 4 <= mnr ) _mm256_storeu_pd( pk + i, v );
+			else                _mm_storeu_pd( pk + i, _mm256_castpd256_pd128( v ) );
+		}
+	}
+
+	bli_dset0s_edge
+	(
+	  mnr, mnr,
+	  n, n_max,
+	  p, ldp
+	);
+}
+
+BLIS_INLINE void bli_spackm_zen_int
+     (
+             dim_t   mnr,
+             dim_t   cdim,
+             dim_t   n,
+             dim_t   n_max,
+             float   kappa,
+       const float*  restrict a, inc_t inca, inc_t lda,
+             float*  restrict p,             inc_t ldp
+     )
+{
+	const __m128  kv   = _mm_set1_ps( kappa );
+	const __m128  zero = _mm_setzero_ps();
+	const __m256i vidx = _mm256_set_epi64x( 3*inca, 2*inca, inca, 0 );
+
+	// Compute the lane masks for each group of four rows.
+	__m128i mask[ 4 ];
+	for ( dim_t g = 0; g < mnr / 4 + ( mnr % 4 != 0 ); ++g )
+	{
+		const int r = cdim - 4*g;
+		mask[ g ] = _mm_set_epi32( -( 3 < r ), -( 2 < r ), -( 1 < r ), -( 0 < r ) );
+	}
+
+	for ( dim_t k = 0; k < n; ++k )
+	{
+		const float* restrict ak = a + k*lda;
+		      float* restrict pk = p + k*ldp;
+
+		for ( dim_t i = 0, g = 0; i < mnr; i += 4, ++g )
+		{
+			__m128 v;
+
+			if ( inca == 1 )
+				v = _mm_maskload_ps( ak + i, mask[ g ] );
+			else
+				v = _mm256_mask_i64gather_ps( zero, ak + i*inca, vidx,
+				                              _mm_castsi128_ps( mask[ g ] ), 4 );
+
+			v = _mm_mul_ps( kv, v );
+
+			if ( i + 4 <= mnr ) _mm_storeu_ps( pk + i, v );
+			else                _mm_storel_pi( ( __m64* )( pk + i ), v );
+		}
+	}
+
+	bli_sset0s_edge
+	(
+	  mnr, mnr,
+	  n, n_max,
+	  p, ldp
+	);
+}
+
+// -----------------------------------------------------------------------------
+
+// Define the kernel entry points. Full micropanels with unit kappa whose
+// source has unit row or column stride are packed by the haswell assembly
+// kernels; all other micropanels are packed by the functions above.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, asmname, mnr ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+             conj_t  conja, \
+             pack_t  schema, \
+             dim_t   cdim, \
+             dim_t   n, \
+             dim_t   n_max, \
+       const void*   kappa, \
+       const void*   a, inc_t inca, inc_t lda, \
+             void*   p,             inc_t ldp, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const bool gs    = ( inca != 1 && lda != 1 ); \
+	const bool unitk = PASTEMAC(ch,eq1)( *( const ctype* )kappa ); \
+\
+	if ( cdim == mnr && !gs && unitk ) \
+	{ \
+		PASTEMAC(ch,asmname) \
+		( \
+		  conja, schema, cdim, n, n_max, \
+		  kappa, a, inca, lda, p, ldp, cntx \
+		); \
+		return; \
+	} \
+\
+	PASTEMAC(ch,packm_zen_int) \
+	( \
+	  mnr, \
+	  cdim, \
+	  n, \
+	  n_max, \
+	  *( const ctype* )kappa, \
+	  a, inca, lda, \
+	  p,       ldp  \
+	); \
+}
+
+GENTFUNC( float,  s, packm_6xk_zen_int,  packm_haswell_asm_6xk,   6 )
+GENTFUNC( float,  s, packm_16xk_zen_int, packm_haswell_asm_16xk, 16 )
+GENTFUNC( double, d, packm_6xk_zen_int,  packm_haswell_asm_6xk,   6 )
+GENTFUNC( double, d, packm_8xk_zen_int,  packm_haswell_asm_8xk,   8 )
+
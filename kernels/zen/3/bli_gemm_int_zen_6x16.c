@@ -0,0 +1,205 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// AVX2 integer gemm microkernels with a 6x16 register block of int32
+// accumulators (the same shape as the haswell sgemm microkernel, whose
+// blocksizes they share). A and B are packed in k-grouped micropanels (see
+// ref_kernels/3/bli_gemm_int_ref.c): every 32-bit word of a micropanel holds
+// four consecutive k values of u8/s8 data or two of s16 data, so that one
+// broadcast word of A and two vectors of B feed vpmaddubsw (u8 x s8) or
+// vpmaddwd (s16 x s16) directly.
+//
+// NOTE: As is inherent to vpmaddubsw, the sum of each adjacent pair of
+// u8 x s8 products saturates to 16 bits. This can only happen when B
+// contains values whose magnitude exceeds 64 or so; quantization schemes
+// that target these instructions usually restrict B to 7 bits for this
+// reason. The reference kernels model the same behavior.
+//
+
+#define IGEMM_MR 6
+#define IGEMM_NR 16
+
+// Update one row of the 6x16 accumulator block with a group of k values.
+#define IGEMM_U8S8_ROW( i ) \
+{ \
+	const __m256i ai = _mm256_set1_epi32( *( const int32_t* )( a + 4*(i) ) ); \
+	c ## i ## 0 = _mm256_add_epi32( c ## i ## 0, \
+	  _mm256_madd_epi16( _mm256_maddubs_epi16( ai, b0 ), ones ) ); \
+	c ## i ## 1 = _mm256_add_epi32( c ## i ## 1, \
+	  _mm256_madd_epi16( _mm256_maddubs_epi16( ai, b1 ), ones ) ); \
+}
+
+#define IGEMM_S16_ROW( i ) \
+{ \
+	const __m256i ai = _mm256_set1_epi32( *( const int32_t* )( a + 4*(i) ) ); \
+	c ## i ## 0 = _mm256_add_epi32( c ## i ## 0, _mm256_madd_epi16( ai, b0 ) ); \
+	c ## i ## 1 = _mm256_add_epi32( c ## i ## 1, _mm256_madd_epi16( ai, b1 ) ); \
+}
+
+// Scale one row of the accumulator block by alpha and update a row of C
+// (stored with unit column stride).
+#define IGEMM_STORE_ROW( i ) \
+{ \
+	int32_t* restrict ci = c + (i)*rs_c; \
+	__m256i r0 = c ## i ## 0; \
+	__m256i r1 = c ## i ## 1; \
+\
+	if ( alpha != 1 ) \
+	{ \
+		r0 = _mm256_mullo_epi32( r0, alphav ); \
+		r1 = _mm256_mullo_epi32( r1, alphav ); \
+	} \
+	if ( beta != 0 ) \
+	{ \
+		__m256i y0 = _mm256_loadu_si256( ( __m256i* )( ci + 0 ) ); \
+		__m256i y1 = _mm256_loadu_si256( ( __m256i* )( ci + 8 ) ); \
+		if ( beta != 1 ) \
+		{ \
+			y0 = _mm256_mullo_epi32( y0, betav ); \
+			y1 = _mm256_mullo_epi32( y1, betav ); \
+		} \
+		r0 = _mm256_add_epi32( r0, y0 ); \
+		r1 = _mm256_add_epi32( r1, y1 ); \
+	} \
+	_mm256_storeu_si256( ( __m256i* )( ci + 0 ), r0 ); \
+	_mm256_storeu_si256( ( __m256i* )( ci + 8 ), r1 ); \
+}
+
+// Spill one row of the accumulator block to the temporary ab.
+#define IGEMM_SPILL_ROW( i ) \
+{ \
+	_mm256_store_si256( ( __m256i* )( ab + (i)*IGEMM_NR + 0 ), c ## i ## 0 ); \
+	_mm256_store_si256( ( __m256i* )( ab + (i)*IGEMM_NR + 8 ), c ## i ## 1 ); \
+}
+
+#undef  GENTFUNCI
+#define GENTFUNCI( opname, kg, row_update ) \
+\
+void PASTEMAC(i,opname) \
+     ( \
+             dim_t      m, \
+             dim_t      n, \
+             dim_t      k, \
+       const void*      alpha0, \
+       const void*      a0, \
+       const void*      b0_, \
+       const void*      beta0, \
+             void*      c0, inc_t rs_c, inc_t cs_c, \
+             auxinfo_t* data, \
+       const cntx_t*    cntx  \
+     ) \
+{ \
+	const int32_t          alpha = *( const int32_t* )alpha0; \
+	const int32_t          beta  = *( const int32_t* )beta0; \
+	const char*   restrict a     = a0; \
+	const char*   restrict b     = b0_; \
+	      int32_t*restrict c     = c0; \
+\
+	/* Every group of kg k values occupies one 32-bit word per row (column)
+	   of the micropanel, regardless of the element size. */ \
+	const dim_t k_iter = ( k + kg - 1 ) / kg; \
+\
+	( void )data; \
+	( void )cntx; \
+\
+	const __m256i ones = _mm256_set1_epi16( 1 ); \
+	( void )ones; \
+\
+	__m256i c00 = _mm256_setzero_si256(), c01 = _mm256_setzero_si256(); \
+	__m256i c10 = _mm256_setzero_si256(), c11 = _mm256_setzero_si256(); \
+	__m256i c20 = _mm256_setzero_si256(), c21 = _mm256_setzero_si256(); \
+	__m256i c30 = _mm256_setzero_si256(), c31 = _mm256_setzero_si256(); \
+	__m256i c40 = _mm256_setzero_si256(), c41 = _mm256_setzero_si256(); \
+	__m256i c50 = _mm256_setzero_si256(), c51 = _mm256_setzero_si256(); \
+\
+	for ( dim_t l = 0; l < k_iter; ++l ) \
+	{ \
+		const __m256i b0 = _mm256_loadu_si256( ( const __m256i* )( b +  0 ) ); \
+		const __m256i b1 = _mm256_loadu_si256( ( const __m256i* )( b + 32 ) ); \
+\
+		row_update( 0 ); \
+		row_update( 1 ); \
+		row_update( 2 ); \
+		row_update( 3 ); \
+		row_update( 4 ); \
+		row_update( 5 ); \
+\
+		a += 4 * IGEMM_MR; \
+		b += 4 * IGEMM_NR; \
+	} \
+\
+	if ( m == IGEMM_MR && n == IGEMM_NR && cs_c == 1 ) \
+	{ \
+		const __m256i alphav = _mm256_set1_epi32( alpha ); \
+		const __m256i betav  = _mm256_set1_epi32( beta ); \
+\
+		IGEMM_STORE_ROW( 0 ); \
+		IGEMM_STORE_ROW( 1 ); \
+		IGEMM_STORE_ROW( 2 ); \
+		IGEMM_STORE_ROW( 3 ); \
+		IGEMM_STORE_ROW( 4 ); \
+		IGEMM_STORE_ROW( 5 ); \
+		return; \
+	} \
+\
+	/* Edge case or non-unit column stride: spill the accumulators and
+	   update C element-wise (with the same wrapping arithmetic). */ \
+	int32_t ab[ IGEMM_MR * IGEMM_NR ] __attribute__((aligned(32))); \
+\
+	IGEMM_SPILL_ROW( 0 ); \
+	IGEMM_SPILL_ROW( 1 ); \
+	IGEMM_SPILL_ROW( 2 ); \
+	IGEMM_SPILL_ROW( 3 ); \
+	IGEMM_SPILL_ROW( 4 ); \
+	IGEMM_SPILL_ROW( 5 ); \
+\
+	for ( dim_t i = 0; i < m; ++i ) \
+	for ( dim_t j = 0; j < n; ++j ) \
+	{ \
+		int32_t* restrict cij  = c + i*rs_c + j*cs_c; \
+		const uint32_t    abij = ( uint32_t )alpha * ( uint32_t )ab[ i*IGEMM_NR + j ]; \
+\
+		if ( beta == 0 ) *cij = ( int32_t )abij; \
+		else             *cij = ( int32_t )( ( uint32_t )beta * ( uint32_t )*cij + abij ); \
+	} \
+}
+
+GENTFUNCI( gemm_u8s8s32_zen_int_6x16,   4, IGEMM_U8S8_ROW )
+GENTFUNCI( gemm_s16s16s32_zen_int_6x16, 2, IGEMM_S16_ROW  )
+
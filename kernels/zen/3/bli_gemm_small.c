@@ -36,9 +36,13 @@
 #include "xmmintrin.h"
 #include "blis.h"
 
+// Entry to and exit from the small gemm code are not traced individually;
+// instead, each operation that completes via the small gemm code is traced
+// (as such) by its caller. The reason for rejecting a problem is left as a
+// note in the trace.
 #define AOCL_DTL_TRACE_ENTRY(x)      ;
 #define AOCL_DTL_TRACE_EXIT(x)       ;
-#define AOCL_DTL_TRACE_EXIT_ERR(x,y) ;
+#define AOCL_DTL_TRACE_EXIT_ERR(x,y) bli_trace_note( y );
 
 #ifdef BLIS_ENABLE_SMALL_MATRIX
 
@@ -46,6 +50,7 @@
 #define D_MR (MR >> 1)
 #define NR 3
 #define D_BLIS_SMALL_MATRIX_K_THRES_ROME    256
+#define S_BLIS_SMALL_MATRIX_K_THRES         512
 
 #define BLIS_ENABLE_PREFETCH
 #define D_BLIS_SMALL_MATRIX_THRES (BLIS_SMALL_MATRIX_THRES / 2 )
@@ -96,10 +101,27 @@ static err_t bli_dgemm_small_atbn
        const cntx_t* cntx,
              cntl_t* cntl
      );
+static err_t bli_gemm_small_at
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+             cntl_t* cntl
+     );
+
 /*
 * The bli_gemm_small function will use the
 * custom MRxNR kernels, to perform the computation.
 * The custom kernels are used if the [M * N] < 240 * 240
+*
+* All four combinations of transa and transb are supported, as is row-major
+* storage of any operand. Row-major C is handled by computing the transposed
+* problem C^T = op(B)^T * op(A)^T, and row-major A or B is handled by
+* reinterpreting the operand as its (column-major) transpose. Operands with
+* general (non-unit) strides in both dimensions are not supported.
 */
 err_t bli_gemm_small
      (
@@ -113,58 +135,162 @@ err_t bli_gemm_small
      )
 {
 	AOCL_DTL_TRACE_ENTRY(AOCL_DTL_LEVEL_TRACE_7);
-	
-#ifdef BLIS_ENABLE_MULTITHREADING
-	AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_7);
-    return BLIS_NOT_YET_IMPLEMENTED;
-#endif
+
+    // NOTE: The small matrix code is single-threaded; the caller only
+    // invokes it when a single thread was requested.
+
+    num_t dt = bli_obj_dt(c);
+
+    if (dt != BLIS_FLOAT && dt != BLIS_DOUBLE)
+    {
+        AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_7);
+        return BLIS_NOT_YET_IMPLEMENTED;
+    }
+
     // If alpha is zero, scale by beta and return.
     if (bli_obj_equals(alpha, &BLIS_ZERO))
     {
-        return BLIS_NOT_YET_IMPLEMENTED;
+        bli_scalm(beta, c);
+        AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_7);
+        return BLIS_SUCCESS;
     }
 
-    // if row major format return.
-    if ((bli_obj_row_stride( a ) != 1) ||
-        (bli_obj_row_stride( b ) != 1) ||
-        (bli_obj_row_stride( c ) != 1))
+    obj_t a_local, b_local, c_local;
+
+    bli_obj_alias_to(a, &a_local);
+    bli_obj_alias_to(b, &b_local);
+    bli_obj_alias_to(c, &c_local);
+
+    // The kernels below assume that C is column-major. If C is row-major,
+    // compute C^T = op(B)^T * op(A)^T instead by swapping A and B and
+    // inducing a transposition on all three operands.
+    if (bli_obj_row_stride(&c_local) != 1 && bli_obj_col_stride(&c_local) == 1)
     {
-        return BLIS_INVALID_ROW_STRIDE;
+        bli_obj_swap(&a_local, &b_local);
+
+        bli_obj_induce_trans(&a_local);
+        bli_obj_induce_trans(&b_local);
+        bli_obj_induce_trans(&c_local);
     }
 
-    num_t dt = bli_obj_dt(c);
+    // A row-major A or B is equivalent to a column-major transpose of that
+    // operand with the transposition bit toggled.
+    if (bli_obj_row_stride(&a_local) != 1 && bli_obj_col_stride(&a_local) == 1)
+    {
+        bli_obj_induce_trans(&a_local);
+        bli_obj_toggle_trans(&a_local);
+    }
+    if (bli_obj_row_stride(&b_local) != 1 && bli_obj_col_stride(&b_local) == 1)
+    {
+        bli_obj_induce_trans(&b_local);
+        bli_obj_toggle_trans(&b_local);
+    }
+
+    // If any operand is still not column-major, it has general stride.
+    if ((bli_obj_row_stride(&a_local) != 1) ||
+        (bli_obj_row_stride(&b_local) != 1) ||
+        (bli_obj_row_stride(&c_local) != 1))
+    {
+        AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_7);
+        return BLIS_INVALID_ROW_STRIDE;
+    }
 
-    if (bli_obj_has_trans( a ))
+    if (bli_obj_has_trans(&a_local))
     {
-        if (bli_obj_has_notrans( b ))
+        // The A^T*B kernels compute dot products between columns of A and B
+        // and so require that B not be transposed. They also decline
+        // problems whose M dimension exceeds BLIS_ATBN_M_THRES.
+        if (bli_obj_has_notrans(&b_local))
         {
+            err_t status;
+
             if (dt == BLIS_FLOAT)
+                status = bli_sgemm_small_atbn(alpha, &a_local, &b_local, beta, &c_local, cntx, cntl);
+            else
+                status = bli_dgemm_small_atbn(alpha, &a_local, &b_local, beta, &c_local, cntx, cntl);
+
+            if (status == BLIS_SUCCESS)
             {
-                return bli_sgemm_small_atbn(alpha, a, b, beta, c, cntx, cntl);
-            }
-            else if (dt == BLIS_DOUBLE)
-            {
-                return bli_dgemm_small_atbn(alpha, a, b, beta, c, cntx, cntl);
+                AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_7);
+                return status;
             }
         }
 
-        return BLIS_NOT_YET_IMPLEMENTED;
+        // Otherwise, copy op(A) to column-major storage and use the
+        // non-transposed A kernels, which handle either value of transb.
+        AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_7);
+        return bli_gemm_small_at(alpha, &a_local, &b_local, beta, &c_local, cntx, cntl);
     }
 
+    // The non-transposed A kernels handle both transposed and
+    // non-transposed B.
     if (dt == BLIS_DOUBLE)
     {
-        return bli_dgemm_small(alpha, a, b, beta, c, cntx, cntl);
+        AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_7);
+        return bli_dgemm_small(alpha, &a_local, &b_local, beta, &c_local, cntx, cntl);
     }
 
-    if (dt == BLIS_FLOAT)
+	AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_7);
+    return bli_sgemm_small(alpha, &a_local, &b_local, beta, &c_local, cntx, cntl);
+};
+
+/*
+* Handle a transposed A by copying op(A) into a column-major buffer taken
+* from the A block pool and then calling the non-transposed A kernels. The
+* copy costs O(M*K) memops, which is small relative to the O(M*N*K) flops
+* of the product itself.
+*/
+static err_t bli_gemm_small_at
+     (
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const obj_t*  beta,
+       const obj_t*  c,
+       const cntx_t* cntx,
+             cntl_t* cntl
+     )
+{
+    num_t  dt = bli_obj_dt( c );
+    dim_t  M  = bli_obj_length( c );
+    dim_t  K  = bli_obj_width_after_trans( a );
+    siz_t  size_a = M * K * bli_dt_size( dt );
+    pba_t* pba = bli_pba_query();
+    mem_t  local_mem_buf_A_t;
+    obj_t  at;
+    err_t  status;
+
+    // Use the current size of the buffer pool for A block packing as a
+    // bound so that we do not induce a pool re-initialization. Problems
+    // too large for the pool block are not "small" anyway.
+    siz_t buffer_size = bli_pool_block_size(
+        bli_pba_pool(bli_packbuf_index(BLIS_BITVAL_BUFFER_FOR_A_BLOCK), pba));
+
+    if (size_a == 0 || size_a > buffer_size)
     {
-        return bli_sgemm_small(alpha, a, b, beta, c, cntx, cntl);
+        return BLIS_NOT_YET_IMPLEMENTED;
     }
 
-	AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_TRACE_7);
-    return BLIS_NOT_YET_IMPLEMENTED;
-};
+    bli_pba_acquire_m(pba,
+                      buffer_size,
+                      BLIS_BITVAL_BUFFER_FOR_A_BLOCK,
+                      &local_mem_buf_A_t);
+
+    bli_obj_create_without_buffer( dt, M, K, &at );
+    bli_obj_attach_buffer( bli_mem_buffer( &local_mem_buf_A_t ), 1, M, 1, &at );
 
+    // Copy op(A) into the buffer; bli_copym() observes the transposition.
+    bli_copym( a, &at );
+
+    if (dt == BLIS_DOUBLE)
+        status = bli_dgemm_small(alpha, &at, b, beta, c, cntx, cntl);
+    else
+        status = bli_sgemm_small(alpha, &at, b, beta, c, cntx, cntl);
+
+    bli_pba_release(pba, &local_mem_buf_A_t);
+
+    return status;
+}
 
 static err_t bli_sgemm_small
      (
@@ -199,8 +325,11 @@ static err_t bli_sgemm_small
     }
 
 
+    // The small code does not block the k dimension, so problems with a
+    // long k dimension are left to the conventional code path.
     if ((((L) < (BLIS_SMALL_MATRIX_THRES * BLIS_SMALL_MATRIX_THRES))
-        || ((M  < BLIS_SMALL_M_RECT_MATRIX_THRES) && (K < BLIS_SMALL_K_RECT_MATRIX_THRES))) && ((L!=0) && (K!=0)))
+        || ((M  < BLIS_SMALL_M_RECT_MATRIX_THRES) && (K < BLIS_SMALL_K_RECT_MATRIX_THRES))) && ((L!=0) && (K!=0))
+        && (K < S_BLIS_SMALL_MATRIX_K_THRES))
     {
         guint_t lda = bli_obj_col_stride( a ); // column stride of matrix OP(A), where OP(A) is Transpose(A) if transA enabled.
         guint_t ldb = bli_obj_col_stride( b ); // column stride of matrix OP(B), where OP(B) is Transpose(B) if transB enabled.
@@ -230,7 +359,7 @@ static err_t bli_sgemm_small
         gint_t required_packing_A = 1;
         mem_t local_mem_buf_A_s;
         float *A_pack = NULL;
-        rntm_t rntm;
+        pba_t* pba = bli_pba_query();
 
         const num_t    dt_exec   = bli_obj_dt( c );
         float* restrict alpha_cast = bli_obj_buffer_for_1x1( dt_exec, alpha );
@@ -266,14 +395,10 @@ static err_t bli_sgemm_small
          * Subsequent invocations will just reuse the buffer from the pool.
          */
 
-        bli_rntm_init_from_global( &rntm );
-        bli_rntm_set_num_threads_only( 1, &rntm );
-        bli_pba_rntm_set_pba( &rntm );
-
         // Get the current size of the buffer pool for A block packing.
         // We will use the same size to avoid pool re-initialization 
         siz_t buffer_size = bli_pool_block_size(bli_pba_pool(bli_packbuf_index(BLIS_BITVAL_BUFFER_FOR_A_BLOCK),
-                                                bli_rntm_pba(&rntm)));
+                                                pba));
 
         // Based on the available memory in the buffer we will decide if 
         // we want to do packing or not.
@@ -299,7 +424,7 @@ static err_t bli_sgemm_small
 #endif
             // Get the buffer from the pool, if there is no pool with
             // required size, it will be created. 
-            bli_pba_acquire_m(&rntm,
+            bli_pba_acquire_m(pba,
                                  buffer_size,
                                  BLIS_BITVAL_BUFFER_FOR_A_BLOCK,
                                  &local_mem_buf_A_s);
@@ -1699,7 +1824,7 @@ static err_t bli_sgemm_small
 #ifdef BLIS_ENABLE_MEM_TRACING
         printf( "bli_sgemm_small(): releasing mem pool block\n" );
 #endif
-            bli_pba_release(&rntm,
+            bli_pba_release(pba,
                                &local_mem_buf_A_s);
         }
 		
@@ -1797,7 +1922,7 @@ static err_t bli_dgemm_small
         gint_t required_packing_A = 1;
         mem_t local_mem_buf_A_s;
         double *D_A_pack = NULL;
-        rntm_t rntm;
+        pba_t* pba = bli_pba_query();
 
         //update the pointer math if matrix B needs to be transposed.
         if (bli_obj_has_trans( b ))
@@ -1831,15 +1956,11 @@ static err_t bli_dgemm_small
          * Subsequent invocations will just reuse the buffer from the pool.
          */
 
-        bli_rntm_init_from_global( &rntm );
-        bli_rntm_set_num_threads_only( 1, &rntm );
-        bli_pba_rntm_set_pba( &rntm );
-
         // Get the current size of the buffer pool for A block packing.
         // We will use the same size to avoid pool re-initliazaton 
         siz_t buffer_size = bli_pool_block_size(
             bli_pba_pool(bli_packbuf_index(BLIS_BITVAL_BUFFER_FOR_A_BLOCK),
-                            bli_rntm_pba(&rntm)));
+                            pba));
 
         //
         // This kernel assumes that "A" will be unpackged if N <= 3.
@@ -1863,7 +1984,7 @@ static err_t bli_dgemm_small
             printf( "bli_dgemm_small: Requesting mem pool block of size %lu\n", buffer_size);
 #endif
             // Get the buffer from the pool.
-            bli_pba_acquire_m(&rntm,
+            bli_pba_acquire_m(pba,
                                  buffer_size,
                                  BLIS_BITVAL_BUFFER_FOR_A_BLOCK,
                                  &local_mem_buf_A_s);
@@ -3309,7 +3430,7 @@ static err_t bli_dgemm_small
 #ifdef BLIS_ENABLE_MEM_TRACING
         printf( "bli_dgemm_small(): releasing mem pool block\n" );
 #endif
-        bli_pba_release(&rntm,
+        bli_pba_release(pba,
                            &local_mem_buf_A_s);
         }
 		AOCL_DTL_TRACE_EXIT(AOCL_DTL_LEVEL_INFO);
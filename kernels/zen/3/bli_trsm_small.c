@@ -373,8 +373,9 @@ static err_t bli_strsm_small_XAltB
        cntl_t* cntl
      );
 
-//A.'X = B;  A is upper triangular; A has to be transposed; double precision
-static err_t bli_dtrsm_small_AutXB
+//AX = B, A.'X = B;  op(A) is other than lower triangular and non-transposed;
+//double precision
+static err_t bli_dtrsm_small_opAXB
      (
        side_t  side,
        obj_t*  alpha,
@@ -384,28 +385,332 @@ static err_t bli_dtrsm_small_AutXB
        cntl_t* cntl
      );
 
+/*
+ * Generic small TRSM, used for storage that the dedicated kernels in this
+ * file do not support, and for the single-precision combinations of side,
+ * uplo, trans, and diag that have no dedicated kernel. The
+ * problem is first expressed as a left-side solve op(A) X = alpha * B; for
+ * the right side, op(A)^T X^T = alpha * B^T is solved instead, which only
+ * requires toggling the transposition of A and swapping the strides of B.
+ * Each column of X is then computed by the trsv variant best suited to the
+ * storage of A, which in turn uses the level-1f kernels in the context.
+ * Any strides are supported.
+ */
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static err_t PASTEMAC(ch,varname) \
+     ( \
+       side_t  side, \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  b, \
+       cntx_t* cntx, \
+       cntl_t* cntl \
+     ) \
+{ \
+	const num_t dt     = PASTEMAC(ch,type); \
+\
+	uplo_t      uploa  = bli_obj_uplo( a ); \
+	trans_t     transa = bli_obj_conjtrans_status( a ); \
+	diag_t      diaga  = bli_obj_diag( a ); \
+\
+	dim_t       m_a    = bli_obj_length( a ); \
+	dim_t       m      = bli_obj_length( b ); \
+	dim_t       n      = bli_obj_width( b ); \
+\
+	ctype*      buf_a  = bli_obj_buffer_at_off( a ); \
+	inc_t       rs_a   = bli_obj_row_stride( a ); \
+	inc_t       cs_a   = bli_obj_col_stride( a ); \
+\
+	ctype*      buf_b  = bli_obj_buffer_at_off( b ); \
+	inc_t       rs_b   = bli_obj_row_stride( b ); \
+	inc_t       cs_b   = bli_obj_col_stride( b ); \
+\
+	ctype*      buf_alpha = bli_obj_buffer_for_1x1( dt, alpha ); \
+\
+	PASTECH2(ch,trsv,_unb_ft) f; \
+\
+	/* Use the same size threshold as the single-precision kernels. */ \
+	if ( ( m_a * ( m + n ) ) > BLIS_SMALL_MATRIX_THRES_TRSM ) \
+		return BLIS_NOT_YET_IMPLEMENTED; \
+\
+	if ( bli_obj_diag_offset( a ) != 0 ) \
+		return BLIS_NOT_YET_IMPLEMENTED; \
+\
+	if ( cntx == NULL ) cntx = ( cntx_t* )bli_gks_query_cntx(); \
+\
+	/* Solve op(A)^T X^T = alpha * B^T in place of X op(A) = alpha * B. */ \
+	if ( bli_is_right( side ) ) \
+	{ \
+		bli_toggle_trans( &transa ); \
+		bli_swap_dims( &m, &n ); \
+		bli_swap_incs( &rs_b, &cs_b ); \
+	} \
+\
+	/* Choose the trsv variant that accesses A with unit stride, as is done
+	   in the typed trsv API. */ \
+	if ( bli_does_notrans( transa ) ) \
+	{ \
+		if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,trsv_unf_var1); \
+		else                                   f = PASTEMAC(ch,trsv_unf_var2); \
+	} \
+	else \
+	{ \
+		if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,trsv_unf_var2); \
+		else                                   f = PASTEMAC(ch,trsv_unf_var1); \
+	} \
+\
+	for ( dim_t j = 0; j < n; ++j ) \
+	{ \
+		f \
+		( \
+		  uploa, \
+		  transa, \
+		  diaga, \
+		  m, \
+		  buf_alpha, \
+		  buf_a, rs_a, cs_a, \
+		  buf_b + j * cs_b, rs_b, \
+		  cntx \
+		); \
+	} \
+\
+	return BLIS_SUCCESS; \
+}
+
+GENTFUNC( float,  s, trsm_small_gen )
+GENTFUNC( double, d, trsm_small_gen )
+
+/*
+ * Left-side double-precision TRSM for op(A) = A', or op(A) = A with A upper
+ * triangular. op(A) is copied to a column-major lower triangular matrix, so
+ * that the blocked AlXB kernels can be used. If op(A) is upper triangular,
+ * the order of the unknowns is reversed, that is, (J op(A) J)(J X) =
+ * alpha * J B is solved, where J is the exchange matrix; in this case the
+ * rows of B are also copied in reverse order. Column-major B is required.
+ */
+static err_t bli_dtrsm_small_opAXB
+     (
+       side_t  side,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       cntl_t* cntl
+     )
+{
+	dim_t   m      = bli_obj_length( b );
+	dim_t   n      = bli_obj_width( b );
+
+	bool    rev    = ( bli_obj_is_upper( a ) != bli_obj_has_trans( a ) );
+	bool    unit   = bli_obj_has_unit_diag( a );
+
+	double* buf_a  = bli_obj_buffer_at_off( a );
+	inc_t   rs_a   = bli_obj_row_stride( a );
+	inc_t   cs_a   = bli_obj_col_stride( a );
+
+	double* buf_b  = bli_obj_buffer_at_off( b );
+	inc_t   cs_b   = bli_obj_col_stride( b );
+
+	obj_t   a_l, b_l;
+	err_t   r_val;
+
+	// Skip the copies if the kernels would decline the problem anyway.
+	if ( bli_obj_diag_offset( a ) != 0 )
+		return BLIS_NOT_YET_IMPLEMENTED;
+
+#ifdef BLIS_ENABLE_SMALL_MATRIX_ROME
+	if ( ( m > D_BLIS_SMALL_MATRIX_THRES_TRSM_ALXB_ROME_ROW_PANEL_M && n > D_BLIS_SMALL_MATRIX_THRES_TRSM_ALXB_ROME ) ||
+	     ( m > D_BLIS_SMALL_MATRIX_THRES_TRSM_ALXB_ROME && n > D_BLIS_SMALL_MATRIX_THRES_TRSM_ALXB_ROME_COLUMN_PANEL_N ) ||
+	     ( m > D_BLIS_SMALL_MATRIX_THRES_TRSM_ALXB_ROME_COLUMN_PANEL_M && n < D_BLIS_SMALL_MATRIX_THRES_TRSM_ALXB_ROME_COLUMN_PANEL_N ) )
+		return BLIS_NOT_YET_IMPLEMENTED;
+#else
+	if ( bli_max( m, n ) > D_BLIS_SMALL_MATRIX_THRES_TRSM_ALXB_NAPLES )
+		return BLIS_NOT_YET_IMPLEMENTED;
+#endif
+
+	double* buf_l  = bli_malloc_intl( ( m * m + ( rev ? m * n : 0 ) ) *
+	                                  sizeof( double ), &r_val );
+	double* buf_x  = ( rev ? buf_l + m * m : buf_b );
+	inc_t   cs_x   = ( rev ? m : cs_b );
+
+	if ( buf_l == NULL ) return BLIS_NOT_YET_IMPLEMENTED;
+
+	// Index op(A) rather than A.
+	if ( bli_obj_has_trans( a ) ) bli_swap_incs( &rs_a, &cs_a );
+
+	// L = op(A), or J op(A) J if op(A) is upper triangular. The strictly
+	// upper triangle of L is zeroed, and its diagonal is set to one if A
+	// has an implicit unit diagonal.
+	for ( dim_t j = 0; j < m; ++j )
+	{
+		const dim_t ja = ( rev ? m - 1 - j : j );
+
+		for ( dim_t i = 0; i < j; ++i )
+			buf_l[ i + j * m ] = 0.0;
+
+		buf_l[ j + j * m ] = ( unit ? 1.0 : buf_a[ ja * rs_a + ja * cs_a ] );
+
+		for ( dim_t i = j + 1; i < m; ++i )
+		{
+			const dim_t ia = ( rev ? m - 1 - i : i );
+
+			buf_l[ i + j * m ] = buf_a[ ia * rs_a + ja * cs_a ];
+		}
+	}
+
+	if ( rev )
+	{
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+			buf_x[ i + j * cs_x ] = buf_b[ ( m - 1 - i ) + j * cs_b ];
+	}
+
+	bli_obj_create_with_attached_buffer( BLIS_DOUBLE, m, m, buf_l, 1, m, &a_l );
+	bli_obj_create_with_attached_buffer( BLIS_DOUBLE, m, n, buf_x, 1, cs_x, &b_l );
+
+	if ( unit ) r_val = bli_dtrsm_small_AlXB_unitDiag( side, alpha, &a_l, &b_l, cntx, cntl );
+	else        r_val = bli_dtrsm_small_AlXB( side, alpha, &a_l, &b_l, cntx, cntl );
+
+	if ( rev && r_val == BLIS_SUCCESS )
+	{
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+			buf_b[ ( m - 1 - i ) + j * cs_b ] = buf_x[ i + j * cs_x ];
+	}
+
+	bli_free_intl( buf_l );
+
+	return r_val;
+}
+
+typedef err_t (*trsmsmall_ker_ft)
+     (
+       side_t  side,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       cntl_t* cntl
+     );
+
+/*
+ * Small TRSM kernels, indexed by [side][uplo][trans][diag][dt], where uplo
+ * is 0 for lower and 1 for upper, trans is 0 for op(A) = A and 1 for a
+ * transposed A, diag is 0 for non-unit and 1 for unit diagonal, and dt is
+ * the num_t value (s, c, d, z). The single-precision kernels handle both
+ * diag cases internally. There are no complex kernels; those problems are
+ * left to the conventional code path.
+ */
+static trsmsmall_ker_ft bli_trsm_small_kers[2][2][2][2][BLIS_NUM_FP_TYPES] =
+{
+  // side = left
+  {
+    // uplo = lower
+    {
+      // AlXB
+      {
+        { bli_strsm_small_AlXB, NULL,
+          bli_dtrsm_small_AlXB, NULL },
+        { bli_strsm_small_AlXB, NULL,
+          bli_dtrsm_small_AlXB_unitDiag, NULL },
+      },
+      // AltXB
+      {
+        { bli_strsm_small_gen, NULL,
+          bli_dtrsm_small_opAXB, NULL },
+        { bli_strsm_small_gen, NULL,
+          bli_dtrsm_small_opAXB, NULL },
+      },
+    },
+    // uplo = upper
+    {
+      // AuXB
+      {
+        { bli_strsm_small_gen, NULL,
+          bli_dtrsm_small_opAXB, NULL },
+        { bli_strsm_small_gen, NULL,
+          bli_dtrsm_small_opAXB, NULL },
+      },
+      // AutXB
+      {
+        { bli_strsm_small_AutXB, NULL,
+          bli_dtrsm_small_opAXB, NULL },
+        { bli_strsm_small_AutXB, NULL,
+          bli_dtrsm_small_opAXB, NULL },
+      },
+    },
+  },
+  // side = right
+  {
+    // uplo = lower
+    {
+      // XAlB
+      {
+        { bli_strsm_small_gen, NULL,
+          bli_dtrsm_small_XAlB, NULL },
+        { bli_strsm_small_gen, NULL,
+          bli_dtrsm_small_XAlB_unitDiag, NULL },
+      },
+      // XAltB
+      {
+        { bli_strsm_small_XAltB, NULL,
+          bli_dtrsm_small_XAltB, NULL },
+        { bli_strsm_small_XAltB, NULL,
+          bli_dtrsm_small_XAltB_unitDiag, NULL },
+      },
+    },
+    // uplo = upper
+    {
+      // XAuB
+      {
+        { bli_strsm_small_gen, NULL,
+          bli_dtrsm_small_XAuB, NULL },
+        { bli_strsm_small_gen, NULL,
+          bli_dtrsm_small_XAuB_unitDiag, NULL },
+      },
+      // XAutB
+      {
+        { bli_strsm_small_gen, NULL,
+          bli_dtrsm_small_XAutB, NULL },
+        { bli_strsm_small_gen, NULL,
+          bli_dtrsm_small_XAutB_unitDiag, NULL },
+      },
+    },
+  },
+};
+
+static trsmsmall_ker_ft bli_trsm_small_gen_kers[BLIS_NUM_FP_TYPES] =
+{
+  bli_strsm_small_gen, NULL,
+  bli_dtrsm_small_gen, NULL,
+};
+
 /*
 * The bli_trsm_small implements unpacked version of TRSM 
-* Currently only column-major is supported, A & B are column-major
 * Input: A: MxM (triangular matrix)
 *        B: MxN matrix
 * Output: X: MxN matrix such that AX = alpha*B or XA = alpha*B or A'X = alpha*B or XA' = alpha*B 
 * Here the output X is stored in B
 * The custom-kernel will be called only when M*(M+N)* sizeof(Matrix Elements) < L3 cache
+*
+* The dedicated kernels require column-major A and B; other storage, as well
+* as the single-precision combinations without a dedicated kernel, are handled
+* by the generic kernel above.
 */
 err_t bli_trsm_small
      (
-       side_t  side,
-       obj_t*  alpha,
-       obj_t*  a,
-       obj_t*  b,
-       cntx_t* cntx,
-       cntl_t* cntl
+             side_t  side,
+       const obj_t*  alpha,
+       const obj_t*  a,
+       const obj_t*  b,
+       const cntx_t* cntx,
+             cntl_t* cntl
      )
 {
-#ifdef BLIS_ENABLE_MULTITHREADING
-    return BLIS_NOT_YET_IMPLEMENTED;
-#endif
+    // This code is single-threaded; the caller only invokes it when a single
+    // thread was requested.
 
     dim_t m = bli_obj_length(b);
     dim_t n = bli_obj_width(b);
@@ -413,27 +718,12 @@ err_t bli_trsm_small
     if(!(m && n))
         return BLIS_SUCCESS;
 
+    num_t dt = bli_obj_dt(b);
 
-    // If alpha is zero, B matrix will become zero after scaling & hence solution is also zero matrix 
-    if (bli_obj_equals(alpha, &BLIS_ZERO))
-    {
-        return BLIS_NOT_YET_IMPLEMENTED; // scale B by alpha
-    }
-    // We have to call matrix scaling if alpha != 1.0
-    
-    // if row major format return. Check this again.
-    if ((bli_obj_row_stride(a) != 1) ||
-        (bli_obj_row_stride(b) != 1))
-    {
-        return BLIS_INVALID_ROW_STRIDE;
-    }
-
-    num_t dt = ((*b).info & (0x7 << 0));
-
-    // only float and double datatypes are supported as of now.
-    if (dt != BLIS_DOUBLE && dt != BLIS_FLOAT)
+    // only homogeneous real datatypes are supported.
+    if (!bli_is_real(dt) || bli_obj_dt(a) != dt)
     {
-    return BLIS_EXPECTED_REAL_DATATYPE;
+    return BLIS_NOT_YET_IMPLEMENTED;
     }
 
     // A is expected to be triangular in trsm
@@ -442,147 +732,55 @@ err_t bli_trsm_small
     return BLIS_EXPECTED_TRIANGULAR_OBJECT;
     }
 
-    // can use other control structs - even can use array of function pointers,
-    // indexed by a number with bits formed by f('side', 'uplo', 'transa', dt).
-    // In the below implementation, based on the number of finally implemented
-    // cases, can move the checks with more cases higher up.
-
-    if(side == BLIS_LEFT)
+    // If alpha is zero, B matrix will become zero after scaling & hence solution is also zero matrix 
+    if (bli_obj_equals(alpha, &BLIS_ZERO))
     {
-        if(bli_obj_has_trans(a))
-        {
-            if(dt == BLIS_DOUBLE)
-            {
-                if(bli_obj_is_upper(a))
-                {
-                    //return bli_dtrsm_small_AutXB(side, alpha, a, b, cntx, cntl);
-                    return BLIS_NOT_YET_IMPLEMENTED;
-                }
-                else
-                {
-                    //return bli_dtrsm_small_AltXB(side, alpha, a, b, cntx, cntl);
-                    return BLIS_NOT_YET_IMPLEMENTED;
-                }
-            }
-            else
-            {
-                if(bli_obj_is_upper(a))
-                {
-                    return bli_strsm_small_AutXB(side, alpha, a, b, cntx, cntl);
-                }
-                else
-                {
-                    //return bli_strsm_small_AltXB(side, alpha, a, b, cntx, cntl);
-                    return BLIS_NOT_YET_IMPLEMENTED;
-                }
+        bli_setm(&BLIS_ZERO, b);
+        return BLIS_SUCCESS;
+    }
 
-            }
-        }
-        else
-        {
-            if(dt == BLIS_DOUBLE)
-            {
-                if(bli_obj_is_upper(a))
-                {
-                    //return bli_dtrsm_small_AuXB(side, alpha, a, b, cntx, cntl);
-                    return BLIS_NOT_YET_IMPLEMENTED;
-                }
-                else
-                {
-                    if(bli_obj_has_unit_diag(a))
-                        return bli_dtrsm_small_AlXB_unitDiag(side, alpha, a, b, cntx, cntl);
-                    else
-                        return bli_dtrsm_small_AlXB(side, alpha, a, b, cntx, cntl);
-                }
-            }
-            else
-            {
-                if(bli_obj_is_upper(a))
-                {
-                    //return bli_strsm_small_AuXB(side, alpha, a, b, cntx, cntl);
-                    return BLIS_NOT_YET_IMPLEMENTED;
-                }
-                else
-                {
-                    return bli_strsm_small_AlXB(side, alpha, a, b, cntx, cntl);
-                }
+    dim_t uplo_i  = bli_obj_is_upper(a) ? 1 : 0;
+    dim_t trans_i = bli_obj_has_trans(a) ? 1 : 0;
+    dim_t diag_i  = bli_obj_has_unit_diag(a) ? 1 : 0;
+    dim_t side_i  = bli_is_left(side) ? 0 : 1;
 
-            }
+    trsmsmall_ker_ft ker     = bli_trsm_small_kers[side_i][uplo_i][trans_i][diag_i][dt];
+    trsmsmall_ker_ft ker_gen = bli_trsm_small_gen_kers[dt];
 
-        }
-    }
-    else
+    // The dedicated kernels only handle column-major A and B.
+    if ((bli_obj_row_stride(a) != 1) ||
+        (bli_obj_row_stride(b) != 1))
     {
-        if(bli_obj_has_trans(a))
-        {
-            if(dt == BLIS_DOUBLE)
-            {
-                if(bli_obj_is_upper(a))
-                {
-                    if(bli_obj_has_unit_diag(a))
-                        return bli_dtrsm_small_XAutB_unitDiag(side, alpha, a, b, cntx, cntl);
-                    else
-                        return bli_dtrsm_small_XAutB(side, alpha, a, b, cntx, cntl);
-                }
-                else
-                {
-                    if(bli_obj_has_unit_diag(a))
-                        return bli_dtrsm_small_XAltB_unitDiag(side, alpha, a, b, cntx, cntl);
-                    else
-                        return bli_dtrsm_small_XAltB(side, alpha, a, b, cntx, cntl);
-                }
-            }
-            else
-            {
-                if(bli_obj_is_upper(a))
-                {
-                    //return bli_strsm_small_XAutB(side, alpha, a, b, cntx, cntl);
-                    return BLIS_NOT_YET_IMPLEMENTED;
-                }
-                else
-                {
-                    return bli_strsm_small_XAltB(side, alpha, a, b, cntx, cntl);
-                }
+        ker = ker_gen;
+    }
 
-            }
-        }
-        else
-        {
-            if(dt == BLIS_DOUBLE)
-            {
-                if(bli_obj_is_upper(a))
-                {
-                    if(bli_obj_has_unit_diag(a))
-                        return bli_dtrsm_small_XAuB_unitDiag(side, alpha, a, b, cntx, cntl);
-                    else
-                        return bli_dtrsm_small_XAuB(side, alpha, a, b, cntx, cntl);
-                }
-                else
-                {
-                    if(bli_obj_has_unit_diag(a))
-                        return bli_dtrsm_small_XAlB_unitDiag(side, alpha, a, b, cntx, cntl);
-                    else
-                        return bli_dtrsm_small_XAlB(side, alpha, a, b, cntx, cntl);
-                }
-            }
-            else
-            {
-                if(bli_obj_is_upper(a))
-                {
-                    //return bli_strsm_small_XAuB(side, alpha, a, b, cntx, cntl);
-                    return BLIS_NOT_YET_IMPLEMENTED;
-                }
-                else
-                {
-                    //return bli_strsm_small_XAlB(side, alpha, a, b, cntx, cntl);
-                    return BLIS_NOT_YET_IMPLEMENTED;
-                }
+    // The dedicated kernels address the buffers of A and B directly and read
+    // alpha straight from its buffer, so pass them aliases whose buffers
+    // point to the first element of any view (such as the tiles used by
+    // bli_l3_dag()), and a copy of alpha in the datatype of the problem
+    // (since alpha may be a constant such as BLIS_ONE).
+    obj_t alpha_local, a_local, b_local;
 
-            }
+    bli_obj_scalar_init_detached_copy_of(dt, BLIS_NO_CONJUGATE, alpha, &alpha_local);
+    bli_obj_alias_to(a, &a_local);
+    bli_obj_alias_to(b, &b_local);
+    bli_obj_reset_origin(&a_local);
+    bli_obj_reset_origin(&b_local);
 
-        }
+    cntx_t* cntx_p = (cntx_t*)cntx;
+
+    err_t status = ker(side, &alpha_local, &a_local, &b_local, cntx_p, cntl);
+
+    // The single-precision kernels only support certain multiples of their
+    // block sizes, so fall back to the generic kernel for other shapes. The
+    // double-precision kernels instead decline based on tuned thresholds
+    // beyond which the conventional path is faster, so those are honored.
+    if (status != BLIS_SUCCESS && ker != ker_gen && dt == BLIS_FLOAT)
+    {
+        status = ker_gen(side, &alpha_local, &a_local, &b_local, cntx_p, cntl);
     }
-    return BLIS_NOT_YET_IMPLEMENTED;
+
+    return status;
 };
 
 /* TRSM scalar code for the case AX = alpha * B
@@ -2532,7 +2730,7 @@ static err_t bli_dtrsm_small_AlXB(
             ymm2 = _mm256_broadcast_sd((double const *)(&ones));  //B11[0-3][2] *alpha -= ymm6
             ymm3 = _mm256_broadcast_sd((double const *)(&ones));  //B11[0-3][3] *alpha -= ymm7
         }
-        else if(1 == n_remainder)
+        else    //(1 == n_remainder)
         {
             ymm0 = _mm256_loadu_pd((double const *)(b11));      //B11[0][0] B11[1][0] B11[2][0] B11[3][0]
 
@@ -4248,7 +4446,7 @@ static err_t bli_dtrsm_small_AlXB_unitDiag(
             ymm2 = _mm256_broadcast_sd((double const *)(&ones));  //B11[0-3][2] *alpha -= ymm6
             ymm3 = _mm256_broadcast_sd((double const *)(&ones));  //B11[0-3][3] *alpha -= ymm7
         }
-        else if(1 == n_remainder)
+        else    //(1 == n_remainder)
         {
             ymm0 = _mm256_loadu_pd((double const *)(b11));      //B11[0][0] B11[1][0] B11[2][0] B11[3][0]
 
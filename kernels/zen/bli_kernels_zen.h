@@ -39,6 +39,18 @@ PACKM_KER_PROT(double, d, packm_6xk_gen_zen)
 PACKM_KER_PROT(double, d, packm_8xk_nn_zen)
 PACKM_KER_PROT(double, d, packm_6xk_nn_zen)
 
+// packm (intrinsics; general-stride and edge cases)
+PACKM_KER_PROT( float,    s, packm_6xk_zen_int )
+PACKM_KER_PROT( float,    s, packm_16xk_zen_int )
+PACKM_KER_PROT( double,   d, packm_6xk_zen_int )
+PACKM_KER_PROT( double,   d, packm_8xk_zen_int )
+
+// packm (intrinsics; half-precision widened to float)
+PACKM_KER_PROT( float,    s, packm_mrxk_bf16_zen_int )
+PACKM_KER_PROT( float,    s, packm_nrxk_bf16_zen_int )
+PACKM_KER_PROT( float,    s, packm_mrxk_f16_zen_int )
+PACKM_KER_PROT( float,    s, packm_nrxk_f16_zen_int )
+
 
 // -- level-1v --
 
@@ -46,6 +58,12 @@ PACKM_KER_PROT(double, d, packm_6xk_nn_zen)
 AMAXV_KER_PROT( float,    s, amaxv_zen_int )
 AMAXV_KER_PROT( double,   d, amaxv_zen_int )
 
+// asumv (intrinsics)
+ASUMV_KER_PROT( float,    s, asumv_zen_int )
+ASUMV_KER_PROT( double,   d, asumv_zen_int )
+ASUMV_KER_PROT( scomplex, c, asumv_zen_int )
+ASUMV_KER_PROT( dcomplex, z, asumv_zen_int )
+
 // axpyv (intrinsics)
 AXPYV_KER_PROT( float,    s, axpyv_zen_int )
 AXPYV_KER_PROT( double,   d, axpyv_zen_int )
@@ -66,6 +84,22 @@ DOTV_KER_PROT( double,   d, dotv_zen_int10 )
 DOTXV_KER_PROT( float,    s, dotxv_zen_int )
 DOTXV_KER_PROT( double,   d, dotxv_zen_int )
 
+// normfv (intrinsics)
+NORMFV_KER_PROT( float,    s, normfv_zen_int )
+NORMFV_KER_PROT( double,   d, normfv_zen_int )
+NORMFV_KER_PROT( scomplex, c, normfv_zen_int )
+NORMFV_KER_PROT( dcomplex, z, normfv_zen_int )
+
+// rotv, rotmv (intrinsics)
+ROTV_KER_PROT( float,    s, rotv_zen_int )
+ROTV_KER_PROT( double,   d, rotv_zen_int )
+ROTV_KER_PROT( scomplex, c, rotv_zen_int )
+ROTV_KER_PROT( dcomplex, z, rotv_zen_int )
+ROTMV_KER_PROT( float,    s, rotmv_zen_int )
+ROTMV_KER_PROT( double,   d, rotmv_zen_int )
+ROTMV_KER_PROT( scomplex, c, rotmv_zen_int )
+ROTMV_KER_PROT( dcomplex, z, rotmv_zen_int )
+
 // scalv (intrinsics)
 SCALV_KER_PROT( float,    s, scalv_zen_int )
 SCALV_KER_PROT( double,   d, scalv_zen_int )
@@ -107,6 +141,12 @@ AXPYF_KER_PROT( scomplex, c, axpyf_zen_int_4 )
 DOTXF_KER_PROT( float,    s, dotxf_zen_int_8 )
 DOTXF_KER_PROT( double,   d, dotxf_zen_int_8 )
 
+// -- level-3 -------------------------------------------------------------------
+
+// gemm (intrinsics; integer, int32 accumulation)
+GEMM_UKR_PROT( int32_t,  i, gemm_u8s8s32_zen_int_6x16 )
+GEMM_UKR_PROT( int32_t,  i, gemm_s16s16s32_zen_int_6x16 )
+
 // -- level-3 sup --------------------------------------------------------------
 
 // semmsup_rv
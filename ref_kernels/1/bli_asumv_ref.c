@@ -0,0 +1,80 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+             dim_t   n, \
+       const void*   x0, inc_t incx, \
+             void*   asum0, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const ctype*   x    = x0; \
+	      ctype_r* asum = asum0; \
+\
+	ctype_r chi1_r; \
+	ctype_r chi1_i; \
+	ctype_r absum; \
+\
+	/* Initialize the absolute sum accumulator to zero. */ \
+	PASTEMAC(chr,set0s)( absum ); \
+\
+	for ( dim_t i = 0; i < n; ++i ) \
+	{ \
+		const ctype* chi1 = x + (i  )*incx; \
+\
+		/* Get the real and imaginary components of chi1. */ \
+		PASTEMAC2(ch,chr,gets)( *chi1, chi1_r, chi1_i ); \
+\
+		/* Replace chi1_r and chi1_i with their absolute values. */ \
+		chi1_r = bli_fabs( chi1_r ); \
+		chi1_i = bli_fabs( chi1_i ); \
+\
+		/* Accumulate the real and imaginary components into absum. */ \
+		PASTEMAC(chr,adds)( chi1_r, absum ); \
+		PASTEMAC(chr,adds)( chi1_i, absum ); \
+	} \
+\
+	/* Store the final value of absum to the output variable. */ \
+	PASTEMAC(chr,copys)( absum, *asum ); \
+}
+
+INSERT_GENTFUNCR_BASIC( asumv, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
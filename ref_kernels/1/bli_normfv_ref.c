@@ -0,0 +1,81 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+             dim_t   n, \
+       const void*   x0, inc_t incx, \
+             void*   norm0, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const ctype*   x    = x0; \
+	      ctype_r* norm = norm0; \
+\
+	ctype_r  scale; \
+	ctype_r  sumsq; \
+	ctype_r  sqrt_sumsq; \
+\
+	/* Initialize scale and sumsq to begin the summation. */ \
+	PASTEMAC(chr,copys)( *PASTEMAC(chr,0), scale ); \
+	PASTEMAC(chr,copys)( *PASTEMAC(chr,1), sumsq ); \
+\
+	/* Compute the sum of the squares of the vector using the scaled
+	   recurrence, which avoids unnecessary overflow and underflow. */ \
+	PASTEMAC(ch,sumsqv_unb_var1) \
+	( \
+	  n, \
+	  ( ctype* )x, incx, \
+	  &scale, \
+	  &sumsq, \
+	  ( cntx_t* )cntx, \
+	  NULL  \
+	); \
+\
+	/* Compute: norm = scale * sqrt( sumsq ) */ \
+	PASTEMAC(chr,sqrt2s)( sumsq, sqrt_sumsq ); \
+	PASTEMAC(chr,scals)( scale, sqrt_sumsq ); \
+\
+	/* Store the final value to the output variable. */ \
+	PASTEMAC(chr,copys)( sqrt_sumsq, *norm ); \
+}
+
+INSERT_GENTFUNCR_BASIC( normfv, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
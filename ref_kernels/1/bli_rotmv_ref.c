@@ -0,0 +1,95 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+             dim_t   n, \
+             void*   x0, inc_t incx, \
+             void*   y0, inc_t incy, \
+       const void*   param0, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	ctype*         x     = x0; \
+	ctype*         y     = y0; \
+	const ctype_r* param = param0; \
+\
+	const ctype_r  flag  = param[0]; \
+	      ctype_r  h11, h21, h12, h22; \
+\
+	/* The flag encodes which elements of H are stored in param and which
+	   are implied, following the convention of the BLAS rotm/rotmg:
+	     -2: H = I (no-op)
+	     -1: H = [ h11 h12; h21 h22 ]
+	      0: H = [  1  h12; h21  1  ]
+	      1: H = [ h11  1 ;  -1 h22 ] */ \
+	if      ( flag == -2.0 ) return; \
+	else if ( flag <   0.0 ) { h11 = param[1]; h21 = param[2]; \
+	                           h12 = param[3]; h22 = param[4]; } \
+	else if ( flag ==  0.0 ) { h11 = 1.0;      h21 = param[2]; \
+	                           h12 = param[3]; h22 = 1.0;      } \
+	else                     { h11 = param[1]; h21 = -1.0; \
+	                           h12 = 1.0;      h22 = param[4]; } \
+\
+	ctype rho1; \
+	ctype tau1; \
+	ctype temp; \
+\
+	for ( dim_t i = 0; i < n; ++i ) \
+	{ \
+		ctype* chi1 = x + (i  )*incx; \
+		ctype* psi1 = y + (i  )*incy; \
+\
+		/* rho1 = h11 * chi1 + h12 * psi1; */ \
+		PASTEMAC3(chr,ch,ch,scal2s)( h11, *chi1, rho1 ); \
+		PASTEMAC3(chr,ch,ch,scal2s)( h12, *psi1, temp ); \
+		PASTEMAC(ch,adds)( temp, rho1 ); \
+\
+		/* tau1 = h21 * chi1 + h22 * psi1; */ \
+		PASTEMAC3(chr,ch,ch,scal2s)( h21, *chi1, tau1 ); \
+		PASTEMAC3(chr,ch,ch,scal2s)( h22, *psi1, temp ); \
+		PASTEMAC(ch,adds)( temp, tau1 ); \
+\
+		PASTEMAC(ch,copys)( rho1, *chi1 ); \
+		PASTEMAC(ch,copys)( tau1, *psi1 ); \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC( rotmv, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
@@ -0,0 +1,84 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+             dim_t   n, \
+             void*   x0, inc_t incx, \
+             void*   y0, inc_t incy, \
+       const void*   c0, \
+       const void*   s0, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	ctype*         x = x0; \
+	ctype*         y = y0; \
+	const ctype_r* c = c0; \
+	const ctype_r* s = s0; \
+\
+	const ctype_r  c1  = *c; \
+	const ctype_r  s1  = *s; \
+	const ctype_r  ms1 = -( *s ); \
+\
+	ctype rho1; \
+	ctype tau1; \
+	ctype temp; \
+\
+	for ( dim_t i = 0; i < n; ++i ) \
+	{ \
+		ctype* chi1 = x + (i  )*incx; \
+		ctype* psi1 = y + (i  )*incy; \
+\
+		/* rho1 = c * chi1 + s * psi1; */ \
+		PASTEMAC3(chr,ch,ch,scal2s)( c1, *chi1, rho1 ); \
+		PASTEMAC3(chr,ch,ch,scal2s)( s1, *psi1, temp ); \
+		PASTEMAC(ch,adds)( temp, rho1 ); \
+\
+		/* tau1 = -s * chi1 + c * psi1; */ \
+		PASTEMAC3(chr,ch,ch,scal2s)( c1, *psi1, tau1 ); \
+		PASTEMAC3(chr,ch,ch,scal2s)( ms1, *chi1, temp ); \
+		PASTEMAC(ch,adds)( temp, tau1 ); \
+\
+		PASTEMAC(ch,copys)( rho1, *chi1 ); \
+		PASTEMAC(ch,copys)( tau1, *psi1 ); \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC( rotv, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
@@ -0,0 +1,104 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Reference packm kernels that widen bfloat16 or float16 micropanels to
+// float. These kernels take the place of packm_mrxk/packm_nrxk when the
+// half-precision gemm implementation packs its operands for the float
+// gemm microkernel.
+//
+
+#define PACKM_HALF_BODY( cvt, kappa_op ) \
+\
+do \
+{ \
+	for ( dim_t k = n; k != 0; --k ) \
+	{ \
+		for ( dim_t mn = 0; mn < cdim; mn++ ) \
+			pi1[ mn ] = kappa_op( cvt( alpha1[ mn*inca ] ) ); \
+\
+		alpha1 += lda; \
+		pi1    += ldp; \
+	} \
+} while(0)
+
+#define PACKM_HALF_NOSCAL( x ) ( x )
+#define PACKM_HALF_SCAL( x )   ( kappa_cast * ( x ) )
+
+
+#undef  GENTFUNCH
+#define GENTFUNCH( ctype_h, cvt, opname, mnr0, arch, suf ) \
+\
+void PASTEMAC3(s,opname,arch,suf) \
+     ( \
+             conj_t  conja, \
+             pack_t  schema, \
+             dim_t   cdim, \
+             dim_t   n, \
+             dim_t   n_max, \
+       const void*   kappa, \
+       const void*   a, inc_t inca, inc_t lda, \
+             void*   p,             inc_t ldp, \
+       const cntx_t* cntx  \
+     ) \
+{ \
+	const dim_t            cdim_max   = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, mnr0, cntx ); \
+\
+	const float            kappa_cast = *( const float* )kappa; \
+	const ctype_h*restrict alpha1     = a; \
+	      float*  restrict pi1        = p; \
+\
+	/* Half-precision operands are always real, so there is nothing to
+	   conjugate. */ \
+	( void )conja; \
+	( void )schema; \
+\
+	if ( kappa_cast == 1.0F ) PACKM_HALF_BODY( cvt, PACKM_HALF_NOSCAL ); \
+	else                      PACKM_HALF_BODY( cvt, PACKM_HALF_SCAL ); \
+\
+	bli_sset0s_edge \
+	( \
+	  cdim, cdim_max, \
+	  n, n_max, \
+	  p, ldp  \
+	); \
+}
+
+GENTFUNCH( bfloat16, bli_bf16_to_float, packm_mrxk_bf16, BLIS_MR, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+GENTFUNCH( bfloat16, bli_bf16_to_float, packm_nrxk_bf16, BLIS_NR, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+GENTFUNCH( float16,  bli_f16_to_float,  packm_mrxk_f16,  BLIS_MR, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+GENTFUNCH( float16,  bli_f16_to_float,  packm_nrxk_f16,  BLIS_NR, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
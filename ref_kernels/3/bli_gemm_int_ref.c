@@ -0,0 +1,151 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// Reference integer gemm microkernels. A and B are packed in k-grouped
+// micropanels: each group of KG consecutive k indices of a row of A (or a
+// column of B) is stored contiguously in one 32-bit word, and the words for
+// the MR rows (NR columns) of the micropanel are stored next to each other.
+// That is, element (i,l) of an A micropanel is found at
+//
+//   a[ ( ( l / KG ) * MR + i ) * KG + ( l % KG ) ]
+//
+// and similarly for B. KG is 4 for 8-bit and 2 for 16-bit operands. The
+// micropanels are zero-padded out to a multiple of KG in the k dimension.
+//
+// These kernels reproduce the arithmetic of the x86 vpmaddubsw/vpmaddwd
+// instructions exactly so that results do not depend on which kernel set
+// is in use: for u8 x s8, adjacent pairs of products are summed with
+// saturation to 16 bits before being accumulated, and all 32-bit sums wrap
+// on overflow.
+//
+
+BLIS_INLINE int32_t bli_igemm_sat16( int32_t x )
+{
+	return ( x > INT16_MAX ? INT16_MAX : ( x < INT16_MIN ? INT16_MIN : x ) );
+}
+
+#undef  GENTFUNCI
+#define GENTFUNCI( ctype_a, ctype_b, kg, opname, arch, suf ) \
+\
+void PASTEMAC3(i,opname,arch,suf) \
+     ( \
+             dim_t      m, \
+             dim_t      n, \
+             dim_t      k, \
+       const void*      alpha0, \
+       const void*      a0, \
+       const void*      b0, \
+       const void*      beta0, \
+             void*      c0, inc_t rs_c, inc_t cs_c, \
+             auxinfo_t* data, \
+       const cntx_t*    cntx  \
+     ) \
+{ \
+	const uint32_t         alpha = ( uint32_t )*( const int32_t* )alpha0; \
+	const uint32_t         beta  = ( uint32_t )*( const int32_t* )beta0; \
+	const ctype_a*restrict a     = a0; \
+	const ctype_b*restrict b     = b0; \
+	      int32_t*restrict c     = c0; \
+\
+	const dim_t mr = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_MR, cntx ); \
+	const dim_t nr = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_NR, cntx ); \
+\
+	const dim_t k_iter = ( k + kg - 1 ) / kg; \
+\
+	uint32_t    ab[ BLIS_STACK_BUF_MAX_SIZE \
+	                / sizeof( uint32_t ) ] \
+	                __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+\
+	( void )data; \
+\
+	for ( dim_t i = 0; i < m * n; ++i ) ab[ i ] = 0; \
+\
+	/* Perform a series of k_iter rank-kg updates into ab. */ \
+	for ( dim_t l = 0; l < k_iter; ++l ) \
+	{ \
+		for ( dim_t i = 0; i < m; ++i ) \
+		{ \
+			const ctype_a* restrict ai = a + i*kg; \
+\
+			for ( dim_t j = 0; j < n; ++j ) \
+			{ \
+				const ctype_b* restrict bj = b + j*kg; \
+\
+				PASTEMAC(opname,_dots)( ai, bj, ab[ i*n + j ] ); \
+			} \
+		} \
+\
+		a += mr * kg; \
+		b += nr * kg; \
+	} \
+\
+	/* Scale by alpha and accumulate into C (or overwrite C if beta is
+	   zero). */ \
+	for ( dim_t i = 0; i < m; ++i ) \
+	for ( dim_t j = 0; j < n; ++j ) \
+	{ \
+		int32_t* restrict cij = c + i*rs_c + j*cs_c; \
+		const uint32_t    abij = alpha * ab[ i*n + j ]; \
+\
+		if ( beta == 0 ) *cij = ( int32_t )abij; \
+		else             *cij = ( int32_t )( beta * ( uint32_t )*cij + abij ); \
+	} \
+}
+
+// u8 x s8: two saturated pair sums per group of four (as with vpmaddubsw
+// followed by vpmaddwd against a vector of ones).
+#define bli_gemm_u8s8s32_dots( a, b, ab ) \
+{ \
+	const int32_t p0 = bli_igemm_sat16( ( int32_t )(a)[0] * (b)[0] + \
+	                                    ( int32_t )(a)[1] * (b)[1] ); \
+	const int32_t p1 = bli_igemm_sat16( ( int32_t )(a)[2] * (b)[2] + \
+	                                    ( int32_t )(a)[3] * (b)[3] ); \
+	(ab) += ( uint32_t )p0 + ( uint32_t )p1; \
+}
+
+// s16 x s16: the two products of a group are summed in 32 bits (as with
+// vpmaddwd).
+#define bli_gemm_s16s16s32_dots( a, b, ab ) \
+{ \
+	(ab) += ( uint32_t )( ( int32_t )(a)[0] * (b)[0] ) + \
+	        ( uint32_t )( ( int32_t )(a)[1] * (b)[1] ); \
+}
+
+GENTFUNCI( uint8_t, int8_t,  4, gemm_u8s8s32,   BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+GENTFUNCI( int16_t, int16_t, 2, gemm_s16s16s32, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
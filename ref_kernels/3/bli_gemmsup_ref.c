@@ -64,7 +64,42 @@ void PASTEMAC3(ch,opname,arch,suf) \
 	      ctype* restrict c     = c0; \
 \
 	/* NOTE: This microkernel can actually handle arbitrarily large
-	   values of m, n, and k. */ \
+	   values of m, n, and k, but only if a and b are not packed. The sup
+	   variants call it as a millikernel, with m > MR (var2m) or n > NR
+	   (var1n), and a or b may then be packed into micropanels that are
+	   ps_a or ps_b elements apart. So we break such problems into MR x NR
+	   subproblems, each of which reads from a single micropanel. */ \
+	const num_t dt = PASTEMAC(ch,type); \
+	const dim_t mr = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t nr = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_NR, cntx ); \
+\
+	if ( m > mr || n > nr ) \
+	{ \
+		const inc_t ps_a = bli_auxinfo_ps_a( data ); \
+		const inc_t ps_b = bli_auxinfo_ps_b( data ); \
+\
+		for ( dim_t i = 0; i < m; i += mr ) \
+		for ( dim_t j = 0; j < n; j += nr ) \
+		{ \
+			PASTEMAC3(ch,opname,arch,suf) \
+			( \
+			  conja, \
+			  conjb, \
+			  bli_min( mr, m - i ), \
+			  bli_min( nr, n - j ), \
+			  k, \
+			  alpha, \
+			  a + ( i / mr ) * ps_a, rs_a, cs_a, \
+			  b + ( j / nr ) * ps_b, rs_b, cs_b, \
+			  beta, \
+			  c + i*rs_c + j*cs_c, rs_c, cs_c, \
+			  data, \
+			  cntx \
+			); \
+		} \
+\
+		return; \
+	} \
 \
 	if ( bli_is_noconj( conja ) && bli_is_noconj( conjb ) ) \
 	{ \
@@ -275,7 +310,42 @@ void PASTEMAC3(ch,opname,arch,suf) \
 	      ctype* restrict c     = c0; \
 \
 	/* NOTE: This microkernel can actually handle arbitrarily large
-	   values of m, n, and k. */ \
+	   values of m, n, and k, but only if a and b are not packed. The sup
+	   variants call it as a millikernel, with m > MR (var2m) or n > NR
+	   (var1n), and a or b may then be packed into micropanels that are
+	   ps_a or ps_b elements apart. So we break such problems into MR x NR
+	   subproblems, each of which reads from a single micropanel. */ \
+	const num_t dt = PASTEMAC(ch,type); \
+	const dim_t mr = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t nr = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_NR, cntx ); \
+\
+	if ( m > mr || n > nr ) \
+	{ \
+		const inc_t ps_a = bli_auxinfo_ps_a( data ); \
+		const inc_t ps_b = bli_auxinfo_ps_b( data ); \
+\
+		for ( dim_t i = 0; i < m; i += mr ) \
+		for ( dim_t j = 0; j < n; j += nr ) \
+		{ \
+			PASTEMAC3(ch,opname,arch,suf) \
+			( \
+			  conja, \
+			  conjb, \
+			  bli_min( mr, m - i ), \
+			  bli_min( nr, n - j ), \
+			  k, \
+			  alpha, \
+			  a + ( i / mr ) * ps_a, rs_a, cs_a, \
+			  b + ( j / nr ) * ps_b, rs_b, cs_b, \
+			  beta, \
+			  c + i*rs_c + j*cs_c, rs_c, cs_c, \
+			  data, \
+			  cntx \
+			); \
+		} \
+\
+		return; \
+	} \
 \
 	if ( bli_is_noconj( conja ) && bli_is_noconj( conjb ) ) \
 	{ \
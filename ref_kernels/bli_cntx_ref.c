@@ -78,11 +78,23 @@ INSERT_PROTMAC_BASIC( GEMMTRSM_UKR_PROT, gemmtrsm_u_ukr_name )
 INSERT_PROTMAC_BASIC( TRSM_UKR_PROT,     trsm_l_ukr_name )
 INSERT_PROTMAC_BASIC( TRSM_UKR_PROT,     trsm_u_ukr_name )
 
+// The integer gemm microkernels accumulate in int32 (hence the 'i' prefix).
+
+#define gemm_u8s8s32_ukr_name   GENARNAME(gemm_u8s8s32)
+#define gemm_s16s16s32_ukr_name GENARNAME(gemm_s16s16s32)
+
+GEMM_UKR_PROT( int32_t, i, gemm_u8s8s32_ukr_name )
+GEMM_UKR_PROT( int32_t, i, gemm_s16s16s32_ukr_name )
+
 
 // -- Level-3 virtual micro-kernel prototype redefinitions ---------------------
 
 // -- Construct arch-specific names for reference virtual level-3 microkernels --
 
+// -- 3m --
+
+#define gemm3m_ukr_name        GENARNAME(gemm3m)
+
 // -- 1m --
 
 #define gemm1m_ukr_name        GENARNAME(gemm1m)
@@ -94,6 +106,10 @@ INSERT_PROTMAC_BASIC( TRSM_UKR_PROT,     trsm_u_ukr_name )
 // Instantiate prototypes for above functions using the pre-defined level-3
 // microkernel prototype-generating macros.
 
+// -- 3m --
+
+INSERT_PROTMAC_BASIC( GEMM_UKR_PROT,     gemm3m_ukr_name )
+
 // -- 1m --
 
 INSERT_PROTMAC_BASIC( GEMM_UKR_PROT,     gemm1m_ukr_name )
@@ -131,12 +147,18 @@ INSERT_PROTMAC_BASIC( GEMMSUP_KER_PROT, gemmsup_gx_ukr_name )
 #define packm_nrxk_ker_name            GENARNAME(packm_nrxk)
 #define packm_mrxk_1er_ker_name        GENARNAME(packm_mrxk_1er)
 #define packm_nrxk_1er_ker_name        GENARNAME(packm_nrxk_1er)
+#define packm_mrxk_3mi_ker_name        GENARNAME(packm_mrxk_3mi)
+#define packm_nrxk_3mi_ker_name        GENARNAME(packm_nrxk_3mi)
 #define packm_mrxmr_diag_ker_name      GENARNAME(packm_mrxmr_diag)
 #define packm_nrxnr_diag_ker_name      GENARNAME(packm_nrxnr_diag)
 #define packm_mrxmr_diag_1er_ker_name  GENARNAME(packm_mrxmr_diag_1er)
 #define packm_nrxnr_diag_1er_ker_name  GENARNAME(packm_nrxnr_diag_1er)
 #define unpackm_mrxk_ker_name          GENARNAME(unpackm_mrxk)
 #define unpackm_nrxk_ker_name          GENARNAME(unpackm_nrxk)
+#define packm_mrxk_bf16_ker_name       GENARNAME(packm_mrxk_bf16)
+#define packm_nrxk_bf16_ker_name       GENARNAME(packm_nrxk_bf16)
+#define packm_mrxk_f16_ker_name        GENARNAME(packm_mrxk_f16)
+#define packm_nrxk_f16_ker_name        GENARNAME(packm_nrxk_f16)
 
 // Instantiate prototypes for above functions using the pre-defined packm
 // kernel prototype-generating macros.
@@ -145,6 +167,8 @@ INSERT_PROTMAC_BASIC( PACKM_KER_PROT,      packm_mrxk_ker_name )
 INSERT_PROTMAC_BASIC( PACKM_KER_PROT,      packm_nrxk_ker_name )
 INSERT_PROTMAC_BASIC( PACKM_KER_PROT,      packm_mrxk_1er_ker_name )
 INSERT_PROTMAC_BASIC( PACKM_KER_PROT,      packm_nrxk_1er_ker_name )
+INSERT_PROTMAC_BASIC( PACKM_KER_PROT,      packm_mrxk_3mi_ker_name )
+INSERT_PROTMAC_BASIC( PACKM_KER_PROT,      packm_nrxk_3mi_ker_name )
 INSERT_PROTMAC_BASIC( PACKM_DIAG_KER_PROT, packm_mrxmr_diag_ker_name )
 INSERT_PROTMAC_BASIC( PACKM_DIAG_KER_PROT, packm_nrxnr_diag_ker_name )
 INSERT_PROTMAC_BASIC( PACKM_DIAG_KER_PROT, packm_mrxmr_diag_1er_ker_name )
@@ -152,6 +176,13 @@ INSERT_PROTMAC_BASIC( PACKM_DIAG_KER_PROT, packm_nrxnr_diag_1er_ker_name )
 INSERT_PROTMAC_BASIC( UNPACKM_KER_PROT,    unpackm_mrxk_ker_name )
 INSERT_PROTMAC_BASIC( UNPACKM_KER_PROT,    unpackm_nrxk_ker_name )
 
+// The half-precision packm kernels only produce packed float micropanels.
+
+PACKM_KER_PROT( float, s, packm_mrxk_bf16_ker_name )
+PACKM_KER_PROT( float, s, packm_nrxk_bf16_ker_name )
+PACKM_KER_PROT( float, s, packm_mrxk_f16_ker_name )
+PACKM_KER_PROT( float, s, packm_nrxk_f16_ker_name )
+
 
 // -- Level-1f kernel prototype redefinitions ----------------------------------
 
@@ -179,6 +210,7 @@ INSERT_PROTMAC_BASIC( DOTXF_KER_PROT,      dotxf_ker_name )
 
 #define addv_ker_name      GENARNAME(addv)
 #define amaxv_ker_name     GENARNAME(amaxv)
+#define asumv_ker_name     GENARNAME(asumv)
 #define axpbyv_ker_name    GENARNAME(axpbyv)
 #define axpyv_ker_name     GENARNAME(axpyv)
 #define copyv_ker_name     GENARNAME(copyv)
@@ -186,6 +218,9 @@ INSERT_PROTMAC_BASIC( DOTXF_KER_PROT,      dotxf_ker_name )
 #define dotxv_ker_name     GENARNAME(dotxv)
 #define invertv_ker_name   GENARNAME(invertv)
 #define invscalv_ker_name  GENARNAME(invscalv)
+#define normfv_ker_name    GENARNAME(normfv)
+#define rotmv_ker_name     GENARNAME(rotmv)
+#define rotv_ker_name      GENARNAME(rotv)
 #define scalv_ker_name     GENARNAME(scalv)
 #define scal2v_ker_name    GENARNAME(scal2v)
 #define setv_ker_name      GENARNAME(setv)
@@ -198,6 +233,7 @@ INSERT_PROTMAC_BASIC( DOTXF_KER_PROT,      dotxf_ker_name )
 
 INSERT_PROTMAC_BASIC( ADDV_KER_PROT,     addv_ker_name )
 INSERT_PROTMAC_BASIC( AMAXV_KER_PROT,    amaxv_ker_name )
+INSERT_PROTMAC_BASIC( ASUMV_KER_PROT,    asumv_ker_name )
 INSERT_PROTMAC_BASIC( AXPBYV_KER_PROT,   axpbyv_ker_name )
 INSERT_PROTMAC_BASIC( AXPYV_KER_PROT,    axpyv_ker_name )
 INSERT_PROTMAC_BASIC( COPYV_KER_PROT,    copyv_ker_name )
@@ -205,6 +241,9 @@ INSERT_PROTMAC_BASIC( DOTV_KER_PROT,     dotv_ker_name )
 INSERT_PROTMAC_BASIC( DOTXV_KER_PROT,    dotxv_ker_name )
 INSERT_PROTMAC_BASIC( INVERTV_KER_PROT,  invertv_ker_name )
 INSERT_PROTMAC_BASIC( INVSCALV_KER_PROT, invscalv_ker_name )
+INSERT_PROTMAC_BASIC( NORMFV_KER_PROT,   normfv_ker_name )
+INSERT_PROTMAC_BASIC( ROTMV_KER_PROT,    rotmv_ker_name )
+INSERT_PROTMAC_BASIC( ROTV_KER_PROT,     rotv_ker_name )
 INSERT_PROTMAC_BASIC( SCALV_KER_PROT,    scalv_ker_name )
 INSERT_PROTMAC_BASIC( SCAL2V_KER_PROT,   scal2v_ker_name )
 INSERT_PROTMAC_BASIC( SETV_KER_PROT,     setv_ker_name )
@@ -222,6 +261,18 @@ INSERT_PROTMAC_BASIC( XPBYV_KER_PROT,    xpbyv_ker_name )
 	                       PASTEMAC(c,opname), PASTEMAC(z,opname) ); \
 }
 
+#define gen_func_init_s( func_p, opname ) \
+{ \
+	bli_func_init( func_p, PASTEMAC(s,opname), NULL, \
+	                       NULL,               NULL ); \
+}
+
+#define gen_func_init_i( func_p, opname ) \
+{ \
+	bli_func_init( func_p, PASTEMAC(i,opname), NULL, \
+	                       NULL,               NULL ); \
+}
+
 #define gen_func_init( func_p, opname ) \
 { \
 	bli_func_init( func_p, PASTEMAC(s,opname), PASTEMAC(d,opname), \
@@ -393,6 +444,12 @@ void GENBARNAME(cntx_init)
 	bli_mbool_init( &mbools[ BLIS_GEMMSUP_XXX_UKR_ROW_PREF ],  TRUE,  TRUE,  TRUE,  TRUE );
 
 
+	// -- Set integer gemm micro-kernels ---------------------------------------
+
+	gen_func_init_i( &funcs[ BLIS_GEMM_U8S8S32_UKR ],   gemm_u8s8s32_ukr_name   );
+	gen_func_init_i( &funcs[ BLIS_GEMM_S16S16S32_UKR ], gemm_s16s16s32_ukr_name );
+
+
 	// -- Set level-1f kernels -------------------------------------------------
 
 	gen_func_init( &funcs[ BLIS_AXPY2V_KER ],    axpy2v_ker_name    );
@@ -406,6 +463,7 @@ void GENBARNAME(cntx_init)
 
 	gen_func_init( &funcs[ BLIS_ADDV_KER ],     addv_ker_name     );
 	gen_func_init( &funcs[ BLIS_AMAXV_KER ],    amaxv_ker_name    );
+	gen_func_init( &funcs[ BLIS_ASUMV_KER ],    asumv_ker_name    );
 	gen_func_init( &funcs[ BLIS_AXPBYV_KER ],   axpbyv_ker_name   );
 	gen_func_init( &funcs[ BLIS_AXPYV_KER ],    axpyv_ker_name    );
 	gen_func_init( &funcs[ BLIS_COPYV_KER ],    copyv_ker_name    );
@@ -413,6 +471,9 @@ void GENBARNAME(cntx_init)
 	gen_func_init( &funcs[ BLIS_DOTXV_KER ],    dotxv_ker_name    );
 	gen_func_init( &funcs[ BLIS_INVERTV_KER ],  invertv_ker_name  );
 	gen_func_init( &funcs[ BLIS_INVSCALV_KER ], invscalv_ker_name );
+	gen_func_init( &funcs[ BLIS_NORMFV_KER ],   normfv_ker_name   );
+	gen_func_init( &funcs[ BLIS_ROTMV_KER ],    rotmv_ker_name    );
+	gen_func_init( &funcs[ BLIS_ROTV_KER ],     rotv_ker_name     );
 	gen_func_init( &funcs[ BLIS_SCALV_KER ],    scalv_ker_name    );
 	gen_func_init( &funcs[ BLIS_SCAL2V_KER ],   scal2v_ker_name   );
 	gen_func_init( &funcs[ BLIS_SETV_KER ],     setv_ker_name     );
@@ -429,6 +490,9 @@ void GENBARNAME(cntx_init)
 	gen_func_init_co( &funcs[ BLIS_PACKM_MRXK_1ER_KER ],  packm_mrxk_1er_ker_name );
 	gen_func_init_co( &funcs[ BLIS_PACKM_NRXK_1ER_KER ],  packm_nrxk_1er_ker_name );
 
+	gen_func_init_co( &funcs[ BLIS_PACKM_MRXK_3MI_KER ],  packm_mrxk_3mi_ker_name );
+	gen_func_init_co( &funcs[ BLIS_PACKM_NRXK_3MI_KER ],  packm_nrxk_3mi_ker_name );
+
 	gen_func_init( &funcs[ BLIS_PACKM_MRXMR_DIAG_KER ],  packm_mrxmr_diag_ker_name );
 	gen_func_init( &funcs[ BLIS_PACKM_NRXNR_DIAG_KER ],  packm_nrxnr_diag_ker_name );
 
@@ -438,6 +502,11 @@ void GENBARNAME(cntx_init)
 	gen_func_init( &funcs[ BLIS_UNPACKM_MRXK_KER ],  unpackm_mrxk_ker_name );
 	gen_func_init( &funcs[ BLIS_UNPACKM_NRXK_KER ],  unpackm_nrxk_ker_name );
 
+	gen_func_init_s( &funcs[ BLIS_PACKM_MRXK_BF16_KER ],  packm_mrxk_bf16_ker_name );
+	gen_func_init_s( &funcs[ BLIS_PACKM_NRXK_BF16_KER ],  packm_nrxk_bf16_ker_name );
+	gen_func_init_s( &funcs[ BLIS_PACKM_MRXK_F16_KER ],   packm_mrxk_f16_ker_name );
+	gen_func_init_s( &funcs[ BLIS_PACKM_NRXK_F16_KER ],   packm_nrxk_f16_ker_name );
+
 
 	// -- Set level-3 small/unpacked handlers ----------------------------------
 
@@ -479,7 +548,14 @@ void GENBAINAME(cntx_init)
 
 	funcs = cntx->ukrs;
 
-	if ( method == BLIS_1M )
+	if ( method == BLIS_3M )
+	{
+		// The 3m method is only implemented for gemm, so we leave the
+		// trsm-related virtual micro-kernels as they were copied from the
+		// native context.
+		gen_func_init_co( &funcs[ BLIS_GEMM_VIR_UKR ],       gemm3m_ukr_name       );
+	}
+	else if ( method == BLIS_1M )
 	{
 		gen_func_init_co( &funcs[ BLIS_GEMM_VIR_UKR ],       gemm1m_ukr_name       );
 		gen_func_init_co( &funcs[ BLIS_GEMMTRSM_L_VIR_UKR ], gemmtrsm1m_l_ukr_name );
@@ -523,7 +599,7 @@ void GENBAINAME(cntx_init)
 		gen_func_init_co( &funcs[ BLIS_PACKM_MRXK_KER ],  packm_mrxk_1er_ker_name );
 		gen_func_init_co( &funcs[ BLIS_PACKM_NRXK_KER ],  packm_nrxk_1er_ker_name );
 	}
-	else // if ( method == BLIS_NAT )
+	else if ( method == BLIS_NAT )
 	{
 		gen_func_init( &funcs[ BLIS_PACKM_MRXK_KER ],  packm_mrxk_ker_name );
 		gen_func_init( &funcs[ BLIS_PACKM_NRXK_KER ],  packm_nrxk_ker_name );
@@ -532,6 +608,12 @@ void GENBAINAME(cntx_init)
 	gen_func_init_co( &funcs[ BLIS_PACKM_MRXK_1ER_KER ],  packm_mrxk_1er_ker_name );
 	gen_func_init_co( &funcs[ BLIS_PACKM_NRXK_1ER_KER ],  packm_nrxk_1er_ker_name );
 
+	// NOTE: The 3mi packm kernels are selected by bli_packm_struc_cxk()
+	// according to the pack schema, so the 3m method does not need to
+	// override the BLIS_PACKM_[MN]RXK_KER slots above.
+	gen_func_init_co( &funcs[ BLIS_PACKM_MRXK_3MI_KER ],  packm_mrxk_3mi_ker_name );
+	gen_func_init_co( &funcs[ BLIS_PACKM_NRXK_3MI_KER ],  packm_nrxk_3mi_ker_name );
+
 	gen_func_init( &funcs[ BLIS_UNPACKM_MRXK_KER ],  unpackm_mrxk_ker_name );
 	gen_func_init( &funcs[ BLIS_UNPACKM_NRXK_KER ],  unpackm_nrxk_ker_name );
 
@@ -540,7 +622,7 @@ void GENBAINAME(cntx_init)
 
 	// Modify the context with cache and register blocksizes (and multiples)
 	// appropriate for the current induced method.
-	if ( method == BLIS_1M )
+	if ( method == BLIS_3M || method == BLIS_1M )
 	{
 		//const bool is_pb = FALSE;
 
@@ -569,6 +651,29 @@ void GENBAINAME(cntx_init_blkszs)
 
 	num_t dt_r = bli_dt_proj_to_real( dt );
 
+	// The 3m method computes each complex microtile from three real
+	// microtiles of the same (real) dimensions, and so the register
+	// blocksizes are inherited from the real domain unchanged. However,
+	// each packed complex micropanel occupies three real micropanels, so
+	// we divide kc by three to keep the packed blocks of A and B within the
+	// same cache footprint as their real domain counterparts.
+	if ( method == BLIS_3M )
+	{
+		bli_cntx_set_ind_blkszs
+		(
+		  method, dt, cntx,
+		  BLIS_NC, 1.0, 1.0,
+		  BLIS_KC, 3.0, 3.0, // divide kc by three
+		  BLIS_MC, 1.0, 1.0,
+		  BLIS_NR, 1.0, 1.0,
+		  BLIS_MR, 1.0, 1.0,
+		  BLIS_KR, 1.0, 1.0,
+		  BLIS_VA_END
+		);
+
+		return;
+	}
+
 	// Initialize the blocksizes according to the micro-kernel preference as
 	// well as the algorithm.
 	//if ( bli_cntx_ukr_prefers_cols_dt( dt, BLIS_GEMM_UKR, cntx ) )
@@ -0,0 +1,151 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#undef  GENTFUNCCO
+#define GENTFUNCCO( ctype, ctype_r, ch, chr, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+             dim_t      m, \
+             dim_t      n, \
+             dim_t      k, \
+       const void*      alpha0, \
+       const void*      a0, \
+       const void*      b0, \
+       const void*      beta0, \
+             void*      c0, inc_t rs_c, inc_t cs_c, \
+             auxinfo_t* data, \
+       const cntx_t*    cntx  \
+     ) \
+{ \
+	const ctype*      alpha     = alpha0; \
+	const ctype*      beta      = beta0; \
+	      ctype*      c         = c0; \
+\
+	const num_t       dt_r      = PASTEMAC(chr,type); \
+\
+	      gemm_ukr_ft rgemm_ukr = bli_cntx_get_ukr_dt( dt_r, BLIS_GEMM_UKR, cntx ); \
+	const bool        col_pref  = bli_cntx_ukr_prefers_cols_dt( dt_r, BLIS_GEMM_UKR, cntx ); \
+\
+	const dim_t       mr_r      = bli_cntx_get_blksz_def_dt( dt_r, BLIS_MR, cntx ); \
+	const dim_t       nr_r      = bli_cntx_get_blksz_def_dt( dt_r, BLIS_NR, cntx ); \
+\
+	/* The real, imaginary, and real+imaginary parts of each micropanel are
+	   stored as three consecutive real micropanels separated by the
+	   imaginary stride (see bli_packm_init() and the 3mi packm kernels). */ \
+	const inc_t       is_a      = bli_auxinfo_is_a( data ); \
+	const inc_t       is_b      = bli_auxinfo_is_b( data ); \
+\
+	const ctype_r*    a_r       = ( const ctype_r* )a0; \
+	const ctype_r*    a_i       = a_r + is_a; \
+	const ctype_r*    a_rpi     = a_r + 2*is_a; \
+\
+	const ctype_r*    b_r       = ( const ctype_r* )b0; \
+	const ctype_r*    b_i       = b_r + is_b; \
+	const ctype_r*    b_rpi     = b_r + 2*is_b; \
+\
+	const ctype_r*    one_r     = PASTEMAC(chr,1); \
+	const ctype_r*    zero_r    = PASTEMAC(chr,0); \
+\
+	      ctype_r     ab_r  [ BLIS_STACK_BUF_MAX_SIZE \
+	                          / sizeof( ctype_r ) ] \
+	                          __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	      ctype_r     ab_i  [ BLIS_STACK_BUF_MAX_SIZE \
+	                          / sizeof( ctype_r ) ] \
+	                          __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	      ctype_r     ab_rpi[ BLIS_STACK_BUF_MAX_SIZE \
+	                          / sizeof( ctype_r ) ] \
+	                          __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+\
+	/* Store the real microtiles according to the preference of the
+	   underlying real domain gemm micro-kernel. */ \
+	const inc_t       rs_ab     = ( col_pref ? 1    : nr_r ); \
+	const inc_t       cs_ab     = ( col_pref ? mr_r : 1    ); \
+\
+	/* The following three real gemm micro-kernel calls implement the 3m
+	   method, which induces a complex matrix multiplication with three
+	   real matrix products instead of four:
+
+	     ab_r   = a_r * b_r
+	     ab_i   = a_i * b_i
+	     ab_rpi = ( a_r + a_i ) * ( b_r + b_i )
+
+	   after which the real and imaginary parts of the complex product are
+	   recovered as
+
+	     re( a * b ) = ab_r - ab_i
+	     im( a * b ) = ab_rpi - ab_r - ab_i
+
+	   Since alpha may be complex, it is applied afterwards along with beta,
+	   when the result is accumulated back to c. */ \
+	rgemm_ukr( mr_r, nr_r, k, one_r, a_r,   b_r,   zero_r, \
+	           ab_r,   rs_ab, cs_ab, data, cntx ); \
+	rgemm_ukr( mr_r, nr_r, k, one_r, a_i,   b_i,   zero_r, \
+	           ab_i,   rs_ab, cs_ab, data, cntx ); \
+	rgemm_ukr( mr_r, nr_r, k, one_r, a_rpi, b_rpi, zero_r, \
+	           ab_rpi, rs_ab, cs_ab, data, cntx ); \
+\
+	/* Accumulate the final result back to c. */ \
+	if ( PASTEMAC(ch,eq0)( *beta ) ) \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+		{ \
+			const dim_t ij   = i*rs_ab + j*cs_ab; \
+			      ctype ab; \
+\
+			PASTEMAC(ch,sets)( ab_r[ ij ] - ab_i[ ij ], \
+			                   ab_rpi[ ij ] - ab_r[ ij ] - ab_i[ ij ], ab ); \
+			PASTEMAC(ch,scal2s)( *alpha, ab, *(c + i*rs_c + j*cs_c) ); \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+		{ \
+			const dim_t ij   = i*rs_ab + j*cs_ab; \
+			      ctype ab; \
+\
+			PASTEMAC(ch,sets)( ab_r[ ij ] - ab_i[ ij ], \
+			                   ab_rpi[ ij ] - ab_r[ ij ] - ab_i[ ij ], ab ); \
+			PASTEMAC(ch,axpbys)( *alpha, ab, *beta, *(c + i*rs_c + j*cs_c) ); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCCO( gemm3m, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
@@ -56,29 +56,8 @@ typedef union
     } bits;
 } nibbles;
 
-// brain float16 
-typedef union
-{
-    uint16_t v;
-    struct
-    {
-        uint16_t m:7;
-        uint16_t e:8;
-        uint16_t s:1;
-    } bits;
-} bfloat16;
-
-// ieee float16 
-typedef union
-{
-    uint16_t v;
-    struct
-    {
-        uint16_t m:10;
-        uint16_t e:5;
-        uint16_t s:1;
-    } bits;
-} float16;
+// NOTE: The bfloat16 and float16 types are defined by the framework (see
+// bli_type_defs.h).
 
 #define P10_PG_SIZE 4096
 
@@ -0,0 +1,745 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver measures the performance of a sweep of problem shapes for
+// gemm (through the object and typed APIs), gemmt, trsm, gemv, the
+// strided-batched gemm, and fixed-shape gemm (through a handle from
+// bli_?gemm_jit_query()), and reports the
+// results in a form suitable for tracking performance over time. Unlike the
+// drivers in test/3 and test/sup, which report only the best of n_repeats
+// trials, each measurement here summarizes the full distribution of trial
+// times:
+//
+// - the minimum, median, and 99th percentile (nearest-rank) times,
+// - the GFLOPS corresponding to the minimum and median times,
+// - the effective memory bandwidth (and, if the peak bandwidth of the
+//   machine is given, its utilization), based on the compulsory traffic
+//   of the operation (each operand read once and the output written once)
+//   and the median time, and
+// - the speedup and parallel efficiency relative to the first thread count
+//   of the sweep (ie: the thread scaling curve).
+//
+// The shapes are read from an input file (see input.bench for the format),
+// and the results are printed as a table and optionally written as CSV
+// and/or JSON.
+
+#define MAX_NT_LIST  32
+#define MAX_LINE     1024
+#define MAX_LABEL    64
+
+typedef enum
+{
+	BENCH_GEMM = 0,
+	BENCH_GEMMT,
+	BENCH_TRSM,
+	BENCH_GEMV,
+	BENCH_GEMM_BATCH,
+	BENCH_GEMM_BATCH_SB,
+	BENCH_GEMM_JIT,
+	BENCH_GEMM_TYPED,
+	BENCH_NUM_OPS
+} bench_op_t;
+
+static const char* bench_op_names[ BENCH_NUM_OPS ] =
+{
+	"gemm", "gemmt", "trsm", "gemv", "gemm_batch", "gemm_batch_sb", "gemm_jit",
+	"gemm_typed"
+};
+
+typedef struct
+{
+	bench_op_t op;
+	num_t      dt;
+	dim_t      m;
+	dim_t      n;
+	dim_t      k;
+	dim_t      batch;
+	char       label[ MAX_LABEL ];
+} bench_shape_t;
+
+typedef struct
+{
+	int        n_repeats;
+	int        n_warmup;
+	int        n_nt;
+	dim_t      nt_list[ MAX_NT_LIST ];
+	double     peak_bw;
+	FILE*      csv;
+	FILE*      json;
+	int        n_json;
+} bench_params_t;
+
+typedef struct
+{
+	obj_t      alpha;
+	obj_t      beta;
+	obj_t      a;
+	obj_t      b;
+	obj_t      c;
+	obj_t      c_save;
+	obj_t      a_full;
+	obj_t      b_full;
+	obj_t      c_full;
+
+	const gemmjit_t* jit;
+} bench_objs_t;
+
+// -----------------------------------------------------------------------------
+
+// Return the number of floating-point operations (counting a complex
+// multiply-add as eight) performed by a shape.
+
+static double bench_flops( const bench_shape_t* s )
+{
+	const double m = s->m, n = s->n, k = s->k, b = s->batch;
+	const double f = ( bli_is_complex( s->dt ) ? 4.0 : 1.0 );
+
+	switch ( s->op )
+	{
+		case BENCH_GEMM:
+		case BENCH_GEMM_JIT:
+		case BENCH_GEMM_TYPED:    return f * 2.0 * m * n * k;
+		case BENCH_GEMMT:         return f * m * ( m + 1.0 ) * k;
+		case BENCH_TRSM:          return f * m * m * n;
+		case BENCH_GEMV:          return f * 2.0 * m * n;
+		case BENCH_GEMM_BATCH:
+		case BENCH_GEMM_BATCH_SB: return f * 2.0 * m * n * k * b;
+		default:                  return 0.0;
+	}
+}
+
+// Return the number of bytes of compulsory memory traffic of a shape: each
+// input read once, and each output read and written once.
+
+static double bench_bytes( const bench_shape_t* s )
+{
+	const double m = s->m, n = s->n, k = s->k, b = s->batch;
+	const double es = bli_dt_size( s->dt );
+
+	switch ( s->op )
+	{
+		case BENCH_GEMM:
+		case BENCH_GEMM_JIT:
+		case BENCH_GEMM_TYPED:    return es * ( m * k + k * n + 2.0 * m * n );
+		case BENCH_GEMMT:         return es * ( 2.0 * m * k + m * ( m + 1.0 ) );
+		case BENCH_TRSM:          return es * ( m * ( m + 1.0 ) / 2.0 + 2.0 * m * n );
+		case BENCH_GEMV:          return es * ( m * n + n + 2.0 * m );
+		case BENCH_GEMM_BATCH:    return es * b * ( m * k + k * n + 2.0 * m * n );
+		case BENCH_GEMM_BATCH_SB: return es * ( b * ( m * k + 2.0 * m * n ) + k * n );
+		default:                  return 0.0;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+static void bench_create( const bench_shape_t* s, bench_objs_t* o )
+{
+	const num_t dt = s->dt;
+	const dim_t m  = s->m;
+	const dim_t n  = s->n;
+	const dim_t k  = s->k;
+	const dim_t nb = s->batch;
+
+	bli_obj_scalar_init_detached( dt, &o->alpha );
+	bli_obj_scalar_init_detached( dt, &o->beta );
+
+	bli_setsc( 1.0, 0.0, &o->alpha );
+	bli_setsc( 1.0, 0.0, &o->beta );
+
+	switch ( s->op )
+	{
+		case BENCH_GEMM:
+		case BENCH_GEMM_JIT:
+		case BENCH_GEMM_TYPED:
+		bli_obj_create( dt, m, k, 0, 0, &o->a );
+		bli_obj_create( dt, k, n, 0, 0, &o->b );
+		bli_obj_create( dt, m, n, 0, 0, &o->c );
+		break;
+
+		case BENCH_GEMMT:
+		bli_obj_create( dt, m, k, 0, 0, &o->a );
+		bli_obj_create( dt, k, m, 0, 0, &o->b );
+		bli_obj_create( dt, m, m, 0, 0, &o->c );
+		bli_obj_set_struc( BLIS_TRIANGULAR, &o->c );
+		bli_obj_set_uplo( BLIS_LOWER, &o->c );
+		break;
+
+		case BENCH_TRSM:
+		bli_obj_create( dt, m, m, 0, 0, &o->a );
+		bli_obj_create( dt, 0, 0, 0, 0, &o->b );
+		bli_obj_create( dt, m, n, 0, 0, &o->c );
+		bli_obj_create( dt, m, n, 0, 0, &o->c_save );
+		break;
+
+		case BENCH_GEMV:
+		bli_obj_create( dt, m, n, 0, 0, &o->a );
+		bli_obj_create( dt, n, 1, 0, 0, &o->b );
+		bli_obj_create( dt, m, 1, 0, 0, &o->c );
+		break;
+
+		case BENCH_GEMM_BATCH:
+		case BENCH_GEMM_BATCH_SB:
+		{
+			// The problems of the batch are stored next to each other as
+			// consecutive column blocks of full matrices.
+			const dim_t nb_b = ( s->op == BENCH_GEMM_BATCH_SB ? 1 : nb );
+
+			bli_obj_create( dt, m, k * nb,   1, m, &o->a_full );
+			bli_obj_create( dt, k, n * nb_b, 1, k, &o->b_full );
+			bli_obj_create( dt, m, n * nb,   1, m, &o->c_full );
+
+			bli_randm( &o->a_full );
+			bli_randm( &o->b_full );
+			bli_randm( &o->c_full );
+
+			bli_acquire_mpart( 0, 0, m, k, &o->a_full, &o->a );
+			bli_acquire_mpart( 0, 0, k, n, &o->b_full, &o->b );
+			bli_acquire_mpart( 0, 0, m, n, &o->c_full, &o->c );
+			return;
+		}
+
+		default: break;
+	}
+
+	bli_randm( &o->a );
+	bli_randm( &o->b );
+	bli_randm( &o->c );
+
+	if ( s->op == BENCH_TRSM )
+	{
+		bli_obj_set_struc( BLIS_TRIANGULAR, &o->a );
+		bli_obj_set_uplo( BLIS_LOWER, &o->a );
+
+		// Zero the unstored triangle, and load the diagonal of A to make it
+		// more likely to be well-conditioned.
+		bli_mktrim( &o->a );
+		bli_shiftd( &BLIS_TWO, &o->a );
+
+		bli_copym( &o->c, &o->c_save );
+	}
+
+	// Query the handle for the shape once, outside of the timed region.
+	if ( s->op == BENCH_GEMM_JIT )
+	{
+		const trans_t tr   = BLIS_NO_TRANSPOSE;
+		const void*   buf1 = bli_obj_buffer_for_1x1( dt, &BLIS_ONE );
+		const inc_t   lda  = bli_obj_col_stride( &o->a );
+		const inc_t   ldb  = bli_obj_col_stride( &o->b );
+		const inc_t   ldc  = bli_obj_col_stride( &o->c );
+
+		switch ( dt )
+		{
+			case BLIS_FLOAT:    o->jit = bli_sgemm_jit_query( tr, tr, m, n, k, buf1, 1, lda, 1, ldb, buf1, 1, ldc ); break;
+			case BLIS_DOUBLE:   o->jit = bli_dgemm_jit_query( tr, tr, m, n, k, buf1, 1, lda, 1, ldb, buf1, 1, ldc ); break;
+			case BLIS_SCOMPLEX: o->jit = bli_cgemm_jit_query( tr, tr, m, n, k, buf1, 1, lda, 1, ldb, buf1, 1, ldc ); break;
+			default:            o->jit = bli_zgemm_jit_query( tr, tr, m, n, k, buf1, 1, lda, 1, ldb, buf1, 1, ldc ); break;
+		}
+	}
+}
+
+// Execute a fixed-shape gemm through the handle queried by bench_create().
+
+static void bench_gemm_jit( num_t dt, bench_objs_t* o )
+{
+	const void* alpha = bli_obj_buffer_for_1x1( dt, &o->alpha );
+	const void* beta  = bli_obj_buffer_for_1x1( dt, &o->beta );
+	const void* a     = bli_obj_buffer_at_off( &o->a );
+	const void* b     = bli_obj_buffer_at_off( &o->b );
+	      void* c     = bli_obj_buffer_at_off( &o->c );
+
+	switch ( dt )
+	{
+		case BLIS_FLOAT:    bli_sgemm_jit_exec( o->jit, alpha, a, b, beta, c ); break;
+		case BLIS_DOUBLE:   bli_dgemm_jit_exec( o->jit, alpha, a, b, beta, c ); break;
+		case BLIS_SCOMPLEX: bli_cgemm_jit_exec( o->jit, alpha, a, b, beta, c ); break;
+		default:            bli_zgemm_jit_exec( o->jit, alpha, a, b, beta, c ); break;
+	}
+}
+
+// Execute a gemm through the typed API (which computes tiny problems without
+// constructing objects).
+
+static void bench_gemm_typed( num_t dt, bench_objs_t* o, const rntm_t* rntm )
+{
+	const trans_t tr    = BLIS_NO_TRANSPOSE;
+	const dim_t   m     = bli_obj_length( &o->c );
+	const dim_t   n     = bli_obj_width( &o->c );
+	const dim_t   k     = bli_obj_width( &o->a );
+	const void*   alpha = bli_obj_buffer_for_1x1( dt, &o->alpha );
+	const void*   beta  = bli_obj_buffer_for_1x1( dt, &o->beta );
+	const void*   a     = bli_obj_buffer_at_off( &o->a );
+	const void*   b     = bli_obj_buffer_at_off( &o->b );
+	      void*   c     = bli_obj_buffer_at_off( &o->c );
+	const inc_t   lda   = bli_obj_col_stride( &o->a );
+	const inc_t   ldb   = bli_obj_col_stride( &o->b );
+	const inc_t   ldc   = bli_obj_col_stride( &o->c );
+
+	switch ( dt )
+	{
+		case BLIS_FLOAT:    bli_sgemm_ex( tr, tr, m, n, k, alpha, a, 1, lda, b, 1, ldb, beta, c, 1, ldc, NULL, rntm ); break;
+		case BLIS_DOUBLE:   bli_dgemm_ex( tr, tr, m, n, k, alpha, a, 1, lda, b, 1, ldb, beta, c, 1, ldc, NULL, rntm ); break;
+		case BLIS_SCOMPLEX: bli_cgemm_ex( tr, tr, m, n, k, alpha, a, 1, lda, b, 1, ldb, beta, c, 1, ldc, NULL, rntm ); break;
+		default:            bli_zgemm_ex( tr, tr, m, n, k, alpha, a, 1, lda, b, 1, ldb, beta, c, 1, ldc, NULL, rntm ); break;
+	}
+}
+
+static void bench_free( const bench_shape_t* s, bench_objs_t* o )
+{
+	if ( s->op == BENCH_GEMM_BATCH || s->op == BENCH_GEMM_BATCH_SB )
+	{
+		bli_obj_free( &o->a_full );
+		bli_obj_free( &o->b_full );
+		bli_obj_free( &o->c_full );
+		return;
+	}
+
+	bli_obj_free( &o->a );
+	bli_obj_free( &o->b );
+	bli_obj_free( &o->c );
+
+	if ( s->op == BENCH_TRSM ) bli_obj_free( &o->c_save );
+}
+
+// Execute one trial of a shape and return its time (in seconds).
+
+static double bench_trial( const bench_shape_t* s, bench_objs_t* o, const rntm_t* rntm )
+{
+	const dim_t m = s->m;
+	const dim_t n = s->n;
+	const dim_t k = s->k;
+
+	// Restore the right-hand side of trsm, which is overwritten by the
+	// solution, outside of the timed region.
+	if ( s->op == BENCH_TRSM ) bli_copym( &o->c_save, &o->c );
+
+	double dtime = bli_clock();
+
+	switch ( s->op )
+	{
+		case BENCH_GEMM:
+		bli_gemm_ex( &o->alpha, &o->a, &o->b, &o->beta, &o->c, NULL, rntm );
+		break;
+
+		case BENCH_GEMMT:
+		bli_gemmt_ex( &o->alpha, &o->a, &o->b, &o->beta, &o->c, NULL, rntm );
+		break;
+
+		case BENCH_TRSM:
+		bli_trsm_ex( BLIS_LEFT, &o->alpha, &o->a, &o->c, NULL, rntm );
+		break;
+
+		case BENCH_GEMV:
+		bli_gemv_ex( &o->alpha, &o->a, &o->b, &o->beta, &o->c, NULL, rntm );
+		break;
+
+		case BENCH_GEMM_BATCH:
+		bli_gemm_batch_strided_ex( &o->alpha, &o->a, m * k, &o->b, k * n,
+		                           &o->beta, &o->c, m * n, s->batch, NULL, rntm );
+		break;
+
+		case BENCH_GEMM_BATCH_SB:
+		bli_gemm_batch_strided_ex( &o->alpha, &o->a, m * k, &o->b, 0,
+		                           &o->beta, &o->c, m * n, s->batch, NULL, rntm );
+		break;
+
+		case BENCH_GEMM_JIT:
+		bench_gemm_jit( s->dt, o );
+		break;
+
+		case BENCH_GEMM_TYPED:
+		bench_gemm_typed( s->dt, o, rntm );
+		break;
+
+		default: break;
+	}
+
+	return bli_clock() - dtime;
+}
+
+// -----------------------------------------------------------------------------
+
+static int bench_cmp_double( const void* x, const void* y )
+{
+	const double a = *( const double* )x;
+	const double b = *( const double* )y;
+
+	return ( a < b ? -1 : ( a > b ? 1 : 0 ) );
+}
+
+// Return the p-th percentile (0 < p <= 100) of n sorted values using the
+// nearest-rank method.
+
+static double bench_percentile( const double* t, int n, double p )
+{
+	int rank = ( int )ceil( p / 100.0 * n );
+
+	if ( rank < 1 ) rank = 1;
+	if ( rank > n ) rank = n;
+
+	return t[ rank - 1 ];
+}
+
+static void bench_print_header( bench_params_t* params )
+{
+	printf( "%-13s %2s %6s %6s %6s %5s %3s %11s %11s %11s %9s %9s %8s %6s %7s %6s  %s\n",
+	        "op", "dt", "m", "n", "k", "batch", "nt",
+	        "t_min", "t_median", "t_p99", "gf_max", "gf_med",
+	        "GB/s", "bw%", "speedup", "eff", "label" );
+
+	if ( params->csv != NULL )
+		fprintf( params->csv, "op,dt,m,n,k,batch,label,threads,repeats,"
+		                      "t_min,t_median,t_p99,gflops_max,gflops_median,"
+		                      "gbps_median,bw_util,speedup,efficiency\n" );
+}
+
+static void bench_shape
+     (
+       const bench_shape_t*  s,
+             bench_params_t* params
+     )
+{
+	bench_objs_t o;
+	double*      t      = malloc( params->n_repeats * sizeof( double ) );
+	double       t_base = 0.0;
+	const char   dt_ch  = ( bli_is_float( s->dt )    ? 's' :
+	                      ( bli_is_double( s->dt )   ? 'd' :
+	                      ( bli_is_scomplex( s->dt ) ? 'c' : 'z' ) ) );
+
+	bench_create( s, &o );
+
+	const double flops = bench_flops( s );
+	const double bytes = bench_bytes( s );
+
+	for ( int it = 0; it < params->n_nt; ++it )
+	{
+		const dim_t nt = params->nt_list[ it ];
+
+		// Start from the global runtime so that the default threading
+		// implementation (rather than the sequential one) is used.
+		rntm_t rntm;
+		bli_rntm_init_from_global( &rntm );
+		bli_rntm_set_num_threads( nt, &rntm );
+
+		for ( int r = 0; r < params->n_warmup; ++r )
+			bench_trial( s, &o, &rntm );
+
+		for ( int r = 0; r < params->n_repeats; ++r )
+			t[ r ] = bench_trial( s, &o, &rntm );
+
+		qsort( t, params->n_repeats, sizeof( double ), bench_cmp_double );
+
+		const double t_min  = t[ 0 ];
+		const double t_med  = bench_percentile( t, params->n_repeats, 50.0 );
+		const double t_p99  = bench_percentile( t, params->n_repeats, 99.0 );
+		const double gf_max = flops / t_min / 1.0e9;
+		const double gf_med = flops / t_med / 1.0e9;
+		const double gbps   = bytes / t_med / 1.0e9;
+		const double util   = ( params->peak_bw > 0.0 ? gbps / params->peak_bw : 0.0 );
+
+		// Measure thread scaling relative to the first thread count.
+		if ( it == 0 ) t_base = t_med;
+
+		const double speedup = t_base / t_med;
+		const double eff     = speedup * ( double )params->nt_list[ 0 ] / ( double )nt;
+
+		printf( "%-13s %2c %6ld %6ld %6ld %5ld %3ld %11.4e %11.4e %11.4e %9.2f %9.2f %8.2f %6.1f %7.2f %6.2f  %s\n",
+		        bench_op_names[ s->op ], dt_ch,
+		        ( long )s->m, ( long )s->n, ( long )s->k, ( long )s->batch, ( long )nt,
+		        t_min, t_med, t_p99, gf_max, gf_med, gbps, 100.0 * util,
+		        speedup, eff, s->label );
+		fflush( stdout );
+
+		if ( params->csv != NULL )
+			fprintf( params->csv, "%s,%c,%ld,%ld,%ld,%ld,%s,%ld,%d,"
+			                      "%.6e,%.6e,%.6e,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f\n",
+			         bench_op_names[ s->op ], dt_ch,
+			         ( long )s->m, ( long )s->n, ( long )s->k, ( long )s->batch,
+			         s->label, ( long )nt, params->n_repeats,
+			         t_min, t_med, t_p99, gf_max, gf_med, gbps, util,
+			         speedup, eff );
+
+		if ( params->json != NULL )
+			fprintf( params->json, "%s\n    { \"op\": \"%s\", \"dt\": \"%c\", "
+			                       "\"m\": %ld, \"n\": %ld, \"k\": %ld, \"batch\": %ld, "
+			                       "\"label\": \"%s\", \"threads\": %ld, "
+			                       "\"t_min\": %.6e, \"t_median\": %.6e, \"t_p99\": %.6e, "
+			                       "\"gflops_max\": %.4f, \"gflops_median\": %.4f, "
+			                       "\"gbps_median\": %.4f, \"bw_util\": %.4f, "
+			                       "\"speedup\": %.4f, \"efficiency\": %.4f }",
+			         ( params->n_json++ == 0 ? "" : "," ),
+			         bench_op_names[ s->op ], dt_ch,
+			         ( long )s->m, ( long )s->n, ( long )s->k, ( long )s->batch,
+			         s->label, ( long )nt,
+			         t_min, t_med, t_p99, gf_max, gf_med, gbps, util,
+			         speedup, eff );
+	}
+
+	bench_free( s, &o );
+	free( t );
+}
+
+// -----------------------------------------------------------------------------
+
+// A dimension of the input file is a single value ("256"), a range
+// ("lo:hi:inc"), or the name of a preceding dimension ("m" or "n"), which
+// ties the two dimensions together.
+
+typedef struct
+{
+	dim_t lo;
+	dim_t hi;
+	dim_t inc;
+	char  tie;
+} bench_range_t;
+
+static int bench_parse_range( const char* str, bench_range_t* r )
+{
+	long lo, hi, inc;
+
+	r->tie = 0;
+
+	if ( strcmp( str, "m" ) == 0 || strcmp( str, "n" ) == 0 )
+	{
+		r->tie = str[ 0 ];
+		r->lo  = r->hi = r->inc = 1;
+		return 0;
+	}
+
+	if ( sscanf( str, "%ld:%ld:%ld", &lo, &hi, &inc ) == 3 && inc > 0 ) {}
+	else if ( sscanf( str, "%ld", &lo ) == 1 ) { hi = lo; inc = 1; }
+	else return -1;
+
+	if ( lo < 0 || hi < lo ) return -1;
+
+	r->lo = lo; r->hi = hi; r->inc = inc;
+	return 0;
+}
+
+// Expand one line of the input file into the shapes it describes, and
+// benchmark each of them.
+
+static int bench_line( const char* line, bench_params_t* params )
+{
+	char          op_str[ 32 ], dt_str[ 8 ], dims[ 4 ][ 32 ];
+	char          label[ MAX_LABEL ] = "-";
+	bench_range_t r[ 4 ];
+	bench_shape_t s;
+
+	const int n_read = sscanf( line, "%31s %7s %31s %31s %31s %31s %63s",
+	                           op_str, dt_str, dims[ 0 ], dims[ 1 ],
+	                           dims[ 2 ], dims[ 3 ], label );
+	if ( n_read < 6 ) return -1;
+
+	for ( s.op = 0; s.op < BENCH_NUM_OPS; ++s.op )
+		if ( strcmp( op_str, bench_op_names[ s.op ] ) == 0 ) break;
+	if ( s.op == BENCH_NUM_OPS ) return -1;
+
+	switch ( dt_str[ 0 ] )
+	{
+		case 's': s.dt = BLIS_FLOAT;    break;
+		case 'd': s.dt = BLIS_DOUBLE;   break;
+		case 'c': s.dt = BLIS_SCOMPLEX; break;
+		case 'z': s.dt = BLIS_DCOMPLEX; break;
+		default:  return -1;
+	}
+
+	for ( int i = 0; i < 4; ++i )
+		if ( bench_parse_range( dims[ i ], &r[ i ] ) != 0 ) return -1;
+
+	// Only n and k may be tied to a preceding dimension.
+	if ( r[ 0 ].tie != 0 || r[ 3 ].tie != 0 || r[ 1 ].tie == 'n' ) return -1;
+
+	strncpy( s.label, label, MAX_LABEL - 1 );
+	s.label[ MAX_LABEL - 1 ] = '\0';
+
+	for ( dim_t m = r[ 0 ].lo; m <= r[ 0 ].hi; m += r[ 0 ].inc )
+	for ( dim_t n = r[ 1 ].lo; n <= r[ 1 ].hi; n += r[ 1 ].inc )
+	for ( dim_t k = r[ 2 ].lo; k <= r[ 2 ].hi; k += r[ 2 ].inc )
+	for ( dim_t b = r[ 3 ].lo; b <= r[ 3 ].hi; b += r[ 3 ].inc )
+	{
+		s.m     = m;
+		s.n     = ( r[ 1 ].tie == 'm' ? m : n );
+		s.k     = ( r[ 2 ].tie == 'm' ? m : ( r[ 2 ].tie == 'n' ? s.n : k ) );
+		s.batch = b;
+
+		bench_shape( &s, params );
+	}
+
+	return 0;
+}
+
+// -----------------------------------------------------------------------------
+
+static void bench_usage( const char* prog )
+{
+	printf( "Usage: %s [options]\n", prog );
+	printf( "  -i file   read the shapes from file (default: input.bench)\n" );
+	printf( "  -r n      number of timed trials per measurement (default: 50)\n" );
+	printf( "  -w n      number of untimed warmup trials (default: 2)\n" );
+	printf( "  -t list   comma-separated list of thread counts (default: 1)\n" );
+	printf( "  -B gbps   peak memory bandwidth, for computing utilization\n" );
+	printf( "  -c file   write the results as CSV to file\n" );
+	printf( "  -j file   write the results as JSON to file\n" );
+}
+
+int main( int argc, char** argv )
+{
+	bench_params_t params;
+	const char*    in_file   = "input.bench";
+	const char*    csv_file  = NULL;
+	const char*    json_file = NULL;
+	int            opt;
+
+	params.n_repeats   = 50;
+	params.n_warmup    = 2;
+	params.n_nt        = 1;
+	params.nt_list[ 0 ] = 1;
+	params.peak_bw     = 0.0;
+	params.csv         = NULL;
+	params.json        = NULL;
+	params.n_json      = 0;
+
+	while ( ( opt = getopt( argc, argv, "i:r:w:t:B:c:j:h" ) ) != -1 )
+	{
+		switch ( opt )
+		{
+			case 'i': in_file          = optarg;        break;
+			case 'r': params.n_repeats = atoi( optarg ); break;
+			case 'w': params.n_warmup  = atoi( optarg ); break;
+			case 'B': params.peak_bw   = atof( optarg ); break;
+			case 'c': csv_file         = optarg;        break;
+			case 'j': json_file        = optarg;        break;
+			case 't':
+			{
+				char* tok = strtok( optarg, "," );
+				params.n_nt = 0;
+				while ( tok != NULL && params.n_nt < MAX_NT_LIST )
+				{
+					params.nt_list[ params.n_nt++ ] = bli_max( 1, atoi( tok ) );
+					tok = strtok( NULL, "," );
+				}
+				break;
+			}
+			default:
+			bench_usage( argv[ 0 ] );
+			return ( opt == 'h' ? 0 : 1 );
+		}
+	}
+
+	if ( params.n_repeats < 1 || params.n_nt < 1 )
+	{
+		bench_usage( argv[ 0 ] );
+		return 1;
+	}
+
+	FILE* fin = fopen( in_file, "r" );
+	if ( fin == NULL )
+	{
+		fprintf( stderr, "Error opening input file %s\n", in_file );
+		return 1;
+	}
+
+	if ( csv_file != NULL && ( params.csv = fopen( csv_file, "w" ) ) == NULL )
+	{
+		fprintf( stderr, "Error opening output file %s\n", csv_file );
+		return 1;
+	}
+
+	if ( json_file != NULL && ( params.json = fopen( json_file, "w" ) ) == NULL )
+	{
+		fprintf( stderr, "Error opening output file %s\n", json_file );
+		return 1;
+	}
+
+	bli_init();
+
+	const char* config = bli_arch_string( bli_arch_query_id() );
+	const char* timpl  = bli_thread_get_thread_impl_str( bli_thread_get_thread_impl() );
+
+	printf( "%% BLIS %s, configuration %s, threading %s, %d trials (%d warmup)\n",
+	        bli_info_get_version_str(), config, timpl,
+	        params.n_repeats, params.n_warmup );
+
+	if ( params.json != NULL )
+	{
+		fprintf( params.json, "{\n  \"blis_version\": \"%s\",\n", bli_info_get_version_str() );
+		fprintf( params.json, "  \"config\": \"%s\",\n", config );
+		fprintf( params.json, "  \"thread_impl\": \"%s\",\n", timpl );
+		fprintf( params.json, "  \"repeats\": %d,\n", params.n_repeats );
+		fprintf( params.json, "  \"warmup\": %d,\n", params.n_warmup );
+		fprintf( params.json, "  \"peak_bw_gbps\": %.4f,\n", params.peak_bw );
+		fprintf( params.json, "  \"results\": [" );
+	}
+
+	bench_print_header( &params );
+
+	char line[ MAX_LINE ];
+	int  line_no = 0;
+	int  n_err   = 0;
+
+	while ( fgets( line, MAX_LINE, fin ) != NULL )
+	{
+		++line_no;
+
+		// Skip comments and blank lines.
+		const char* p = line;
+		while ( *p == ' ' || *p == '\t' ) ++p;
+		if ( *p == '#' || *p == '\n' || *p == '\0' ) continue;
+
+		if ( bench_line( p, &params ) != 0 )
+		{
+			fprintf( stderr, "%s:%d: could not parse line; skipping.\n",
+			         in_file, line_no );
+			++n_err;
+		}
+	}
+
+	if ( params.json != NULL )
+	{
+		fprintf( params.json, "\n  ]\n}\n" );
+		fclose( params.json );
+	}
+
+	if ( params.csv != NULL ) fclose( params.csv );
+
+	fclose( fin );
+
+	bli_finalize();
+
+	return ( n_err == 0 ? 0 : 1 );
+}
+
@@ -0,0 +1,195 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <string.h>
+#include "blis.h"
+
+//
+// Performance driver for the factorizations of the 'factor' addon. When
+// compiled with -DBLIS, the addon's bao_potrf(), bao_getrf(), and
+// bao_geqrf() are timed; otherwise, the corresponding LAPACK routines are
+// timed (typically those of the reference LAPACK, linked against the BLAS
+// compatibility layer of the same BLIS library). The number of threads is
+// set via BLIS_NUM_THREADS (or the other usual BLIS environment variables)
+// in either case.
+//
+// Usage: test_factor_<impl>.x <op> <dt> <p_begin> <p_max> <p_inc> <n_repeats>
+//
+//   op  is one of potrf, getrf, or geqrf
+//   dt  is one of s, d, c, or z
+//
+
+#ifndef BLIS
+#define FACTOR_PROT( ch, ctype ) \
+void PASTEF77(ch,potrf)( const f77_char* uplo, const f77_int* n, ctype* a, \
+                         const f77_int* lda, f77_int* info ); \
+void PASTEF77(ch,getrf)( const f77_int* m, const f77_int* n, ctype* a, \
+                         const f77_int* lda, f77_int* ipiv, f77_int* info ); \
+void PASTEF77(ch,geqrf)( const f77_int* m, const f77_int* n, ctype* a, \
+                         const f77_int* lda, ctype* tau, ctype* work, \
+                         const f77_int* lwork, f77_int* info );
+
+FACTOR_PROT( s, float )
+FACTOR_PROT( d, double )
+FACTOR_PROT( c, scomplex )
+FACTOR_PROT( z, dcomplex )
+
+#define FACTOR_CALL( dt, fn, ... ) \
+do { \
+	if      ( bli_is_float( dt ) )    PASTEF77(s,fn)( __VA_ARGS__ ); \
+	else if ( bli_is_double( dt ) )   PASTEF77(d,fn)( __VA_ARGS__ ); \
+	else if ( bli_is_scomplex( dt ) ) PASTEF77(c,fn)( __VA_ARGS__ ); \
+	else                              PASTEF77(z,fn)( __VA_ARGS__ ); \
+} while ( 0 )
+#endif
+
+int main( int argc, char** argv )
+{
+	if ( argc != 7 )
+	{
+		printf( "usage: %s <potrf|getrf|geqrf> <s|d|c|z> "
+		        "<p_begin> <p_max> <p_inc> <n_repeats>\n", argv[0] );
+		return 1;
+	}
+
+	const char* op        = argv[1];
+	const char  dt_ch     = argv[2][0];
+	const dim_t p_begin   = atol( argv[3] );
+	const dim_t p_max     = atol( argv[4] );
+	const dim_t p_inc     = atol( argv[5] );
+	const int   n_repeats = atoi( argv[6] );
+
+	num_t dt;
+	bli_param_map_char_to_blis_dt( dt_ch, &dt );
+
+	// The number of flops of each factorization (of an n x n matrix), in
+	// units of n^3.
+	enum { POTRF, GETRF, GEQRF } op_id;
+	double flops_n3;
+	if      ( strcmp( op, "potrf" ) == 0 ) { op_id = POTRF; flops_n3 = 1.0 / 3.0; }
+	else if ( strcmp( op, "getrf" ) == 0 ) { op_id = GETRF; flops_n3 = 2.0 / 3.0; }
+	else if ( strcmp( op, "geqrf" ) == 0 ) { op_id = GEQRF; flops_n3 = 4.0 / 3.0; }
+	else
+	{
+		printf( "unknown operation '%s'\n", op );
+		return 1;
+	}
+
+	if ( bli_is_complex( dt ) ) flops_n3 *= 4.0;
+
+	for ( dim_t p = p_begin; p <= p_max; p += p_inc )
+	{
+		const dim_t n = p;
+
+		obj_t a, a_save, piv, tau, t;
+
+		bli_obj_create( dt, n, n, 0, 0, &a );
+		bli_obj_create( dt, n, n, 0, 0, &a_save );
+		bli_obj_create( BLIS_INT, n, 1, 0, 0, &piv );
+		bli_obj_create( dt, n, 1, 0, 0, &tau );
+
+		bli_randm( &a_save );
+
+		// Make A Hermitian positive definite for potrf.
+		if ( op_id == POTRF )
+		{
+			bli_obj_create( dt, n, n, 0, 0, &t );
+			bli_copym( &a_save, &t );
+			bli_obj_set_struc( BLIS_HERMITIAN, &a_save );
+			bli_obj_set_uplo( BLIS_LOWER, &a_save );
+			bli_herk( &BLIS_ONE, &t, &BLIS_ZERO, &a_save );
+			bli_shiftd( &BLIS_TWO, &a_save );
+			bli_obj_free( &t );
+		}
+
+#ifndef BLIS
+		err_t    r_val;
+		f77_int  nn    = n;
+		f77_int  lda   = bli_obj_col_stride( &a );
+		f77_int  lwork = 64 * n;
+		f77_int  info;
+		f77_char uplo  = 'L';
+		f77_int* ipiv  = bli_malloc_user( n * sizeof( f77_int ), &r_val );
+		void*    work  = bli_malloc_user( lwork * bli_dt_size( dt ), &r_val );
+		void*    ap    = bli_obj_buffer( &a );
+		void*    taup  = bli_obj_buffer( &tau );
+#endif
+
+		double dtime_save = DBL_MAX;
+
+		for ( int r = 0; r < n_repeats; ++r )
+		{
+			bli_copym( &a_save, &a );
+			bli_obj_set_struc( bli_obj_struc( &a_save ), &a );
+			bli_obj_set_uplo( bli_obj_uplo( &a_save ), &a );
+
+			double dtime = bli_clock();
+
+#ifdef BLIS
+			if      ( op_id == POTRF ) bao_potrf( &a );
+			else if ( op_id == GETRF ) bao_getrf( &a, &piv );
+			else                       bao_geqrf( &a, &tau );
+#else
+			if      ( op_id == POTRF )
+				FACTOR_CALL( dt, potrf, &uplo, &nn, ap, &lda, &info );
+			else if ( op_id == GETRF )
+				FACTOR_CALL( dt, getrf, &nn, &nn, ap, &lda, ipiv, &info );
+			else
+				FACTOR_CALL( dt, geqrf, &nn, &nn, ap, &lda, taup, work, &lwork, &info );
+#endif
+
+			dtime_save = bli_clock_min_diff( dtime_save, dtime );
+		}
+
+		const double gflops = ( flops_n3 * n * n * n ) / ( dtime_save * 1.0e9 );
+
+		printf( "data_%c%s_%s( %4lu, 1:2 ) = [ %5lu %8.2f ];\n",
+		        dt_ch, op, IMPL_STR,
+		        ( unsigned long )( ( p - p_begin ) / p_inc + 1 ),
+		        ( unsigned long )n, gflops );
+		fflush( stdout );
+
+#ifndef BLIS
+		bli_free_user( ipiv );
+		bli_free_user( work );
+#endif
+		bli_obj_free( &a );
+		bli_obj_free( &a_save );
+		bli_obj_free( &piv );
+		bli_obj_free( &tau );
+	}
+
+	return 0;
+}
+
@@ -0,0 +1,190 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <math.h>
+#include "blis.h"
+
+//
+// Correctness test for bao_geqrf() of the 'factor' addon on badly scaled
+// matrices. For each datatype, several shapes (square, tall, and wide), and
+// each of several scaling factors (1, and factors close to the limits of
+// the datatype's range, so that the norms computed while generating the
+// Householder reflectors would overflow or underflow if they were not
+// computed carefully), a random matrix A is scaled and factored, and Q*R
+// is formed by applying the reflectors to R. The test checks that
+//
+//   || Q*R - A ||_F <= 8 * max(m,n) * eps * || A ||_F
+//
+// (which fails if the factorization produced any Inf or NaN).
+//
+// Usage: test_geqrf.x
+//
+// The program exits with a non-zero status if any case fails.
+//
+
+// B := H(0) H(1) ... H(mn-1) B, where H(j) = I - tau(j) v(j) v(j)^H and the
+// trailing part of v(j) is stored below the diagonal of column j of A.
+static void apply_q( obj_t* a, obj_t* tau, obj_t* b )
+{
+	const dim_t m  = bli_obj_length( a );
+	const dim_t n  = bli_obj_width( b );
+	const dim_t mn = bli_min( m, bli_obj_width( a ) );
+	const num_t dt = bli_obj_dt( a );
+
+	obj_t v, w, scale;
+	bli_obj_create( dt, m, 1, 0, 0, &v );
+	bli_obj_create( dt, n, 1, 0, 0, &w );
+	bli_obj_scalar_init_detached( dt, &scale );
+
+	for ( dim_t j = mn - 1; 0 <= j; --j )
+	{
+		obj_t aj, vj, bj;
+		bli_acquire_mpart( j, j, m - j, 1, a, &aj );
+		bli_acquire_mpart( 0, 0, m - j, 1, &v, &vj );
+		bli_acquire_mpart( j, 0, m - j, n, b, &bj );
+
+		bli_copym( &aj, &vj );
+		bli_setijm( 1.0, 0.0, 0, 0, &vj );
+
+		double tr, ti;
+		bli_getijm( j, 0, tau, &tr, &ti );
+		bli_setsc( -tr, -ti, &scale );
+
+		// B := B - tau * v * ( B^H * v )^H
+		bli_obj_set_conjtrans( BLIS_CONJ_TRANSPOSE, &bj );
+		bli_gemv( &BLIS_ONE, &bj, &vj, &BLIS_ZERO, &w );
+		bli_obj_set_conjtrans( BLIS_NO_TRANSPOSE, &bj );
+
+		bli_obj_set_conj( BLIS_CONJUGATE, &w );
+		bli_ger( &scale, &vj, &w, &bj );
+		bli_obj_set_conj( BLIS_NO_CONJUGATE, &w );
+	}
+
+	bli_obj_free( &v );
+	bli_obj_free( &w );
+}
+
+int main( int argc, char** argv )
+{
+	const num_t  dts[]    = { BLIS_FLOAT, BLIS_DOUBLE,
+	                          BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const dim_t  shapes[][2] =
+	{
+		{ 200, 200 },
+		{ 333, 150 },
+		{ 100, 290 },
+	};
+	const double scales_s[] = { 1.0, 1.0e30, 1.0e-30, 1.0e-35 };
+	const double scales_d[] = { 1.0, 1.0e150, 1.0e-150, 1.0e300, 1.0e-300 };
+
+	const int n_shapes   = sizeof( shapes ) / sizeof( shapes[0] );
+	const int n_scales_s = sizeof( scales_s ) / sizeof( scales_s[0] );
+	const int n_scales_d = sizeof( scales_d ) / sizeof( scales_d[0] );
+
+	int n_cases = 0, n_fail = 0;
+
+	for ( int id = 0; id < 4; ++id )
+	for ( int ih = 0; ih < n_shapes; ++ih )
+	for ( int ic = 0; ic < n_scales_d; ++ic )
+	{
+		const num_t dt    = dts[ id ];
+		const bool  is_sp = bli_dt_prec_is_single( dt );
+
+		if ( is_sp && n_scales_s <= ic ) continue;
+
+		const double scale = ( is_sp ? scales_s[ ic ] : scales_d[ ic ] );
+		const double eps   = ( is_sp ? FLT_EPSILON : DBL_EPSILON );
+
+		const dim_t m  = shapes[ ih ][0];
+		const dim_t n  = shapes[ ih ][1];
+		const dim_t mn = bli_min( m, n );
+
+		obj_t a0, a, b, tau, r, b_r, alpha, norm;
+
+		bli_obj_create( dt, m, n, 0, 0, &a0 );
+		bli_obj_create( dt, m, n, 0, 0, &a );
+		bli_obj_create( dt, m, n, 0, 0, &b );
+		bli_obj_create( dt, mn, 1, 0, 0, &tau );
+		bli_obj_scalar_init_detached( dt, &alpha );
+		bli_obj_scalar_init_detached( bli_dt_proj_to_real( dt ), &norm );
+
+		bli_randm( &a0 );
+		bli_setsc( scale, 0.0, &alpha );
+		bli_scalm( &alpha, &a0 );
+		bli_copym( &a0, &a );
+
+		bao_geqrf( &a, &tau );
+
+		// B := Q * R
+		bli_setm( &BLIS_ZERO, &b );
+		bli_acquire_mpart( 0, 0, mn, n, &a, &r );
+		bli_acquire_mpart( 0, 0, mn, n, &b, &b_r );
+		bli_obj_set_struc( BLIS_TRIANGULAR, &r );
+		bli_obj_set_uplo( BLIS_UPPER, &r );
+		bli_copym( &r, &b_r );
+
+		apply_q( &a, &tau, &b );
+
+		double norm_a, norm_d, dummy;
+		bli_normfm( &a0, &norm );
+		bli_getsc( &norm, &norm_a, &dummy );
+
+		bli_subm( &a0, &b );
+		bli_normfm( &b, &norm );
+		bli_getsc( &norm, &norm_d, &dummy );
+
+		const double tol = 8.0 * bli_max( m, n ) * eps * norm_a;
+
+		if ( !( norm_d <= tol ) || !isfinite( norm_a ) )
+		{
+			printf( "FAIL: dt=%c m=%ld n=%ld scale=%g: "
+			        "||QR - A|| / ||A|| = %g\n",
+			        "sdcz"[ id ], ( long )m, ( long )n, scale,
+			        norm_d / norm_a );
+			n_fail += 1;
+		}
+
+		n_cases += 1;
+
+		bli_obj_free( &a0 );
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &tau );
+	}
+
+	printf( "%d cases, %d failed\n", n_cases, n_fail );
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
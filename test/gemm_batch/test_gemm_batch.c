@@ -0,0 +1,283 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <math.h>
+#include "blis.h"
+
+//
+// Correctness test for the strided-batched gemm (bli_gemm_batch_strided()
+// and, for double precision, bli_dgemm_batch_strided()). Each batch is
+// compared with a loop of single bli_gemm_ex() calls over the problems of
+// the batch, for:
+//
+// - each datatype (s, d, c, and z), and no-transpose, transpose, and (for
+//   complex datatypes) conjugate-transpose of A and B;
+// - nonzero strides for A and B, and a zero stride for A and/or B (ie: an
+//   operand shared by all problems of the batch);
+// - batch counts that are and are not multiples of the number of threads,
+//   with one and with several threads;
+// - column- and row-major C, and a range of problem sizes, including k
+//   larger than KC.
+//
+// The results must agree to within a rounding error bound proportional to
+// k. The elements between consecutive problems of C are filled with NaN
+// and must not be modified.
+//
+// Usage: test_gemm_batch.x [nt]
+//
+//   nt  is the number of threads for the multithreaded cases (default 4)
+//
+// The program exits with a non-zero status if any case fails.
+//
+
+// Attach an m x n matrix (stored by columns or rows) that begins off
+// elements beyond buf.
+static void attach( num_t dt, dim_t m, dim_t n, char stor, void* buf,
+                    inc_t off, obj_t* x )
+{
+	const inc_t rs = ( stor == 'c' ? 1 : bli_max( n, 1 ) );
+	const inc_t cs = ( stor == 'c' ? bli_max( m, 1 ) : 1 );
+
+	bli_obj_create_with_attached_buffer
+	(
+	  dt, m, n, ( char* )buf + off * bli_dt_size( dt ), rs, cs, x
+	);
+}
+
+static int n_cases = 0, n_fail = 0;
+
+static void test_batch
+     (
+       num_t   dt,
+       trans_t transa,
+       trans_t transb,
+       char    storc,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       bool    share_a,
+       bool    share_b,
+       dim_t   batch,
+       dim_t   nt
+     )
+{
+	const siz_t  es  = bli_dt_size( dt );
+	const double eps = ( bli_dt_prec_is_single( dt ) ? FLT_EPSILON
+	                                                 : DBL_EPSILON );
+
+	dim_t m_a = m, n_a = k, m_b = k, n_b = n;
+	if ( bli_does_trans( transa ) ) bli_swap_dims( &m_a, &n_a );
+	if ( bli_does_trans( transb ) ) bli_swap_dims( &m_b, &n_b );
+
+	// Leave gaps between consecutive problems.
+	const inc_t stride_a = ( share_a ? 0 : m_a * n_a + 3 );
+	const inc_t stride_b = ( share_b ? 0 : m_b * n_b + 1 );
+	const inc_t stride_c = m * n + 7;
+
+	const dim_t len_a = m_a * n_a + ( batch - 1 ) * stride_a;
+	const dim_t len_b = m_b * n_b + ( batch - 1 ) * stride_b;
+	const dim_t len_c = batch * stride_c;
+
+	void* a_buf  = malloc( bli_max( len_a, 1 ) * es );
+	void* b_buf  = malloc( bli_max( len_b, 1 ) * es );
+	void* c_buf  = malloc( len_c * es );
+	void* c0_buf = malloc( len_c * es );
+	void* c1_buf = malloc( len_c * es );
+
+	obj_t a_all, b_all, c_all, c0_all, c1_all;
+	attach( dt, 1, len_a, 'c', a_buf,  0, &a_all );
+	attach( dt, 1, len_b, 'c', b_buf,  0, &b_all );
+	attach( dt, 1, len_c, 'c', c_buf,  0, &c_all );
+	attach( dt, 1, len_c, 'c', c0_buf, 0, &c0_all );
+	attach( dt, 1, len_c, 'c', c1_buf, 0, &c1_all );
+
+	bli_randm( &a_all );
+	bli_randm( &b_all );
+	bli_setm( &BLIS_NAN, &c0_all );
+
+	for ( dim_t l = 0; l < batch; ++l )
+	{
+		obj_t c0_l;
+		attach( dt, m, n, storc, c0_buf, l * stride_c, &c0_l );
+		bli_randm( &c0_l );
+	}
+
+	bli_copym( &c0_all, &c_all );
+	bli_copym( &c0_all, &c1_all );
+
+	obj_t alpha, beta;
+	bli_obj_scalar_init_detached( dt, &alpha );
+	bli_obj_scalar_init_detached( dt, &beta );
+	bli_setsc( -0.5,  0.25, &alpha );
+	bli_setsc(  1.5, -0.75, &beta );
+
+	// Compute the reference with a loop of single-threaded gemm calls.
+	rntm_t rntm_1 = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( 1, &rntm_1 );
+
+	for ( dim_t l = 0; l < batch; ++l )
+	{
+		obj_t a_l, b_l, c_l;
+		attach( dt, m_a, n_a, 'c', a_buf, l * stride_a, &a_l );
+		attach( dt, m_b, n_b, 'c', b_buf, l * stride_b, &b_l );
+		attach( dt, m,   n,   storc, c_buf, l * stride_c, &c_l );
+		bli_obj_set_conjtrans( transa, &a_l );
+		bli_obj_set_conjtrans( transb, &b_l );
+
+		bli_gemm_ex( &alpha, &a_l, &b_l, &beta, &c_l, NULL, &rntm_1 );
+	}
+
+	// Compute the batch with the object API.
+	rntm_t rntm;
+	bli_rntm_init_from_global( &rntm );
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	obj_t a, b, c;
+	attach( dt, m_a, n_a, 'c', a_buf, 0, &a );
+	attach( dt, m_b, n_b, 'c', b_buf, 0, &b );
+	attach( dt, m,   n,   storc, c1_buf, 0, &c );
+	bli_obj_set_conjtrans( transa, &a );
+	bli_obj_set_conjtrans( transb, &b );
+
+	bli_gemm_batch_strided_ex( &alpha, &a, stride_a, &b, stride_b, &beta,
+	                           &c, stride_c, batch, NULL, &rntm );
+
+	// For double precision, also compute the batch with the typed API
+	// (overwriting c0).
+	if ( dt == BLIS_DOUBLE )
+	{
+		double alpha_d = -0.5, beta_d = 1.5;
+
+		bli_dgemm_batch_strided_ex
+		(
+		  transa, transb, m, n, k, &alpha_d,
+		  a_buf, bli_obj_row_stride( &a ), bli_obj_col_stride( &a ), stride_a,
+		  b_buf, bli_obj_row_stride( &b ), bli_obj_col_stride( &b ), stride_b,
+		  &beta_d,
+		  c0_buf, bli_obj_row_stride( &c ), bli_obj_col_stride( &c ), stride_c,
+		  batch, NULL, &rntm
+		);
+	}
+
+	// Compare the results (including the gaps between the problems of C).
+	const double tol = 4.0 * ( k + 2 ) * eps * ( 2.0 * k + 2.0 );
+	bool         ok  = TRUE;
+
+	for ( dim_t i = 0; i < len_c; ++i )
+	{
+		double rr, ri, xr, xi, yr, yi;
+		bli_getijv( i, &c_all,  &rr, &ri );
+		bli_getijv( i, &c1_all, &xr, &xi );
+		bli_getijv( i, &c0_all, &yr, &yi );
+
+		const bool in_gap = ( i % stride_c >= m * n );
+
+		if ( in_gap )
+		{
+			if ( !isnan( xr ) ) ok = FALSE;
+			if ( dt == BLIS_DOUBLE && !isnan( yr ) ) ok = FALSE;
+			continue;
+		}
+
+		if ( !( hypot( xr - rr, xi - ri ) <= tol ) ) ok = FALSE;
+		if ( dt == BLIS_DOUBLE && !( fabs( yr - rr ) <= tol ) ) ok = FALSE;
+	}
+
+	if ( !ok )
+	{
+		printf( "FAIL: dt=%c trans=%c%c storc=%c m=%ld n=%ld k=%ld "
+		        "shared(a,b)=%d%d batch=%ld nt=%ld\n",
+		        "sdcz"[ dt == BLIS_FLOAT ? 0 : dt == BLIS_DOUBLE ? 1 :
+		                dt == BLIS_SCOMPLEX ? 2 : 3 ],
+		        "ntc"[ bli_does_conj( transa ) ? 2 : bli_does_trans( transa ) ],
+		        "ntc"[ bli_does_conj( transb ) ? 2 : bli_does_trans( transb ) ],
+		        storc, ( long )m, ( long )n, ( long )k,
+		        share_a, share_b, ( long )batch, ( long )nt );
+		n_fail += 1;
+	}
+
+	n_cases += 1;
+
+	free( a_buf ); free( b_buf ); free( c_buf ); free( c0_buf ); free( c1_buf );
+}
+
+int main( int argc, char** argv )
+{
+	const dim_t nt_mt = ( argc > 1 ? atoi( argv[1] ) : 4 );
+
+	const num_t   dts[]     = { BLIS_FLOAT, BLIS_DOUBLE,
+	                            BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const trans_t transs[]  = { BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE,
+	                            BLIS_CONJ_TRANSPOSE };
+	const dim_t   batches[] = { 1, 3, 6, 7 };
+	const dim_t   nts[]     = { 1, nt_mt };
+	const dim_t   sizes[][3] =
+	{
+		{   1,   1,   1 },
+		{   5,   7,   3 },
+		{  33,  17,  70 },
+		{  70,  40, 300 },
+	};
+
+	const dim_t n_sizes = sizeof( sizes ) / sizeof( sizes[0] );
+
+	for ( int id = 0; id < 4; ++id )
+	for ( int ta = 0; ta < 3; ++ta )
+	for ( int tb = 0; tb < 3; ++tb )
+	for ( int sc = 0; sc < 2; ++sc )
+	for ( int sh = 0; sh < 4; ++sh )
+	for ( int ib = 0; ib < 4; ++ib )
+	for ( int it = 0; it < 2; ++it )
+	for ( dim_t iz = 0; iz < n_sizes; ++iz )
+	{
+		const num_t dt = dts[ id ];
+
+		// Conjugate-transpose is only distinct for complex datatypes.
+		if ( bli_is_real( dt ) && ( ta == 2 || tb == 2 ) ) continue;
+
+		// Keep the multithreaded cases to one size and storage of C, and to
+		// the combinations of no-transpose and transpose.
+		if ( it == 1 && ( iz != 2 || sc == 1 || ta == 2 || tb == 2 ) )
+			continue;
+
+		test_batch( dt, transs[ ta ], transs[ tb ], sc ? 'r' : 'c',
+		            sizes[ iz ][0], sizes[ iz ][1], sizes[ iz ][2],
+		            sh & 1, sh & 2, batches[ ib ], nts[ it ] );
+	}
+
+	printf( "%d cases, %d failed\n", n_cases, n_fail );
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
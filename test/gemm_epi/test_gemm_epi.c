@@ -0,0 +1,307 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <math.h>
+#include "blis.h"
+
+//
+// Correctness test for the gemm epilogues (bli_gemm_epi_ex()). For each real
+// datatype, each bias type, activation function, and output scaling and
+// clipping, each storage of C (column-major, row-major, which causes the
+// operation to be transposed internally on configurations whose microkernels
+// prefer column storage, and vice versa, and general stride), and problems
+// whose k dimension spans more than one KC block, the result is compared
+// with a plain gemm followed by the epilogue computed in double precision.
+// Each problem is executed:
+//
+// - with sup handling enabled and one thread (the sup path);
+// - with sup handling disabled and one thread (the conventional path);
+// - with sup handling disabled and several threads.
+//
+// If BLIS was configured with --enable-trace, the test also checks that the
+// first two cases took the sup and conventional paths, respectively.
+//
+// Usage: test_gemm_epi.x [nt]
+//
+//   nt  is the number of threads for the multithreaded cases (default 4)
+//
+// The program exits with a non-zero status if any case fails.
+//
+
+// Apply the epilogue to x in double precision.
+static double epi_ref( const gemm_epi_t* epi, const double* bias,
+                       dim_t i, dim_t j, double x )
+{
+	if      ( epi->bias_type == BLIS_EPI_BIAS_ROWS ) x += bias[ i ];
+	else if ( epi->bias_type == BLIS_EPI_BIAS_COLS ) x += bias[ j ];
+
+	if      ( epi->act == BLIS_EPI_RELU )
+		x = ( x > 0.0 ? x : 0.0 );
+	else if ( epi->act == BLIS_EPI_GELU_TANH )
+		x = 0.5 * x * ( 1.0 + tanh( 0.7978845608028654 *
+		                            ( x + 0.044715 * x * x * x ) ) );
+	else if ( epi->act == BLIS_EPI_GELU_ERF )
+		x = 0.5 * x * ( 1.0 + erf( 0.7071067811865476 * x ) );
+
+	x *= epi->scale;
+
+	if ( epi->clip )
+		x = ( x < epi->clip_min ? epi->clip_min :
+		    ( x > epi->clip_max ? epi->clip_max : x ) );
+
+	return x;
+}
+
+// Replace each element of x with its absolute value.
+static void absm( obj_t* x )
+{
+	for ( dim_t j = 0; j < bli_obj_width( x ); ++j )
+	for ( dim_t i = 0; i < bli_obj_length( x ); ++i )
+	{
+		double re, im;
+		bli_getijm( i, j, x, &re, &im );
+		bli_setijm( fabs( re ), 0.0, i, j, x );
+	}
+}
+
+int main( int argc, char** argv )
+{
+	const dim_t nt_mt = ( argc > 1 ? atoi( argv[1] ) : 4 );
+
+	const num_t      dts[]   = { BLIS_FLOAT, BLIS_DOUBLE };
+	const epi_bias_t biass[] = { BLIS_EPI_NO_BIAS, BLIS_EPI_BIAS_ROWS,
+	                             BLIS_EPI_BIAS_COLS };
+	const epi_act_t  acts[]  = { BLIS_EPI_NO_ACT, BLIS_EPI_RELU,
+	                             BLIS_EPI_GELU_TANH, BLIS_EPI_GELU_ERF };
+	const char       stors[] = "crg";
+	const dim_t      sizes[][2] =
+	{
+		{  50,  37 },
+		{ 150,  90 },
+	};
+
+	const dim_t n_sizes = sizeof( sizes ) / sizeof( sizes[0] );
+
+	const bool use_trace = ( bli_info_get_enable_trace() != 0 );
+
+	if ( use_trace ) bli_trace_enable();
+
+	int n_cases = 0, n_fail = 0;
+
+	for ( int id = 0; id < 2; ++id )
+	for ( int ib = 0; ib < 3; ++ib )
+	for ( int ia = 0; ia < 4; ++ia )
+	for ( int is = 0; is < 2; ++is )
+	for ( int sc = 0; sc < 3; ++sc )
+	for ( dim_t iz = 0; iz < n_sizes; ++iz )
+	for ( int ip = 0; ip < 3; ++ip )
+	{
+		const num_t  dt  = dts[ id ];
+		const double eps = ( dt == BLIS_FLOAT ? FLT_EPSILON : DBL_EPSILON );
+		const dim_t  m   = sizes[ iz ][0];
+		const dim_t  n   = sizes[ iz ][1];
+
+		// Span more than two KC blocks so that the epilogue must be applied
+		// only after the last one.
+		const dim_t  kc  = bli_cntx_get_blksz_def_dt( dt, BLIS_KC,
+		                                              bli_gks_query_cntx() );
+		const dim_t  k   = 2 * kc + 7;
+
+		const double alpha_d = 0.5, beta_d = -1.0;
+
+		// General stride leaves a gap between consecutive rows and columns
+		// of C.
+		inc_t rs_c = 1, cs_c = m;
+
+		if      ( stors[ sc ] == 'r' ) { rs_c = n; cs_c = 1; }
+		else if ( stors[ sc ] == 'g' ) { rs_c = 2; cs_c = 2 * m + 1; }
+
+		obj_t a, b, c0, c, ct, mag, bias, alpha, beta;
+
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, n, 1, &b );
+		bli_obj_create( dt, m, n, rs_c, cs_c, &c0 );
+		bli_obj_create( dt, m, n, rs_c, cs_c, &c );
+		bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &ct );
+		bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &mag );
+		bli_obj_create( dt, bli_max( m, n ), 1, 1, 1, &bias );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c0 );
+		bli_randv( &bias );
+
+		// Make the bias large enough that an omitted (or repeated) bias is
+		// detected reliably.
+		bli_scalv( &BLIS_TWO, &bias );
+
+		bli_obj_scalar_init_detached( dt, &alpha );
+		bli_obj_scalar_init_detached( dt, &beta );
+		bli_setsc( alpha_d, 0.0, &alpha );
+		bli_setsc( beta_d,  0.0, &beta );
+
+		gemm_epi_t epi;
+		bli_gemm_epi_init( &epi );
+
+		epi.bias_type = biass[ ib ];
+		epi.bias      = bli_obj_buffer( &bias );
+		epi.inc_bias  = 1;
+		epi.act       = acts[ ia ];
+
+		if ( is == 1 )
+		{
+			epi.scale    = 0.75;
+			epi.clip     = TRUE;
+			epi.clip_min = -3.0;
+			epi.clip_max =  2.5;
+		}
+
+		double bias_d[ 150 ];
+		for ( dim_t i = 0; i < bli_max( m, n ); ++i )
+		{
+			double im;
+			bli_getijv( i, &bias, &bias_d[ i ], &im );
+		}
+
+		// Compute the plain gemm (without the epilogue) in double precision,
+		// along with the magnitudes of the terms involved.
+		{
+			obj_t ad, bd, c0d;
+
+			bli_obj_create( BLIS_DOUBLE, m, k, 0, 0, &ad );
+			bli_obj_create( BLIS_DOUBLE, k, n, 0, 0, &bd );
+			bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &c0d );
+
+			bli_castm( &a,  &ad );
+			bli_castm( &b,  &bd );
+			bli_castm( &c0, &c0d );
+
+			bli_copym( &c0d, &ct );
+			bli_scalm( &beta, &ct );
+			bli_gemm( &alpha, &ad, &bd, &BLIS_ONE, &ct );
+
+			absm( &ad );
+			absm( &bd );
+			absm( &c0d );
+
+			obj_t alpha_abs, beta_abs;
+			bli_obj_scalar_init_detached( BLIS_DOUBLE, &alpha_abs );
+			bli_obj_scalar_init_detached( BLIS_DOUBLE, &beta_abs );
+			bli_setsc( fabs( alpha_d ), 0.0, &alpha_abs );
+			bli_setsc( fabs( beta_d ),  0.0, &beta_abs );
+
+			bli_copym( &c0d, &mag );
+			bli_scalm( &beta_abs, &mag );
+			bli_gemm( &alpha_abs, &ad, &bd, &BLIS_ONE, &mag );
+
+			bli_obj_free( &ad );
+			bli_obj_free( &bd );
+			bli_obj_free( &c0d );
+		}
+
+		rntm_t rntm;
+		bli_rntm_init_from_global( &rntm );
+		bli_rntm_set_num_threads( ip == 2 ? nt_mt : 1, &rntm );
+		if ( ip != 0 ) bli_rntm_disable_l3_sup( &rntm );
+
+		trace_counters_t before, after;
+
+		bli_copym( &c0, &c );
+
+		if ( use_trace ) bli_trace_query_counters( &before );
+
+		bli_gemm_epi_ex( &alpha, &a, &b, &beta, &c, &epi, NULL, &rntm );
+
+		if ( use_trace ) bli_trace_query_counters( &after );
+
+		bool ok = TRUE;
+
+		// The epilogue functions are Lipschitz continuous with a constant of
+		// at most 1.13 (for GELU), so the gemm error bound carries over (with
+		// allowance for the bias, whose elements are at most two in
+		// magnitude, and the rounding of the epilogue itself).
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			double tij, mij, cij, im;
+
+			bli_getijm( i, j, &ct,  &tij, &im );
+			bli_getijm( i, j, &mag, &mij, &im );
+			bli_getijm( i, j, &c,   &cij, &im );
+
+			const double ref = epi_ref( &epi, bias_d, i, j, tij );
+			const double tol = 8.0 * ( k + 2 ) * eps *
+			                   ( mij + 2.0 + fabs( ref ) );
+
+			if ( !( fabs( cij - ref ) <= tol ) ) ok = FALSE;
+		}
+
+		// Check that the intended path was taken. (With general stride, the
+		// sup code may decline the problem.)
+		if ( use_trace && ip == 0 && stors[ sc ] != 'g' &&
+		     after.calls[ BLIS_TRACE_SUP ] !=
+		     before.calls[ BLIS_TRACE_SUP ] + 1 ) ok = FALSE;
+
+		if ( use_trace && ip == 1 &&
+		     after.calls[ BLIS_TRACE_NAT ] !=
+		     before.calls[ BLIS_TRACE_NAT ] + 1 ) ok = FALSE;
+
+		if ( !ok )
+		{
+			printf( "FAIL: dt=%c bias=%d act=%d scale/clip=%d storc=%c "
+			        "m=%ld n=%ld k=%ld path=%s\n",
+			        dt == BLIS_FLOAT ? 's' : 'd', ( int )epi.bias_type,
+			        ( int )epi.act, is, stors[ sc ],
+			        ( long )m, ( long )n, ( long )k,
+			        ip == 0 ? "sup" : ip == 1 ? "conv" : "conv-mt" );
+			n_fail += 1;
+		}
+
+		n_cases += 1;
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c0 );
+		bli_obj_free( &c );
+		bli_obj_free( &ct );
+		bli_obj_free( &mag );
+		bli_obj_free( &bias );
+	}
+
+	printf( "%d cases, %d failed%s\n", n_cases, n_fail,
+	        use_trace ? "" : " (trace counters not checked)" );
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
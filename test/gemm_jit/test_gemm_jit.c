@@ -0,0 +1,261 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <math.h>
+#include "blis.h"
+
+//
+// Correctness test for the fixed-shape small gemm handles
+// (bli_?gemm_jit_query() and bli_?gemm_jit_exec()). For each datatype, each
+// combination of transa and transb, several storage combinations of A, B,
+// and C (all column-major, all row-major, and mixed, with leading
+// dimensions larger than necessary), a grid of m, n, and k (including
+// dimensions that are not multiples of the register blocksizes and one
+// dimension beyond the largest for which code is generated), and each
+// class of alpha and beta (zero, one, and other values), a handle is
+// queried and executed, and the result is compared with bli_gemm(). When
+// beta is zero, C is filled with NaN, which must not propagate.
+//
+// The test reports how many of the handles use generated code, which
+// depends on the processor (and on BLIS_GEMM_JIT).
+//
+// Usage: test_gemm_jit.x
+//
+// The program exits with a non-zero status if any case fails.
+//
+
+static const gemmjit_t* query_exec
+     (
+       trans_t transa,
+       trans_t transb,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c
+     )
+{
+	const num_t dt = bli_obj_dt( c );
+	const dim_t m  = bli_obj_length( c );
+	const dim_t n  = bli_obj_width( c );
+	const dim_t k  = bli_obj_width_after_trans( a );
+
+	const inc_t rs_a = bli_obj_row_stride( a ), cs_a = bli_obj_col_stride( a );
+	const inc_t rs_b = bli_obj_row_stride( b ), cs_b = bli_obj_col_stride( b );
+	const inc_t rs_c = bli_obj_row_stride( c ), cs_c = bli_obj_col_stride( c );
+
+	void* buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
+	void* buf_beta  = bli_obj_buffer_for_1x1( dt, beta );
+	void* buf_a     = bli_obj_buffer( a );
+	void* buf_b     = bli_obj_buffer( b );
+	void* buf_c     = bli_obj_buffer( c );
+
+	const gemmjit_t* h = NULL;
+
+	if ( dt == BLIS_FLOAT )
+	{
+		h = bli_sgemm_jit_query( transa, transb, m, n, k, buf_alpha,
+		                         rs_a, cs_a, rs_b, cs_b, buf_beta, rs_c, cs_c );
+		bli_sgemm_jit_exec( h, buf_alpha, buf_a, buf_b, buf_beta, buf_c );
+	}
+	else if ( dt == BLIS_DOUBLE )
+	{
+		h = bli_dgemm_jit_query( transa, transb, m, n, k, buf_alpha,
+		                         rs_a, cs_a, rs_b, cs_b, buf_beta, rs_c, cs_c );
+		bli_dgemm_jit_exec( h, buf_alpha, buf_a, buf_b, buf_beta, buf_c );
+	}
+	else if ( dt == BLIS_SCOMPLEX )
+	{
+		h = bli_cgemm_jit_query( transa, transb, m, n, k, buf_alpha,
+		                         rs_a, cs_a, rs_b, cs_b, buf_beta, rs_c, cs_c );
+		bli_cgemm_jit_exec( h, buf_alpha, buf_a, buf_b, buf_beta, buf_c );
+	}
+	else
+	{
+		h = bli_zgemm_jit_query( transa, transb, m, n, k, buf_alpha,
+		                         rs_a, cs_a, rs_b, cs_b, buf_beta, rs_c, cs_c );
+		bli_zgemm_jit_exec( h, buf_alpha, buf_a, buf_b, buf_beta, buf_c );
+	}
+
+	return h;
+}
+
+int main( int argc, char** argv )
+{
+	const num_t  dts[]    = { BLIS_FLOAT, BLIS_DOUBLE,
+	                          BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const char*  stors[]  = { "ccc", "rrr", "crc", "rcr", "ccr" }; // c, a, b
+	const dim_t  ms[]     = { 1, 5, 8, 13, 32 };
+	const dim_t  ns[]     = { 1, 7, 16, 31 };
+	const dim_t  ks[]     = { 1, 9, 32 };
+	const double scalars[][2] =
+	{
+		{  1.0,  0.0 },
+		{  0.0,  1.0 },
+		{ -1.5,  0.5 },
+		{  1.0,  1.0 },
+		{  0.5, -2.0 },
+	};
+
+	const int n_stors   = sizeof( stors ) / sizeof( stors[0] );
+	const int n_ms      = sizeof( ms ) / sizeof( ms[0] );
+	const int n_ns      = sizeof( ns ) / sizeof( ns[0] );
+	const int n_ks      = sizeof( ks ) / sizeof( ks[0] );
+	const int n_scalars = sizeof( scalars ) / sizeof( scalars[0] );
+
+	int n_cases = 0, n_gen = 0, n_fail = 0;
+
+	for ( int id = 0; id < 4; ++id )
+	for ( int ta = 0; ta < 2; ++ta )
+	for ( int tb = 0; tb < 2; ++tb )
+	for ( int is = 0; is < n_stors; ++is )
+	for ( int im = 0; im < n_ms + 1; ++im )
+	for ( int in = 0; in < n_ns; ++in )
+	for ( int ik = 0; ik < n_ks; ++ik )
+	for ( int ia = 0; ia < n_scalars; ++ia )
+	{
+		const num_t dt = dts[ id ];
+
+		// Only test a few shapes for the complex datatypes, for which no
+		// code is generated.
+		if ( bli_is_complex( dt ) && ( in != 1 || ik != 1 ) ) continue;
+
+		// The last m is just beyond the largest dimension for which code is
+		// generated.
+		const dim_t m = ( im < n_ms ? ms[ im ] : BLIS_GEMMJIT_MAX_DIM + 1 );
+		const dim_t n = ns[ in ];
+		const dim_t k = ks[ ik ];
+
+		const trans_t transa = ( ta ? BLIS_TRANSPOSE : BLIS_NO_TRANSPOSE );
+		const trans_t transb = ( tb ? BLIS_TRANSPOSE : BLIS_NO_TRANSPOSE );
+
+		const double alpha_d = scalars[ ia ][0];
+		const double beta_d  = scalars[ ia ][1];
+		const double eps     = ( bli_dt_prec_is_single( dt ) ? FLT_EPSILON
+		                                                    : DBL_EPSILON );
+
+		const dim_t ma = ( ta ? k : m ), na = ( ta ? m : k );
+		const dim_t mb = ( tb ? n : k ), nb = ( tb ? k : n );
+
+		obj_t a, b, c0, c, c_ref, alpha, beta;
+
+		// Pad the leading dimensions so that they differ from the other
+		// dimension of each operand.
+		if ( stors[ is ][1] == 'c' ) bli_obj_create( dt, ma, na, 1, ma + 3, &a );
+		else                         bli_obj_create( dt, ma, na, na + 2, 1, &a );
+
+		if ( stors[ is ][2] == 'c' ) bli_obj_create( dt, mb, nb, 1, mb + 3, &b );
+		else                         bli_obj_create( dt, mb, nb, nb + 2, 1, &b );
+
+		if ( stors[ is ][0] == 'c' )
+		{
+			bli_obj_create( dt, m, n, 1, m + 3, &c0 );
+			bli_obj_create( dt, m, n, 1, m + 3, &c );
+			bli_obj_create( dt, m, n, 1, m + 3, &c_ref );
+		}
+		else
+		{
+			bli_obj_create( dt, m, n, n + 2, 1, &c0 );
+			bli_obj_create( dt, m, n, n + 2, 1, &c );
+			bli_obj_create( dt, m, n, n + 2, 1, &c_ref );
+		}
+
+		bli_obj_set_onlytrans( transa, &a );
+		bli_obj_set_onlytrans( transb, &b );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c0 );
+
+		// When beta is zero, C must not be read, so fill it with NaN.
+		if ( beta_d == 0.0 ) bli_setm( &BLIS_NAN, &c0 );
+
+		bli_obj_scalar_init_detached( dt, &alpha );
+		bli_obj_scalar_init_detached( dt, &beta );
+		bli_setsc( alpha_d, 0.0, &alpha );
+		bli_setsc( beta_d,  0.0, &beta );
+
+		bli_copym( &c0, &c );
+		bli_copym( &c0, &c_ref );
+
+		const gemmjit_t* h = query_exec( transa, transb, &alpha, &a, &b,
+		                                 &beta, &c );
+
+		bli_gemm( &alpha, &a, &b, &beta, &c_ref );
+
+		bool ok = TRUE;
+
+		const double tol = 4.0 * ( k + 2 ) * eps *
+		                   ( 2.0 * fabs( alpha_d ) * k + 2.0 * fabs( beta_d ) );
+
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			double xr, xi, yr, yi;
+			bli_getijm( i, j, &c,     &xr, &xi );
+			bli_getijm( i, j, &c_ref, &yr, &yi );
+
+			if ( !( hypot( xr - yr, xi - yi ) <= tol ) ) ok = FALSE;
+		}
+
+		// A second query for the same shape must return the same handle.
+		if ( h != query_exec( transa, transb, &alpha, &a, &b, &beta, &c0 ) )
+			ok = FALSE;
+
+		if ( !ok )
+		{
+			printf( "FAIL: dt=%c trans=%c%c stor(c,a,b)=%s m=%ld n=%ld k=%ld "
+			        "alpha=%g beta=%g generated=%d\n",
+			        "sdcz"[ id ], ta ? 't' : 'n', tb ? 't' : 'n', stors[ is ],
+			        ( long )m, ( long )n, ( long )k, alpha_d, beta_d,
+			        h->ker != NULL );
+			n_fail += 1;
+		}
+
+		n_cases += 1;
+		n_gen   += ( h->ker != NULL );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c0 );
+		bli_obj_free( &c );
+		bli_obj_free( &c_ref );
+	}
+
+	printf( "%d cases (%d with generated code), %d failed\n",
+	        n_cases, n_gen, n_fail );
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
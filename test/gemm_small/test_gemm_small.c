@@ -0,0 +1,295 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <math.h>
+#include "blis.h"
+
+#ifdef BLIS_ENABLE_SMALL_MATRIX
+
+//
+// Correctness test for the small matrix gemm code (bli_gemm_small()), which
+// is enabled on zen family configurations via --enable-small-matrix.
+// For each datatype (s and d), each combination of transa and transb, each
+// storage of C, A, and B (column-major or row-major), and a range of problem
+// sizes and scalars, the result is compared with a simple reference computed
+// in double precision:
+//
+// - bli_gemm_small() is called directly. It must accept every problem whose
+//   m and n dimensions are at least three and whose k dimension is less
+//   than 256 (and may decline the others).
+// - bli_gemm_ex() is called with sup handling disabled and one thread, in
+//   which case bli_gemm_front() hands the problem to bli_gemm_small(). If
+//   BLIS was configured with --enable-trace, the test also checks that the
+//   problem was counted as taking the small matrix path whenever the
+//   direct call accepted it.
+//
+// Usage: test_gemm_small.x
+//
+// The program exits with a non-zero status if any case fails.
+//
+
+// Return element (i,j) of op(X), where op() is given by the transposition
+// property of X.
+static double get_op( const obj_t* x, dim_t i, dim_t j )
+{
+	double re, im;
+
+	if ( bli_obj_has_trans( x ) ) bli_getijm( j, i, x, &re, &im );
+	else                          bli_getijm( i, j, x, &re, &im );
+
+	return re;
+}
+
+// Check C against beta * C0 + alpha * op(A) * op(B), allowing an error that
+// is proportional to the magnitude of the terms involved.
+static bool check_gemm
+     (
+       double       alpha,
+       const obj_t* a,
+       const obj_t* b,
+       double       beta,
+       const obj_t* c0,
+       const obj_t* c
+     )
+{
+	const num_t  dt  = bli_obj_dt( c );
+	const dim_t  m   = bli_obj_length( c );
+	const dim_t  n   = bli_obj_width( c );
+	const dim_t  k   = bli_obj_width_after_trans( a );
+	const double eps = ( dt == BLIS_FLOAT ? FLT_EPSILON : DBL_EPSILON );
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		double ref = 0.0, mag = 0.0, c0ij, cij, im;
+
+		for ( dim_t l = 0; l < k; ++l )
+		{
+			const double t = get_op( a, i, l ) * get_op( b, l, j );
+			ref += t;
+			mag += fabs( t );
+		}
+
+		ref *= alpha;
+		mag *= fabs( alpha );
+
+		// A zero beta means that C0 is not read (and may hold NaN).
+		if ( beta != 0.0 )
+		{
+			bli_getijm( i, j, c0, &c0ij, &im );
+			ref += beta * c0ij;
+			mag += fabs( beta * c0ij );
+		}
+
+		bli_getijm( i, j, c, &cij, &im );
+
+		if ( !( fabs( cij - ref ) <= 4.0 * ( k + 2 ) * eps * mag ) )
+			return FALSE;
+	}
+
+	return TRUE;
+}
+
+int main( int argc, char** argv )
+{
+	const num_t  dts[]    = { BLIS_FLOAT, BLIS_DOUBLE };
+	const char   stors[]  = "cr";
+	const dim_t  sizes[][3] =
+	{
+		{   1,   1,   1 },
+		{   5,   7,   3 },
+		{  17,   2,  11 },
+		{  33,  17,   9 },
+		{  47,   4,  65 },
+		{  40,   1,  20 },
+		{  70,  45, 130 },
+		{  20,   9, 600 },
+	};
+	const double scalars[][2] =
+	{
+		{  1.0,  0.0 },
+		{ -1.5,  0.5 },
+		{  0.0,  0.0 },
+		{  0.0, -2.0 },
+	};
+
+	const dim_t n_sizes   = sizeof( sizes ) / sizeof( sizes[0] );
+	const dim_t n_scalars = sizeof( scalars ) / sizeof( scalars[0] );
+
+	const bool use_trace = ( bli_info_get_enable_trace() != 0 );
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( 1, &rntm );
+	bli_rntm_disable_l3_sup( &rntm );
+
+	if ( use_trace ) bli_trace_enable();
+
+	int n_cases = 0, n_small = 0, n_fail = 0;
+
+	for ( int id = 0; id < 2; ++id )
+	for ( int ta = 0; ta < 2; ++ta )
+	for ( int tb = 0; tb < 2; ++tb )
+	for ( int sc = 0; sc < 2; ++sc )
+	for ( int sa = 0; sa < 2; ++sa )
+	for ( int sb = 0; sb < 2; ++sb )
+	for ( dim_t is = 0; is < n_sizes; ++is )
+	for ( dim_t ia = 0; ia < n_scalars; ++ia )
+	{
+		const num_t dt = dts[ id ];
+		const dim_t m  = sizes[ is ][0];
+		const dim_t n  = sizes[ is ][1];
+		const dim_t k  = sizes[ is ][2];
+
+		const double alpha_d = scalars[ ia ][0];
+		const double beta_d  = scalars[ ia ][1];
+
+		const dim_t ma = ( ta ? k : m ), na = ( ta ? m : k );
+		const dim_t mb = ( tb ? n : k ), nb = ( tb ? k : n );
+
+		obj_t a, b, c0, c, alpha, beta;
+
+		if ( stors[ sa ] == 'c' ) bli_obj_create( dt, ma, na, 0, 0, &a );
+		else                      bli_obj_create( dt, ma, na, na, 1, &a );
+
+		if ( stors[ sb ] == 'c' ) bli_obj_create( dt, mb, nb, 0, 0, &b );
+		else                      bli_obj_create( dt, mb, nb, nb, 1, &b );
+
+		if ( stors[ sc ] == 'c' )
+		{
+			bli_obj_create( dt, m, n, 0, 0, &c0 );
+			bli_obj_create( dt, m, n, 0, 0, &c );
+		}
+		else
+		{
+			bli_obj_create( dt, m, n, n, 1, &c0 );
+			bli_obj_create( dt, m, n, n, 1, &c );
+		}
+
+		if ( ta ) bli_obj_set_onlytrans( BLIS_TRANSPOSE, &a );
+		if ( tb ) bli_obj_set_onlytrans( BLIS_TRANSPOSE, &b );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c0 );
+
+		// When beta is zero, C must not be read, so fill it with NaN.
+		if ( beta_d == 0.0 ) bli_setm( &BLIS_NAN, &c0 );
+
+		bli_obj_scalar_init_detached( dt, &alpha );
+		bli_obj_scalar_init_detached( dt, &beta );
+		bli_setsc( alpha_d, 0.0, &alpha );
+		bli_setsc( beta_d,  0.0, &beta );
+
+		// Call the small matrix code directly.
+		bli_copym( &c0, &c );
+
+		err_t status = bli_gemm_small( &alpha, &a, &b, &beta, &c,
+		                               bli_gks_query_cntx(), NULL );
+
+		bool ok = TRUE;
+
+		if ( status == BLIS_SUCCESS )
+		{
+			ok = check_gemm( alpha_d, &a, &b, beta_d, &c0, &c );
+			n_small += 1;
+		}
+		else if ( m >= 3 && n >= 3 && k < 256 )
+		{
+			// The double-precision kernels require at least three columns
+			// (which may be the rows of C if C is stored by rows), but no
+			// other problem with a short k dimension may be declined.
+			ok = FALSE;
+		}
+
+		// Call the object API, which should also reach the small matrix
+		// code for the problems accepted above.
+		trace_counters_t before, after;
+
+		bli_copym( &c0, &c );
+
+		if ( use_trace ) bli_trace_query_counters( &before );
+
+		bli_gemm_ex( &alpha, &a, &b, &beta, &c, NULL, &rntm );
+
+		if ( use_trace ) bli_trace_query_counters( &after );
+
+		ok = ok && check_gemm( alpha_d, &a, &b, beta_d, &c0, &c );
+
+		// The problem should be counted as taking the small matrix path
+		// exactly when the direct call above accepted it, except that zero
+		// alpha returns early from bli_gemm_ex().
+		const uint64_t n_exp = ( status == BLIS_SUCCESS && alpha_d != 0.0 );
+
+		if ( use_trace &&
+		     after.calls[ BLIS_TRACE_SMALL ] !=
+		     before.calls[ BLIS_TRACE_SMALL ] + n_exp ) ok = FALSE;
+
+		if ( !ok )
+		{
+			printf( "FAIL: dt=%c trans=%c%c stor(c,a,b)=%c%c%c "
+			        "m=%ld n=%ld k=%ld alpha=%g beta=%g status=%d\n",
+			        dt == BLIS_FLOAT ? 's' : 'd',
+			        ta ? 't' : 'n', tb ? 't' : 'n',
+			        stors[ sc ], stors[ sa ], stors[ sb ],
+			        ( long )m, ( long )n, ( long )k,
+			        alpha_d, beta_d, ( int )status );
+			n_fail += 1;
+		}
+
+		n_cases += 1;
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c0 );
+		bli_obj_free( &c );
+	}
+
+	printf( "%d cases (%d via bli_gemm_small()), %d failed%s\n",
+	        n_cases, n_small, n_fail,
+	        use_trace ? "" : " (trace counters not checked)" );
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
+
+#else
+
+int main( int argc, char** argv )
+{
+	printf( "BLIS_ENABLE_SMALL_MATRIX is not defined by this configuration; "
+	        "nothing to test\n" );
+	return 0;
+}
+
+#endif
@@ -0,0 +1,311 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <math.h>
+#include "blis.h"
+
+//
+// Correctness test for mixed-datatype gemm in the sup code path. For each
+// combination of the storage datatypes of C, A, and B (s, d, c, and z), each
+// computation precision, each combination of transa and transb, each storage
+// of C (column- or row-major), and several problem sizes below the sup
+// thresholds, the result is compared with that of the conventional mixed-
+// datatype implementation (bli_gemm_ex() with sup handling disabled):
+//
+// - bli_gemmsup() is called directly. It must accept every problem in which
+//   C is real and A and B are real, or in which C is complex and at least
+//   one of A and B is complex, and decline the others.
+// - bli_gemm_ex() is called with sup handling enabled.
+//
+// Usage: test_gemm_sup_md.x
+//
+// The program exits with a non-zero status if any case fails.
+//
+
+// Return element (i,j) of op(X), where op() is given by the transposition
+// property of X.
+static void get_op( const obj_t* x, dim_t i, dim_t j, double* re, double* im )
+{
+	if ( bli_obj_has_trans( x ) ) bli_getijm( j, i, x, re, im );
+	else                          bli_getijm( i, j, x, re, im );
+}
+
+// Compute the magnitude of the terms that contribute to each element of
+// beta * C0 + alpha * op(A) * op(B).
+static void gemm_mag
+     (
+       double       alpha,
+       const obj_t* a,
+       const obj_t* b,
+       double       beta,
+       const obj_t* c0,
+       obj_t*       mag
+     )
+{
+	const dim_t m = bli_obj_length( c0 );
+	const dim_t n = bli_obj_width( c0 );
+	const dim_t k = bli_obj_width_after_trans( a );
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		double sum = 0.0, ar, ai, br, bi, cr, ci;
+
+		for ( dim_t l = 0; l < k; ++l )
+		{
+			get_op( a, i, l, &ar, &ai );
+			get_op( b, l, j, &br, &bi );
+			sum += hypot( ar, ai ) * hypot( br, bi );
+		}
+
+		sum *= alpha;
+
+		if ( beta != 0.0 )
+		{
+			bli_getijm( i, j, c0, &cr, &ci );
+			sum += beta * hypot( cr, ci );
+		}
+
+		bli_setijm( sum, 0.0, i, j, mag );
+	}
+}
+
+// Check that C matches C_ref to within the given tolerance, relative to the
+// magnitude of the terms involved.
+static bool check_close
+     (
+       const obj_t* c,
+       const obj_t* c_ref,
+       const obj_t* mag,
+       double       tol
+     )
+{
+	const dim_t m = bli_obj_length( c );
+	const dim_t n = bli_obj_width( c );
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		double cr, ci, rr, ri, mr, mi;
+
+		bli_getijm( i, j, c,     &cr, &ci );
+		bli_getijm( i, j, c_ref, &rr, &ri );
+		bli_getijm( i, j, mag,   &mr, &mi );
+
+		if ( !( hypot( cr - rr, ci - ri ) <= tol * mr ) )
+			return FALSE;
+	}
+
+	return TRUE;
+}
+
+int main( int argc, char** argv )
+{
+	const num_t  dts[]     = { BLIS_FLOAT, BLIS_DOUBLE,
+	                           BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const char   dtchars[] = "sdcz";
+	const prec_t precs[]   = { BLIS_SINGLE_PREC, BLIS_DOUBLE_PREC };
+	const char   stors[]   = "cr";
+	const dim_t  sizes[][3] =
+	{
+		{   5,   7,   9 },
+		{  40,  33,  17 },
+		{  19,  64,  70 },
+	};
+	const double scalars[][4] =
+	{
+		// alpha (real, imag), beta (real, imag). Mixed-datatype gemm does
+		// not support alpha with a non-zero imaginary part.
+		{  1.0,  0.0,  1.0,  0.0 },
+		{ -0.5,  0.0,  0.0,  0.0 },
+		{  2.0,  0.0, -1.5,  0.5 },
+	};
+
+	const dim_t n_sizes   = sizeof( sizes ) / sizeof( sizes[0] );
+	const dim_t n_scalars = sizeof( scalars ) / sizeof( scalars[0] );
+
+	rntm_t rntm_sup = BLIS_RNTM_INITIALIZER;
+	rntm_t rntm_nat = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( 1, &rntm_sup );
+	bli_rntm_set_num_threads( 1, &rntm_nat );
+	bli_rntm_disable_l3_sup( &rntm_nat );
+
+	// Sup handling may be disabled for the complex datatypes (by way of
+	// negative thresholds), so give them the thresholds of the real domain in
+	// a copy of the context, such that the mixed-domain cases are exercised.
+	cntx_t cntx = *bli_gks_query_cntx();
+
+	for ( int ic = 0; ic < 2; ++ic )
+	{
+		const num_t dt_r = dts[ ic ];
+		const num_t dt_c = bli_dt_proj_to_complex( dt_r );
+
+		bli_cntx_set_blksz_dt( dt_c, BLIS_MT, bli_cntx_get_blksz_def_dt( dt_r, BLIS_MT, &cntx ), &cntx );
+		bli_cntx_set_blksz_dt( dt_c, BLIS_NT, bli_cntx_get_blksz_def_dt( dt_r, BLIS_NT, &cntx ), &cntx );
+		bli_cntx_set_blksz_dt( dt_c, BLIS_KT, bli_cntx_get_blksz_def_dt( dt_r, BLIS_KT, &cntx ), &cntx );
+	}
+
+	int n_cases = 0, n_sup = 0, n_fail = 0;
+
+	for ( int ic = 0; ic < 4; ++ic )
+	for ( int ia = 0; ia < 4; ++ia )
+	for ( int ib = 0; ib < 4; ++ib )
+	for ( int ip = 0; ip < 2; ++ip )
+	for ( int ta = 0; ta < 2; ++ta )
+	for ( int tb = 0; tb < 2; ++tb )
+	for ( int sc = 0; sc < 2; ++sc )
+	for ( dim_t iz = 0; iz < n_sizes; ++iz )
+	for ( dim_t is = 0; is < n_scalars; ++is )
+	{
+		const num_t dt_c = dts[ ic ];
+		const num_t dt_a = dts[ ia ];
+		const num_t dt_b = dts[ ib ];
+		const dim_t m    = sizes[ iz ][0];
+		const dim_t n    = sizes[ iz ][1];
+		const dim_t k    = sizes[ iz ][2];
+
+		const dim_t ma = ( ta ? k : m ), na = ( ta ? m : k );
+		const dim_t mb = ( tb ? n : k ), nb = ( tb ? k : n );
+
+		const double* sc_p  = scalars[ is ];
+		const double  beta_r = sc_p[2];
+
+		// The error is governed by the lowest precision involved.
+		const bool   is_single = ( precs[ ip ] == BLIS_SINGLE_PREC ||
+		                           bli_dt_prec_is_single( dt_a ) ||
+		                           bli_dt_prec_is_single( dt_b ) ||
+		                           bli_dt_prec_is_single( dt_c ) );
+		const double eps = ( is_single ? FLT_EPSILON : DBL_EPSILON );
+
+		obj_t a, b, c0, c, c_ref, mag, alpha, beta;
+
+		if ( ta ) bli_obj_create( dt_a, ma, na, na, 1, &a );
+		else      bli_obj_create( dt_a, ma, na, 0, 0, &a );
+
+		if ( tb ) bli_obj_create( dt_b, mb, nb, nb, 1, &b );
+		else      bli_obj_create( dt_b, mb, nb, 0, 0, &b );
+
+		if ( stors[ sc ] == 'c' )
+		{
+			bli_obj_create( dt_c, m, n, 0, 0, &c0 );
+			bli_obj_create( dt_c, m, n, 0, 0, &c );
+			bli_obj_create( dt_c, m, n, 0, 0, &c_ref );
+		}
+		else
+		{
+			bli_obj_create( dt_c, m, n, n, 1, &c0 );
+			bli_obj_create( dt_c, m, n, n, 1, &c );
+			bli_obj_create( dt_c, m, n, n, 1, &c_ref );
+		}
+
+		bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &mag );
+
+		if ( ta ) bli_obj_set_onlytrans( BLIS_TRANSPOSE, &a );
+		if ( tb ) bli_obj_set_onlytrans( BLIS_TRANSPOSE, &b );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c0 );
+
+		// When beta is zero, C must not be read, so fill it with NaN.
+		if ( beta_r == 0.0 && sc_p[3] == 0.0 ) bli_setm( &BLIS_NAN, &c0 );
+
+		bli_obj_scalar_init_detached( dt_c, &alpha );
+		bli_obj_scalar_init_detached( dt_c, &beta );
+		bli_setsc( sc_p[0], sc_p[1], &alpha );
+		bli_setsc( sc_p[2], sc_p[3], &beta );
+
+		bli_obj_set_comp_prec( precs[ ip ], &c );
+		bli_obj_set_comp_prec( precs[ ip ], &c_ref );
+
+		gemm_mag( hypot( sc_p[0], sc_p[1] ), &a, &b,
+		          hypot( sc_p[2], sc_p[3] ), &c0, &mag );
+
+		const double tol = 8.0 * ( k + 2 ) * eps;
+
+		// Compute the reference with the conventional implementation.
+		bli_copym( &c0, &c_ref );
+		bli_gemm_ex( &alpha, &a, &b, &beta, &c_ref, &cntx, &rntm_nat );
+
+		// Call the sup code directly.
+		const bool real_ab = ( bli_is_real( dt_a ) && bli_is_real( dt_b ) );
+		const bool exp_sup = ( bli_is_real( dt_c ) ? real_ab : !real_ab );
+
+		bli_copym( &c0, &c );
+
+		err_t status = bli_gemmsup( &alpha, &a, &b, &beta, &c,
+		                            &cntx, &rntm_sup );
+
+		bool ok = ( ( status == BLIS_SUCCESS ) == exp_sup );
+
+		if ( status == BLIS_SUCCESS )
+		{
+			ok = ok && check_close( &c, &c_ref, &mag, tol );
+			n_sup += 1;
+		}
+
+		// Call the object API with sup handling enabled.
+		bli_copym( &c0, &c );
+		bli_gemm_ex( &alpha, &a, &b, &beta, &c, &cntx, &rntm_sup );
+
+		ok = ok && check_close( &c, &c_ref, &mag, tol );
+
+		if ( !ok )
+		{
+			printf( "FAIL: dt(c,a,b)=%c%c%c prec=%c trans=%c%c storc=%c "
+			        "m=%ld n=%ld k=%ld alpha=(%g,%g) beta=(%g,%g) "
+			        "status=%d\n",
+			        dtchars[ ic ], dtchars[ ia ], dtchars[ ib ],
+			        "sd"[ ip ], ta ? 't' : 'n', tb ? 't' : 'n', stors[ sc ],
+			        ( long )m, ( long )n, ( long )k,
+			        sc_p[0], sc_p[1], sc_p[2], sc_p[3], ( int )status );
+			n_fail += 1;
+		}
+
+		n_cases += 1;
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c0 );
+		bli_obj_free( &c );
+		bli_obj_free( &c_ref );
+		bli_obj_free( &mag );
+	}
+
+	printf( "%d cases (%d via bli_gemmsup()), %d failed\n",
+	        n_cases, n_sup, n_fail );
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
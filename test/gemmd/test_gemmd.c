@@ -0,0 +1,234 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <math.h>
+#include <string.h>
+#include "blis.h"
+
+//
+// Performance driver for bao_gemmd(), bao_gemmtd(), and bao_syrkd() of the
+// 'gemmd' addon. Each operation is also computed via the conventional
+// approach, in which diag(d) is first applied explicitly to a copy of B
+// (for gemmd and gemmtd) or of A (for syrkd), and then the product is
+// computed by bli_gemm() (for gemmd) or bli_gemmt() (for gemmtd and syrkd,
+// which update the lower triangle of C). All matrices are square and
+// column-stored. The number of threads is set via BLIS_NUM_THREADS (or the
+// other usual BLIS environment variables).
+//
+// The result of the addon is also compared with that of the conventional
+// approach. If the two differ by more than rounding errors allow for some
+// size, FAIL is printed for that size and the program exits with a
+// non-zero status.
+//
+// Usage: test_gemmd.x <gemmd|gemmtd|syrkd> <dt> <p_begin> <p_max> <p_inc> <n_repeats>
+//
+//   dt  is one of s, d, c, or z
+//
+
+int main( int argc, char** argv )
+{
+	if ( argc != 7 )
+	{
+		printf( "usage: %s <gemmd|gemmtd|syrkd> <s|d|c|z> "
+		        "<p_begin> <p_max> <p_inc> <n_repeats>\n", argv[0] );
+		return 1;
+	}
+
+	const char* op        = argv[1];
+	const char  dt_ch     = argv[2][0];
+	const dim_t p_begin   = atol( argv[3] );
+	const dim_t p_max     = atol( argv[4] );
+	const dim_t p_inc     = atol( argv[5] );
+	const int   n_repeats = atoi( argv[6] );
+
+	bool is_syrkd = FALSE, is_gemmt = FALSE;
+	if      ( strcmp( op, "gemmd" )  == 0 ) ;
+	else if ( strcmp( op, "gemmtd" ) == 0 ) is_gemmt = TRUE;
+	else if ( strcmp( op, "syrkd" )  == 0 ) is_gemmt = is_syrkd = TRUE;
+	else
+	{
+		printf( "unknown operation '%s'\n", op );
+		return 1;
+	}
+
+	num_t dt;
+	bli_param_map_char_to_blis_dt( dt_ch, &dt );
+
+	const double eps = ( bli_dt_prec_is_single( dt ) ? FLT_EPSILON
+	                                                 : DBL_EPSILON );
+
+	int n_fail = 0;
+
+	for ( dim_t p = p_begin; p <= p_max; p += p_inc )
+	{
+		const dim_t m = p;
+		const dim_t n = p;
+		const dim_t k = p;
+
+		obj_t a, d, b, c, c_save, c_conv, t;
+
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, 1, 0, 0, &d );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+		bli_obj_create( dt, m, n, 0, 0, &c_save );
+		bli_obj_create( dt, m, n, 0, 0, &c_conv );
+
+		bli_randm( &a );
+		bli_randv( &d );
+		bli_randm( &b );
+		bli_randm( &c_save );
+
+		// The temporary matrix to which diag(d) is applied explicitly: a
+		// copy of B for gemmd, or of A for syrkd.
+		bli_obj_create( dt, is_syrkd ? m : k, is_syrkd ? k : n, 0, 0, &t );
+
+		obj_t at;
+		bli_obj_alias_with_trans( BLIS_TRANSPOSE, &a, &at );
+
+		// A dense alias of C, via which the results are compared.
+		obj_t c_dense;
+		bli_obj_alias_to( &c, &c_dense );
+
+		if ( is_gemmt )
+		{
+			bli_obj_set_struc( is_syrkd ? BLIS_SYMMETRIC : BLIS_GENERAL, &c );
+			bli_obj_set_uplo( BLIS_LOWER, &c );
+		}
+
+		double dtime_gd   = DBL_MAX;
+		double dtime_conv = DBL_MAX;
+
+		for ( int r = 0; r < n_repeats; ++r )
+		{
+			bli_copym( &c_save, &c );
+
+			double dtime = bli_clock();
+
+			if      ( is_syrkd ) bao_syrkd( &BLIS_ONE, &a, &d, &BLIS_ONE, &c );
+			else if ( is_gemmt ) bao_gemmtd( &BLIS_ONE, &a, &d, &b, &BLIS_ONE, &c );
+			else                 bao_gemmd( &BLIS_ONE, &a, &d, &b, &BLIS_ONE, &c );
+
+			dtime_gd = bli_clock_min_diff( dtime_gd, dtime );
+
+			bli_copym( &c_save, &c );
+
+			dtime = bli_clock();
+
+			// Apply diag(d) to the columns of A, or to the rows of B.
+			for ( dim_t l = 0; l < k; ++l )
+			{
+				obj_t dl, x, tx;
+
+				bli_acquire_vi( l, &d, &dl );
+
+				if ( is_syrkd )
+				{
+					bli_acquire_mpart( 0, l, m, 1, &a, &x );
+					bli_acquire_mpart( 0, l, m, 1, &t, &tx );
+				}
+				else
+				{
+					bli_acquire_mpart( l, 0, 1, n, &b, &x );
+					bli_acquire_mpart( l, 0, 1, n, &t, &tx );
+				}
+
+				bli_scal2v( &dl, &x, &tx );
+			}
+
+			if      ( is_syrkd ) bli_gemmt( &BLIS_ONE, &t, &at, &BLIS_ONE, &c );
+			else if ( is_gemmt ) bli_gemmt( &BLIS_ONE, &a, &t, &BLIS_ONE, &c );
+			else                 bli_gemm( &BLIS_ONE, &a, &t, &BLIS_ONE, &c );
+
+			dtime_conv = bli_clock_min_diff( dtime_conv, dtime );
+		}
+
+		// Keep the conventional result and recompute that of the addon.
+		// Comparing all of C also checks that gemmtd and syrkd leave the
+		// strictly upper triangle untouched.
+		bli_copym( &c_dense, &c_conv );
+		bli_copym( &c_save, &c_dense );
+
+		if      ( is_syrkd ) bao_syrkd( &BLIS_ONE, &a, &d, &BLIS_ONE, &c );
+		else if ( is_gemmt ) bao_gemmtd( &BLIS_ONE, &a, &d, &b, &BLIS_ONE, &c );
+		else                 bao_gemmd( &BLIS_ONE, &a, &d, &b, &BLIS_ONE, &c );
+
+		// Since the elements of A, d, and B are at most one in magnitude,
+		// each element of the result may differ by about (k+1) eps ( |c| + k ).
+		obj_t norm;
+		bli_obj_scalar_init_detached( bli_dt_proj_to_real( dt ), &norm );
+
+		double norm_c, norm_d, dummy;
+		bli_normfm( &c_save, &norm );
+		bli_getsc( &norm, &norm_c, &dummy );
+
+		bli_subm( &c_dense, &c_conv );
+		bli_normfm( &c_conv, &norm );
+		bli_getsc( &norm, &norm_d, &dummy );
+
+		const double tol = 2.0 * ( k + 1 ) * eps *
+		                   ( norm_c + k * sqrt( ( double )m * n ) );
+
+		if ( !( norm_d <= tol ) )
+		{
+			printf( "FAIL: %c%s p=%lu: ||C_addon - C_conv|| = %g\n",
+			        dt_ch, op, ( unsigned long )p, norm_d );
+			n_fail += 1;
+		}
+
+		// Only one triangle of C is computed by gemmtd and syrkd.
+		double flops = ( is_gemmt ? 1.0 : 2.0 ) * m * n * k;
+		if ( bli_is_complex( dt ) ) flops *= 4.0;
+
+		printf( "data_%c%s( %4lu, 1:3 ) = [ %5lu %8.2f %8.2f ];\n",
+		        dt_ch, op,
+		        ( unsigned long )( ( p - p_begin ) / p_inc + 1 ),
+		        ( unsigned long )p,
+		        flops / ( dtime_gd   * 1.0e9 ),
+		        flops / ( dtime_conv * 1.0e9 ) );
+		fflush( stdout );
+
+		bli_obj_free( &a );
+		bli_obj_free( &d );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_save );
+		bli_obj_free( &c_conv );
+		bli_obj_free( &t );
+	}
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
+
@@ -0,0 +1,279 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <math.h>
+#include "blis.h"
+
+//
+// Correctness test for the gemmtrsm microkernels registered in the context
+// of the active configuration. For each datatype, each of the lower and
+// upper microkernels, several values of k (including zero and a value large
+// enough to exercise the unrolled k loop of the gemm microkernel), full and
+// partial micro-tiles, C stored by rows and by columns, and a real and a
+// complex alpha, the microkernel is called on packed micropanels and the
+// updated B11 and C11 are compared with a scalar implementation of
+//
+//   B11 := inv(A11) * ( alpha * B11 - A1x * Bx1 ),  C11 := B11
+//
+// The elements of C outside of the m x n micro-tile must not be modified.
+// The micropanels are laid out as the trsm macrokernel packs them (A1x
+// followed by A11 for the lower microkernel, A11 followed by A12 for the
+// upper one, and likewise for B), and the test assumes that the elements
+// of B are not duplicated (BBN = 1).
+//
+// Usage: test_gemmtrsm_ukr.x
+//
+// The program exits with a non-zero status if any case fails.
+//
+
+int main( int argc, char** argv )
+{
+	const num_t  dts[]    = { BLIS_FLOAT, BLIS_DOUBLE,
+	                          BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const dim_t  ks[]     = { 0, 1, 3, 16, 257 };
+	const double alphas[][2] =
+	{
+		{  1.0,  0.0 },
+		{ -0.5,  0.75 },
+	};
+
+	const int n_ks     = sizeof( ks ) / sizeof( ks[0] );
+	const int n_alphas = sizeof( alphas ) / sizeof( alphas[0] );
+
+	const cntx_t* cntx = bli_gks_query_cntx();
+
+	int n_cases = 0, n_fail = 0;
+
+	for ( int id = 0; id < 4; ++id )
+	for ( int iu = 0; iu < 2; ++iu )
+	for ( int ik = 0; ik < n_ks; ++ik )
+	for ( int ie = 0; ie < 3; ++ie )
+	for ( int is = 0; is < 2; ++is )
+	for ( int ia = 0; ia < n_alphas; ++ia )
+	{
+		const num_t dt    = dts[ id ];
+		const bool  upper = ( iu == 1 );
+		const dim_t k     = ks[ ik ];
+
+		const dim_t mr     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+		const dim_t nr     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+		const dim_t packmr = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx );
+		const dim_t packnr = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx );
+
+		// Test a full micro-tile and two partial ones.
+		const dim_t m = ( ie == 0 ? mr : ( ie == 1 ? mr - 1 : 1 ) );
+		const dim_t n = ( ie == 0 ? nr : ( ie == 1 ? 1 : nr - 1 ) );
+
+		const double alpha_r = alphas[ ia ][0];
+		const double alpha_i = ( bli_is_complex( dt ) ? alphas[ ia ][1] : 0.0 );
+		const double eps     = ( bli_dt_prec_is_single( dt ) ? FLT_EPSILON
+		                                                    : DBL_EPSILON );
+
+		gemmtrsm_ukr_ft gemmtrsm_ukr = bli_cntx_get_ukr_dt
+		(
+		  dt, ( upper ? BLIS_GEMMTRSM_U_UKR : BLIS_GEMMTRSM_L_UKR ), cntx
+		);
+
+		// The packed micropanels of A (packmr x (k + mr)) and B
+		// ((k + mr) x packnr), and a micro-tile of C with padded strides.
+		obj_t ap, bp, bp0, c, c0, alpha;
+
+		bli_obj_create( dt, packmr, k + mr, 1, packmr, &ap );
+		bli_obj_create( dt, k + mr, packnr, packnr, 1, &bp );
+		bli_obj_create( dt, k + mr, packnr, packnr, 1, &bp0 );
+
+		if ( is == 0 )
+		{
+			bli_obj_create( dt, mr, nr, 1, mr + 3, &c );
+			bli_obj_create( dt, mr, nr, 1, mr + 3, &c0 );
+		}
+		else
+		{
+			bli_obj_create( dt, mr, nr, nr + 2, 1, &c );
+			bli_obj_create( dt, mr, nr, nr + 2, 1, &c0 );
+		}
+
+		bli_randm( &ap );
+		bli_randm( &bp0 );
+		bli_randm( &c0 );
+
+		// Column (row) offsets of A11 and A1x (B11 and Bx1) in the panels.
+		const dim_t off11 = ( upper ? 0 : k );
+		const dim_t off1x = ( upper ? mr : 0 );
+
+		// Give A11 a dominant diagonal. Store its inverse if the packing
+		// routine would do so.
+		for ( dim_t i = 0; i < mr; ++i )
+		{
+			double dr = 2.0 + 0.25 * i;
+			double di = ( bli_is_complex( dt ) ? 0.5 : 0.0 );
+#ifdef BLIS_ENABLE_TRSM_PREINVERSION
+			const double s = dr * dr + di * di;
+			dr =  dr / s;
+			di = -di / s;
+#endif
+			bli_setijm( dr, di, i, off11 + i, &ap );
+		}
+
+		bli_copym( &bp0, &bp );
+		bli_copym( &c0, &c );
+
+		bli_obj_scalar_init_detached( dt, &alpha );
+		bli_setsc( alpha_r, alpha_i, &alpha );
+
+		const siz_t dt_size = bli_dt_size( dt );
+		char* buf_a = bli_obj_buffer( &ap );
+		char* buf_b = bli_obj_buffer( &bp );
+
+		auxinfo_t aux;
+		bli_auxinfo_set_next_ab( buf_a, buf_b, &aux );
+
+		gemmtrsm_ukr
+		(
+		  m,
+		  n,
+		  k,
+		  bli_obj_buffer_for_1x1( dt, &alpha ),
+		  buf_a + off1x * packmr * dt_size,
+		  buf_a + off11 * packmr * dt_size,
+		  buf_b + off1x * packnr * dt_size,
+		  buf_b + off11 * packnr * dt_size,
+		  bli_obj_buffer( &c ),
+		  bli_obj_row_stride( &c ),
+		  bli_obj_col_stride( &c ),
+		  &aux,
+		  ( cntx_t* )cntx
+		);
+
+		bool ok = TRUE;
+
+		// Compute alpha * B11 - A1x * Bx1 and solve with A11, one column at
+		// a time.
+		for ( dim_t j = 0; j < nr; ++j )
+		{
+			double xr[ mr ], xi[ mr ];
+			double mag = 1.0;
+
+			for ( dim_t i = 0; i < mr; ++i )
+			{
+				double br, bi;
+				bli_getijm( off11 + i, j, &bp0, &br, &bi );
+
+				xr[ i ] = alpha_r * br - alpha_i * bi;
+				xi[ i ] = alpha_r * bi + alpha_i * br;
+
+				for ( dim_t l = 0; l < k; ++l )
+				{
+					double ar, ai, blr, bli;
+					bli_getijm( i, off1x + l, &ap, &ar, &ai );
+					bli_getijm( off1x + l, j, &bp0, &blr, &bli );
+
+					xr[ i ] -= ar * blr - ai * bli;
+					xi[ i ] -= ar * bli + ai * blr;
+				}
+
+				mag = bli_fmax( mag, hypot( xr[ i ], xi[ i ] ) );
+			}
+
+			for ( dim_t ii = 0; ii < mr; ++ii )
+			{
+				const dim_t i = ( upper ? mr - 1 - ii : ii );
+
+				for ( dim_t jj = 0; jj < ii; ++jj )
+				{
+					const dim_t p = ( upper ? mr - 1 - jj : jj );
+					double ar, ai;
+					bli_getijm( i, off11 + p, &ap, &ar, &ai );
+
+					xr[ i ] -= ar * xr[ p ] - ai * xi[ p ];
+					xi[ i ] -= ar * xi[ p ] + ai * xr[ p ];
+				}
+
+				double dr, di;
+				bli_getijm( i, off11 + i, &ap, &dr, &di );
+#ifndef BLIS_ENABLE_TRSM_PREINVERSION
+				const double s = dr * dr + di * di;
+				dr =  dr / s;
+				di = -di / s;
+#endif
+				const double tr = xr[ i ] * dr - xi[ i ] * di;
+				xi[ i ] = xr[ i ] * di + xi[ i ] * dr;
+				xr[ i ] = tr;
+			}
+
+			const double tol = 8.0 * ( k + mr ) * eps * mag;
+
+			for ( dim_t i = 0; i < mr; ++i )
+			{
+				double br, bi, cr, ci, c0r, c0i;
+				bli_getijm( off11 + i, j, &bp, &br, &bi );
+				bli_getijm( i, j, &c,  &cr,  &ci );
+				bli_getijm( i, j, &c0, &c0r, &c0i );
+
+				if ( !( hypot( br - xr[ i ], bi - xi[ i ] ) <= tol ) ) ok = FALSE;
+
+				if ( i < m && j < n )
+				{
+					if ( !( hypot( cr - xr[ i ], ci - xi[ i ] ) <= tol ) ) ok = FALSE;
+				}
+				else
+				{
+					if ( cr != c0r || ci != c0i ) ok = FALSE;
+				}
+			}
+		}
+
+		if ( !ok )
+		{
+			printf( "FAIL: dt=%c uplo=%c k=%ld m=%ld n=%ld stor(c)=%c "
+			        "alpha=(%g,%g)\n",
+			        "sdcz"[ id ], upper ? 'u' : 'l', ( long )k, ( long )m,
+			        ( long )n, is ? 'r' : 'c', alpha_r, alpha_i );
+			n_fail += 1;
+		}
+
+		n_cases += 1;
+
+		bli_obj_free( &ap );
+		bli_obj_free( &bp );
+		bli_obj_free( &bp0 );
+		bli_obj_free( &c );
+		bli_obj_free( &c0 );
+	}
+
+	printf( "%d cases, %d failed\n", n_cases, n_fail );
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
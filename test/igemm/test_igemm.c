@@ -0,0 +1,428 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <math.h>
+#include "blis.h"
+
+//
+// Correctness test for the integer gemm operations bli_u8s8gemm(),
+// bli_i16gemm(), and bli_u8s8gemm_rq(). Each result is compared exactly
+// with a reference computed in 64-bit integers (and wrapped to 32 bits, as
+// all integer arithmetic in the operations wraps on overflow). The test
+// covers:
+//
+// - k not a multiple of the k grouping of the microkernels (four for u8 x s8
+//   and two for s16 x s16), and m and n that are not multiples of MR and NR.
+// - Transposed operands and column- or row-major storage of A, B, and C.
+// - The requantizing variant with k larger than one KC block (in which case
+//   partial sums are kept in a workspace), with per-channel and per-tensor
+//   scale, with and without bias, and with a narrowed clipping range.
+// - u8 x s8 products with elements of B both within and outside [-64, 64].
+//   The former are computed with pair sums saturated to 16 bits (as with
+//   vpmaddubsw), which cannot saturate in that range; for the latter, the
+//   implementation must avoid saturation, so the extreme case of A = 255
+//   and B = 127 (or -128) is checked explicitly.
+//
+// Usage: test_igemm.x
+//
+// The program exits with a non-zero status if any case fails.
+//
+
+// A simple linear congruential generator, so that the test is repeatable.
+static uint32_t rand_state = 1;
+
+static int32_t rand_int( int32_t lo, int32_t hi )
+{
+	rand_state = rand_state * 1664525u + 1013904223u;
+
+	return lo + ( int32_t )( ( rand_state >> 8 ) % ( uint32_t )( hi - lo + 1 ) );
+}
+
+// Return the row and column strides of an m x n matrix stored by columns
+// ('c') or by rows ('r').
+static void get_strides( dim_t m, dim_t n, char stor, inc_t* rs, inc_t* cs )
+{
+	if ( stor == 'c' ) { *rs = 1; *cs = bli_max( m, 1 ); }
+	else               { *rs = bli_max( n, 1 ); *cs = 1; }
+}
+
+// Compute the reference product A * B in int64 for an m x n x k problem
+// whose A (B) elements are given by the callbacks below, and wrap to int32.
+typedef int32_t (*get_ft)( const void* x, inc_t rs, inc_t cs, dim_t i, dim_t j );
+
+static int32_t get_u8 ( const void* x, inc_t rs, inc_t cs, dim_t i, dim_t j )
+{ return ( ( const uint8_t* )x )[ i*rs + j*cs ]; }
+static int32_t get_s8 ( const void* x, inc_t rs, inc_t cs, dim_t i, dim_t j )
+{ return ( ( const int8_t*  )x )[ i*rs + j*cs ]; }
+static int32_t get_s16( const void* x, inc_t rs, inc_t cs, dim_t i, dim_t j )
+{ return ( ( const int16_t* )x )[ i*rs + j*cs ]; }
+
+static void ref_gemm
+     (
+       trans_t     transa,
+       trans_t     transb,
+       dim_t       m,
+       dim_t       n,
+       dim_t       k,
+       get_ft      get_a,
+       const void* a, inc_t rs_a, inc_t cs_a,
+       get_ft      get_b,
+       const void* b, inc_t rs_b, inc_t cs_b,
+       int32_t*    ab
+     )
+{
+	if ( bli_does_trans( transa ) ) bli_swap_incs( &rs_a, &cs_a );
+	if ( bli_does_trans( transb ) ) bli_swap_incs( &rs_b, &cs_b );
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		int64_t sum = 0;
+
+		for ( dim_t l = 0; l < k; ++l )
+			sum += ( int64_t )get_a( a, rs_a, cs_a, i, l ) *
+			       ( int64_t )get_b( b, rs_b, cs_b, l, j );
+
+		ab[ i + j*m ] = ( int32_t )( uint32_t )( uint64_t )sum;
+	}
+}
+
+// Compute beta * c0 + alpha * ab with wraparound.
+static int32_t axpby_wrap( int32_t alpha, int32_t ab, int32_t beta, int32_t c0 )
+{
+	return ( int32_t )( ( uint32_t )alpha * ( uint32_t )ab +
+	                    ( uint32_t )beta  * ( uint32_t )c0 );
+}
+
+// Requantize one element as documented in bli_igemm.h.
+static int8_t requant( int32_t c, dim_t j, const rqnt_t* rq )
+{
+	const float   scale = rq->scale[ j * rq->inc_scale ];
+	const int32_t bias  = ( rq->bias != NULL ? rq->bias[ j ] : 0 );
+
+	float v = nearbyintf( ( float )( ( int64_t )c + bias ) * scale ) +
+	          ( float )rq->zero_point;
+
+	v = bli_min( bli_max( v, ( float )rq->clip_min ), ( float )rq->clip_max );
+
+	return ( int8_t )v;
+}
+
+// Fill an m x n matrix of es-byte elements with random values in [lo, hi].
+static void* create_rand( siz_t es, dim_t m, dim_t n, int32_t lo, int32_t hi )
+{
+	const dim_t len = bli_max( m * n, 1 );
+	char*       x   = malloc( len * es );
+
+	for ( dim_t i = 0; i < len; ++i )
+	{
+		const int32_t v = rand_int( lo, hi );
+
+		if      ( es == 1 && lo >= 0 ) ( ( uint8_t* )x )[ i ] = ( uint8_t )v;
+		else if ( es == 1 )            ( ( int8_t*  )x )[ i ] = ( int8_t  )v;
+		else if ( es == 2 )            ( ( int16_t* )x )[ i ] = ( int16_t )v;
+		else                           ( ( int32_t* )x )[ i ] = v;
+	}
+
+	return x;
+}
+
+static int n_cases = 0, n_fail = 0;
+
+static void report( bool ok, const char* op, char ta, char tb,
+                    const char* stor, dim_t m, dim_t n, dim_t k, const char* what )
+{
+	if ( !ok )
+	{
+		printf( "FAIL: %s trans=%c%c stor(c,a,b)=%s m=%ld n=%ld k=%ld %s\n",
+		        op, ta, tb, stor, ( long )m, ( long )n, ( long )k, what );
+		n_fail += 1;
+	}
+
+	n_cases += 1;
+}
+
+// Test bli_u8s8gemm() or bli_i16gemm() for one problem.
+static void test_gemm
+     (
+       bool        is_u8s8,
+       trans_t     transa,
+       trans_t     transb,
+       const char* stor,
+       dim_t       m,
+       dim_t       n,
+       dim_t       k,
+       int32_t     b_lo,
+       int32_t     b_hi,
+       int32_t     alpha,
+       int32_t     beta
+     )
+{
+	const siz_t es = ( is_u8s8 ? 1 : 2 );
+
+	dim_t m_a = m, n_a = k, m_b = k, n_b = n;
+	if ( bli_does_trans( transa ) ) bli_swap_dims( &m_a, &n_a );
+	if ( bli_does_trans( transb ) ) bli_swap_dims( &m_b, &n_b );
+
+	inc_t rs_c, cs_c, rs_a, cs_a, rs_b, cs_b;
+	get_strides( m,   n,   stor[0], &rs_c, &cs_c );
+	get_strides( m_a, n_a, stor[1], &rs_a, &cs_a );
+	get_strides( m_b, n_b, stor[2], &rs_b, &cs_b );
+
+	void*    a  = create_rand( es, m_a, n_a, is_u8s8 ? 0 : INT16_MIN,
+	                                         is_u8s8 ? UINT8_MAX : INT16_MAX );
+	void*    b  = create_rand( es, m_b, n_b, b_lo, b_hi );
+	int32_t* c  = create_rand( 4, m, n, INT32_MIN / 2, INT32_MAX / 2 );
+	int32_t* c0 = malloc( bli_max( m * n, 1 ) * sizeof( int32_t ) );
+	int32_t* ab = malloc( bli_max( m * n, 1 ) * sizeof( int32_t ) );
+
+	memcpy( c0, c, bli_max( m * n, 1 ) * sizeof( int32_t ) );
+
+	get_ft get_a = ( is_u8s8 ? get_u8 : get_s16 );
+	get_ft get_b = ( is_u8s8 ? get_s8 : get_s16 );
+
+	ref_gemm( transa, transb, m, n, k, get_a, a, rs_a, cs_a,
+	          get_b, b, rs_b, cs_b, ab );
+
+	if ( is_u8s8 )
+		bli_u8s8gemm( transa, transb, m, n, k, &alpha, a, rs_a, cs_a,
+		              b, rs_b, cs_b, &beta, c, rs_c, cs_c );
+	else
+		bli_i16gemm( transa, transb, m, n, k, &alpha, a, rs_a, cs_a,
+		             b, rs_b, cs_b, &beta, c, rs_c, cs_c );
+
+	bool ok = TRUE;
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		const int32_t c0ij = c0[ i*rs_c + j*cs_c ];
+		const int32_t ref  = ( beta == 0 ? ( int32_t )( ( uint32_t )alpha *
+		                                                ( uint32_t )ab[ i + j*m ] )
+		                                 : axpby_wrap( alpha, ab[ i + j*m ], beta, c0ij ) );
+
+		if ( c[ i*rs_c + j*cs_c ] != ref ) ok = FALSE;
+	}
+
+	char what[ 64 ];
+	sprintf( what, "b in [%d,%d] alpha=%d beta=%d", ( int )b_lo, ( int )b_hi,
+	         ( int )alpha, ( int )beta );
+
+	report( ok, is_u8s8 ? "u8s8gemm" : "i16gemm",
+	        bli_does_trans( transa ) ? 't' : 'n',
+	        bli_does_trans( transb ) ? 't' : 'n', stor, m, n, k, what );
+
+	free( a ); free( b ); free( c ); free( c0 ); free( ab );
+}
+
+// Test bli_u8s8gemm_rq() for one problem.
+static void test_gemm_rq
+     (
+       trans_t     transa,
+       trans_t     transb,
+       const char* stor,
+       dim_t       m,
+       dim_t       n,
+       dim_t       k,
+       int32_t     b_lo,
+       int32_t     b_hi,
+       bool        per_channel,
+       bool        use_bias,
+       bool        relu
+     )
+{
+	dim_t m_a = m, n_a = k, m_b = k, n_b = n;
+	if ( bli_does_trans( transa ) ) bli_swap_dims( &m_a, &n_a );
+	if ( bli_does_trans( transb ) ) bli_swap_dims( &m_b, &n_b );
+
+	inc_t rs_q, cs_q, rs_a, cs_a, rs_b, cs_b;
+	get_strides( m,   n,   stor[0], &rs_q, &cs_q );
+	get_strides( m_a, n_a, stor[1], &rs_a, &cs_a );
+	get_strides( m_b, n_b, stor[2], &rs_b, &cs_b );
+
+	uint8_t* a  = create_rand( 1, m_a, n_a, 0, UINT8_MAX );
+	int8_t*  b  = create_rand( 1, m_b, n_b, b_lo, b_hi );
+	int8_t*  q  = malloc( bli_max( m * n, 1 ) );
+	int32_t* ab = malloc( bli_max( m * n, 1 ) * sizeof( int32_t ) );
+
+	// Choose scales that map the typical magnitude of the product (which
+	// grows as the square root of k) to roughly the int8 range, so that
+	// both rounding and clipping are exercised.
+	float*   scale = malloc( n * sizeof( float ) );
+	int32_t* bias  = malloc( n * sizeof( int32_t ) );
+
+	const float s0 = 100.0f / ( 128.0f * ( b_hi - b_lo ) * sqrtf( ( float )k ) );
+
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		scale[ j ] = s0 * ( 0.5f + ( float )rand_int( 0, 100 ) / 100.0f );
+		bias[ j ]  = rand_int( -1000, 1000 ) * ( dim_t )k;
+	}
+
+	rqnt_t rq;
+	bli_rqnt_init( scale, per_channel ? 1 : 0, use_bias ? bias : NULL, -3, &rq );
+	if ( relu ) rq.clip_min = rq.zero_point;
+
+	ref_gemm( transa, transb, m, n, k, get_u8, a, rs_a, cs_a,
+	          get_s8, b, rs_b, cs_b, ab );
+
+	bli_u8s8gemm_rq( transa, transb, m, n, k, a, rs_a, cs_a,
+	                 b, rs_b, cs_b, &rq, q, rs_q, cs_q );
+
+	bool ok = TRUE;
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+		if ( q[ i*rs_q + j*cs_q ] != requant( ab[ i + j*m ], j, &rq ) ) ok = FALSE;
+
+	char what[ 96 ];
+	sprintf( what, "b in [%d,%d] scale=%s bias=%s clip=%s", ( int )b_lo,
+	         ( int )b_hi, per_channel ? "channel" : "tensor",
+	         use_bias ? "yes" : "no", relu ? "relu" : "full" );
+
+	report( ok, "u8s8gemm_rq",
+	        bli_does_trans( transa ) ? 't' : 'n',
+	        bli_does_trans( transb ) ? 't' : 'n', stor, m, n, k, what );
+
+	free( a ); free( b ); free( q ); free( ab ); free( scale ); free( bias );
+}
+
+int main( int argc, char** argv )
+{
+	const trans_t transs[] = { BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE };
+	const char*   stors[]  = { "ccc", "rrr", "crc", "rcr" };
+	const dim_t   sizes[][3] =
+	{
+		{   1,   1,   1 },
+		{   5,  15,   3 },
+		{   6,  16,   4 },
+		{   7,  17,   5 },
+		{  12,  32,   2 },
+		{  13,  33,   7 },
+		{  17,   3,   9 },
+		{  50,  40,  67 },
+		{  97,  70, 130 },
+	};
+	const int32_t scalars[][2] =
+	{
+		{  1,  0 },
+		{  3, -2 },
+		{  0,  5 },
+	};
+
+	const dim_t n_sizes   = sizeof( sizes ) / sizeof( sizes[0] );
+	const dim_t n_scalars = sizeof( scalars ) / sizeof( scalars[0] );
+
+	// The KC blocksize for 8-bit operands (see bli_igemm_kc()), plus a
+	// remainder that is not a multiple of the k grouping.
+	const cntx_t* cntx = bli_gks_query_cntx();
+	const dim_t   kc8  = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_KC, cntx ) * 4;
+
+	for ( int ta = 0; ta < 2; ++ta )
+	for ( int tb = 0; tb < 2; ++tb )
+	for ( int is = 0; is < 4; ++is )
+	for ( dim_t iz = 0; iz < n_sizes; ++iz )
+	for ( dim_t ia = 0; ia < n_scalars; ++ia )
+	{
+		const dim_t m = sizes[ iz ][0];
+		const dim_t n = sizes[ iz ][1];
+		const dim_t k = sizes[ iz ][2];
+
+		const int32_t alpha = scalars[ ia ][0];
+		const int32_t beta  = scalars[ ia ][1];
+
+		// u8 x s8 with B in the range where pair sums cannot saturate, and
+		// with B over the full int8 range.
+		test_gemm( TRUE, transs[ ta ], transs[ tb ], stors[ is ], m, n, k,
+		           -64, 64, alpha, beta );
+		test_gemm( TRUE, transs[ ta ], transs[ tb ], stors[ is ], m, n, k,
+		           INT8_MIN, INT8_MAX, alpha, beta );
+
+		// s16 x s16 over the full int16 range (so sums wrap).
+		test_gemm( FALSE, transs[ ta ], transs[ tb ], stors[ is ], m, n, k,
+		           INT16_MIN, INT16_MAX, alpha, beta );
+	}
+
+	// Requantization, with k both within one KC block and spanning several.
+	const dim_t ks_rq[] = { 67, 2 * kc8 + 37 };
+
+	for ( int ta = 0; ta < 2; ++ta )
+	for ( int tb = 0; tb < 2; ++tb )
+	for ( int is = 0; is < 4; ++is )
+	for ( int ik = 0; ik < 2; ++ik )
+	for ( int ir = 0; ir < 2; ++ir )
+	for ( int opt = 0; opt < 4; ++opt )
+	{
+		const bool full_b = ( ir == 1 );
+
+		test_gemm_rq( transs[ ta ], transs[ tb ], stors[ is ], 23, 19, ks_rq[ ik ],
+		              full_b ? INT8_MIN : -64, full_b ? INT8_MAX : 64,
+		              opt & 1, opt & 2, opt == 3 );
+	}
+
+	// The extreme u8 x s8 pair sums, 2 * 255 * 127 and 2 * 255 * -128, exceed
+	// the int16 range. (The rest of B lies in [-64, 64].)
+	for ( int sign = 0; sign < 2; ++sign )
+	{
+		const dim_t   m = 6, n = 16, k = 4;
+		uint8_t       a[ 6 * 4 ];
+		int8_t        b[ 4 * 16 ];
+		int32_t       c[ 6 * 16 ];
+		const int32_t one = 1, zero = 0;
+		const int32_t bv  = ( sign ? INT8_MIN : INT8_MAX );
+
+		for ( dim_t i = 0; i < m * k; ++i ) a[ i ] = UINT8_MAX;
+		for ( dim_t i = 0; i < k * n; ++i ) b[ i ] = ( i < k ? bv : 1 );
+
+		bli_u8s8gemm( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, m, n, k,
+		              &one, a, 1, m, b, 1, k, &zero, c, 1, m );
+
+		bool ok = TRUE;
+
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			if ( c[ i ] != 4 * UINT8_MAX * bv ) ok = FALSE;
+			for ( dim_t j = 1; j < n; ++j )
+				if ( c[ i + j*m ] != 4 * UINT8_MAX ) ok = FALSE;
+		}
+
+		report( ok, "u8s8gemm", 'n', 'n', "ccc", m, n, k,
+		        sign ? "saturation (b = -128)" : "saturation (b = 127)" );
+	}
+
+	printf( "%d cases, %d failed\n", n_cases, n_fail );
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
@@ -0,0 +1,224 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <math.h>
+#include <stdlib.h>
+#include "blis.h"
+
+//
+// Correctness test for the task-parallel (DAG) trsm and trmm (see
+// frame/3/dag/bli_l3_dag.h). For each operation, side, uplo, and trans, a
+// problem whose triangular matrix spans at least three tiles of
+// BLIS_L3_DAG_BLKSZ (with a partial last tile), and whose general matrix
+// spans two tiles in the other dimension, is computed with several threads,
+// once with the DAG implementation and once with it disabled via the
+// environment variable BLIS_L3_DAG=0. The two results must agree to within
+// rounding error. The triangle of A that is not referenced is filled with
+// NaN, so that any read of it shows up in the result.
+//
+// If BLIS was configured with --enable-trace, the test also checks that
+// each problem was computed by the DAG implementation only when it was
+// enabled.
+//
+// Usage: test_l3_dag.x [nt]
+//
+//   nt  is the number of threads (default 4)
+//
+// The program exits with a non-zero status if any case fails.
+//
+
+static double max_abs( const obj_t* x )
+{
+	double amax = 0.0;
+
+	for ( dim_t j = 0; j < bli_obj_width( x ); ++j )
+	for ( dim_t i = 0; i < bli_obj_length( x ); ++i )
+	{
+		double re, im;
+		bli_getijm( i, j, x, &re, &im );
+		amax = bli_max( amax, fabs( re ) );
+	}
+
+	return amax;
+}
+
+// Return the maximum absolute difference between x and y, or Inf if either
+// contains a NaN.
+static double max_diff( const obj_t* x, const obj_t* y )
+{
+	double dmax = 0.0;
+
+	for ( dim_t j = 0; j < bli_obj_width( x ); ++j )
+	for ( dim_t i = 0; i < bli_obj_length( x ); ++i )
+	{
+		double xr, yr, im;
+		bli_getijm( i, j, x, &xr, &im );
+		bli_getijm( i, j, y, &yr, &im );
+
+		const double d = fabs( xr - yr );
+		if ( !( d <= dmax ) ) dmax = ( isnan( d ) ? INFINITY : d );
+	}
+
+	return dmax;
+}
+
+int main( int argc, char** argv )
+{
+	const dim_t nt = ( argc > 1 ? atoi( argv[1] ) : 4 );
+
+	const num_t  dt    = BLIS_DOUBLE;
+	const dim_t  bs    = BLIS_L3_DAG_BLKSZ;
+	const dim_t  m_tri = 3 * bs + 37;
+	const dim_t  n_gen = bs + 44;
+	const double eps   = DBL_EPSILON;
+
+	const opid_t  ops[]    = { BLIS_TRSM, BLIS_TRMM };
+	const side_t  sides[]  = { BLIS_LEFT, BLIS_RIGHT };
+	const uplo_t  uplos[]  = { BLIS_LOWER, BLIS_UPPER };
+	const trans_t transs[] = { BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE };
+
+	const bool use_trace = ( bli_info_get_enable_trace() != 0 );
+
+	if ( use_trace ) bli_trace_enable();
+
+	rntm_t rntm;
+	bli_rntm_init_from_global( &rntm );
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	if ( bli_rntm_thread_impl( &rntm ) == BLIS_SINGLE )
+		printf( "Note: BLIS was configured without multithreading, so the "
+		        "DAG implementation is never used.\n" );
+
+	obj_t alpha;
+	bli_obj_scalar_init_detached( dt, &alpha );
+	bli_setsc( -0.75, 0.0, &alpha );
+
+	int n_cases = 0, n_fail = 0;
+
+	for ( int io = 0; io < 2; ++io )
+	for ( int is = 0; is < 2; ++is )
+	for ( int iu = 0; iu < 2; ++iu )
+	for ( int it = 0; it < 2; ++it )
+	{
+		const opid_t op   = ops[ io ];
+		const side_t side = sides[ is ];
+		const uplo_t uplo = uplos[ iu ];
+
+		const dim_t m = ( bli_is_left( side ) ? m_tri : n_gen );
+		const dim_t n = ( bli_is_left( side ) ? n_gen : m_tri );
+
+		obj_t a, b0, b_dag, b_ref;
+
+		bli_obj_create( dt, m_tri, m_tri, 0, 0, &a );
+		bli_obj_create( dt, m, n, 0, 0, &b0 );
+		bli_obj_create( dt, m, n, 0, 0, &b_dag );
+		bli_obj_create( dt, m, n, 0, 0, &b_ref );
+
+		// Make A diagonally dominant, and fill the triangle that must not be
+		// read with NaN.
+		obj_t shift;
+		bli_obj_scalar_init_detached( dt, &shift );
+		bli_setsc( ( double )m_tri, 0.0, &shift );
+
+		bli_randm( &a );
+		bli_shiftd( &shift, &a );
+
+		bli_obj_set_struc( BLIS_TRIANGULAR, &a );
+		bli_obj_set_uplo( bli_is_lower( uplo ) ? BLIS_UPPER : BLIS_LOWER, &a );
+		bli_obj_set_diag_offset( bli_is_lower( uplo ) ? 1 : -1, &a );
+		bli_setm( &BLIS_NAN, &a );
+		bli_obj_set_diag_offset( 0, &a );
+		bli_obj_set_uplo( uplo, &a );
+		bli_obj_set_onlytrans( transs[ it ], &a );
+
+		bli_randm( &b0 );
+
+		trace_counters_t t0, t1, t2;
+		if ( use_trace ) bli_trace_query_counters( &t0 );
+
+		// Compute the result with the DAG implementation enabled and then
+		// disabled.
+		obj_t* bs_out[ 2 ] = { &b_dag, &b_ref };
+
+		for ( int id = 0; id < 2; ++id )
+		{
+			setenv( "BLIS_L3_DAG", id == 0 ? "1" : "0", 1 );
+
+			bli_copym( &b0, bs_out[ id ] );
+
+			if ( op == BLIS_TRSM )
+				bli_trsm_ex( side, &alpha, &a, bs_out[ id ], NULL, &rntm );
+			else
+				bli_trmm_ex( side, &alpha, &a, bs_out[ id ], NULL, &rntm );
+
+			if ( use_trace ) bli_trace_query_counters( id == 0 ? &t1 : &t2 );
+		}
+
+		// The computation is well conditioned, so the results may differ by
+		// a modest multiple of the rounding error.
+		const double scale = bli_max( max_abs( &b_ref ), max_abs( &b0 ) );
+		const double diff  = max_diff( &b_dag, &b_ref );
+
+		bool ok = ( diff <= 4.0 * m_tri * eps * scale );
+
+		if ( use_trace &&
+		     ( t1.calls[ BLIS_TRACE_DAG ] != t0.calls[ BLIS_TRACE_DAG ] + 1 ||
+		       t2.calls[ BLIS_TRACE_DAG ] != t1.calls[ BLIS_TRACE_DAG ] ) )
+			ok = FALSE;
+
+		if ( !ok )
+		{
+			printf( "FAIL: %s side=%c uplo=%c trans=%c m=%ld n=%ld diff=%g\n",
+			        op == BLIS_TRSM ? "trsm" : "trmm",
+			        bli_is_left( side ) ? 'l' : 'r',
+			        bli_is_lower( uplo ) ? 'l' : 'u',
+			        bli_does_trans( transs[ it ] ) ? 't' : 'n',
+			        ( long )m, ( long )n, diff );
+			n_fail += 1;
+		}
+
+		n_cases += 1;
+
+		bli_obj_free( &a );
+		bli_obj_free( &b0 );
+		bli_obj_free( &b_dag );
+		bli_obj_free( &b_ref );
+	}
+
+	printf( "%d cases with %ld threads, %d failed%s\n", n_cases, ( long )nt,
+	        n_fail, use_trace ? "" : " (trace counters not checked)" );
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
@@ -0,0 +1,293 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <math.h>
+#include "blis.h"
+
+//
+// Correctness test for the half-precision gemm operations bli_sbgemm(),
+// bli_shgemm(), bli_bbgemm(), and bli_hhgemm(), and for bli_gemm() with
+// half-precision objects. Since these widen A and B to float and compute in
+// float, each result is compared with bli_sgemm() applied to float copies
+// of the (exactly representable) inputs:
+//
+// - For float C, the results must agree to within a rounding error bound
+//   proportional to k (the order of summation may differ).
+// - For half-precision C, the float result is rounded once to the datatype
+//   of C, so each element must be the correctly rounded (to nearest, ties to
+//   even) value of the float reference, except where the reference lies so
+//   close to a rounding boundary that the float rounding error could tip
+//   it either way.
+//
+// The test covers no-transpose and transpose of A and B, column- and row-
+// major C, m, n, and k between 1 and 257 (including values that are not
+// multiples of the register blocksizes and k larger than KC), and zero and
+// non-zero beta. The object API results must match those of the typed API
+// exactly.
+//
+// Usage: test_lpgemm.x
+//
+// The program exits with a non-zero status if any case fails.
+//
+
+// Conversions between float and the half-precision datatype 'b' (bfloat16)
+// or 'h' (float16), where elements are stored as uint16_t.
+static float half_to_float( char dt, uint16_t x )
+{
+	if ( dt == 'b' ) { bfloat16 y; y.v = x; return bli_bf16_to_float( y ); }
+	else             { float16  y; y.v = x; return bli_f16_to_float( y );  }
+}
+
+static uint16_t float_to_half( char dt, float x )
+{
+	if ( dt == 'b' ) return bli_float_to_bf16( x ).v;
+	else             return bli_float_to_f16( x ).v;
+}
+
+static float rand_float( void )
+{
+	return ( float )( 2.0 * ( ( double )rand() / RAND_MAX ) - 1.0 );
+}
+
+static int n_cases = 0, n_fail = 0;
+
+// Test one problem with C stored in float (chc = 's') or in the half-
+// precision datatype chab of A and B.
+static void test_lpgemm
+     (
+       char    chc,
+       char    chab,
+       trans_t transa,
+       trans_t transb,
+       char    storc,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       float   alpha,
+       float   beta
+     )
+{
+	dim_t m_a = m, n_a = k, m_b = k, n_b = n;
+	if ( bli_does_trans( transa ) ) bli_swap_dims( &m_a, &n_a );
+	if ( bli_does_trans( transb ) ) bli_swap_dims( &m_b, &n_b );
+
+	// A and B are stored by columns; C by columns or rows.
+	const inc_t rs_a = 1, cs_a = m_a;
+	const inc_t rs_b = 1, cs_b = m_b;
+	const inc_t rs_c = ( storc == 'c' ? 1 : n );
+	const inc_t cs_c = ( storc == 'c' ? m : 1 );
+
+	uint16_t* a_h  = malloc( m_a * n_a * sizeof( uint16_t ) );
+	uint16_t* b_h  = malloc( m_b * n_b * sizeof( uint16_t ) );
+	uint16_t* c_h  = malloc( m * n * sizeof( uint16_t ) );
+	uint16_t* c_ho = malloc( m * n * sizeof( uint16_t ) );
+	float*    a_f  = malloc( m_a * n_a * sizeof( float ) );
+	float*    b_f  = malloc( m_b * n_b * sizeof( float ) );
+	float*    c_f  = malloc( m * n * sizeof( float ) );
+	float*    c_fo = malloc( m * n * sizeof( float ) );
+	float*    c_r  = malloc( m * n * sizeof( float ) );
+	float*    c0   = malloc( m * n * sizeof( float ) );
+
+	// Generate values that are exactly representable in the half-precision
+	// datatype, so that the float copies hold the same values.
+	for ( dim_t i = 0; i < m_a * n_a; ++i )
+	{
+		a_h[ i ] = float_to_half( chab, rand_float() );
+		a_f[ i ] = half_to_float( chab, a_h[ i ] );
+	}
+	for ( dim_t i = 0; i < m_b * n_b; ++i )
+	{
+		b_h[ i ] = float_to_half( chab, rand_float() );
+		b_f[ i ] = half_to_float( chab, b_h[ i ] );
+	}
+	for ( dim_t i = 0; i < m * n; ++i )
+	{
+		// When beta is zero, C must not be read, so fill it with NaN.
+		const float v = ( beta == 0.0f ? NAN : rand_float() );
+
+		c_h[ i ] = c_ho[ i ] = float_to_half( chab, v );
+		c_f[ i ] = c_fo[ i ] = ( chc == 's' ? v : half_to_float( chab, c_h[ i ] ) );
+		c_r[ i ] = c0[ i ] = ( beta == 0.0f ? 0.0f : c_f[ i ] );
+	}
+
+	// Compute the reference in float.
+	bli_sgemm( transa, transb, m, n, k, &alpha, a_f, rs_a, cs_a,
+	           b_f, rs_b, cs_b, &beta, c_r, rs_c, cs_c );
+
+	// Call the typed API.
+	const bfloat16* a_b = ( const bfloat16* )a_h;
+	const bfloat16* b_b = ( const bfloat16* )b_h;
+	const float16*  a_s = ( const float16*  )a_h;
+	const float16*  b_s = ( const float16*  )b_h;
+
+	if ( chc == 's' && chab == 'b' )
+		bli_sbgemm( transa, transb, m, n, k, &alpha, a_b, rs_a, cs_a,
+		            b_b, rs_b, cs_b, &beta, c_f, rs_c, cs_c );
+	else if ( chc == 's' )
+		bli_shgemm( transa, transb, m, n, k, &alpha, a_s, rs_a, cs_a,
+		            b_s, rs_b, cs_b, &beta, c_f, rs_c, cs_c );
+	else if ( chab == 'b' )
+		bli_bbgemm( transa, transb, m, n, k, &alpha, a_b, rs_a, cs_a,
+		            b_b, rs_b, cs_b, &beta, ( bfloat16* )c_h, rs_c, cs_c );
+	else
+		bli_hhgemm( transa, transb, m, n, k, &alpha, a_s, rs_a, cs_a,
+		            b_s, rs_b, cs_b, &beta, ( float16* )c_h, rs_c, cs_c );
+
+	// Call the object API on fresh copies of C.
+	const num_t dt_ab = ( chab == 'b' ? BLIS_BFLOAT16 : BLIS_FLOAT16 );
+	const num_t dt_c  = ( chc == 's' ? BLIS_FLOAT : dt_ab );
+
+	obj_t a, b, c, alpha_o, beta_o;
+	bli_obj_create_with_attached_buffer( dt_ab, m_a, n_a, a_h, rs_a, cs_a, &a );
+	bli_obj_create_with_attached_buffer( dt_ab, m_b, n_b, b_h, rs_b, cs_b, &b );
+	bli_obj_create_with_attached_buffer( dt_c, m, n,
+	                                     chc == 's' ? ( void* )c_fo : ( void* )c_ho,
+	                                     rs_c, cs_c, &c );
+	bli_obj_set_onlytrans( transa, &a );
+	bli_obj_set_onlytrans( transb, &b );
+	bli_obj_create_1x1_with_attached_buffer( BLIS_FLOAT, &alpha, &alpha_o );
+	bli_obj_create_1x1_with_attached_buffer( BLIS_FLOAT, &beta,  &beta_o );
+
+	bli_gemm( &alpha_o, &a, &b, &beta_o, &c );
+
+	// Check the results.
+	const float eps_f = FLT_EPSILON;
+	bool        ok    = TRUE;
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		const dim_t ij = i*rs_c + j*cs_c;
+
+		// The float rounding error is bounded in terms of the sum of the
+		// magnitudes of the terms.
+		double mag = fabs( beta * c0[ ij ] );
+		for ( dim_t l = 0; l < k; ++l )
+		{
+			const float ail = ( bli_does_trans( transa ) ? a_f[ l + i*cs_a ] : a_f[ i + l*cs_a ] );
+			const float blj = ( bli_does_trans( transb ) ? b_f[ j + l*cs_b ] : b_f[ l + j*cs_b ] );
+			mag += fabs( alpha * ail * blj );
+		}
+		const double tol = 2.0 * ( k + 2 ) * eps_f * mag;
+
+		const double ref = c_r[ ij ];
+
+		if ( chc == 's' )
+		{
+			if ( !( fabs( c_f[ ij ] - ref ) <= tol ) ) ok = FALSE;
+			if ( memcmp( &c_f[ ij ], &c_fo[ ij ], sizeof( float ) ) != 0 ) ok = FALSE;
+		}
+		else
+		{
+			// The result must be as close to the reference as the correctly
+			// rounded reference is, up to the float rounding error.
+			const double cij = half_to_float( chab, c_h[ ij ] );
+			const double rnd = half_to_float( chab, float_to_half( chab, ( float )ref ) );
+
+			if ( !( fabs( cij - ref ) <= fabs( rnd - ref ) + tol ) ) ok = FALSE;
+			if ( c_h[ ij ] != c_ho[ ij ] ) ok = FALSE;
+		}
+	}
+
+	if ( !ok )
+	{
+		printf( "FAIL: %c%cgemm trans=%c%c storc=%c m=%ld n=%ld k=%ld "
+		        "alpha=%g beta=%g\n", chc, chab,
+		        bli_does_trans( transa ) ? 't' : 'n',
+		        bli_does_trans( transb ) ? 't' : 'n', storc,
+		        ( long )m, ( long )n, ( long )k, alpha, beta );
+		n_fail += 1;
+	}
+
+	n_cases += 1;
+
+	free( a_h ); free( b_h ); free( c_h ); free( c_ho );
+	free( a_f ); free( b_f ); free( c_f ); free( c_fo ); free( c_r ); free( c0 );
+}
+
+int main( int argc, char** argv )
+{
+	// The typed operations (C storage datatype, A and B storage datatype).
+	// The power10 sandbox provides its own bli_sbgemm() and bli_shgemm().
+	const char* ops[] =
+	{
+#ifndef BLIS_ENABLE_SANDBOX
+		"sb", "sh",
+#endif
+		"bb", "hh",
+	};
+	const dim_t sizes[][3] =
+	{
+		{   1,   1,   1 },
+		{   1, 257,   3 },
+		{ 257,   1,   5 },
+		{   6,  16,   2 },
+		{   7,  17, 257 },
+		{  33,  47,   1 },
+		{  16,   9, 100 },
+		{ 129,  65,  31 },
+		{ 257, 257, 257 },
+	};
+	const float scalars[][2] =
+	{
+		{  1.0f,  0.0f },
+		{ -0.5f,  1.5f },
+	};
+
+	const dim_t n_ops     = sizeof( ops ) / sizeof( ops[0] );
+	const dim_t n_sizes   = sizeof( sizes ) / sizeof( sizes[0] );
+	const dim_t n_scalars = sizeof( scalars ) / sizeof( scalars[0] );
+
+	srand( 1 );
+
+	for ( dim_t io = 0; io < n_ops; ++io )
+	for ( int ta = 0; ta < 2; ++ta )
+	for ( int tb = 0; tb < 2; ++tb )
+	for ( int sc = 0; sc < 2; ++sc )
+	for ( dim_t iz = 0; iz < n_sizes; ++iz )
+	for ( dim_t ia = 0; ia < n_scalars; ++ia )
+	{
+		test_lpgemm( ops[ io ][0], ops[ io ][1],
+		             ta ? BLIS_TRANSPOSE : BLIS_NO_TRANSPOSE,
+		             tb ? BLIS_TRANSPOSE : BLIS_NO_TRANSPOSE,
+		             sc ? 'r' : 'c',
+		             sizes[ iz ][0], sizes[ iz ][1], sizes[ iz ][2],
+		             scalars[ ia ][0], scalars[ ia ][1] );
+	}
+
+	printf( "%d cases, %d failed\n", n_cases, n_fail );
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
@@ -0,0 +1,331 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <math.h>
+#include <string.h>
+#include "blis.h"
+
+//
+// Performance driver for bao_pdist() and bao_pdist_topk() of the 'pdist'
+// addon. Each operation is also computed via the conventional approach, in
+// which the product -2 X Y^T is computed by bli_gemm() into the full m x n
+// matrix C, and then separate passes over C add the squared norms of the
+// points and apply the transform (or select the nearest neighbors of each
+// row). X and Y hold m = n points of dimension k as column-stored matrices.
+// The reported rates count only the 2mnk flops of the product. The number
+// of threads is set via BLIS_NUM_THREADS (or the other usual BLIS
+// environment variables).
+//
+// The result of the addon is also compared with that of the conventional
+// approach: each transformed distance must agree to within rounding
+// errors, and for knn, the distances of the neighbors must agree and each
+// index must refer to a point at the reported distance. If a check fails
+// for some size, FAIL is printed for that size and the program exits with
+// a non-zero status.
+//
+// Usage: test_pdist.x <sqeuclid|euclid|gaussian|laplacian|knn> <dt> <k> <p_begin> <p_max> <p_inc> <n_repeats>
+//
+//   dt  is one of s or d
+//
+// The kernel functions use unit bandwidth. For knn, the 16 nearest
+// neighbors (in the squared Euclidean distance) of each point are found.
+//
+
+#define KNN_T 16
+
+// Compute the squared norms of the m rows of the column-stored matrix X.
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTECH(ch,opname)( dim_t m, dim_t k, const ctype* x, inc_t cs_x, ctype* nrm ) \
+{ \
+	for ( dim_t i = 0; i < m; ++i ) nrm[ i ] = 0; \
+\
+	for ( dim_t l = 0; l < k; ++l ) \
+	for ( dim_t i = 0; i < m; ++i ) \
+		nrm[ i ] += x[ i + l*cs_x ] * x[ i + l*cs_x ]; \
+}
+
+GENTFUNC( float,  s, norms )
+GENTFUNC( double, d, norms )
+
+// Add the squared norms to the m x n matrix C := -2 X Y^T (stored by
+// columns) and apply the transform f with unit bandwidth.
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTECH(ch,opname)( bao_pdist_func_t func, dim_t m, dim_t n, const ctype* nx, const ctype* ny, ctype* c, inc_t cs_c ) \
+{ \
+	for ( dim_t j = 0; j < n; ++j ) \
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		ctype* cij = c + i + j*cs_c; \
+		ctype  d2  = bli_max( *cij + nx[ i ] + ny[ j ], ( ctype )0 ); \
+\
+		if      ( func == BAO_SQEUCLIDEAN ) *cij = d2; \
+		else if ( func == BAO_EUCLIDEAN )   *cij = sqrt( d2 ); \
+		else if ( func == BAO_GAUSSIAN )    *cij = exp( -d2 ); \
+		else                                *cij = exp( -sqrt( d2 ) ); \
+	} \
+}
+
+GENTFUNC( float,  s, finish )
+GENTFUNC( double, d, finish )
+
+// Select the t smallest entries of each row of C by insertion into a sorted
+// list.
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTECH(ch,opname)( dim_t m, dim_t n, dim_t t, const ctype* c, inc_t cs_c, ctype* dist, gint_t* idx ) \
+{ \
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		ctype*  di = dist + i*t; \
+		gint_t* ii = idx  + i*t; \
+\
+		for ( dim_t l = 0; l < t; ++l ) { di[ l ] = INFINITY; ii[ l ] = -1; } \
+\
+		for ( dim_t j = 0; j < n; ++j ) \
+		{ \
+			ctype cij = c[ i + j*cs_c ]; \
+\
+			if ( cij >= di[ t - 1 ] ) continue; \
+\
+			dim_t l = t - 1; \
+			for ( ; 0 < l && cij < di[ l - 1 ]; --l ) \
+			{ \
+				di[ l ] = di[ l - 1 ]; \
+				ii[ l ] = ii[ l - 1 ]; \
+			} \
+			di[ l ] = cij; \
+			ii[ l ] = j; \
+		} \
+	} \
+}
+
+GENTFUNC( float,  s, select_topk )
+GENTFUNC( double, d, select_topk )
+
+int main( int argc, char** argv )
+{
+	if ( argc != 8 )
+	{
+		printf( "usage: %s <sqeuclid|euclid|gaussian|laplacian|knn> <s|d> <k> "
+		        "<p_begin> <p_max> <p_inc> <n_repeats>\n", argv[0] );
+		return 1;
+	}
+
+	const char* op        = argv[1];
+	const char  dt_ch     = argv[2][0];
+	const dim_t k         = atol( argv[3] );
+	const dim_t p_begin   = atol( argv[4] );
+	const dim_t p_max     = atol( argv[5] );
+	const dim_t p_inc     = atol( argv[6] );
+	const int   n_repeats = atoi( argv[7] );
+
+	bao_pdist_func_t func;
+	bool             is_knn = FALSE;
+	if      ( strcmp( op, "sqeuclid" )  == 0 ) func = BAO_SQEUCLIDEAN;
+	else if ( strcmp( op, "euclid" )    == 0 ) func = BAO_EUCLIDEAN;
+	else if ( strcmp( op, "gaussian" )  == 0 ) func = BAO_GAUSSIAN;
+	else if ( strcmp( op, "laplacian" ) == 0 ) func = BAO_LAPLACIAN;
+	else if ( strcmp( op, "knn" )       == 0 ) { func = BAO_SQEUCLIDEAN; is_knn = TRUE; }
+	else
+	{
+		printf( "unknown operation '%s'\n", op );
+		return 1;
+	}
+
+	num_t dt;
+	bli_param_map_char_to_blis_dt( dt_ch, &dt );
+
+	const double eps = ( dt == BLIS_FLOAT ? FLT_EPSILON : DBL_EPSILON );
+
+	int n_fail = 0;
+
+	for ( dim_t p = p_begin; p <= p_max; p += p_inc )
+	{
+		const dim_t m = p;
+		const dim_t n = p;
+		const dim_t t = bli_min( KNN_T, n );
+
+		obj_t x, y, yt, c, c_ref, h, dist, idx;
+
+		bli_obj_create( dt, m, k, 0, 0, &x );
+		bli_obj_create( dt, n, k, 0, 0, &y );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+		bli_obj_create( dt, m, n, 0, 0, &c_ref );
+		bli_obj_create( dt, m, t, 0, 0, &dist );
+		bli_obj_create( BLIS_INT, m, t, 0, 0, &idx );
+		bli_obj_create_1x1( dt, &h );
+
+		bli_randm( &x );
+		bli_randm( &y );
+		bli_setsc( 1.0, 0.0, &h );
+
+		bli_obj_alias_with_trans( BLIS_TRANSPOSE, &y, &yt );
+
+		const siz_t es = bli_dt_size( dt );
+
+		void*   nx       = malloc( m * es );
+		void*   ny       = malloc( n * es );
+		void*   dist_ref = malloc( m * t * es );
+		gint_t* idx_ref  = malloc( m * t * sizeof( gint_t ) );
+
+		double dtime_pd   = DBL_MAX;
+		double dtime_conv = DBL_MAX;
+
+		for ( int r = 0; r < n_repeats; ++r )
+		{
+			double dtime = bli_clock();
+
+			if ( is_knn ) bao_pdist_topk( func, &h, &x, &y, &dist, &idx );
+			else          bao_pdist( func, &h, &x, &y, &c );
+
+			dtime_pd = bli_clock_min_diff( dtime_pd, dtime );
+
+			dtime = bli_clock();
+
+			if ( dt == BLIS_FLOAT )
+			{
+				snorms( m, k, x.buffer, bli_obj_col_stride( &x ), nx );
+				snorms( n, k, y.buffer, bli_obj_col_stride( &y ), ny );
+			}
+			else
+			{
+				dnorms( m, k, x.buffer, bli_obj_col_stride( &x ), nx );
+				dnorms( n, k, y.buffer, bli_obj_col_stride( &y ), ny );
+			}
+
+			bli_gemm( &BLIS_MINUS_TWO, &x, &yt, &BLIS_ZERO, &c_ref );
+
+			const inc_t cs_c = bli_obj_col_stride( &c_ref );
+
+			if ( dt == BLIS_FLOAT )
+			{
+				sfinish( func, m, n, nx, ny, c_ref.buffer, cs_c );
+				if ( is_knn ) sselect_topk( m, n, t, c_ref.buffer, cs_c, dist_ref, idx_ref );
+			}
+			else
+			{
+				dfinish( func, m, n, nx, ny, c_ref.buffer, cs_c );
+				if ( is_knn ) dselect_topk( m, n, t, c_ref.buffer, cs_c, dist_ref, idx_ref );
+			}
+
+			dtime_conv = bli_clock_min_diff( dtime_conv, dtime );
+		}
+
+		// The squared distance d2(i,j) may differ by about
+		// (k+2) eps ( |x_i|^2 + |y_j|^2 ), and f(d2) by as much (for the
+		// squared distance and the Gaussian kernel) or by its square root
+		// (for the transforms involving sqrt( d2 )).
+		const bool has_sqrt = ( func == BAO_EUCLIDEAN || func == BAO_LAPLACIAN );
+		bool       ok       = TRUE;
+
+		for ( dim_t i = 0; i < m; ++i )
+		for ( dim_t j = 0; j < n; ++j )
+		{
+			const double nxi = ( dt == BLIS_FLOAT ? ( ( float* )nx )[ i ] : ( ( double* )nx )[ i ] );
+			const double nyj = ( dt == BLIS_FLOAT ? ( ( float* )ny )[ j ] : ( ( double* )ny )[ j ] );
+			const double tol = 4.0 * ( k + 2 ) * eps * ( nxi + nyj + 1.0 );
+
+			if ( is_knn )
+			{
+				// Check neighbor j of point i (if there is one).
+				if ( t <= j ) continue;
+
+				double dij, dref, dummy;
+				bli_getijm( i, j, &dist, &dij, &dummy );
+
+				dref = ( dt == BLIS_FLOAT ? ( ( float*  )dist_ref )[ i*t + j ]
+				                          : ( ( double* )dist_ref )[ i*t + j ] );
+
+				const gint_t* idx_buf = bli_obj_buffer( &idx );
+				const gint_t  l       = idx_buf[ i*bli_obj_row_stride( &idx ) +
+				                                 j*bli_obj_col_stride( &idx ) ];
+
+				double dil = INFINITY;
+				if ( 0 <= l && l < n ) bli_getijm( i, l, &c_ref, &dil, &dummy );
+
+				if ( !( fabs( dij - dref ) <= tol ) ||
+				     !( fabs( dij - dil )  <= tol ) ) ok = FALSE;
+			}
+			else
+			{
+				double cij, cref, dummy;
+				bli_getijm( i, j, &c,     &cij,  &dummy );
+				bli_getijm( i, j, &c_ref, &cref, &dummy );
+
+				if ( !( fabs( cij - cref ) <= ( has_sqrt ? sqrt( tol ) : tol ) ) )
+					ok = FALSE;
+			}
+		}
+
+		if ( !ok )
+		{
+			printf( "FAIL: %c%s p=%lu: the results differ from those of the "
+			        "conventional approach\n",
+			        dt_ch, op, ( unsigned long )p );
+			n_fail += 1;
+		}
+
+		double flops = 2.0 * m * n * k;
+
+		printf( "data_%c%s( %4lu, 1:3 ) = [ %5lu %8.2f %8.2f ];\n",
+		        dt_ch, op,
+		        ( unsigned long )( ( p - p_begin ) / p_inc + 1 ),
+		        ( unsigned long )p,
+		        flops / ( dtime_pd   * 1.0e9 ),
+		        flops / ( dtime_conv * 1.0e9 ) );
+		fflush( stdout );
+
+		free( nx );
+		free( ny );
+		free( dist_ref );
+		free( idx_ref );
+
+		bli_obj_free( &x );
+		bli_obj_free( &y );
+		bli_obj_free( &c );
+		bli_obj_free( &c_ref );
+		bli_obj_free( &dist );
+		bli_obj_free( &idx );
+		bli_obj_free( &h );
+	}
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
+
@@ -0,0 +1,232 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <string.h>
+#include "blis.h"
+
+//
+// Performance driver for the reproducible execution mode (see the section
+// on reproducibility in docs/Multithreading.md). For each problem size, the
+// operation is timed with the default behavior and in reproducible mode, in
+// both cases with nt threads, and the result computed in reproducible mode
+// is compared bitwise with that of a single-threaded execution.
+//
+// For gemm, m = n = k = p and the storage of C, A, and B is given by the
+// three characters of stor (each 'r' or 'c'); the reported rates count the
+// 2mnk flops of the product. For sbmv, p is the order of the matrix, its
+// bandwidth is p/8, and the rates count the 4mk flops of the product.
+//
+// Usage: test_repro.x <gemm|sbmv> <dt> <stor> <nt> <p_begin> <p_max> <p_inc> <n_repeats>
+//
+//   dt  is one of s or d
+//
+// Each output line contains the problem size, the rates (in GFLOPS) of the
+// default and reproducible executions, and a 1 if the reproducible result
+// was identical to the single-threaded one (or 0 otherwise).
+//
+
+static void run_op
+     (
+             bool    is_gemm,
+       const obj_t*  a,
+       const obj_t*  b,
+             obj_t*  c,
+             dim_t   kb,
+       const rntm_t* rntm
+     )
+{
+	if ( is_gemm )
+	{
+		bli_gemm_ex( &BLIS_ONE, a, b, &BLIS_ONE, c, NULL, rntm );
+		return;
+	}
+
+	// For sbmv, a holds the band (kb+1 rows, stored by columns), b holds x,
+	// and c holds y.
+	const dim_t m    = bli_obj_length( c );
+	const inc_t cs_a = bli_obj_col_stride( a );
+
+	if ( bli_obj_dt( c ) == BLIS_FLOAT )
+	{
+		float alpha = 1.0f, beta = 1.0f;
+		bli_ssbmv_ex( BLIS_LOWER, BLIS_NO_CONJUGATE, BLIS_NO_CONJUGATE,
+		              m, kb, &alpha, a->buffer, 1, cs_a,
+		              b->buffer, 1, &beta, c->buffer, 1, NULL, rntm );
+	}
+	else
+	{
+		double alpha = 1.0, beta = 1.0;
+		bli_dsbmv_ex( BLIS_LOWER, BLIS_NO_CONJUGATE, BLIS_NO_CONJUGATE,
+		              m, kb, &alpha, a->buffer, 1, cs_a,
+		              b->buffer, 1, &beta, c->buffer, 1, NULL, rntm );
+	}
+}
+
+int main( int argc, char** argv )
+{
+	if ( argc != 9 )
+	{
+		printf( "usage: %s <gemm|sbmv> <s|d> <stor> <nt> "
+		        "<p_begin> <p_max> <p_inc> <n_repeats>\n", argv[0] );
+		return 1;
+	}
+
+	const char* op        = argv[1];
+	const char  dt_ch     = argv[2][0];
+	const char* stor      = argv[3];
+	const dim_t nt        = atol( argv[4] );
+	const dim_t p_begin   = atol( argv[5] );
+	const dim_t p_max     = atol( argv[6] );
+	const dim_t p_inc     = atol( argv[7] );
+	const int   n_repeats = atoi( argv[8] );
+
+	bool is_gemm;
+	if      ( strcmp( op, "gemm" ) == 0 ) is_gemm = TRUE;
+	else if ( strcmp( op, "sbmv" ) == 0 ) is_gemm = FALSE;
+	else
+	{
+		printf( "unknown operation '%s'\n", op );
+		return 1;
+	}
+
+	if ( strlen( stor ) != 3 )
+	{
+		printf( "stor must be three characters, each 'r' or 'c'\n" );
+		return 1;
+	}
+
+	num_t dt;
+	bli_param_map_char_to_blis_dt( dt_ch, &dt );
+
+	// The default execution, the reproducible execution, and the reference
+	// (single-threaded reproducible) execution.
+	rntm_t rntm_def = BLIS_RNTM_INITIALIZER;
+	rntm_t rntm_rep = BLIS_RNTM_INITIALIZER;
+	rntm_t rntm_ref = BLIS_RNTM_INITIALIZER;
+
+	bli_rntm_set_thread_impl( bli_thread_get_thread_impl(), &rntm_def );
+	bli_rntm_set_thread_impl( bli_thread_get_thread_impl(), &rntm_rep );
+	bli_rntm_set_num_threads( nt, &rntm_def );
+	bli_rntm_set_num_threads( nt, &rntm_rep );
+	bli_rntm_set_num_threads( 1, &rntm_ref );
+	bli_rntm_enable_repro( &rntm_rep );
+	bli_rntm_enable_repro( &rntm_ref );
+
+	for ( dim_t p = p_begin; p <= p_max; p += p_inc )
+	{
+		obj_t a, b, c, c0, c_ref;
+		dim_t kb = 0;
+		double flops;
+
+		if ( is_gemm )
+		{
+			const dim_t m = p, n = p, k = p;
+
+			bli_obj_create( dt, m, k, stor[1] == 'r' ? k : 1,
+			                          stor[1] == 'r' ? 1 : m, &a );
+			bli_obj_create( dt, k, n, stor[2] == 'r' ? n : 1,
+			                          stor[2] == 'r' ? 1 : k, &b );
+			bli_obj_create( dt, m, n, stor[0] == 'r' ? n : 1,
+			                          stor[0] == 'r' ? 1 : m, &c0 );
+
+			flops = 2.0 * m * n * k;
+		}
+		else
+		{
+			kb = bli_max( 1, p / 8 );
+
+			bli_obj_create( dt, kb + 1, p, 0, 0, &a );
+			bli_obj_create( dt, p, 1, 0, 0, &b );
+			bli_obj_create( dt, p, 1, 0, 0, &c0 );
+
+			flops = 4.0 * p * kb;
+		}
+
+		bli_obj_create_conf_to( &c0, &c );
+		bli_obj_create_conf_to( &c0, &c_ref );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c0 );
+
+		bli_copym( &c0, &c_ref );
+		run_op( is_gemm, &a, &b, &c_ref, kb, &rntm_ref );
+
+		double dtime_def = DBL_MAX;
+		double dtime_rep = DBL_MAX;
+		bool   same      = TRUE;
+
+		for ( int r = 0; r < n_repeats; ++r )
+		{
+			bli_copym( &c0, &c );
+
+			double dtime = bli_clock();
+
+			run_op( is_gemm, &a, &b, &c, kb, &rntm_def );
+
+			dtime_def = bli_clock_min_diff( dtime_def, dtime );
+
+			bli_copym( &c0, &c );
+
+			dtime = bli_clock();
+
+			run_op( is_gemm, &a, &b, &c, kb, &rntm_rep );
+
+			dtime_rep = bli_clock_min_diff( dtime_rep, dtime );
+
+			// Compare the reproducible result with the reference.
+			const siz_t size = bli_obj_length( &c ) * bli_obj_width( &c ) *
+			                   bli_dt_size( dt );
+			if ( memcmp( c.buffer, c_ref.buffer, size ) != 0 ) same = FALSE;
+		}
+
+		printf( "data_%c%s_%s( %4lu, 1:4 ) = [ %5lu %8.2f %8.2f %d ];\n",
+		        dt_ch, op, stor,
+		        ( unsigned long )( ( p - p_begin ) / p_inc + 1 ),
+		        ( unsigned long )p,
+		        flops / ( dtime_def * 1.0e9 ),
+		        flops / ( dtime_rep * 1.0e9 ),
+		        ( int )same );
+		fflush( stdout );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c0 );
+		bli_obj_free( &c_ref );
+	}
+
+	return 0;
+}
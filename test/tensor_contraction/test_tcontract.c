@@ -0,0 +1,308 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <math.h>
+#include <string.h>
+#include "blis.h"
+
+//
+// Performance driver for bao_tcontract() of the 'tcontract' addon. Each
+// contraction is also computed via the conventional transpose-transpose-
+// gemm-transpose (TTGT) approach, in which A and B are first permuted into
+// column-stored matrices, the product is computed by bli_gemm(), and the
+// result is permuted back into C. All indices share the same length, and
+// all tensors are stored with generalized column-major strides. The number
+// of threads is set via BLIS_NUM_THREADS (or the other usual BLIS
+// environment variables).
+//
+// The result of bao_tcontract() is also compared with that of TTGT. If the
+// two differ by more than rounding errors allow for some size, FAIL is
+// printed for that size and the program exits with a non-zero status.
+//
+// Usage: test_tcontract.x <dt> <spec> <p_begin> <p_max> <p_inc> <n_repeats>
+//
+//   dt    is one of s, d, c, or z
+//   spec  is a contraction of the form idx_a,idx_b->idx_c (e.g. ab,bc->ac)
+//
+
+// Copy the elements of a tensor between two layouts, given the lengths of
+// its dimensions and the strides of each layout.
+static void permute
+     (
+       dim_t        ndim,
+       const dim_t* len,
+       const inc_t* stride_src,
+       const char*  src,
+       const inc_t* stride_dst,
+             char*  dst,
+       siz_t        dt_size
+     )
+{
+	dim_t idx[ BAO_TENSOR_MAX_NDIM ] = { 0 };
+	inc_t off_src = 0;
+	inc_t off_dst = 0;
+
+	dim_t size = 1;
+	for ( dim_t d = 0; d < ndim; ++d ) size *= len[ d ];
+
+	for ( dim_t i = 0; i < size; ++i )
+	{
+		memcpy( dst + off_dst * dt_size, src + off_src * dt_size, dt_size );
+
+		for ( dim_t d = 0; d < ndim; ++d )
+		{
+			if ( idx[ d ] < len[ d ] - 1 )
+			{
+				idx[ d ] += 1;
+				off_src  += stride_src[ d ];
+				off_dst  += stride_dst[ d ];
+				break;
+			}
+
+			off_src -= idx[ d ] * stride_src[ d ];
+			off_dst -= idx[ d ] * stride_dst[ d ];
+			idx[ d ] = 0;
+		}
+	}
+}
+
+// Compute the strides of a tensor within a column-stored matrix whose rows
+// (columns) are indexed by the indices of idx_r (idx_c), in that order.
+static void matrix_strides
+     (
+       const bao_tensor_t* t,
+       const char*         idx_t,
+       const char*         idx_r,
+       const char*         idx_c,
+       dim_t               m,
+             inc_t*        stride
+     )
+{
+	for ( dim_t d = 0; d < t->ndim; ++d )
+	{
+		const char* pr = strchr( idx_r, idx_t[ d ] );
+		const char* pc = strchr( idx_c, idx_t[ d ] );
+		inc_t       s  = ( pr != NULL ? 1 : m );
+		const char* p  = ( pr != NULL ? pr : pc );
+		const char* p0 = ( pr != NULL ? idx_r : idx_c );
+
+		for ( ; p0 < p; ++p0 ) s *= t->len[ strchr( idx_t, *p0 ) - idx_t ];
+
+		stride[ d ] = s;
+	}
+}
+
+int main( int argc, char** argv )
+{
+	if ( argc != 7 || strstr( argv[2], "->" ) == NULL || strchr( argv[2], ',' ) == NULL )
+	{
+		printf( "usage: %s <s|d|c|z> <idx_a,idx_b->idx_c> "
+		        "<p_begin> <p_max> <p_inc> <n_repeats>\n", argv[0] );
+		return 1;
+	}
+
+	const char  dt_ch     = argv[1][0];
+	const dim_t p_begin   = atol( argv[3] );
+	const dim_t p_max     = atol( argv[4] );
+	const dim_t p_inc     = atol( argv[5] );
+	const int   n_repeats = atoi( argv[6] );
+
+	num_t dt;
+	bli_param_map_char_to_blis_dt( dt_ch, &dt );
+
+	const siz_t dt_size = bli_dt_size( dt );
+
+	// Split the specification into the indices of A, B, and C.
+	char idx_a[ BAO_TENSOR_MAX_NDIM + 1 ] = { 0 };
+	char idx_b[ BAO_TENSOR_MAX_NDIM + 1 ] = { 0 };
+	char idx_c[ BAO_TENSOR_MAX_NDIM + 1 ] = { 0 };
+
+	const char* comma = strchr( argv[2], ',' );
+	const char* arrow = strstr( argv[2], "->" );
+
+	strncpy( idx_a, argv[2], bli_min( comma - argv[2], BAO_TENSOR_MAX_NDIM ) );
+	strncpy( idx_b, comma + 1, bli_min( arrow - comma - 1, BAO_TENSOR_MAX_NDIM ) );
+	strncpy( idx_c, arrow + 2, BAO_TENSOR_MAX_NDIM );
+
+	// Sort the indices into the m, n, and k groups (ordered as they appear
+	// in C, C, and A, respectively) for the TTGT approach.
+	char idx_m[ BAO_TENSOR_MAX_NDIM + 1 ] = { 0 };
+	char idx_n[ BAO_TENSOR_MAX_NDIM + 1 ] = { 0 };
+	char idx_k[ BAO_TENSOR_MAX_NDIM + 1 ] = { 0 };
+
+	for ( const char* p = idx_c; *p; ++p )
+	{
+		if ( strchr( idx_a, *p ) ) idx_m[ strlen( idx_m ) ] = *p;
+		else                       idx_n[ strlen( idx_n ) ] = *p;
+	}
+	for ( const char* p = idx_a; *p; ++p )
+		if ( strchr( idx_b, *p ) ) idx_k[ strlen( idx_k ) ] = *p;
+
+	const dim_t ndim_a = strlen( idx_a );
+	const dim_t ndim_b = strlen( idx_b );
+	const dim_t ndim_c = strlen( idx_c );
+
+	const double eps = ( bli_dt_prec_is_single( dt ) ? FLT_EPSILON
+	                                                 : DBL_EPSILON );
+
+	int n_fail = 0;
+
+	for ( dim_t p = p_begin; p <= p_max; p += p_inc )
+	{
+		dim_t len[ BAO_TENSOR_MAX_NDIM ];
+		for ( dim_t d = 0; d < BAO_TENSOR_MAX_NDIM; ++d ) len[ d ] = p;
+
+		dim_t m = 1, n = 1, k = 1;
+		for ( dim_t d = 0; idx_m[ d ]; ++d ) m *= p;
+		for ( dim_t d = 0; idx_n[ d ]; ++d ) n *= p;
+		for ( dim_t d = 0; idx_k[ d ]; ++d ) k *= p;
+
+		bao_tensor_t a, b, c, c_save;
+
+		bao_tensor_create( dt, ndim_a, len, &a );
+		bao_tensor_create( dt, ndim_b, len, &b );
+		bao_tensor_create( dt, ndim_c, len, &c );
+		bao_tensor_create( dt, ndim_c, len, &c_save );
+
+		// Initialize the tensors via vector views of their buffers.
+		obj_t av, bv, cv, cv_save;
+
+		bli_obj_create_with_attached_buffer( dt, bao_tensor_size( &a ), 1, a.buffer, 1, bao_tensor_size( &a ), &av );
+		bli_obj_create_with_attached_buffer( dt, bao_tensor_size( &b ), 1, b.buffer, 1, bao_tensor_size( &b ), &bv );
+		bli_obj_create_with_attached_buffer( dt, bao_tensor_size( &c ), 1, c.buffer, 1, bao_tensor_size( &c ), &cv );
+		bli_obj_create_with_attached_buffer( dt, bao_tensor_size( &c ), 1, c_save.buffer, 1, bao_tensor_size( &c ), &cv_save );
+
+		bli_randv( &av );
+		bli_randv( &bv );
+		bli_randv( &cv_save );
+
+		// Create the matrices used by the TTGT approach, along with the
+		// strides of each tensor within its matrix.
+		obj_t am, bm, cm;
+		inc_t stride_am[ BAO_TENSOR_MAX_NDIM ];
+		inc_t stride_bm[ BAO_TENSOR_MAX_NDIM ];
+		inc_t stride_cm[ BAO_TENSOR_MAX_NDIM ];
+
+		bli_obj_create( dt, m, k, 1, m, &am );
+		bli_obj_create( dt, k, n, 1, k, &bm );
+		bli_obj_create( dt, m, n, 1, m, &cm );
+
+		matrix_strides( &a, idx_a, idx_m, idx_k, m, stride_am );
+		matrix_strides( &b, idx_b, idx_k, idx_n, k, stride_bm );
+		matrix_strides( &c, idx_c, idx_m, idx_n, m, stride_cm );
+
+		double dtime_tc   = DBL_MAX;
+		double dtime_ttgt = DBL_MAX;
+
+		for ( int r = 0; r < n_repeats; ++r )
+		{
+			bli_copyv( &cv_save, &cv );
+
+			double dtime = bli_clock();
+
+			bao_tcontract( &BLIS_ONE, &a, idx_a, &b, idx_b, &BLIS_ONE, &c, idx_c );
+
+			dtime_tc = bli_clock_min_diff( dtime_tc, dtime );
+
+			bli_copyv( &cv_save, &cv );
+
+			dtime = bli_clock();
+
+			permute( ndim_a, a.len, a.stride, a.buffer, stride_am, bli_obj_buffer( &am ), dt_size );
+			permute( ndim_b, b.len, b.stride, b.buffer, stride_bm, bli_obj_buffer( &bm ), dt_size );
+			permute( ndim_c, c.len, c.stride, c.buffer, stride_cm, bli_obj_buffer( &cm ), dt_size );
+
+			bli_gemm( &BLIS_ONE, &am, &bm, &BLIS_ONE, &cm );
+
+			permute( ndim_c, c.len, stride_cm, bli_obj_buffer( &cm ), c.stride, c.buffer, dt_size );
+
+			dtime_ttgt = bli_clock_min_diff( dtime_ttgt, dtime );
+		}
+
+		// Keep the result of TTGT and recompute that of bao_tcontract().
+		obj_t cv_ttgt, norm;
+		bli_obj_create( dt, bao_tensor_size( &c ), 1, 0, 0, &cv_ttgt );
+		bli_obj_scalar_init_detached( bli_dt_proj_to_real( dt ), &norm );
+
+		bli_copyv( &cv, &cv_ttgt );
+		bli_copyv( &cv_save, &cv );
+
+		bao_tcontract( &BLIS_ONE, &a, idx_a, &b, idx_b, &BLIS_ONE, &c, idx_c );
+
+		// Since the elements of A and B are at most one in magnitude, each
+		// element of the result may differ by about (k+1) eps ( |c| + k ).
+		double norm_c, norm_d, dummy;
+		bli_normfv( &cv_save, &norm );
+		bli_getsc( &norm, &norm_c, &dummy );
+
+		bli_subv( &cv, &cv_ttgt );
+		bli_normfv( &cv_ttgt, &norm );
+		bli_getsc( &norm, &norm_d, &dummy );
+
+		const double tol = 2.0 * ( k + 1 ) * eps *
+		                   ( norm_c + k * sqrt( ( double )bao_tensor_size( &c ) ) );
+
+		if ( !( norm_d <= tol ) )
+		{
+			printf( "FAIL: %c %s p=%lu: ||C_tcontract - C_ttgt|| = %g\n",
+			        dt_ch, argv[2], ( unsigned long )p, norm_d );
+			n_fail += 1;
+		}
+
+		bli_obj_free( &cv_ttgt );
+
+		double flops = 2.0 * m * n * k;
+		if ( bli_is_complex( dt ) ) flops *= 4.0;
+
+		printf( "data_%c_tcontract( %4lu, 1:4 ) = [ %5lu %8lu %8.2f %8.2f ];\n",
+		        dt_ch,
+		        ( unsigned long )( ( p - p_begin ) / p_inc + 1 ),
+		        ( unsigned long )p, ( unsigned long )( m * n * k ),
+		        flops / ( dtime_tc   * 1.0e9 ),
+		        flops / ( dtime_ttgt * 1.0e9 ) );
+		fflush( stdout );
+
+		bli_obj_free( &am );
+		bli_obj_free( &bm );
+		bli_obj_free( &cm );
+
+		bao_tensor_free( &a );
+		bao_tensor_free( &b );
+		bao_tensor_free( &c );
+		bao_tensor_free( &c_save );
+	}
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
@@ -0,0 +1,175 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// Test for the tracing subsystem, which is compiled in when BLIS is
+// configured with --enable-trace. With tracing enabled, the test executes
+// one double-precision gemm on each of several implementation paths and
+// checks that exactly one call was counted, on the expected path:
+//
+// - a tiny problem via the typed API (the tiny gemm path);
+// - a small problem via the object API (the sup path);
+// - a small problem with sup handling disabled and one thread (the small
+//   matrix path, if BLIS_ENABLE_SMALL_MATRIX is defined, or else the
+//   conventional path);
+// - a larger problem with sup handling disabled and two threads (the
+//   conventional path).
+//
+// It also checks that nothing is counted while tracing is disabled.
+//
+// Usage: test_trace.x
+//
+// The program exits with a non-zero status if any case fails.
+//
+
+static int n_cases = 0, n_fail = 0;
+
+// Execute C := A * B with m = n = k = mnk, using the typed API if typed is
+// TRUE, and check that the counters advanced by one call on path (or by
+// none, if path is BLIS_NUM_TRACE_PATHS).
+static void test_path
+     (
+       const char* label,
+       dim_t       mnk,
+       bool        typed,
+       bool        sup,
+       dim_t       nt,
+       int         path
+     )
+{
+	obj_t a, b, c;
+
+	bli_obj_create( BLIS_DOUBLE, mnk, mnk, 0, 0, &a );
+	bli_obj_create( BLIS_DOUBLE, mnk, mnk, 0, 0, &b );
+	bli_obj_create( BLIS_DOUBLE, mnk, mnk, 0, 0, &c );
+
+	bli_randm( &a );
+	bli_randm( &b );
+
+	rntm_t rntm;
+	bli_rntm_init_from_global( &rntm );
+	bli_rntm_set_num_threads( nt, &rntm );
+	if ( !sup ) bli_rntm_disable_l3_sup( &rntm );
+
+	trace_counters_t before, after;
+
+	bli_trace_query_counters( &before );
+
+	if ( typed )
+	{
+		double one = 1.0, zero = 0.0;
+
+		bli_dgemm
+		(
+		  BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, mnk, mnk, mnk,
+		  &one,
+		  bli_obj_buffer( &a ), bli_obj_row_stride( &a ), bli_obj_col_stride( &a ),
+		  bli_obj_buffer( &b ), bli_obj_row_stride( &b ), bli_obj_col_stride( &b ),
+		  &zero,
+		  bli_obj_buffer( &c ), bli_obj_row_stride( &c ), bli_obj_col_stride( &c )
+		);
+	}
+	else
+	{
+		bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c, NULL, &rntm );
+	}
+
+	bli_trace_query_counters( &after );
+
+	bool ok = TRUE;
+
+	for ( int p = 0; p < BLIS_NUM_TRACE_PATHS; ++p )
+	{
+		const uint64_t n_exp = ( p == path );
+
+		if ( after.calls[ p ] != before.calls[ p ] + n_exp ) ok = FALSE;
+	}
+
+	if ( !ok )
+	{
+		printf( "FAIL: %s:", label );
+		for ( int p = 0; p < BLIS_NUM_TRACE_PATHS; ++p )
+			if ( after.calls[ p ] != before.calls[ p ] )
+				printf( " %s +%lu", bli_trace_path_string( p ),
+				        ( unsigned long )( after.calls[ p ] -
+				                           before.calls[ p ] ) );
+		printf( "\n" );
+		n_fail += 1;
+	}
+
+	n_cases += 1;
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+}
+
+int main( int argc, char** argv )
+{
+	if ( bli_info_get_enable_trace() == 0 )
+	{
+		printf( "BLIS was not configured with --enable-trace; "
+		        "nothing to test\n" );
+		return 0;
+	}
+
+	bli_trace_reset();
+	bli_trace_enable();
+
+	if ( !bli_trace_is_enabled() )
+	{
+		printf( "FAIL: bli_trace_enable() had no effect\n" );
+		return 1;
+	}
+
+	test_path( "tiny",  4,   TRUE,  TRUE,  1, BLIS_TRACE_TINY );
+	test_path( "sup",   40,  FALSE, TRUE,  1, BLIS_TRACE_SUP );
+#ifdef BLIS_ENABLE_SMALL_MATRIX
+	test_path( "small", 40,  FALSE, FALSE, 1, BLIS_TRACE_SMALL );
+#else
+	test_path( "small", 40,  FALSE, FALSE, 1, BLIS_TRACE_NAT );
+#endif
+	test_path( "nat",   300, FALSE, FALSE, 2, BLIS_TRACE_NAT );
+
+	bli_trace_disable();
+
+	test_path( "disabled", 300, FALSE, FALSE, 2, BLIS_NUM_TRACE_PATHS );
+
+	printf( "%d cases, %d failed\n", n_cases, n_fail );
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
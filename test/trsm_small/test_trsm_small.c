@@ -0,0 +1,344 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <math.h>
+#include "blis.h"
+
+#ifdef BLIS_ENABLE_SMALL_MATRIX_TRSM
+
+//
+// Correctness test for the small matrix trsm code (bli_trsm_small()), which
+// is enabled on zen family configurations via --enable-small-matrix. For
+// each datatype (s, d, c, and z), each combination of side, uplo, trans (no
+// transpose, transpose, and conjugate-transpose), and diag, each storage of
+// A and B (column- or row-major), and a range of problem sizes and scalars,
+// the solution X is checked by computing the residual of op(A) X = alpha B
+// (or X op(A) = alpha B) in double precision:
+//
+// - bli_trsm_small() is called directly. It must accept every real problem
+//   in the test, all of which are below the size thresholds of the small
+//   matrix code, and decline every complex problem.
+// - bli_trsm_ex() is called with one thread, in which case bli_trsm_front()
+//   hands the problem to bli_trsm_small(). If BLIS was configured with
+//   --enable-trace, the test also checks that the problem was counted as
+//   taking the small matrix path exactly when the direct call accepted it
+//   (unless alpha is zero, which returns early).
+//
+// A and B are views into larger matrices, and a unit alpha is passed as
+// the constant BLIS_ONE. The triangle of A that is not referenced is
+// filled with NaN, as is the diagonal of A when it is implicitly unit, so
+// that any such reads show up in the residual.
+//
+// Usage: test_trsm_small.x
+//
+// The program exits with a non-zero status if any case fails.
+//
+
+// Return element (i,j) of op(A), where A is triangular and op() is given by
+// the conjugation and transposition properties of A.
+static void get_op_tri( const obj_t* a, dim_t i, dim_t j, double* re, double* im )
+{
+	const bool is_lower = bli_obj_is_lower( a );
+
+	if ( bli_obj_has_trans( a ) ) { dim_t t = i; i = j; j = t; }
+
+	if ( ( is_lower && i < j ) || ( !is_lower && i > j ) )
+	{
+		*re = 0.0; *im = 0.0;
+		return;
+	}
+
+	if ( i == j && bli_obj_has_unit_diag( a ) )
+	{
+		*re = 1.0; *im = 0.0;
+		return;
+	}
+
+	bli_getijm( i, j, a, re, im );
+
+	if ( bli_obj_has_conj( a ) ) *im = -*im;
+}
+
+// Check that X satisfies op(A) X = alpha * B0 (left) or X op(A) = alpha * B0
+// (right), allowing a residual that is proportional to the magnitude of the
+// terms involved.
+static bool check_trsm
+     (
+       side_t       side,
+       double       alpha_r,
+       double       alpha_i,
+       const obj_t* a,
+       const obj_t* b0,
+       const obj_t* x
+     )
+{
+	const num_t  dt  = bli_obj_dt( x );
+	const dim_t  m   = bli_obj_length( x );
+	const dim_t  n   = bli_obj_width( x );
+	const dim_t  k   = bli_obj_length( a );
+	const double eps = ( bli_dt_prec_is_single( dt ) ? FLT_EPSILON
+	                                                 : DBL_EPSILON );
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		double res_r = 0.0, res_i = 0.0, mag = 0.0;
+
+		for ( dim_t l = 0; l < k; ++l )
+		{
+			double ar, ai, xr, xi;
+
+			if ( bli_is_left( side ) )
+			{
+				get_op_tri( a, i, l, &ar, &ai );
+				bli_getijm( l, j, x, &xr, &xi );
+			}
+			else
+			{
+				get_op_tri( a, l, j, &ar, &ai );
+				bli_getijm( i, l, x, &xr, &xi );
+			}
+
+			res_r += ar * xr - ai * xi;
+			res_i += ar * xi + ai * xr;
+			mag   += hypot( ar, ai ) * hypot( xr, xi );
+		}
+
+		double br, bi;
+		bli_getijm( i, j, b0, &br, &bi );
+
+		res_r -= alpha_r * br - alpha_i * bi;
+		res_i -= alpha_r * bi + alpha_i * br;
+		mag   += hypot( alpha_r, alpha_i ) * hypot( br, bi );
+
+		if ( !( hypot( res_r, res_i ) <= 8.0 * ( k + 2 ) * eps * mag ) )
+			return FALSE;
+	}
+
+	return TRUE;
+}
+
+int main( int argc, char** argv )
+{
+	const num_t   dts[]    = { BLIS_FLOAT, BLIS_DOUBLE,
+	                           BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const char    dtchars[] = "sdcz";
+	const side_t  sides[]  = { BLIS_LEFT, BLIS_RIGHT };
+	const uplo_t  uplos[]  = { BLIS_LOWER, BLIS_UPPER };
+	const trans_t transs[] = { BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE,
+	                           BLIS_CONJ_TRANSPOSE };
+	const diag_t  diags[]  = { BLIS_NONUNIT_DIAG, BLIS_UNIT_DIAG };
+	const char    stors[]  = "cr";
+	const dim_t   sizes[][2] =
+	{
+		{   1,   1 },
+		{   4,   3 },
+		{   7,   9 },
+		{  16,   5 },
+		{  33,  17 },
+		{   8,  64 },
+		{  70,  20 },
+	};
+	const double  scalars[][2] =
+	{
+		{  1.0,  0.0 },
+		{ -0.5,  0.75 },
+		{  0.0,  0.0 },
+	};
+
+	const dim_t n_sizes   = sizeof( sizes ) / sizeof( sizes[0] );
+	const dim_t n_scalars = sizeof( scalars ) / sizeof( scalars[0] );
+
+	const bool use_trace = ( bli_info_get_enable_trace() != 0 );
+
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+	bli_rntm_set_num_threads( 1, &rntm );
+
+	if ( use_trace ) bli_trace_enable();
+
+	int n_cases = 0, n_fail = 0;
+
+	for ( int id = 0; id < 4; ++id )
+	for ( int is = 0; is < 2; ++is )
+	for ( int iu = 0; iu < 2; ++iu )
+	for ( int it = 0; it < 3; ++it )
+	for ( int ig = 0; ig < 2; ++ig )
+	for ( int sa = 0; sa < 2; ++sa )
+	for ( int sb = 0; sb < 2; ++sb )
+	for ( dim_t iz = 0; iz < n_sizes; ++iz )
+	for ( dim_t ia = 0; ia < n_scalars; ++ia )
+	{
+		const num_t  dt   = dts[ id ];
+		const side_t side = sides[ is ];
+		const dim_t  m    = sizes[ iz ][0];
+		const dim_t  n    = sizes[ iz ][1];
+		const dim_t  mn_a = ( bli_is_left( side ) ? m : n );
+
+		// The imaginary part of alpha is ignored for real datatypes.
+		const double alpha_r = scalars[ ia ][0];
+		const double alpha_i = ( bli_is_complex( dt ) ? scalars[ ia ][1]
+		                                              : 0.0 );
+
+		obj_t a_big, b_big, a, b0, b, alpha;
+
+		// A and B are views into larger matrices, so that the operands do
+		// not begin at the start of their buffers.
+		if ( stors[ sa ] == 'c' )
+			bli_obj_create( dt, mn_a + 2, mn_a + 2, 0, 0, &a_big );
+		else
+			bli_obj_create( dt, mn_a + 2, mn_a + 2, mn_a + 2, 1, &a_big );
+
+		if ( stors[ sb ] == 'c' )
+		{
+			bli_obj_create( dt, m, n, 0, 0, &b0 );
+			bli_obj_create( dt, m + 3, n + 2, 0, 0, &b_big );
+		}
+		else
+		{
+			bli_obj_create( dt, m, n, n, 1, &b0 );
+			bli_obj_create( dt, m + 3, n + 2, n + 2, 1, &b_big );
+		}
+
+		bli_acquire_mpart( 1, 1, mn_a, mn_a, &a_big, &a );
+		bli_acquire_mpart( 3, 2, m, n, &b_big, &b );
+
+		bli_randm( &a );
+		bli_randm( &b0 );
+
+		// Make A diagonally dominant, and fill the elements that must not
+		// be read with NaN.
+		for ( dim_t j = 0; j < mn_a; ++j )
+		for ( dim_t i = 0; i < mn_a; ++i )
+		{
+			double re, im;
+			bli_getijm( i, j, &a, &re, &im );
+
+			const bool in_tri = ( bli_is_lower( uplos[ iu ] ) ? i >= j
+			                                                  : i <= j );
+
+			if ( !in_tri || ( i == j && bli_is_unit_diag( diags[ ig ] ) ) )
+				bli_setijm( NAN, NAN, i, j, &a );
+			else if ( i == j )
+				bli_setijm( re + mn_a + 1.0, im, i, j, &a );
+		}
+
+		bli_obj_set_struc( BLIS_TRIANGULAR, &a );
+		bli_obj_set_uplo( uplos[ iu ], &a );
+		bli_obj_set_diag( diags[ ig ], &a );
+		bli_obj_set_conjtrans( transs[ it ], &a );
+
+		// A unit alpha is passed as the constant BLIS_ONE.
+		if ( alpha_r == 1.0 && alpha_i == 0.0 )
+		{
+			bli_obj_alias_to( &BLIS_ONE, &alpha );
+		}
+		else
+		{
+			bli_obj_scalar_init_detached( dt, &alpha );
+			bli_setsc( alpha_r, alpha_i, &alpha );
+		}
+
+		// Call the small matrix code directly.
+		bli_copym( &b0, &b );
+
+		err_t status = bli_trsm_small( side, &alpha, &a, &b,
+		                               bli_gks_query_cntx(), NULL );
+
+		bool ok;
+
+		if ( bli_is_real( dt ) )
+			ok = ( status == BLIS_SUCCESS &&
+			       check_trsm( side, alpha_r, alpha_i, &a, &b0, &b ) );
+		else
+			ok = ( status != BLIS_SUCCESS );
+
+		// Call the object API, which should also reach the small matrix
+		// code for the problems accepted above.
+		trace_counters_t before, after;
+
+		bli_copym( &b0, &b );
+
+		if ( use_trace ) bli_trace_query_counters( &before );
+
+		bli_trsm_ex( side, &alpha, &a, &b, NULL, &rntm );
+
+		if ( use_trace ) bli_trace_query_counters( &after );
+
+		ok = ok && check_trsm( side, alpha_r, alpha_i, &a, &b0, &b );
+
+		const uint64_t n_exp = ( status == BLIS_SUCCESS &&
+		                         ( alpha_r != 0.0 || alpha_i != 0.0 ) );
+
+		if ( use_trace &&
+		     after.calls[ BLIS_TRACE_SMALL ] !=
+		     before.calls[ BLIS_TRACE_SMALL ] + n_exp ) ok = FALSE;
+
+		if ( !ok )
+		{
+			printf( "FAIL: dt=%c side=%c uplo=%c trans=%c diag=%c "
+			        "stor(a,b)=%c%c m=%ld n=%ld alpha=(%g,%g) status=%d\n",
+			        dtchars[ id ],
+			        bli_is_left( side ) ? 'l' : 'r',
+			        bli_is_lower( uplos[ iu ] ) ? 'l' : 'u',
+			        "ntc"[ it ],
+			        bli_is_unit_diag( diags[ ig ] ) ? 'u' : 'n',
+			        stors[ sa ], stors[ sb ],
+			        ( long )m, ( long )n, alpha_r, alpha_i, ( int )status );
+			n_fail += 1;
+		}
+
+		n_cases += 1;
+
+		bli_obj_free( &a_big );
+		bli_obj_free( &b0 );
+		bli_obj_free( &b_big );
+	}
+
+	printf( "%d cases, %d failed%s\n", n_cases, n_fail,
+	        use_trace ? "" : " (trace counters not checked)" );
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
+
+#else
+
+int main( int argc, char** argv )
+{
+	printf( "BLIS_ENABLE_SMALL_MATRIX_TRSM is not defined by this "
+	        "configuration; nothing to test\n" );
+	return 0;
+}
+
+#endif
@@ -0,0 +1,322 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver searches for cache blocksizes (MC, KC, NC) and small/unpacked
+// (sup) thresholds (MT, NT, KT) that perform well on the machine on which it
+// runs, and writes them to a tuning file that BLIS will load at
+// initialization time when the BLIS_TUNING_FILE environment variable names
+// it. The search is deliberately simple:
+//
+// - Blocksizes are tuned one at a time (KC, then MC, then NC) on a large
+//   square gemm with sup disabled, keeping the best value found for each
+//   before moving on to the next.
+// - Each sup threshold is found by growing one dimension of a gemm whose
+//   other two dimensions are large, and recording the first size at which
+//   the conventional implementation is faster than the sup implementation.
+//
+// Every candidate blocksize is a multiple of the register blocksizes of the
+// active configuration, so the resulting file always passes the loader's
+// validation. Timings are the best of n_repeats trials.
+
+#define MAX_CANDS  32
+#define THRESH_INF 1000000
+
+typedef struct
+{
+	num_t       dt;
+	dim_t       p_blk;
+	dim_t       p_big;
+	dim_t       t_max;
+	dim_t       t_inc;
+	int         n_repeats;
+} tune_params_t;
+
+static double time_gemm
+     (
+       dim_t          m,
+       dim_t          n,
+       dim_t          k,
+       bool           use_sup,
+       const cntx_t*  cntx,
+       tune_params_t* params
+     )
+{
+	obj_t  a, b, c;
+	rntm_t rntm;
+	num_t  dt = params->dt;
+	double dtime_best = DBL_MAX;
+
+	bli_rntm_init_from_global( &rntm );
+	if ( use_sup ) bli_rntm_enable_l3_sup( &rntm );
+	else           bli_rntm_disable_l3_sup( &rntm );
+
+	bli_obj_create( dt, m, k, 0, 0, &a );
+	bli_obj_create( dt, k, n, 0, 0, &b );
+	bli_obj_create( dt, m, n, 0, 0, &c );
+
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c );
+
+	for ( int r = 0; r < params->n_repeats; ++r )
+	{
+		double dtime = bli_clock();
+
+		bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, cntx, &rntm );
+
+		dtime_best = bli_clock_min_diff( dtime_best, dtime );
+	}
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+
+	return dtime_best;
+}
+
+static dim_t gcd( dim_t x, dim_t y )
+{
+	while ( y != 0 ) { dim_t t = x % y; x = y; y = t; }
+	return x;
+}
+
+static dim_t lcm( dim_t x, dim_t y )
+{
+	return ( x / gcd( x, y ) ) * y;
+}
+
+// Fill cands with up to MAX_CANDS multiples of mult spanning [lo,hi].
+static dim_t gen_cands( dim_t lo, dim_t hi, dim_t mult, dim_t* cands )
+{
+	dim_t n_cands = 0;
+
+	lo = bli_max( mult, ( lo / mult ) * mult );
+	hi = bli_max( lo, hi );
+
+	dim_t step = bli_max( mult, ( ( hi - lo ) / ( MAX_CANDS - 1 ) / mult ) * mult );
+
+	for ( dim_t v = lo; v <= hi && n_cands < MAX_CANDS; v += step )
+		cands[ n_cands++ ] = v;
+
+	return n_cands;
+}
+
+static dim_t tune_blksz
+     (
+       bszid_t        bs_id,
+       dim_t          lo,
+       dim_t          hi,
+       dim_t          mult,
+       cntx_t*        cntx,
+       tune_params_t* params
+     )
+{
+	num_t  dt       = params->dt;
+	dim_t  p        = params->p_blk;
+	dim_t  def_orig = bli_cntx_get_blksz_def_dt( dt, bs_id, cntx );
+	dim_t  max_orig = bli_cntx_get_blksz_max_dt( dt, bs_id, cntx );
+	dim_t  slack    = bli_max( max_orig - def_orig, 0 );
+	dim_t  best     = def_orig;
+	double t_best   = DBL_MAX;
+	dim_t  cands[ MAX_CANDS ];
+	dim_t  n_cands  = gen_cands( lo, hi, mult, cands );
+
+	for ( dim_t i = 0; i < n_cands; ++i )
+	{
+		bli_cntx_set_blksz_def_dt( dt, bs_id, cands[ i ],         cntx );
+		bli_cntx_set_blksz_max_dt( dt, bs_id, cands[ i ] + slack, cntx );
+
+		double t = time_gemm( p, p, p, FALSE, cntx, params );
+
+		if ( t < t_best ) { t_best = t; best = cands[ i ]; }
+	}
+
+	// Leave the context with the best value so that subsequent searches
+	// build on it.
+	bli_cntx_set_blksz_def_dt( dt, bs_id, best,         cntx );
+	bli_cntx_set_blksz_max_dt( dt, bs_id, best + slack, cntx );
+
+	return best;
+}
+
+static dim_t tune_thresh
+     (
+       bszid_t        bs_id,
+       const cntx_t*  cntx_conv,
+       const cntx_t*  cntx_sup,
+       tune_params_t* params
+     )
+{
+	dim_t big = params->p_big;
+
+	for ( dim_t x = params->t_inc; x <= params->t_max; x += params->t_inc )
+	{
+		dim_t m = ( bs_id == BLIS_MT ? x : big );
+		dim_t n = ( bs_id == BLIS_NT ? x : big );
+		dim_t k = ( bs_id == BLIS_KT ? x : big );
+
+		double t_sup  = time_gemm( m, n, k, TRUE,  cntx_sup,  params );
+		double t_conv = time_gemm( m, n, k, FALSE, cntx_conv, params );
+
+		// The thresholds are exclusive: sup is used when m < MT, etc.
+		if ( t_conv < t_sup ) return x;
+	}
+
+	return params->t_max;
+}
+
+int main( int argc, char** argv )
+{
+	tune_params_t params;
+	const char*   dt_str   = "sd";
+	const char*   out_path = "blis_tuning.txt";
+	getopt_t      state;
+	int           opt;
+
+	params.p_blk     = 2000;
+	params.p_big     = 1000;
+	params.t_max     = 512;
+	params.t_inc     = 16;
+	params.n_repeats = 3;
+
+	bli_getopt_init_state( 0, &state );
+
+	while ( ( opt = bli_getopt( argc, ( const char* const * )argv,
+	                            "d:o:p:b:t:i:r:", &state ) ) != -1 )
+	{
+		switch ( opt )
+		{
+			case 'd': dt_str           = state.optarg;        break;
+			case 'o': out_path         = state.optarg;        break;
+			case 'p': params.p_blk     = atoi( state.optarg ); break;
+			case 'b': params.p_big     = atoi( state.optarg ); break;
+			case 't': params.t_max     = atoi( state.optarg ); break;
+			case 'i': params.t_inc     = atoi( state.optarg ); break;
+			case 'r': params.n_repeats = atoi( state.optarg ); break;
+			default:
+				printf( "usage: %s [-d dts] [-o file] [-p blk_size] [-b big_size]\n"
+				        "       [-t thresh_max] [-i thresh_inc] [-r repeats]\n",
+				        argv[0] );
+				return 1;
+		}
+	}
+
+	const arch_t  id   = bli_arch_query_id();
+	const cntx_t* cntx = bli_gks_query_cntx();
+
+	FILE* fp = fopen( out_path, "w" );
+
+	if ( fp == NULL )
+	{
+		printf( "%s: unable to open '%s' for writing.\n", argv[0], out_path );
+		return 1;
+	}
+
+	fprintf( fp, "# BLIS tuning file written by test/tune/tune.x.\n" );
+	fprintf( fp, "# Load it by setting BLIS_TUNING_FILE to its path.\n" );
+	fprintf( fp, "arch %s\n", bli_arch_string( id ) );
+
+	for ( const char* dt_ch = dt_str; *dt_ch != '\0'; ++dt_ch )
+	{
+		num_t dt;
+		char  dt_uc = ( char )toupper( *dt_ch );
+
+		if ( dt_uc != 'S' && dt_uc != 'D' && dt_uc != 'C' && dt_uc != 'Z' )
+			continue;
+
+		bli_param_map_char_to_blis_dt( ( char )tolower( *dt_ch ), &dt );
+
+		params.dt = dt;
+
+		// Tune a private copy of the active native context.
+		cntx_t cntx_l = *cntx;
+
+		const dim_t mr  = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, &cntx_l );
+		const dim_t nr  = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, &cntx_l );
+		const dim_t kr  = bli_cntx_get_blksz_def_dt( dt, BLIS_KR, &cntx_l );
+		const dim_t mnr = lcm( mr, nr );
+
+		const dim_t mc0 = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, &cntx_l );
+		const dim_t kc0 = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, &cntx_l );
+		const dim_t nc0 = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, &cntx_l );
+
+		printf( "%cgemm: tuning blocksizes (mr=%d nr=%d)\n",
+		        *dt_ch, ( int )mr, ( int )nr );
+
+		dim_t kc = tune_blksz( BLIS_KC, kc0 / 4, kc0 * 2, kr,  &cntx_l, &params );
+		dim_t mc = tune_blksz( BLIS_MC, mnr,     mc0 * 4, mnr, &cntx_l, &params );
+		dim_t nc = tune_blksz( BLIS_NC, nc0 / 4, nc0 * 2, mnr, &cntx_l, &params );
+
+		printf( "%cgemm: mc=%d kc=%d nc=%d\n", *dt_ch,
+		        ( int )mc, ( int )kc, ( int )nc );
+
+		// For the thresholds, the sup context forces sup handling by raising
+		// all thresholds beyond any size we will test.
+		cntx_t cntx_sup = cntx_l;
+
+		for ( num_t dt_i = BLIS_DT_LO; dt_i <= BLIS_DT_HI; ++dt_i )
+		{
+			bli_cntx_set_blksz_def_dt( dt_i, BLIS_MT, THRESH_INF, &cntx_sup );
+			bli_cntx_set_blksz_def_dt( dt_i, BLIS_NT, THRESH_INF, &cntx_sup );
+			bli_cntx_set_blksz_def_dt( dt_i, BLIS_KT, THRESH_INF, &cntx_sup );
+		}
+
+		printf( "%cgemm: tuning sup thresholds\n", *dt_ch );
+
+		dim_t mt = tune_thresh( BLIS_MT, &cntx_l, &cntx_sup, &params );
+		dim_t nt = tune_thresh( BLIS_NT, &cntx_l, &cntx_sup, &params );
+		dim_t kt = tune_thresh( BLIS_KT, &cntx_l, &cntx_sup, &params );
+
+		printf( "%cgemm: mt=%d nt=%d kt=%d\n", *dt_ch,
+		        ( int )mt, ( int )nt, ( int )kt );
+
+		fprintf( fp, "MC_%c %d\n", dt_uc, ( int )mc );
+		fprintf( fp, "KC_%c %d\n", dt_uc, ( int )kc );
+		fprintf( fp, "NC_%c %d\n", dt_uc, ( int )nc );
+		fprintf( fp, "MT_%c %d\n", dt_uc, ( int )mt );
+		fprintf( fp, "NT_%c %d\n", dt_uc, ( int )nt );
+		fprintf( fp, "KT_%c %d\n", dt_uc, ( int )kt );
+	}
+
+	fclose( fp );
+
+	printf( "wrote %s\n", out_path );
+
+	return 0;
+}
+
@@ -0,0 +1,255 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2022, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <math.h>
+#include <stdlib.h>
+#include "blis.h"
+
+//
+// Test for the runtime blocksize overrides. The test checks that:
+//
+// - bli_cntx_set_blksz_dt() accepts valid blocksizes and rejects invalid
+//   ones with the appropriate error code, leaving the context untouched,
+//   and that it re-derives the tiny gemm dispatch table;
+// - variables of the form BLIS_<blksz>_<dt> in the environment override
+//   the blocksizes of the active sub-configuration when BLIS is initialized,
+//   except for rejected values (which are reported on stderr and ignored).
+//
+// Since the environment is only read when BLIS is initialized, the test
+// sets it and then finalizes and re-initializes BLIS.
+//
+// Usage: test_tune_env.x
+//
+// The program exits with a non-zero status if any case fails.
+//
+
+static int n_cases = 0, n_fail = 0;
+
+static void check( bool ok, const char* what )
+{
+	if ( !ok )
+	{
+		printf( "FAIL: %s\n", what );
+		n_fail += 1;
+	}
+
+	n_cases += 1;
+}
+
+static dim_t get_def( num_t dt, bszid_t bs_id )
+{
+	return bli_cntx_get_blksz_def_dt( dt, bs_id, bli_gks_query_cntx() );
+}
+
+#ifndef BLIS_RELAX_MCNR_NCMR_CONSTRAINTS
+// Return a multiple of mult that is not a multiple of other, or zero if
+// there is none.
+static dim_t nonmultiple( dim_t mult, dim_t other )
+{
+	for ( dim_t i = 1; i <= other; ++i )
+		if ( ( i * mult ) % other != 0 ) return i * mult;
+
+	return 0;
+}
+#endif
+
+static void test_set_blksz( num_t dt )
+{
+	cntx_t cntx = *bli_gks_query_cntx();
+
+	const dim_t mr = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, &cntx );
+	const dim_t nr = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, &cntx );
+	const dim_t mc = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, &cntx );
+	const dim_t nc = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, &cntx );
+
+	// Rejected values.
+	check( bli_cntx_set_blksz_dt( dt, BLIS_MC, 0, &cntx ) ==
+	       BLIS_NONPOSITIVE_BLKSZ, "MC = 0" );
+	check( bli_cntx_set_blksz_dt( dt, BLIS_KC, -8, &cntx ) ==
+	       BLIS_NONPOSITIVE_BLKSZ, "KC < 0" );
+
+	if ( mr > 1 )
+		check( bli_cntx_set_blksz_dt( dt, BLIS_MC, mc + 1, &cntx ) ==
+		       BLIS_MC_DEF_NONMULTIPLE_OF_MR, "MC % MR != 0" );
+	if ( nr > 1 )
+		check( bli_cntx_set_blksz_dt( dt, BLIS_NC, nc + 1, &cntx ) ==
+		       BLIS_NC_DEF_NONMULTIPLE_OF_NR, "NC % NR != 0" );
+
+#ifndef BLIS_RELAX_MCNR_NCMR_CONSTRAINTS
+	const dim_t mc_bad = nonmultiple( mr, nr );
+	const dim_t nc_bad = nonmultiple( nr, mr );
+
+	if ( mc_bad != 0 )
+		check( bli_cntx_set_blksz_dt( dt, BLIS_MC, mc_bad, &cntx ) ==
+		       BLIS_MC_DEF_NONMULTIPLE_OF_NR, "MC % NR != 0" );
+	if ( nc_bad != 0 )
+		check( bli_cntx_set_blksz_dt( dt, BLIS_NC, nc_bad, &cntx ) ==
+		       BLIS_NC_DEF_NONMULTIPLE_OF_MR, "NC % MR != 0" );
+#endif
+
+	check( bli_cntx_get_blksz_def_dt( dt, BLIS_MC, &cntx ) == mc &&
+	       bli_cntx_get_blksz_def_dt( dt, BLIS_NC, &cntx ) == nc,
+	       "context unchanged by rejected values" );
+
+	// Accepted values.
+	check( bli_cntx_set_blksz_dt( dt, BLIS_MC, mc + mr * nr, &cntx ) ==
+	       BLIS_SUCCESS &&
+	       bli_cntx_get_blksz_def_dt( dt, BLIS_MC, &cntx ) == mc + mr * nr,
+	       "MC += MR * NR" );
+
+	// Lowering the m threshold must also lower the largest dimension handled
+	// by the tiny gemm path (which is less than each threshold).
+	check( bli_cntx_set_blksz_dt( dt, BLIS_MT, 5, &cntx ) == BLIS_SUCCESS &&
+	       bli_cntx_get_blksz_def_dt( dt, BLIS_MT, &cntx ) == 5 &&
+	       bli_cntx_get_l3_tiny_dt( dt, &cntx )->max_dim <= 4,
+	       "MT = 5 updates the tiny gemm table" );
+}
+
+int main( int argc, char** argv )
+{
+	static const char* vars[] =
+	{
+		"BLIS_TUNING_FILE", "BLIS_MC_D", "BLIS_KC_D", "BLIS_MT_D",
+		"BLIS_NT_D", "BLIS_MC_S", "BLIS_KT_S",
+	};
+
+	for ( size_t i = 0; i < sizeof( vars ) / sizeof( vars[0] ); ++i )
+		unsetenv( vars[ i ] );
+
+	// Record the blocksizes registered by the context initialization
+	// function.
+	bli_init();
+
+	const dim_t mr_d = get_def( BLIS_DOUBLE, BLIS_MR );
+	const dim_t nr_d = get_def( BLIS_DOUBLE, BLIS_NR );
+	const dim_t mc_d = get_def( BLIS_DOUBLE, BLIS_MC );
+	const dim_t kc_d = get_def( BLIS_DOUBLE, BLIS_KC );
+	const dim_t nt_d = get_def( BLIS_DOUBLE, BLIS_NT );
+	const dim_t mr_s = get_def( BLIS_FLOAT,  BLIS_MR );
+	const dim_t mc_s = get_def( BLIS_FLOAT,  BLIS_MC );
+	const dim_t kt_s = get_def( BLIS_FLOAT,  BLIS_KT );
+
+	test_set_blksz( BLIS_FLOAT );
+	test_set_blksz( BLIS_DOUBLE );
+
+	bli_finalize();
+
+	// Override some blocksizes through the environment, with valid values
+	// for MC_D, KC_D, and MT_D and rejected values for the others.
+	char str[ 32 ];
+
+	snprintf( str, sizeof( str ), "%ld", ( long )( mc_d + mr_d * nr_d ) );
+	setenv( "BLIS_MC_D", str, 1 );
+	snprintf( str, sizeof( str ), "%ld", ( long )( kc_d / 2 ) );
+	setenv( "BLIS_KC_D", str, 1 );
+	setenv( "BLIS_MT_D", "5", 1 );
+	setenv( "BLIS_NT_D", "-3", 1 );
+	setenv( "BLIS_KT_S", "12x", 1 );
+	snprintf( str, sizeof( str ), "%ld", ( long )( mc_s + 1 ) );
+	if ( mr_s > 1 ) setenv( "BLIS_MC_S", str, 1 );
+
+	printf( "Expect rejected values for BLIS_NT_D, BLIS_KT_S, and "
+	        "BLIS_MC_S to be reported below.\n" );
+	fflush( stdout );
+
+	bli_init();
+
+	check( get_def( BLIS_DOUBLE, BLIS_MC ) == mc_d + mr_d * nr_d,
+	       "BLIS_MC_D applied" );
+	check( get_def( BLIS_DOUBLE, BLIS_KC ) == kc_d / 2,
+	       "BLIS_KC_D applied" );
+	check( get_def( BLIS_DOUBLE, BLIS_MT ) == 5 &&
+	       bli_cntx_get_l3_tiny_dt( BLIS_DOUBLE,
+	                                bli_gks_query_cntx() )->max_dim <= 4,
+	       "BLIS_MT_D applied" );
+	check( get_def( BLIS_DOUBLE, BLIS_NT ) == nt_d,
+	       "BLIS_NT_D (nonpositive) rejected" );
+	check( get_def( BLIS_FLOAT, BLIS_KT ) == kt_s,
+	       "BLIS_KT_S (non-numeric) rejected" );
+	check( get_def( BLIS_FLOAT, BLIS_MC ) == mc_s,
+	       "BLIS_MC_S (non-multiple of MR) rejected" );
+
+	// Make sure that gemm still computes the right answer with the
+	// overridden blocksizes (and a k dimension spanning several KC blocks).
+	{
+		const dim_t m = 2 * mc_d + 3, n = 50, k = 3 * kc_d + 1;
+		obj_t a, b, c, c_ref, norm;
+
+		bli_obj_create( BLIS_DOUBLE, m, k, 0, 0, &a );
+		bli_obj_create( BLIS_DOUBLE, k, n, 0, 0, &b );
+		bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &c );
+		bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &c_ref );
+		bli_obj_scalar_init_detached( BLIS_DOUBLE, &norm );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_setm( &BLIS_ZERO, &c );
+		bli_setm( &BLIS_ZERO, &c_ref );
+
+		// Compute the reference one rank-1 update at a time.
+		for ( dim_t l = 0; l < k; ++l )
+		{
+			obj_t a_l, b_l;
+			bli_acquire_mpart( 0, l, m, 1, &a, &a_l );
+			bli_acquire_mpart( l, 0, 1, n, &b, &b_l );
+			bli_ger( &BLIS_ONE, &a_l, &b_l, &c_ref );
+		}
+
+		rntm_t rntm = BLIS_RNTM_INITIALIZER;
+		bli_rntm_disable_l3_sup( &rntm );
+
+		bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c, NULL, &rntm );
+
+		bli_subm( &c_ref, &c );
+		bli_normfm( &c, &norm );
+
+		double res, im;
+		bli_getsc( &norm, &res, &im );
+
+		check( res <= 10.0 * k * sqrt( ( double )( m * n ) ) * DBL_EPSILON,
+		       "gemm with overridden blocksizes" );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_ref );
+	}
+
+	bli_finalize();
+
+	printf( "%d cases, %d failed\n", n_cases, n_fail );
+
+	return ( n_fail == 0 ? 0 : 1 );
+}
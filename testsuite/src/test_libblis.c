@@ -564,6 +564,10 @@ void libblis_test_read_params_file( char* input_filename, test_params_t* params
 	libblis_test_read_next_line( buffer, input_stream );
 	sscanf( buffer, "%u ", &(params->p_inc) );
 
+	// Read whether to enable 3m.
+	libblis_test_read_next_line( buffer, input_stream );
+	sscanf( buffer, "%u ", &(params->ind_enable[ BLIS_3M ]) );
+
 	// Read whether to enable 1m.
 	libblis_test_read_next_line( buffer, input_stream );
 	sscanf( buffer, "%u ", &(params->ind_enable[ BLIS_1M ]) );
@@ -583,13 +587,15 @@ void libblis_test_read_params_file( char* input_filename, test_params_t* params
 	// threads.
 	if ( params->n_app_threads > 1 )
 	{
-		if ( params->ind_enable[ BLIS_1M ] )
+		if ( params->ind_enable[ BLIS_3M ] ||
+		     params->ind_enable[ BLIS_1M ] )
 		{
 			// Due to an inherent race condition in the way induced methods
 			// are enabled and disabled at runtime, all induced methods must be
 			// disabled when simulating multiple application threads.
 			libblis_test_printf_infoc( "simulating multiple application threads; disabling induced methods.\n" );
 
+			params->ind_enable[ BLIS_3M   ] = 0;
 			params->ind_enable[ BLIS_1M   ] = 0;
 		}
 	}
@@ -1298,6 +1304,7 @@ void libblis_test_output_params_struct( FILE* os, test_params_t* params )
 	libblis_test_fprintf_c( os, "problem size: max to test    %u\n", params->p_max );
 	libblis_test_fprintf_c( os, "problem size increment       %u\n", params->p_inc );
 	libblis_test_fprintf_c( os, "complex implementations        \n" );
+	libblis_test_fprintf_c( os, "  3m?                        %u\n", params->ind_enable[ BLIS_3M ] );
 	libblis_test_fprintf_c( os, "  1m?                        %u\n", params->ind_enable[ BLIS_1M ] );
 	libblis_test_fprintf_c( os, "  native?                    %u\n", params->ind_enable[ BLIS_NAT ] );
 	libblis_test_fprintf_c( os, "simulated app-level threads  %u\n", params->n_app_threads );
@@ -2261,6 +2268,15 @@ void libblis_test_op_driver
 						else if ( has_samep && has_cd_only ) { ; }
 						else { continue; }
 					}
+					// If the current induced method is 3m, make sure that
+					// we only proceed for gemm where all operands share the
+					// same (complex) datatype, since 3m does not support
+					// any form of mixed-datatype computation.
+					else if ( indi == BLIS_3M )
+					{
+						if ( op->opid == BLIS_GEMM && has_samep && has_cd_only ) { ; }
+						else { continue; }
+					}
 					else { ; }
 				}
 				else { continue; }